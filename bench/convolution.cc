@@ -941,6 +941,26 @@ static void DWConv5x5(benchmark::internal::Benchmark* b) {
   b->Args({1,  7,  7,  5,  5, 1, 1,   16,    1,    1});
 }
 
+static void DWConvSmallChannels(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"N", "H", "W", "KH", "KW", "S", "D", "G", "GCin", "GCout"});
+
+  /* Channel counts which are not multiples of the widest depthwise micro-kernel tile */
+  /********************** 3 x 3 ***********************/
+  /*       N   H   W  KH  KW  S  D    G   GCin  GCout */
+  b->Args({1, 56, 56,  3,  3, 1, 1,    8,    1,    1});
+  b->Args({1, 56, 56,  3,  3, 1, 1,   16,    1,    1});
+  b->Args({1, 56, 56,  3,  3, 1, 1,   24,    1,    1});
+  b->Args({1, 56, 56,  3,  3, 1, 1,   40,    1,    1});
+  b->Args({1, 56, 56,  3,  3, 1, 1,   72,    1,    1});
+  /********************** 5 x 5 ***********************/
+  /*       N   H   W  KH  KW  S  D    G   GCin  GCout */
+  b->Args({1, 56, 56,  5,  5, 1, 1,    8,    1,    1});
+  b->Args({1, 56, 56,  5,  5, 1, 1,   16,    1,    1});
+  b->Args({1, 56, 56,  5,  5, 1, 1,   24,    1,    1});
+  b->Args({1, 56, 56,  5,  5, 1, 1,   40,    1,    1});
+  b->Args({1, 56, 56,  5,  5, 1, 1,   72,    1,    1});
+}
+
 BENCHMARK_CAPTURE(convolution_q8, mobilenet_v1, "MobileNet v1")->Apply(MobileNetV1);
 BENCHMARK_CAPTURE(convolution_q8, mobilenet_v2, "MobileNet v2")->Apply(MobileNetV2);
 BENCHMARK_CAPTURE(convolution_q8, shufflenet_v1_g1, "ShuffleNet v1 (1 group)")->Apply(ShuffleNetV1G1);
@@ -960,6 +980,7 @@ BENCHMARK_CAPTURE(convolution_q8, vgg, "VGG")->Apply(VGG);
 BENCHMARK_CAPTURE(convolution_q8, dwconv3x3, "3x3 DW Convolutions")->Apply(DWConv3x3);
 BENCHMARK_CAPTURE(convolution_q8, dwconv3x3d2, "3x3 DW Convolutions (dilation 2)")->Apply(DWConv3x3d2);
 BENCHMARK_CAPTURE(convolution_q8, dwconv5x5, "5x5 DW Convolutions")->Apply(DWConv5x5);
+BENCHMARK_CAPTURE(convolution_q8, dwconv_small_channels, "DW Convolutions with few channels")->Apply(DWConvSmallChannels);
 
 #ifndef QNNPACK_BENCHMARK_NO_MAIN
 BENCHMARK_MAIN();
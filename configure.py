@@ -64,22 +64,39 @@ def main(args):
         qnnpack_objects = [
             # Common parts
             build.cc("init.c"),
+            build.cc("autotune.c"),
+            build.cc("ukernel-registry.c"),
+            build.cc("allocator.c"),
+            build.cc("memory-info.c"),
+            build.cc("operator-cost.c"),
             build.cc("operator-delete.c"),
             build.cc("operator-run.c"),
+            build.cc("operator-run-async.c"),
+            build.cc("operator-run-graph.c"),
             # Operators
             build.cc("add.c"),
             build.cc("average-pooling.c"),
             build.cc("channel-shuffle.c"),
             build.cc("clamp.c"),
+            build.cc("concat.c"),
+            build.cc("constant-pad.c"),
+            build.cc("convert.c"),
             build.cc("convolution.c"),
             build.cc("indirection.c"),
             build.cc("deconvolution.c"),
+            build.cc("dequantize.c"),
             build.cc("fully-connected.c"),
             build.cc("global-average-pooling.c"),
             build.cc("leaky-relu.c"),
+            build.cc("lut.c"),
             build.cc("max-pooling.c"),
+            build.cc("multiply.c"),
+            build.cc("quantize.c"),
+            build.cc("reduce.c"),
+            build.cc("resize.c"),
             build.cc("sigmoid.c"),
             build.cc("softargmax.c"),
+            build.cc("top-k.c"),
             # Scalar micro-kernels
             build.cc("u8lut32norm/scalar.c"),
             build.cc("x8lut/scalar.c"),
@@ -98,6 +115,8 @@ def main(args):
                     build.cc("q8avgpool/mp8x9p8q-neon.c"),
                     build.cc("q8avgpool/up8x9-neon.c"),
                     build.cc("q8avgpool/up8xm-neon.c"),
+                    build.cc("q8conv/4x8-f32-neon.c"),
+                    build.cc("q8conv/4x8-i32-neon.c"),
                     build.cc("q8conv/4x8-neon.c"),
                     build.cc("q8conv/8x8-neon.c"),
                     build.cc("q8dwconv/mp8x25-neon.c"),
@@ -106,17 +125,31 @@ def main(args):
                     build.cc("q8gavgpool/up8x7-neon.c"),
                     build.cc("q8gavgpool/up8xm-neon.c"),
                     build.cc("q8gemm/4x-sumrows-neon.c"),
+                    build.cc("q8gemm/4x8-f32-neon.c"),
+                    build.cc("q8gemm/4x8-i32-neon.c"),
                     build.cc("q8gemm/4x8-neon.c"),
                     build.cc("q8gemm/4x8c2-xzp-neon.c"),
                     build.cc("q8gemm/6x4-neon.c"),
                     build.cc("q8gemm/8x8-neon.c"),
                     build.cc("q8vadd/neon.c"),
+                    build.cc("q8vaddc/neon.c"),
+                    build.cc("q8vdequantize/neon.c"),
+                    build.cc("q8vmul/neon.c"),
+                    build.cc("q8vquantize/neon.c"),
                     build.cc("sgemm/5x8-neon.c"),
                     build.cc("sgemm/6x8-neon.c"),
+                    build.cc("srminmax/neon.c"),
                     build.cc("u8clamp/neon.c"),
+                    build.cc("u8ibilinear/neon.c"),
                     build.cc("u8maxpool/16x9p8q-neon.c"),
                     build.cc("u8maxpool/sub16-neon.c"),
                     build.cc("u8rmax/neon.c"),
+                    build.cc("u8rsum/neon.c"),
+                    build.cc("u8softargmax/neon.c"),
+                    build.cc("x32transpose/neon.c"),
+                    build.cc("x8lut/neon.c"),
+                    build.cc("x8pad/neon.c"),
+                    build.cc("x8transpose/neon.c"),
                     build.cc("x8zip/x2-neon.c"),
                     build.cc("x8zip/x3-neon.c"),
                     build.cc("x8zip/x4-neon.c"),
@@ -141,6 +174,8 @@ def main(args):
                         build.cc("q8avgpool/mp8x9p8q-sse2.c"),
                         build.cc("q8avgpool/up8x9-sse2.c"),
                         build.cc("q8avgpool/up8xm-sse2.c"),
+                        build.cc("q8conv/4x4c2-f32-sse2.c"),
+                        build.cc("q8conv/4x4c2-i32-sse2.c"),
                         build.cc("q8conv/4x4c2-sse2.c"),
                         build.cc("q8dwconv/mp8x25-sse2.c"),
                         build.cc("q8dwconv/up8x9-sse2.c"),
@@ -148,17 +183,52 @@ def main(args):
                         build.cc("q8gavgpool/up8x7-sse2.c"),
                         build.cc("q8gavgpool/up8xm-sse2.c"),
                         build.cc("q8gemm/2x4c8-sse2.c"),
+                        build.cc("q8gemm/4x4c2-f32-sse2.c"),
+                        build.cc("q8gemm/4x4c2-i32-sse2.c"),
                         build.cc("q8gemm/4x4c2-sse2.c"),
                         build.cc("q8vadd/sse2.c"),
+                        build.cc("q8vaddc/sse2.c"),
+                        build.cc("q8vdequantize/sse2.c"),
+                        build.cc("q8vmul/sse2.c"),
+                        build.cc("q8vquantize/sse2.c"),
+                        build.cc("srminmax/sse2.c"),
                         build.cc("u8clamp/sse2.c"),
+                        build.cc("u8ibilinear/sse2.c"),
                         build.cc("u8maxpool/16x9p8q-sse2.c"),
                         build.cc("u8maxpool/sub16-sse2.c"),
                         build.cc("u8rmax/sse2.c"),
+                        build.cc("u8rsum/sse2.c"),
+                        build.cc("u8softargmax/sse2.c"),
+                        build.cc("x32transpose/sse2.c"),
+                        build.cc("x8pad/sse2.c"),
+                        build.cc("x8transpose/sse2.c"),
                         build.cc("x8zip/x2-sse2.c"),
                         build.cc("x8zip/x3-sse2.c"),
                         build.cc("x8zip/x4-sse2.c"),
                         build.cc("x8zip/xm-sse2.c"),
                     ]
+                with build.options(isa=x86.ssse3):
+                    qnnpack_objects += [
+                        build.cc("x8lut/ssse3.c"),
+                    ]
+                with build.options(isa=x86.avx2):
+                    qnnpack_objects += [
+                        build.cc("q8avgpool/mp16x9p8q-avx2.c"),
+                        build.cc("q8avgpool/up16x9-avx2.c"),
+                        build.cc("q8avgpool/up16xm-avx2.c"),
+                        build.cc("q8dwconv/mp32x25-avx2.c"),
+                        build.cc("q8dwconv/up32x9-avx2.c"),
+                        build.cc("q8gavgpool/mp16x7p7q-avx2.c"),
+                        build.cc("q8gavgpool/up16x7-avx2.c"),
+                        build.cc("q8gavgpool/up16xm-avx2.c"),
+                        build.cc("q8vmul/avx2.c"),
+                        build.cc("u8ibilinear/avx2.c"),
+                        build.cc("u8lut32norm/avx2.c"),
+                        build.cc("u8maxpool/32x9p8q-avx2.c"),
+                        build.cc("u8maxpool/sub32-avx2.c"),
+                        build.cc("u8softargmax/avx2.c"),
+                        build.cc("x8lut/avx2.c"),
+                    ]
             build.static_library("qnnpack", qnnpack_objects)
 
     with build.options(source_dir="test",
@@ -174,27 +244,52 @@ def main(args):
         build.unittest("q8gavgpool-test", build.cxx("q8gavgpool.cc"))
         build.unittest("q8gemm-test", build.cxx("q8gemm.cc"))
         build.unittest("q8vadd-test", build.cxx("q8vadd.cc"))
+        build.unittest("q8vaddc-test", build.cxx("q8vaddc.cc"))
+        build.unittest("q8vdequantize-test", build.cxx("q8vdequantize.cc"))
+        build.unittest("q8vmul-test", build.cxx("q8vmul.cc"))
+        build.unittest("q8vquantize-test", build.cxx("q8vquantize.cc"))
         build.unittest("sconv-test", build.cxx("sconv.cc"))
         build.unittest("sgemm-test", build.cxx("sgemm.cc"))
         build.unittest("u8clamp-test", build.cxx("u8clamp.cc"))
+        build.unittest("u8ibilinear-test", build.cxx("u8ibilinear.cc"))
         build.unittest("u8lut32norm-test", build.cxx("u8lut32norm.cc"))
         build.unittest("u8maxpool-test", build.cxx("u8maxpool.cc"))
         build.unittest("u8rmax-test", build.cxx("u8rmax.cc"))
+        build.unittest("u8rsum-test", build.cxx("u8rsum.cc"))
+        build.unittest("u8softargmax-test", build.cxx("u8softargmax.cc"))
+        build.unittest("x32transpose-test", build.cxx("x32transpose.cc"))
         build.unittest("x8lut-test", build.cxx("x8lut.cc"))
+        build.unittest("x8pad-test", build.cxx("x8pad.cc"))
+        build.unittest("x8transpose-test", build.cxx("x8transpose.cc"))
         build.unittest("x8zip-test", build.cxx("x8zip.cc"))
 
         build.unittest("add-test", build.cxx("add.cc"))
         build.unittest("average-pooling-test", build.cxx("average-pooling.cc"))
         build.unittest("channel-shuffle-test", build.cxx("channel-shuffle.cc"))
         build.unittest("clamp-test", build.cxx("clamp.cc"))
+        build.unittest("concat-test", build.cxx("concat.cc"))
+        build.unittest("constant-pad-test", build.cxx("constant-pad.cc"))
+        build.unittest("convert-test", build.cxx("convert.cc"))
         build.unittest("convolution-test", build.cxx("convolution.cc"))
         build.unittest("deconvolution-test", build.cxx("deconvolution.cc"))
+        build.unittest("dequantize-test", build.cxx("dequantize.cc"))
         build.unittest("fully-connected-test", build.cxx("fully-connected.cc"))
         build.unittest("global-average-pooling-test", build.cxx("global-average-pooling.cc"))
         build.unittest("leaky-relu-test", build.cxx("leaky-relu.cc"))
+        build.unittest("lut-test", build.cxx("lut.cc"))
         build.unittest("max-pooling-test", build.cxx("max-pooling.cc"))
+        build.unittest("multiply-test", build.cxx("multiply.cc"))
+        build.unittest("quantize-test", build.cxx("quantize.cc"))
+        build.unittest("reduce-test", build.cxx("reduce.cc"))
+        build.unittest("resize-test", build.cxx("resize.cc"))
+        build.unittest("run-operators-test", build.cxx("run-operators.cc"))
+        build.unittest("autotune-test", build.cxx("autotune.cc"))
+        build.unittest("ukernel-registry-test", build.cxx("ukernel-registry.cc"))
+        build.unittest("allocator-test", build.cxx("allocator.cc"))
+        build.unittest("memory-info-test", build.cxx("memory-info.cc"))
         build.unittest("sigmoid-test", build.cxx("sigmoid.cc"))
         build.unittest("softargmax-test", build.cxx("softargmax.cc"))
+        build.unittest("top-k-test", build.cxx("top-k.cc"))
         build.unittest("requantization-test", [build.cxx("requantization.cc")] + requantization_objects)
 
     benchmark_isa = None
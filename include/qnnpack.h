@@ -31,10 +31,145 @@ enum qnnp_status {
   qnnp_status_out_of_memory = 5,
 };
 
+/**
+ * @brief Resize operators map the centers of the corner pixels of the input and output images onto each other.
+ */
+#define QNNP_FLAG_ALIGN_CORNERS 0x00000001
+
+/**
+ * @brief Resize operators map output pixel coordinates to input coordinates as x * input_size / output_size, without
+ *        the half-pixel offset, to match TensorFlow 1.x before half_pixel_centers was introduced.
+ */
+#define QNNP_FLAG_TENSORFLOW_LEGACY_MODE 0x00000002
+
+/**
+ * @brief Maximum number of dimensions in tensors of N-dimensional operators.
+ */
+#define QNNP_MAX_TENSOR_DIMS 6
+
 enum qnnp_status qnnp_initialize(void);
 
 enum qnnp_status qnnp_deinitialize(void);
 
+/**
+ * @brief Allocator for the memory which operators hold.
+ *
+ * Operators allocate their structure, packed weights, zero buffers, and lookup tables with allocate when they are
+ * created, and grow indirection buffers and row sums with reallocate when they are set up. An arena whose deallocate
+ * does nothing keeps the state of a whole model contiguous and releases it in one shot.
+ */
+struct qnnp_allocator {
+  /* Opaque pointer passed to every function */
+  void* context;
+  /* Allocates size bytes aligned to alignment, a power of 2 no smaller than sizeof(void*); returns NULL on failure */
+  void* (*allocate)(void* context, size_t alignment, size_t size);
+  /* Resizes a block as realloc does; the pointer is NULL or was returned by reallocate */
+  void* (*reallocate)(void* context, void* pointer, size_t size);
+  /* Releases a non-NULL block returned by allocate or reallocate */
+  void (*deallocate)(void* context, void* pointer);
+};
+
+/**
+ * @brief Sets the allocator for operators created after this call. NULL restores the default, malloc-based allocator.
+ *
+ * The allocator is copied, and every operator keeps the allocator it was created with for setup and deletion, so
+ * operators of models with different arenas can coexist. Must not be called concurrently with operator creation.
+ */
+enum qnnp_status qnnp_set_allocator(const struct qnnp_allocator* allocator);
+
+/**
+ * @brief Placement of packed weights across NUMA nodes.
+ */
+enum qnnp_numa_placement {
+  /**
+   * Pages are placed on first touch by the kernel's default policy, i.e. on the node of the thread which packs the
+   * weights when the operator is created. This is not necessarily the node of the threads which run the operator:
+   * QNNPACK neither pins threadpool threads nor knows their affinity. To place weights on the node of pinned consumer
+   * threads, create the operator on one of them, or use bind placement with the node_mask of those threads.
+   */
+  qnnp_numa_placement_local = 0,
+  /** Pages are placed only on the nodes in node_mask. */
+  qnnp_numa_placement_bind = 1,
+  /** Pages are interleaved across the nodes in node_mask. */
+  qnnp_numa_placement_interleave = 2,
+};
+
+/**
+ * @brief Memory policy for packed weights of convolution, deconvolution, and fully-connected operators.
+ *
+ * With huge_pages, packed weights of at least 2 MB are aligned to 2 MB and advised to the kernel as transparent huge
+ * pages, which removes most TLB misses of the GEMM inner loop. NUMA placement other than local aligns packed weights
+ * to pages and binds them to or interleaves them across node_mask before they are written. Both are supported on
+ * Linux only, and are hints: if the kernel rejects them, weights keep the default placement. Aligned weights are
+ * requested from the allocator of the operator with page or 2 MB alignment. Operators keep the policy they were
+ * created with, also for weights repacked by qnnp_set_operator_ukernel.
+ */
+struct qnnp_weights_memory_policy {
+  bool huge_pages;
+  enum qnnp_numa_placement numa_placement;
+  /* Bit i selects NUMA node i; must be non-zero for bind and interleave placement */
+  uint64_t node_mask;
+};
+
+/**
+ * @brief Sets the memory policy for packed weights of operators created after this call. NULL restores the default
+ *        policy: no huge pages and local placement. Must not be called concurrently with operator creation.
+ */
+enum qnnp_status qnnp_set_weights_memory_policy(const struct qnnp_weights_memory_policy* policy);
+
+/**
+ * @brief Selects GEMM/CONV, depthwise convolution, and pooling micro-kernels, and the XZP GEMM threshold, by timing
+ *        them on this CPU.
+ *
+ * Must be called after qnnp_initialize and before creating operators. If cache_path is not NULL, results tuned for
+ * the same CPU are loaded from this file, and otherwise the newly tuned results are saved to it.
+ *
+ * On x86 there is a single GEMM/CONV micro-kernel (4x4c2 SSE2) and no XZP GEMM, so only the depthwise convolution
+ * and pooling micro-kernels (AVX2 or SSE2) are chosen by timing.
+ */
+enum qnnp_status qnnp_autotune(const char* cache_path);
+
+/**
+ * @brief Class of interchangeable micro-kernels.
+ */
+enum qnnp_ukernel_class {
+  /** GEMM and CONV micro-kernels of convolution, deconvolution, and fully-connected operators. */
+  qnnp_ukernel_class_q8conv = 0,
+  /** Depthwise convolution micro-kernels. */
+  qnnp_ukernel_class_q8dwconv = 1,
+};
+
+struct qnnp_ukernel_info {
+  const char* name;
+  const char* isa;
+  /** Rows of the output tile; 1 for depthwise convolution micro-kernels. */
+  uint32_t mr;
+  /** Columns (output channels) of the output tile. */
+  uint32_t nr;
+  /** Number of input channels packed together; 1 for depthwise convolution micro-kernels. */
+  uint32_t kr;
+  /** Whether newly created operators use this micro-kernel. */
+  bool selected;
+};
+
+enum qnnp_status qnnp_get_ukernels_count(
+    enum qnnp_ukernel_class ukernel_class,
+    size_t* count);
+
+enum qnnp_status qnnp_get_ukernel_info(
+    enum qnnp_ukernel_class ukernel_class,
+    size_t index,
+    struct qnnp_ukernel_info* info);
+
+/**
+ * @brief Selects the micro-kernel for operators created after this call.
+ *
+ * Existing operators keep using the micro-kernels which match the layout of their packed weights.
+ */
+enum qnnp_status qnnp_select_ukernel(
+    enum qnnp_ukernel_class ukernel_class,
+    const char* name);
+
 typedef struct qnnp_operator* qnnp_operator_t;
 
 enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
@@ -75,6 +210,98 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
     size_t output_stride,
     pthreadpool_t threadpool);
 
+/**
+ * @brief Folds a constant pad of an NHWC tensor into the implicit padding of the convolution which consumes it.
+ *
+ * Convolution pads its input with input_zero_point, so a pad is foldable if it pads only the height and width
+ * dimensions with padding_value equal to input_zero_point. On success, the spatial paddings are added to the input
+ * paddings, which should then be passed to qnnp_create_convolution2d_nhwc_q8 instead of running the pad operator.
+ * Returns qnnp_status_unsupported_parameter and leaves the input paddings unchanged if the pad is not foldable.
+ */
+enum qnnp_status qnnp_fold_constant_pad_into_convolution2d_nhwc_q8(
+    const size_t pre_paddings[4],
+    const size_t post_paddings[4],
+    uint8_t padding_value,
+    uint8_t input_zero_point,
+    uint32_t* input_padding_top,
+    uint32_t* input_padding_right,
+    uint32_t* input_padding_bottom,
+    uint32_t* input_padding_left);
+
+/**
+ * @brief Creates a convolution operator which outputs raw 32-bit accumulators instead of requantized values.
+ *
+ * The output is the sum of bias and products of input and kernel values less their zero points.
+ */
+enum qnnp_status qnnp_create_convolution2d_nhwc_q8_s32(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    uint8_t kernel_zero_point,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    qnnp_operator_t* convolution);
+
+enum qnnp_status qnnp_setup_convolution2d_nhwc_q8_s32(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_stride,
+    int32_t* output,
+    size_t output_stride,
+    pthreadpool_t threadpool);
+
+/**
+ * @brief Creates a convolution operator which outputs 32-bit accumulators multiplied by input_scale * kernel_scale.
+ */
+enum qnnp_status qnnp_create_convolution2d_nhwc_q8_f32(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    qnnp_operator_t* convolution);
+
+enum qnnp_status qnnp_setup_convolution2d_nhwc_q8_f32(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_stride,
+    float* output,
+    size_t output_stride,
+    pthreadpool_t threadpool);
+
 enum qnnp_status qnnp_create_deconvolution2d_nhwc_q8(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -139,6 +366,74 @@ enum qnnp_status qnnp_setup_fully_connected_nc_q8(
     uint8_t* output,
     size_t output_stride);
 
+/**
+ * @brief Creates a fully connected operator which outputs raw 32-bit accumulators instead of requantized values.
+ */
+enum qnnp_status qnnp_create_fully_connected_nc_q8_s32(
+    size_t input_channels,
+    size_t output_channels,
+    uint8_t input_zero_point,
+    uint8_t kernel_zero_point,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    qnnp_operator_t* fully_connected);
+
+enum qnnp_status qnnp_setup_fully_connected_nc_q8_s32(
+    qnnp_operator_t fully_connected,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    int32_t* output,
+    size_t output_stride);
+
+/**
+ * @brief Creates a fully connected operator which outputs 32-bit accumulators multiplied by input_scale * kernel_scale.
+ */
+enum qnnp_status qnnp_create_fully_connected_nc_q8_f32(
+    size_t input_channels,
+    size_t output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    qnnp_operator_t* fully_connected);
+
+enum qnnp_status qnnp_setup_fully_connected_nc_q8_f32(
+    qnnp_operator_t fully_connected,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    float* output,
+    size_t output_stride);
+
+/**
+ * @brief Creates a fully connected operator with fp32 input and output and a quantized kernel.
+ *
+ * Every row of the input is quantized at run time with a scale and zero point derived from its range, and the
+ * product is computed with 32-bit quantized arithmetic before it is converted back to fp32 and the bias is added.
+ */
+enum qnnp_status qnnp_create_dynamic_fully_connected_nc_f32(
+    size_t input_channels,
+    size_t output_channels,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const float* bias,
+    uint32_t flags,
+    qnnp_operator_t* fully_connected);
+
+enum qnnp_status qnnp_setup_dynamic_fully_connected_nc_f32(
+    qnnp_operator_t fully_connected,
+    size_t batch_size,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    size_t output_stride);
+
 enum qnnp_status qnnp_create_global_average_pooling_nwc_q8(
     size_t channels,
     uint8_t input_zero_point,
@@ -159,6 +454,57 @@ enum qnnp_status qnnp_setup_global_average_pooling_nwc_q8(
     uint8_t* output,
     size_t output_stride);
 
+/**
+ * @brief Creates an operator which computes the mean of a quantized tensor over a set of axes.
+ *
+ * The reduced axes, ignoring kept axes of size 1, must be adjacent, e.g. H, W, HW, C, or HWC of an NHWC tensor.
+ * The output is dense and has the same layout whether or not the reduced dimensions are kept as size-1 dimensions.
+ */
+enum qnnp_status qnnp_create_reduce_mean_nd_q8(
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* reduce_mean);
+
+enum qnnp_status qnnp_setup_reduce_mean_nd_q8(
+    qnnp_operator_t reduce_mean,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool);
+
+/**
+ * @brief Creates an operator which computes the sum of a quantized tensor over a set of axes.
+ *
+ * Axes are specified as for qnnp_create_reduce_mean_nd_q8.
+ */
+enum qnnp_status qnnp_create_reduce_sum_nd_q8(
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* reduce_sum);
+
+enum qnnp_status qnnp_setup_reduce_sum_nd_q8(
+    qnnp_operator_t reduce_sum,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool);
+
 enum qnnp_status qnnp_create_average_pooling2d_nhwc_q8(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
@@ -231,6 +577,142 @@ enum qnnp_status qnnp_setup_channel_shuffle_nc_x8(
     uint8_t* output,
     size_t output_stride);
 
+/**
+ * @brief Creates an operator which converts images from NCHW (planar) to NHWC layout.
+ *
+ * Output pixels are output_stride elements apart, so the result can be written straight into the input buffer of a
+ * convolution or into a slice of a concatenated tensor.
+ */
+enum qnnp_status qnnp_create_convert_nchw_nhwc_x8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* convert);
+
+enum qnnp_status qnnp_setup_convert_nchw_nhwc_x8(
+    qnnp_operator_t convert,
+    size_t batch_size,
+    size_t height,
+    size_t width,
+    const uint8_t* input,
+    uint8_t* output,
+    size_t output_stride);
+
+/**
+ * @brief Creates an operator which converts images from NHWC to NCHW (planar) layout.
+ */
+enum qnnp_status qnnp_create_convert_nhwc_nchw_x8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* convert);
+
+enum qnnp_status qnnp_setup_convert_nhwc_nchw_x8(
+    qnnp_operator_t convert,
+    size_t batch_size,
+    size_t height,
+    size_t width,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output);
+
+/**
+ * @brief Creates an operator which converts images of 32-bit elements, e.g. fp32, from NCHW to NHWC layout.
+ */
+enum qnnp_status qnnp_create_convert_nchw_nhwc_x32(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* convert);
+
+enum qnnp_status qnnp_setup_convert_nchw_nhwc_x32(
+    qnnp_operator_t convert,
+    size_t batch_size,
+    size_t height,
+    size_t width,
+    const void* input,
+    void* output,
+    size_t output_stride);
+
+/**
+ * @brief Creates an operator which converts images of 32-bit elements, e.g. fp32, from NHWC to NCHW layout.
+ */
+enum qnnp_status qnnp_create_convert_nhwc_nchw_x32(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* convert);
+
+enum qnnp_status qnnp_setup_convert_nhwc_nchw_x32(
+    qnnp_operator_t convert,
+    size_t batch_size,
+    size_t height,
+    size_t width,
+    const void* input,
+    size_t input_stride,
+    void* output);
+
+/**
+ * @brief Creates an operator which pads a tensor of bytes with a constant value.
+ *
+ * Dimensions without padding are merged, so padding only the outer dimensions of a tensor costs one copy per row.
+ */
+enum qnnp_status qnnp_create_constant_pad_nd_x8(
+    uint8_t padding_value,
+    uint32_t flags,
+    qnnp_operator_t* constant_pad);
+
+enum qnnp_status qnnp_setup_constant_pad_nd_x8(
+    qnnp_operator_t constant_pad,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* pre_paddings,
+    const size_t* post_paddings,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool);
+
+/**
+ * @brief Creates an operator which resizes images with bilinear interpolation.
+ *
+ * Input and output share the quantization parameters, so interpolation is done directly on quantized values.
+ * Supported flags are QNNP_FLAG_ALIGN_CORNERS and QNNP_FLAG_TENSORFLOW_LEGACY_MODE.
+ */
+enum qnnp_status qnnp_create_resize_bilinear2d_nhwc_q8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* resize);
+
+enum qnnp_status qnnp_setup_resize_bilinear2d_nhwc_q8(
+    qnnp_operator_t resize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride,
+    pthreadpool_t threadpool);
+
+/**
+ * @brief Creates an operator which resizes images by nearest-neighbour sampling, with the same flags as bilinear resize.
+ */
+enum qnnp_status qnnp_create_resize_nearest2d_nhwc_x8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* resize);
+
+enum qnnp_status qnnp_setup_resize_nearest2d_nhwc_x8(
+    qnnp_operator_t resize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride,
+    pthreadpool_t threadpool);
+
 enum qnnp_status qnnp_create_add_nc_q8(
     size_t channels,
     uint8_t a_zero_point,
@@ -254,6 +736,54 @@ enum qnnp_status qnnp_setup_add_nc_q8(
     uint8_t* sum,
     size_t sum_stride);
 
+/**
+ * @brief Sets up an add operator with NumPy-style broadcasting of the B input.
+ *
+ * B has b_batch_size rows (1 or batch_size) of b_channels elements (1 or the number of channels), so a scalar, a
+ * per-channel vector, or one value per row can be added without materializing a full-size B tensor.
+ */
+enum qnnp_status qnnp_setup_add_nc_q8_broadcast(
+    qnnp_operator_t add,
+    size_t batch_size,
+    const uint8_t* a,
+    size_t a_stride,
+    const uint8_t* b,
+    size_t b_batch_size,
+    size_t b_channels,
+    size_t b_stride,
+    uint8_t* sum,
+    size_t sum_stride);
+
+enum qnnp_status qnnp_create_multiply_nc_q8(
+    size_t channels,
+    uint8_t a_zero_point,
+    float a_scale,
+    uint8_t b_zero_point,
+    float b_scale,
+    uint8_t product_zero_point,
+    float product_scale,
+    uint8_t product_min,
+    uint8_t product_max,
+    uint32_t flags,
+    qnnp_operator_t* multiply);
+
+/**
+ * @brief Sets up a multiply operator.
+ *
+ * B has b_batch_size rows, which must divide batch_size: each B row multiplies batch_size / b_batch_size consecutive
+ * rows of A. With one B row per image, this broadcasts a squeeze-and-excitation gate over all pixels of the image.
+ */
+enum qnnp_status qnnp_setup_multiply_nc_q8(
+    qnnp_operator_t multiply,
+    size_t batch_size,
+    const uint8_t* a,
+    size_t a_stride,
+    const uint8_t* b,
+    size_t b_batch_size,
+    size_t b_stride,
+    uint8_t* product,
+    size_t product_stride);
+
 enum qnnp_status qnnp_create_clamp_nc_u8(
     size_t channels,
     uint8_t output_min,
@@ -269,6 +799,82 @@ enum qnnp_status qnnp_setup_clamp_nc_u8(
     uint8_t* output,
     size_t output_stride);
 
+/**
+ * @brief Creates an operator which maps every 8-bit element through a user-supplied 256-entry table.
+ */
+enum qnnp_status qnnp_create_lut_nc_x8(
+    size_t channels,
+    const uint8_t* lookup_table,
+    uint32_t flags,
+    qnnp_operator_t* lut);
+
+typedef float (*qnnp_lut_function)(float x, void* context);
+
+/**
+ * @brief Creates an operator which applies a pointwise function to quantized elements.
+ *
+ * The function is evaluated once for each of the 256 dequantized input values at creation time, and the results are
+ * quantized into a lookup table. Set up the operator with qnnp_setup_lut_nc_x8.
+ */
+enum qnnp_status qnnp_create_lut_nc_q8(
+    size_t channels,
+    qnnp_lut_function function,
+    void* function_context,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* lut);
+
+enum qnnp_status qnnp_setup_lut_nc_x8(
+    qnnp_operator_t lut,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride);
+
+/**
+ * @brief Creates an operator which converts fp32 values to quint8.
+ *
+ * Values are divided by output_scale, rounded to nearest (ties to even), offset by output_zero_point, and clamped to
+ * [output_min, output_max].
+ */
+enum qnnp_status qnnp_create_quantize_nc_f32_q8(
+    size_t channels,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* quantize);
+
+enum qnnp_status qnnp_setup_quantize_nc_f32_q8(
+    qnnp_operator_t quantize,
+    size_t batch_size,
+    const float* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride);
+
+enum qnnp_status qnnp_create_dequantize_nc_q8_f32(
+    size_t channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint32_t flags,
+    qnnp_operator_t* dequantize);
+
+enum qnnp_status qnnp_setup_dequantize_nc_q8_f32(
+    qnnp_operator_t dequantize,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    float* output,
+    size_t output_stride);
+
 enum qnnp_status qnnp_create_sigmoid_nc_q8(
     size_t channels,
     uint8_t input_zero_point,
@@ -324,10 +930,212 @@ enum qnnp_status qnnp_setup_softargmax_nc_q8(
     uint8_t* output,
     size_t output_stride);
 
+/**
+ * @brief Creates an operator which finds the index of the largest element in every row of a byte matrix.
+ *
+ * Quantization preserves order, so the argmax of quantized logits needs no dequantization. Ties resolve to the lowest
+ * index.
+ */
+enum qnnp_status qnnp_create_argmax_nc_u8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* argmax);
+
+enum qnnp_status qnnp_setup_argmax_nc_u8(
+    qnnp_operator_t argmax,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint32_t* output);
+
+/**
+ * @brief Creates an operator which finds the K largest elements in every row of a byte matrix.
+ *
+ * Outputs are sorted by decreasing value, and equal values by increasing index. output_values may be NULL if only
+ * the indices are needed.
+ */
+enum qnnp_status qnnp_create_top_k_nc_u8(
+    size_t channels,
+    size_t k,
+    uint32_t flags,
+    qnnp_operator_t* top_k);
+
+enum qnnp_status qnnp_setup_top_k_nc_u8(
+    qnnp_operator_t top_k,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output_values,
+    size_t output_values_stride,
+    uint32_t* output_indices,
+    size_t output_indices_stride);
+
+/**
+ * @brief Plans a channel concatenation without copies.
+ *
+ * Splits every pixel of the output into consecutive slices of input_channels[i] channels and stores a pointer to the
+ * first slice of each input in input_outputs[i]. Set up the producer of each input with input_outputs[i] as its output
+ * and output_stride as its output pixel stride, and the producers write the concatenated tensor directly. Producers
+ * must use the same output quantization parameters, and may run concurrently, e.g. in qnnp_run_operator_graph.
+ */
+enum qnnp_status qnnp_plan_concat_nc_x8(
+    size_t inputs_count,
+    const size_t* input_channels,
+    uint8_t* output,
+    size_t output_stride,
+    uint8_t** input_outputs);
+
 enum qnnp_status qnnp_run_operator(
     qnnp_operator_t op,
     pthreadpool_t threadpool);
 
+/**
+ * @brief Limits the number of threadpool threads which run the operator.
+ *
+ * By default (max_threads = 0) the limit is derived from the estimated cost of the operator, and small operators run
+ * on the calling thread. Pass SIZE_MAX to always use all threads of the threadpool.
+ */
+enum qnnp_status qnnp_set_operator_max_threads(
+    qnnp_operator_t op,
+    size_t max_threads);
+
+/**
+ * @brief Switches a convolution, deconvolution, or fully-connected operator to a different micro-kernel.
+ *
+ * Packed weights are converted to the layout of the new micro-kernel. The state of the last setup is discarded: the
+ * operator must be set up again after this call, and runs fail with qnnp_status_invalid_parameter until it is.
+ */
+enum qnnp_status qnnp_set_operator_ukernel(
+    qnnp_operator_t op,
+    const char* name);
+
+/**
+ * @brief Fuses a 256-entry lookup table into the output of a convolution, deconvolution, or fully-connected operator.
+ *
+ * Each output tile is mapped through the table right after requantization, which replaces a separate LUT operator
+ * over the whole output. The table is copied; pass NULL to remove it. The operator must be set up after this call.
+ */
+enum qnnp_status qnnp_set_operator_output_lut(
+    qnnp_operator_t op,
+    const uint8_t* lookup_table);
+
+/**
+ * @brief Bytes of memory held by an operator, by category.
+ */
+struct qnnp_operator_memory_info {
+  /* The qnnp_operator structure */
+  size_t operator_size;
+  /* Packed weights and biases, or interpolation weights of bilinear resize */
+  size_t packed_weights_size;
+  /* Input pointers built by setup */
+  size_t indirection_buffer_size;
+  /* Per-row input data built by setup: row sums of XZP convolutions, quantized rows of dynamic fully connected */
+  size_t a_sum_size;
+  /* Padding row of input zero points */
+  size_t zero_buffer_size;
+  /* Lookup tables of LUT, Sigmoid, Leaky ReLU, and Soft ArgMax operators, and fused output lookup tables */
+  size_t lookup_table_size;
+  /* Sum of all the above */
+  size_t total_size;
+};
+
+/**
+ * @brief Reports the memory which an operator currently holds.
+ */
+enum qnnp_status qnnp_get_operator_memory_info(
+    qnnp_operator_t op,
+    struct qnnp_operator_memory_info* memory_info);
+
+/**
+ * @brief Predicts the memory which an operator would hold after setup with the given shape, without setting it up.
+ *
+ * Indirection buffers, row sums, and interpolation weights are sized as setup would allocate them; create-time buffers
+ * are reported as they are. Input height and width are ignored by operators without spatial dimensions, and output
+ * height and width are used only by resize operators, whose setup takes the output size. Setup of pooling and resize
+ * operators with the same shape as their last setup may keep an indirection buffer built for a larger batch, so for
+ * such shapes the larger of the current and the predicted indirection buffer is reported, which is an upper bound.
+ */
+enum qnnp_status qnnp_predict_operator_memory_info(
+    qnnp_operator_t op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    struct qnnp_operator_memory_info* memory_info);
+
+/**
+ * @brief Runs set-up operators one after another, in array order, and stops at the first failure.
+ *
+ * Each operator may consume the output of any earlier operator. The status of the first failed operator is returned.
+ */
+enum qnnp_status qnnp_run_operators(
+    size_t operators_count,
+    const qnnp_operator_t* operators,
+    pthreadpool_t threadpool);
+
+struct qnnp_operator_dependency {
+  size_t producer;
+  size_t consumer;
+};
+
+/**
+ * @brief Runs set-up operators which form a directed acyclic graph.
+ *
+ * Dependencies refer to operators by their index in the operators array. Operators which do not depend on each other
+ * run concurrently, with threadpool workers divided among them in proportion to their estimated MAC counts.
+ */
+enum qnnp_status qnnp_run_operator_graph(
+    size_t operators_count,
+    const qnnp_operator_t* operators,
+    size_t dependencies_count,
+    const struct qnnp_operator_dependency* dependencies,
+    pthreadpool_t threadpool);
+
+typedef struct qnnp_task* qnnp_task_t;
+
+/**
+ * @brief Completion callback for asynchronously run operators.
+ *
+ * The callback is invoked on the asynchronous worker thread of the task's threadpool, after the last operator completed
+ * or failed.
+ */
+typedef void (*qnnp_task_callback_t)(
+    void* context,
+    enum qnnp_status status);
+
+/**
+ * @brief Queues set-up operators to run in the background, like qnnp_run_operators.
+ *
+ * Each threadpool, including the NULL threadpool, has its own worker thread, so tasks on different threadpools run
+ * concurrently, while tasks on the same threadpool run one after another in submission order. A worker is started by
+ * the first task queued to its threadpool and exits once it has been idle for a second; if it can not be started, the
+ * call fails and the next call tries again. Until the task completes, the caller must not run anything else on the
+ * threadpool, nor modify or delete the operators. The callback must not wait for other tasks on the same threadpool.
+ * If task is non-NULL, it receives a handle which must be passed to qnnp_wait_task exactly once; otherwise the task is
+ * released on completion.
+ */
+enum qnnp_status qnnp_run_operator_async(
+    qnnp_operator_t op,
+    pthreadpool_t threadpool,
+    qnnp_task_callback_t callback,
+    void* callback_context,
+    qnnp_task_t* task);
+
+enum qnnp_status qnnp_run_operators_async(
+    size_t operators_count,
+    const qnnp_operator_t* operators,
+    pthreadpool_t threadpool,
+    qnnp_task_callback_t callback,
+    void* callback_context,
+    qnnp_task_t* task);
+
+/**
+ * @brief Blocks until an asynchronous task completes, releases it, and returns the status of its run.
+ */
+enum qnnp_status qnnp_wait_task(
+    qnnp_task_t task);
+
 enum qnnp_status qnnp_delete_operator(
     qnnp_operator_t op);
 
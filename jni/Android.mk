@@ -14,6 +14,8 @@ LOCAL_SRC_FILES += \
 	src/q8avgpool/up8x9-neon.c \
 	src/q8avgpool/up8xm-neon.c \
 	src/q8conv/4x8-aarch32-neon.S \
+	src/q8conv/4x8-f32-neon.c \
+	src/q8conv/4x8-i32-neon.c \
 	src/q8dwconv/mp8x25-neon.c \
 	src/q8dwconv/up8x9-aarch32-neon.S \
 	src/q8gavgpool/mp8x7p7q-neon.c \
@@ -21,14 +23,28 @@ LOCAL_SRC_FILES += \
 	src/q8gavgpool/up8xm-neon.c \
 	src/q8gemm/4x-sumrows-neon.c \
 	src/q8gemm/4x8-aarch32-neon.S \
+	src/q8gemm/4x8-f32-neon.c \
+	src/q8gemm/4x8-i32-neon.c \
 	src/q8gemm/4x8c2-xzp-aarch32-neon.S \
 	src/q8vadd/neon.c \
+	src/q8vaddc/neon.c \
+	src/q8vdequantize/neon.c \
+	src/q8vmul/neon.c \
+	src/q8vquantize/neon.c \
+	src/srminmax/neon.c \
 	src/u8clamp/neon.c \
+	src/u8ibilinear/neon.c \
 	src/u8lut32norm/scalar.c \
 	src/u8maxpool/16x9p8q-neon.c \
 	src/u8maxpool/sub16-neon.c \
 	src/u8rmax/neon.c \
+	src/u8rsum/neon.c \
+	src/u8softargmax/neon.c \
+	src/x32transpose/neon.c \
+	src/x8lut/neon.c \
 	src/x8lut/scalar.c \
+	src/x8pad/neon.c \
+	src/x8transpose/neon.c \
 	src/x8zip/x2-neon.c \
 	src/x8zip/x3-neon.c \
 	src/x8zip/x4-neon.c \
@@ -46,20 +62,36 @@ LOCAL_SRC_FILES += \
 	src/q8avgpool/mp8x9p8q-neon.c \
 	src/q8avgpool/up8x9-neon.c \
 	src/q8avgpool/up8xm-neon.c \
+	src/q8conv/4x8-f32-neon.c \
+	src/q8conv/4x8-i32-neon.c \
 	src/q8conv/8x8-aarch64-neon.S \
 	src/q8dwconv/mp8x25-neon.c \
 	src/q8dwconv/up8x9-neon.c \
 	src/q8gavgpool/mp8x7p7q-neon.c \
 	src/q8gavgpool/up8x7-neon.c \
 	src/q8gavgpool/up8xm-neon.c \
+	src/q8gemm/4x8-f32-neon.c \
+	src/q8gemm/4x8-i32-neon.c \
 	src/q8gemm/8x8-aarch64-neon.S \
 	src/q8vadd/neon.c \
+	src/q8vaddc/neon.c \
+	src/q8vdequantize/neon.c \
+	src/q8vmul/neon.c \
+	src/q8vquantize/neon.c \
+	src/srminmax/neon.c \
 	src/u8clamp/neon.c \
+	src/u8ibilinear/neon.c \
 	src/u8lut32norm/scalar.c \
 	src/u8maxpool/16x9p8q-neon.c \
 	src/u8maxpool/sub16-neon.c \
 	src/u8rmax/neon.c \
+	src/u8rsum/neon.c \
+	src/u8softargmax/neon.c \
+	src/x32transpose/neon.c \
+	src/x8lut/neon.c \
 	src/x8lut/scalar.c \
+	src/x8pad/neon.c \
+	src/x8transpose/neon.c \
 	src/x8zip/x2-neon.c \
 	src/x8zip/x3-neon.c \
 	src/x8zip/x4-neon.c \
@@ -77,20 +109,35 @@ LOCAL_SRC_FILES += \
 	src/q8avgpool/mp8x9p8q-sse2.c \
 	src/q8avgpool/up8x9-sse2.c \
 	src/q8avgpool/up8xm-sse2.c \
+	src/q8conv/4x4c2-f32-sse2.c \
+	src/q8conv/4x4c2-i32-sse2.c \
 	src/q8conv/4x4c2-sse2.c \
 	src/q8dwconv/mp8x25-sse2.c \
 	src/q8dwconv/up8x9-sse2.c \
 	src/q8gavgpool/mp8x7p7q-sse2.c \
 	src/q8gavgpool/up8x7-sse2.c \
 	src/q8gavgpool/up8xm-sse2.c \
+	src/q8gemm/4x4c2-f32-sse2.c \
+	src/q8gemm/4x4c2-i32-sse2.c \
 	src/q8gemm/4x4c2-sse2.c \
 	src/q8vadd/sse2.c \
+	src/q8vaddc/sse2.c \
+	src/q8vdequantize/sse2.c \
+	src/q8vmul/sse2.c \
+	src/q8vquantize/sse2.c \
+	src/srminmax/sse2.c \
 	src/u8clamp/sse2.c \
+	src/u8ibilinear/sse2.c \
 	src/u8lut32norm/scalar.c \
 	src/u8maxpool/16x9p8q-sse2.c \
 	src/u8maxpool/sub16-sse2.c \
 	src/u8rmax/sse2.c \
+	src/u8rsum/sse2.c \
+	src/u8softargmax/sse2.c \
+	src/x32transpose/sse2.c \
 	src/x8lut/scalar.c \
+	src/x8pad/sse2.c \
+	src/x8transpose/sse2.c \
 	src/x8zip/x2-sse2.c \
 	src/x8zip/x3-sse2.c \
 	src/x8zip/x4-sse2.c \
@@ -99,13 +146,48 @@ LOCAL_C_INCLUDES := $(LOCAL_PATH)/src
 LOCAL_CFLAGS := -std=c99 -Wall -O2
 LOCAL_STATIC_LIBRARIES := cpuinfo FP16 fxdiv
 include $(BUILD_STATIC_LIBRARY)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := qnnpack_ssse3_ukernels
+LOCAL_SRC_FILES += \
+	src/x8lut/ssse3.c
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/src
+LOCAL_CFLAGS := -std=c99 -Wall -O2 -mssse3
+LOCAL_STATIC_LIBRARIES := cpuinfo FP16 fxdiv
+include $(BUILD_STATIC_LIBRARY)
+
+include $(CLEAR_VARS)
+LOCAL_MODULE := qnnpack_avx2_ukernels
+LOCAL_SRC_FILES += \
+	src/q8avgpool/mp16x9p8q-avx2.c \
+	src/q8avgpool/up16x9-avx2.c \
+	src/q8avgpool/up16xm-avx2.c \
+	src/q8dwconv/mp32x25-avx2.c \
+	src/q8dwconv/up32x9-avx2.c \
+	src/q8gavgpool/mp16x7p7q-avx2.c \
+	src/q8gavgpool/up16x7-avx2.c \
+	src/q8gavgpool/up16xm-avx2.c \
+	src/q8vmul/avx2.c \
+	src/u8ibilinear/avx2.c \
+	src/u8lut32norm/avx2.c \
+	src/u8maxpool/32x9p8q-avx2.c \
+	src/u8maxpool/sub32-avx2.c \
+	src/u8softargmax/avx2.c \
+	src/x8lut/avx2.c
+LOCAL_C_INCLUDES := $(LOCAL_PATH)/src
+LOCAL_CFLAGS := -std=c99 -Wall -O2 -mavx2
+LOCAL_STATIC_LIBRARIES := cpuinfo FP16 fxdiv
+include $(BUILD_STATIC_LIBRARY)
 endif # x86 or x86_64
 
 include $(CLEAR_VARS)
 LOCAL_MODULE = qnnpack_exec
 LOCAL_SRC_FILES := \
 	src/indirection.c \
-	src/operator-run.c
+	src/operator-cost.c \
+	src/operator-run.c \
+	src/operator-run-async.c \
+	src/operator-run-graph.c
 LOCAL_C_INCLUDES := $(LOCAL_PATH)/include $(LOCAL_PATH)/src
 LOCAL_CFLAGS := -std=c99 -Wall -O2
 ifeq ($(NDK_DEBUG),1)
@@ -120,18 +202,32 @@ include $(CLEAR_VARS)
 LOCAL_MODULE := qnnpack
 LOCAL_SRC_FILES := \
 	src/init.c \
+	src/autotune.c \
+	src/ukernel-registry.c \
+	src/allocator.c \
+	src/memory-info.c \
 	src/add.c \
 	src/average-pooling.c \
 	src/channel-shuffle.c \
 	src/clamp.c \
+	src/concat.c \
+	src/constant-pad.c \
+	src/convert.c \
 	src/convolution.c \
 	src/deconvolution.c \
+	src/dequantize.c \
 	src/fully-connected.c \
 	src/global-average-pooling.c \
 	src/leaky-relu.c \
+	src/lut.c \
 	src/max-pooling.c \
+	src/multiply.c \
+	src/quantize.c \
+	src/reduce.c \
+	src/resize.c \
 	src/sigmoid.c \
 	src/softargmax.c \
+	src/top-k.c \
 	src/operator-delete.c
 LOCAL_EXPORT_C_INCLUDES := $(LOCAL_PATH)/include
 LOCAL_C_INCLUDES := $(LOCAL_EXPORT_C_INCLUDES) $(LOCAL_PATH)/src
@@ -150,7 +246,7 @@ LOCAL_CFLAGS += -DQNNP_LOG_LEVEL=0
 endif
 LOCAL_STATIC_LIBRARIES := clog cpuinfo pthreadpool_interface qnnpack_exec
 ifeq ($(TARGET_ARCH_ABI),$(filter $(TARGET_ARCH_ABI),x86 x86_64))
-LOCAL_STATIC_LIBRARIES += qnnpack_sse2_ukernels
+LOCAL_STATIC_LIBRARIES += qnnpack_sse2_ukernels qnnpack_ssse3_ukernels qnnpack_avx2_ukernels
 endif # x86 or x86_64
 ifeq ($(TARGET_ARCH_ABI),$(filter $(TARGET_ARCH_ABI),armeabi armeabi-v7a))
 LOCAL_STATIC_LIBRARIES += qnnpack_aarch32_neon_ukernels
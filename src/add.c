@@ -13,6 +13,7 @@
 #include <stdlib.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/requantization.h>
 #include <qnnpack/log.h>
@@ -93,7 +94,7 @@ enum qnnp_status qnnp_create_add_nc_q8(
 
   status = qnnp_status_out_of_memory;
 
-  add_op = calloc(1, sizeof(struct qnnp_operator));
+  add_op = qnnp_allocate_operator();
   if (add_op == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
@@ -142,6 +143,57 @@ enum qnnp_status qnnp_setup_add_nc_q8(
   add_op->input_pixel_stride = a_stride;
   add_op->input2 = b;
   add_op->input2_pixel_stride = b_stride;
+  add_op->input2_batch_size = batch_size;
+  add_op->input2_channels = add_op->channels;
+  add_op->output = sum;
+  add_op->output_pixel_stride = sum_stride;
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_setup_add_nc_q8_broadcast(
+    qnnp_operator_t add_op,
+    size_t batch_size,
+    const uint8_t* a,
+    size_t a_stride,
+    const uint8_t* b,
+    size_t b_batch_size,
+    size_t b_channels,
+    size_t b_stride,
+    uint8_t* sum,
+    size_t sum_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_add_nc_q8_broadcast failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup add operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (b_batch_size != 1 && b_batch_size != batch_size) {
+    qnnp_log_error(
+      "failed to setup add operator with B batch size %zu: B batch size must be 1 or match batch size %zu",
+      b_batch_size, batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (b_channels != 1 && b_channels != add_op->channels) {
+    qnnp_log_error(
+      "failed to setup add operator with %zu B channels: number of B channels must be 1 or match %zu channels",
+      b_channels, add_op->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  add_op->batch_size = batch_size;
+  add_op->input = a;
+  add_op->input_pixel_stride = a_stride;
+  add_op->input2 = b;
+  add_op->input2_pixel_stride = b_batch_size == 1 ? 0 : b_stride;
+  add_op->input2_batch_size = b_batch_size;
+  add_op->input2_channels = b_channels;
   add_op->output = sum;
   add_op->output_pixel_stride = sum_stride;
 
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __ANDROID__
+  #include <malloc.h>
+#endif
+
+#ifdef __linux__
+  #include <sys/mman.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+#include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/operator.h>
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  #define QNNP_HUGE_PAGES_SUPPORTED 1
+#else
+  #define QNNP_HUGE_PAGES_SUPPORTED 0
+#endif
+
+#if defined(__linux__) && defined(SYS_mbind)
+  #define QNNP_NUMA_SUPPORTED 1
+  /* Values from <numaif.h>, which is distributed with libnuma rather than the C library */
+  #define QNNP_MPOL_DEFAULT 0
+  #define QNNP_MPOL_BIND 2
+  #define QNNP_MPOL_INTERLEAVE 3
+  #define QNNP_MPOL_MF_MOVE 2
+#else
+  #define QNNP_NUMA_SUPPORTED 0
+#endif
+
+/* Size of transparent huge pages on x86-64 and ARM64 with 4 KB base pages */
+#define QNNP_HUGE_PAGE_SIZE (2 * 1024 * 1024)
+
+
+static void* default_allocate(void* context, size_t alignment, size_t size) {
+#if defined(__ANDROID__)
+  return memalign(alignment, size);
+#else
+  void* memory = NULL;
+  if (posix_memalign(&memory, alignment, size) != 0) {
+    return NULL;
+  }
+  return memory;
+#endif
+}
+
+static void* default_reallocate(void* context, void* memory, size_t size) {
+  return realloc(memory, size);
+}
+
+static void default_deallocate(void* context, void* memory) {
+  free(memory);
+}
+
+static const struct qnnp_allocator default_allocator = {
+  .context = NULL,
+  .allocate = default_allocate,
+  .reallocate = default_reallocate,
+  .deallocate = default_deallocate,
+};
+
+static struct qnnp_allocator current_allocator = {
+  .context = NULL,
+  .allocate = default_allocate,
+  .reallocate = default_reallocate,
+  .deallocate = default_deallocate,
+};
+
+static struct qnnp_weights_memory_policy current_weights_memory_policy = {
+  .huge_pages = false,
+  .numa_placement = qnnp_numa_placement_local,
+  .node_mask = 0,
+};
+
+enum qnnp_status qnnp_set_allocator(const struct qnnp_allocator* allocator)
+{
+  if (allocator == NULL) {
+    current_allocator = default_allocator;
+    return qnnp_status_success;
+  }
+
+  if (allocator->allocate == NULL || allocator->reallocate == NULL || allocator->deallocate == NULL) {
+    qnnp_log_error("failed to set allocator: allocate, reallocate, and deallocate functions must be non-NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  current_allocator = *allocator;
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_set_weights_memory_policy(const struct qnnp_weights_memory_policy* policy)
+{
+  if (policy == NULL) {
+    current_weights_memory_policy = (struct qnnp_weights_memory_policy) {
+      .huge_pages = false,
+      .numa_placement = qnnp_numa_placement_local,
+      .node_mask = 0,
+    };
+    return qnnp_status_success;
+  }
+
+  switch (policy->numa_placement) {
+    case qnnp_numa_placement_local:
+      break;
+    case qnnp_numa_placement_bind:
+    case qnnp_numa_placement_interleave:
+      if (policy->node_mask == 0) {
+        qnnp_log_error("failed to set weights memory policy: NUMA node mask must be non-zero");
+        return qnnp_status_invalid_parameter;
+      }
+      if (!QNNP_NUMA_SUPPORTED) {
+        qnnp_log_error("failed to set weights memory policy: NUMA placement is not supported on this platform");
+        return qnnp_status_unsupported_parameter;
+      }
+      break;
+    default:
+      qnnp_log_error("failed to set weights memory policy: unknown NUMA placement %d", (int) policy->numa_placement);
+      return qnnp_status_invalid_parameter;
+  }
+
+  if (policy->huge_pages && !QNNP_HUGE_PAGES_SUPPORTED) {
+    qnnp_log_error("failed to set weights memory policy: huge pages are not supported on this platform");
+    return qnnp_status_unsupported_parameter;
+  }
+
+  current_weights_memory_policy = *policy;
+  return qnnp_status_success;
+}
+
+qnnp_operator_t qnnp_allocate_operator(void)
+{
+  const struct qnnp_allocator allocator = current_allocator;
+  qnnp_operator_t op = allocator.allocate(allocator.context, QNNP_CACHE_LINE_SIZE, sizeof(struct qnnp_operator));
+  if (op != NULL) {
+    memset(op, 0, sizeof(struct qnnp_operator));
+    op->allocator = allocator;
+    op->weights_memory_policy = current_weights_memory_policy;
+  }
+  return op;
+}
+
+#if QNNP_NUMA_SUPPORTED
+static long set_numa_policy(void* memory, size_t size, int mode, uint64_t node_mask, unsigned int flags) {
+  unsigned long nodes[64 / (CHAR_BIT * sizeof(unsigned long))];
+  for (size_t i = 0; i < sizeof(nodes) / sizeof(nodes[0]); i++) {
+    nodes[i] = (unsigned long) (node_mask >> (i * CHAR_BIT * sizeof(unsigned long)));
+  }
+  /* The kernel reads one bit less than maxnode */
+  return syscall(SYS_mbind, memory, size, mode, mode == QNNP_MPOL_DEFAULT ? NULL : nodes, 64 + 1, flags);
+}
+#endif
+
+void* qnnp_operator_allocate_weights(qnnp_operator_t op, size_t size)
+{
+  const struct qnnp_weights_memory_policy policy = op->weights_memory_policy;
+  const bool huge_pages = policy.huge_pages && size >= QNNP_HUGE_PAGE_SIZE;
+  const bool numa = policy.numa_placement != qnnp_numa_placement_local;
+  if (!huge_pages && !numa) {
+    return qnnp_operator_allocate(op, size);
+  }
+
+#if QNNP_HUGE_PAGES_SUPPORTED || QNNP_NUMA_SUPPORTED
+  /* Page-aligned blocks of whole pages, so that policies apply only to the weights */
+  const size_t page_size = (size_t) sysconf(_SC_PAGESIZE);
+  const size_t alignment = huge_pages ? QNNP_HUGE_PAGE_SIZE : page_size;
+  const size_t placed_size = round_up(size, page_size);
+  void* weights = op->allocator.allocate(op->allocator.context, alignment, placed_size);
+  if (weights == NULL) {
+    return NULL;
+  }
+
+  #if QNNP_HUGE_PAGES_SUPPORTED
+    if (huge_pages && madvise(weights, placed_size, MADV_HUGEPAGE) != 0) {
+      qnnp_log_warning("failed to advise huge pages for %zu bytes of packed weights", placed_size);
+    }
+  #endif
+  #if QNNP_NUMA_SUPPORTED
+    const int mode = policy.numa_placement == qnnp_numa_placement_bind ? QNNP_MPOL_BIND : QNNP_MPOL_INTERLEAVE;
+    const bool numa_placed = numa && set_numa_policy(weights, placed_size, mode, policy.node_mask, QNNP_MPOL_MF_MOVE) == 0;
+    if (numa && !numa_placed) {
+      qnnp_log_warning("failed to set NUMA policy for %zu bytes of packed weights", placed_size);
+    }
+  #endif
+
+  /* Fault in all pages under the policy */
+  memset(weights, 0, placed_size);
+
+  #if QNNP_NUMA_SUPPORTED
+    /* Placed pages stay on their nodes, but the memory follows the default policy once it is released and reused */
+    if (numa_placed) {
+      set_numa_policy(weights, placed_size, QNNP_MPOL_DEFAULT, 0, 0);
+    }
+  #endif
+  return weights;
+#else
+  return qnnp_operator_allocate(op, size);
+#endif
+}
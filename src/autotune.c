@@ -0,0 +1,615 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+/* clock_gettime is a POSIX extension to C99 */
+#ifndef _POSIX_C_SOURCE
+  #define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <cpuinfo.h>
+#include <qnnpack.h>
+#include <qnnpack/common.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/ukernel-registry.h>
+
+#define AUTOTUNE_CACHE_HEADER "QNNPACK autotune cache v2"
+
+/* Representative shapes: a pointwise (1x1) convolution and a 3x3 convolution */
+#define AUTOTUNE_M 64
+#define AUTOTUNE_N 64
+#define AUTOTUNE_GEMM_K 256
+#define AUTOTUNE_CONV_KC 64
+#define AUTOTUNE_CONV_KS 9
+#define AUTOTUNE_TRIALS 5
+#define AUTOTUNE_PASSES 4
+
+/*
+ * Representative depthwise convolution and pooling shapes: a row of AUTOTUNE_M output pixels with
+ * AUTOTUNE_POOLING_CHANNELS channels, with 3x3 and 5x5 windows, and global average pooling over a 7x7 image
+ */
+#define AUTOTUNE_POOLING_CHANNELS 64
+#define AUTOTUNE_SMALL_TAPS 9
+#define AUTOTUNE_LARGE_TAPS 25
+#define AUTOTUNE_GLOBAL_POOLING_ROWS 49
+
+/* Extra bytes around input rows: micro-kernels may over-read up to 8 bytes before and after a row */
+#define AUTOTUNE_PADDING 16
+
+/* Values of K at which GEMM and XZP GEMM micro-kernels are compared */
+static const size_t xzp_k_candidates[] = { 16, 32, 64, 128, 256, 512, 1024 };
+
+/* Indices into the micro-kernel tables of ukernel-registry.h */
+struct autotune_result {
+  size_t q8conv_index;
+  size_t q8conv_xzp_kthreshold;
+  size_t q8dwconv_index;
+  size_t q8avgpool_index;
+  size_t q8gavgpool_index;
+  size_t u8maxpool_index;
+};
+
+struct autotune_buffers {
+  uint8_t* a;
+  size_t a_stride;
+  int32_t* a_sum;
+  const uint8_t** indirect_a;
+  void* w;
+  uint8_t* c;
+  /* Accumulators of multipass depthwise convolution and pooling micro-kernels */
+  int32_t* acc;
+};
+
+static bool is_supported(bool (*is_supported_function)(void))
+{
+  return is_supported_function == NULL || is_supported_function();
+}
+
+static uint64_t get_time_ns(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * UINT64_C(1000000000) + (uint64_t) ts.tv_nsec;
+}
+
+static void get_cpu_signature(char* signature, size_t signature_size)
+{
+  const struct cpuinfo_core* core = cpuinfo_get_core(0);
+  const struct cpuinfo_package* package = cpuinfo_get_package(0);
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  const uint32_t id = core->midr;
+#else
+  const uint32_t id = core->cpuid;
+#endif
+  snprintf(signature, signature_size,
+    "vendor=%d uarch=0x%08" PRIx32 " id=0x%08" PRIx32 " cores=%" PRIu32 " name=%s",
+    (int) core->vendor, (uint32_t) core->uarch, id, cpuinfo_get_cores_count(),
+    package != NULL ? package->name : "");
+}
+
+static uint64_t time_q8gemm(
+    const struct q8conv_parameters* parameters,
+    const struct autotune_buffers* buffers,
+    size_t k,
+    const union qnnp_conv_quantization_params* quantization_params)
+{
+  const size_t k_stride = round_up(k, parameters->kr);
+  uint64_t best_time = UINT64_MAX;
+  for (size_t trial = 0; trial < AUTOTUNE_TRIALS; trial++) {
+    const uint64_t start_time = get_time_ns();
+    for (size_t pass = 0; pass < AUTOTUNE_PASSES; pass++) {
+      for (size_t m = 0; m < AUTOTUNE_M; m += parameters->mr) {
+        for (size_t n = 0; n < AUTOTUNE_N; n += parameters->nr) {
+          parameters->gemm(
+            min(parameters->mr, AUTOTUNE_M - m), min(parameters->nr, AUTOTUNE_N - n), k,
+            buffers->a + m * buffers->a_stride, buffers->a_stride,
+            (const void*) ((uintptr_t) buffers->w + n * (k_stride * sizeof(uint8_t) + sizeof(int32_t))),
+            buffers->c + m * AUTOTUNE_N + n, AUTOTUNE_N,
+            quantization_params);
+        }
+      }
+    }
+    best_time = min(best_time, get_time_ns() - start_time);
+  }
+  return best_time;
+}
+
+static uint64_t time_q8conv(
+    const struct q8conv_parameters* parameters,
+    const struct autotune_buffers* buffers,
+    const union qnnp_conv_quantization_params* quantization_params)
+{
+  const size_t kc_stride = round_up(AUTOTUNE_CONV_KC, parameters->kr) * AUTOTUNE_CONV_KS;
+  uint64_t best_time = UINT64_MAX;
+  for (size_t trial = 0; trial < AUTOTUNE_TRIALS; trial++) {
+    const uint64_t start_time = get_time_ns();
+    for (size_t pass = 0; pass < AUTOTUNE_PASSES; pass++) {
+      for (size_t m = 0; m < AUTOTUNE_M; m += parameters->mr) {
+        for (size_t n = 0; n < AUTOTUNE_N; n += parameters->nr) {
+          parameters->conv(
+            min(parameters->mr, AUTOTUNE_M - m), min(parameters->nr, AUTOTUNE_N - n),
+            AUTOTUNE_CONV_KC, AUTOTUNE_CONV_KS,
+            buffers->indirect_a + m * AUTOTUNE_CONV_KS,
+            (const void*) ((uintptr_t) buffers->w + n * (kc_stride * sizeof(uint8_t) + sizeof(int32_t))),
+            buffers->c + m * AUTOTUNE_N + n, AUTOTUNE_N,
+            quantization_params);
+        }
+      }
+    }
+    best_time = min(best_time, get_time_ns() - start_time);
+  }
+  return best_time;
+}
+
+static uint64_t time_q8gemm_xzp(
+    const struct autotune_buffers* buffers,
+    size_t k,
+    const union qnnp_q31_requantization_params* requantization_params)
+{
+  const struct q8conv_xzp_parameters* parameters = &qnnp_params.q8conv_xzp;
+  const size_t k_stride = round_up(k, parameters->kr);
+  uint64_t best_time = UINT64_MAX;
+  for (size_t trial = 0; trial < AUTOTUNE_TRIALS; trial++) {
+    const uint64_t start_time = get_time_ns();
+    for (size_t pass = 0; pass < AUTOTUNE_PASSES; pass++) {
+      for (size_t m = 0; m < AUTOTUNE_M; m += qnnp_params.q8sum_rows.m) {
+        qnnp_params.q8sum_rows.sum_rows(
+          buffers->a + m * buffers->a_stride,
+          min(qnnp_params.q8sum_rows.m, AUTOTUNE_M - m),
+          k, buffers->a_stride, -127, buffers->a_sum + m);
+      }
+      for (size_t m = 0; m < AUTOTUNE_M; m += parameters->mr) {
+        for (size_t n = 0; n < AUTOTUNE_N; n += parameters->nr) {
+          parameters->gemm(
+            min(parameters->mr, AUTOTUNE_M - m), min(parameters->nr, AUTOTUNE_N - n), k,
+            buffers->a + m * buffers->a_stride, buffers->a_stride,
+            buffers->a_sum + m,
+            (const void*) ((uintptr_t) buffers->w + n * (k_stride * sizeof(uint8_t) + sizeof(int32_t))),
+            buffers->c + m * AUTOTUNE_N + n, AUTOTUNE_N,
+            requantization_params);
+        }
+      }
+    }
+    best_time = min(best_time, get_time_ns() - start_time);
+  }
+  return best_time;
+}
+
+static uint64_t time_q8dwconv(
+    const struct qnnp_q8dwconv_ukernel* ukernel,
+    const struct autotune_buffers* buffers,
+    const union qnnp_conv_quantization_params* quantization_params)
+{
+  uint64_t best_time = UINT64_MAX;
+  for (size_t trial = 0; trial < AUTOTUNE_TRIALS; trial++) {
+    const uint64_t start_time = get_time_ns();
+    for (size_t pass = 0; pass < AUTOTUNE_PASSES; pass++) {
+      ukernel->q8dw9.updw(
+        AUTOTUNE_POOLING_CHANNELS, AUTOTUNE_M,
+        buffers->indirect_a, buffers->w, buffers->c,
+        AUTOTUNE_SMALL_TAPS * sizeof(void*), 0,
+        quantization_params);
+      ukernel->q8dw25.mpdw(
+        AUTOTUNE_POOLING_CHANNELS, AUTOTUNE_M,
+        buffers->indirect_a, buffers->w, buffers->acc, buffers->c,
+        AUTOTUNE_LARGE_TAPS * sizeof(void*), 0,
+        quantization_params);
+    }
+    best_time = min(best_time, get_time_ns() - start_time);
+  }
+  return best_time;
+}
+
+static uint64_t time_q8avgpool(
+    const struct q8avgpool_parameters* parameters,
+    const struct autotune_buffers* buffers,
+    const union qnnp_avgpool_quantization_params* quantization_params)
+{
+  /* Pointer increments as computed for average pooling operators with non-overlapping windows */
+  const size_t multipass_adjustment =
+    round_up(AUTOTUNE_LARGE_TAPS - parameters->mr, parameters->qr) + parameters->mr - parameters->qr;
+  uint64_t best_time = UINT64_MAX;
+  for (size_t trial = 0; trial < AUTOTUNE_TRIALS; trial++) {
+    const uint64_t start_time = get_time_ns();
+    for (size_t pass = 0; pass < AUTOTUNE_PASSES; pass++) {
+      parameters->gekr_lemr(
+        AUTOTUNE_M, AUTOTUNE_SMALL_TAPS, AUTOTUNE_POOLING_CHANNELS,
+        buffers->indirect_a, buffers->a, buffers->c,
+        AUTOTUNE_SMALL_TAPS * sizeof(void*), 0,
+        quantization_params);
+      parameters->gekr_gtmr(
+        AUTOTUNE_M, AUTOTUNE_LARGE_TAPS, AUTOTUNE_POOLING_CHANNELS,
+        buffers->indirect_a, buffers->a, buffers->acc, buffers->c,
+        (AUTOTUNE_LARGE_TAPS - multipass_adjustment) * sizeof(void*), 0,
+        quantization_params);
+    }
+    best_time = min(best_time, get_time_ns() - start_time);
+  }
+  return best_time;
+}
+
+static uint64_t time_q8gavgpool(
+    const struct q8gavgpool_parameters* parameters,
+    const struct autotune_buffers* buffers,
+    const union qnnp_avgpool_quantization_params* quantization_params)
+{
+  uint64_t best_time = UINT64_MAX;
+  for (size_t trial = 0; trial < AUTOTUNE_TRIALS; trial++) {
+    const uint64_t start_time = get_time_ns();
+    for (size_t pass = 0; pass < AUTOTUNE_PASSES; pass++) {
+      for (size_t m = 0; m < AUTOTUNE_M; m++) {
+        parameters->genr_gtmr(
+          AUTOTUNE_GLOBAL_POOLING_ROWS, AUTOTUNE_POOLING_CHANNELS,
+          buffers->a, buffers->a_stride, buffers->a, buffers->acc,
+          buffers->c + m * AUTOTUNE_POOLING_CHANNELS,
+          quantization_params);
+      }
+    }
+    best_time = min(best_time, get_time_ns() - start_time);
+  }
+  return best_time;
+}
+
+static uint64_t time_u8maxpool(
+    const struct u8maxpool_parameters* parameters,
+    const struct autotune_buffers* buffers,
+    const union qnnp_u8_clamping_params* clamping_params)
+{
+  /* Pointer increments as computed for max pooling operators with non-overlapping windows */
+  const size_t small_adjustment = round_up(doz(AUTOTUNE_SMALL_TAPS, parameters->mr), parameters->qr) + parameters->mr;
+  const size_t large_adjustment = round_up(doz(AUTOTUNE_LARGE_TAPS, parameters->mr), parameters->qr) + parameters->mr;
+  uint64_t best_time = UINT64_MAX;
+  for (size_t trial = 0; trial < AUTOTUNE_TRIALS; trial++) {
+    const uint64_t start_time = get_time_ns();
+    for (size_t pass = 0; pass < AUTOTUNE_PASSES; pass++) {
+      parameters->gekr(
+        AUTOTUNE_M, AUTOTUNE_SMALL_TAPS, AUTOTUNE_POOLING_CHANNELS,
+        buffers->indirect_a, buffers->c,
+        (AUTOTUNE_SMALL_TAPS - small_adjustment) * sizeof(void*), 0,
+        clamping_params);
+      parameters->gekr(
+        AUTOTUNE_M, AUTOTUNE_LARGE_TAPS, AUTOTUNE_POOLING_CHANNELS,
+        buffers->indirect_a, buffers->c,
+        (AUTOTUNE_LARGE_TAPS - large_adjustment) * sizeof(void*), 0,
+        clamping_params);
+    }
+    best_time = min(best_time, get_time_ns() - start_time);
+  }
+  return best_time;
+}
+
+static enum qnnp_status run_autotune(struct autotune_result* result)
+{
+  enum qnnp_status status = qnnp_status_out_of_memory;
+  struct autotune_buffers buffers = { 0 };
+
+  size_t max_k = max(AUTOTUNE_GEMM_K, AUTOTUNE_CONV_KC * AUTOTUNE_CONV_KS);
+  if (qnnp_params.q8conv_xzp.gemm != NULL) {
+    max_k = max(max_k, xzp_k_candidates[QNNP_COUNT_OF(xzp_k_candidates) - 1]);
+  }
+  /* Round up to cover the largest kr of any candidate */
+  max_k = round_up(max_k, 8);
+  buffers.a_stride = max_k + AUTOTUNE_PADDING;
+  const size_t a_size = (AUTOTUNE_M + 1) * buffers.a_stride;
+  const size_t w_size = round_up(AUTOTUNE_N, 16) * (max_k + sizeof(int32_t));
+  uint8_t* a_buffer = malloc(a_size);
+  /* Depthwise convolution and pooling micro-kernels read up to (mr - 1) pointers past the last output pixel */
+  const size_t indirect_a_count = (AUTOTUNE_M + 1) * AUTOTUNE_LARGE_TAPS;
+  const size_t c_size = AUTOTUNE_M * max(AUTOTUNE_N, AUTOTUNE_POOLING_CHANNELS);
+  buffers.a_sum = malloc(AUTOTUNE_M * sizeof(int32_t));
+  buffers.indirect_a = malloc(indirect_a_count * sizeof(uint8_t*));
+  buffers.w = malloc(w_size);
+  buffers.c = malloc(c_size);
+  buffers.acc = malloc(round_up(AUTOTUNE_POOLING_CHANNELS, 32) * sizeof(int32_t));
+  if (a_buffer == NULL || buffers.a_sum == NULL || buffers.indirect_a == NULL || buffers.w == NULL ||
+      buffers.c == NULL || buffers.acc == NULL)
+  {
+    qnnp_log_error("failed to allocate buffers for micro-kernel autotuning");
+    goto cleanup;
+  }
+
+  /* Inputs and weights are filled with a pattern which avoids saturation-related shortcuts */
+  for (size_t i = 0; i < a_size; i++) {
+    a_buffer[i] = (uint8_t) (i * 37 + 11);
+  }
+  memset(buffers.w, 0x5A, w_size);
+  buffers.a = a_buffer + AUTOTUNE_PADDING / 2;
+  for (size_t i = 0; i < indirect_a_count; i++) {
+    buffers.indirect_a[i] = buffers.a + ((i * 7) % AUTOTUNE_M) * buffers.a_stride;
+  }
+
+  const union qnnp_conv_quantization_params conv_quantization_params =
+    qnnp_compute_conv_quantization_params(127, 127, 0x1.0p-10f, 127, 0, 255);
+
+  uint64_t best_time = UINT64_MAX;
+  result->q8conv_index = 0;
+  for (size_t i = 0; i < qnnp_q8conv_ukernels_count; i++) {
+    const struct q8conv_parameters* parameters = &qnnp_q8conv_ukernels[i].parameters;
+    const uint64_t time =
+      time_q8gemm(parameters, &buffers, AUTOTUNE_GEMM_K, &conv_quantization_params) +
+      time_q8conv(parameters, &buffers, &conv_quantization_params);
+    qnnp_log_debug("autotune: q8conv candidate %s: %" PRIu64 " ns", qnnp_q8conv_ukernels[i].name, time);
+    if (time < best_time) {
+      best_time = time;
+      result->q8conv_index = i;
+    }
+  }
+
+  result->q8conv_xzp_kthreshold = qnnp_params.q8conv_xzp.kthreshold;
+  if (qnnp_params.q8conv_xzp.gemm != NULL) {
+    const struct q8conv_parameters* parameters = &qnnp_q8conv_ukernels[result->q8conv_index].parameters;
+    const union qnnp_q31_requantization_params requantization_params =
+      qnnp_compute_requantization_params(0x1.0p-10f, 127, 0, 255);
+
+    /* Smallest K such that XZP GEMM wins for it and for all larger K */
+    result->q8conv_xzp_kthreshold = SIZE_MAX;
+    for (size_t i = QNNP_COUNT_OF(xzp_k_candidates); i != 0; i--) {
+      const size_t k = xzp_k_candidates[i - 1];
+      const uint64_t gemm_time = time_q8gemm(parameters, &buffers, k, &conv_quantization_params);
+      const uint64_t xzp_time = time_q8gemm_xzp(&buffers, k, &requantization_params);
+      qnnp_log_debug("autotune: K = %zu: gemm %" PRIu64 " ns, xzp gemm %" PRIu64 " ns", k, gemm_time, xzp_time);
+      if (xzp_time >= gemm_time) {
+        break;
+      }
+      result->q8conv_xzp_kthreshold = k;
+    }
+  }
+
+  best_time = UINT64_MAX;
+  for (size_t i = 0; i < qnnp_q8dwconv_ukernels_count; i++) {
+    const struct qnnp_q8dwconv_ukernel* ukernel = &qnnp_q8dwconv_ukernels[i];
+    if (!is_supported(ukernel->is_supported)) {
+      continue;
+    }
+    const uint64_t time = time_q8dwconv(ukernel, &buffers, &conv_quantization_params);
+    qnnp_log_debug("autotune: q8dwconv candidate %s: %" PRIu64 " ns", ukernel->name, time);
+    if (time < best_time) {
+      best_time = time;
+      result->q8dwconv_index = i;
+    }
+  }
+
+  const union qnnp_avgpool_quantization_params avgpool_quantization_params =
+    qnnp_compute_avgpool_quantization_params(
+      -127 * AUTOTUNE_LARGE_TAPS, 1.0f / (float) AUTOTUNE_LARGE_TAPS, 127, 0, 255);
+  best_time = UINT64_MAX;
+  for (size_t i = 0; i < qnnp_q8avgpool_ukernels_count; i++) {
+    const struct qnnp_q8avgpool_ukernel* ukernel = &qnnp_q8avgpool_ukernels[i];
+    if (!is_supported(ukernel->is_supported)) {
+      continue;
+    }
+    const uint64_t time = time_q8avgpool(&ukernel->parameters, &buffers, &avgpool_quantization_params);
+    qnnp_log_debug("autotune: q8avgpool candidate %s: %" PRIu64 " ns", ukernel->name, time);
+    if (time < best_time) {
+      best_time = time;
+      result->q8avgpool_index = i;
+    }
+  }
+
+  best_time = UINT64_MAX;
+  for (size_t i = 0; i < qnnp_q8gavgpool_ukernels_count; i++) {
+    const struct qnnp_q8gavgpool_ukernel* ukernel = &qnnp_q8gavgpool_ukernels[i];
+    if (!is_supported(ukernel->is_supported)) {
+      continue;
+    }
+    const uint64_t time = time_q8gavgpool(&ukernel->parameters, &buffers, &avgpool_quantization_params);
+    qnnp_log_debug("autotune: q8gavgpool candidate %s: %" PRIu64 " ns", ukernel->name, time);
+    if (time < best_time) {
+      best_time = time;
+      result->q8gavgpool_index = i;
+    }
+  }
+
+  const union qnnp_u8_clamping_params clamping_params = qnnp_compute_u8_clamping_params(0, 255);
+  best_time = UINT64_MAX;
+  for (size_t i = 0; i < qnnp_u8maxpool_ukernels_count; i++) {
+    const struct qnnp_u8maxpool_ukernel* ukernel = &qnnp_u8maxpool_ukernels[i];
+    if (!is_supported(ukernel->is_supported)) {
+      continue;
+    }
+    const uint64_t time = time_u8maxpool(&ukernel->parameters, &buffers, &clamping_params);
+    qnnp_log_debug("autotune: u8maxpool candidate %s: %" PRIu64 " ns", ukernel->name, time);
+    if (time < best_time) {
+      best_time = time;
+      result->u8maxpool_index = i;
+    }
+  }
+  status = qnnp_status_success;
+
+cleanup:
+  free(a_buffer);
+  free(buffers.a_sum);
+  free(buffers.indirect_a);
+  free(buffers.w);
+  free(buffers.c);
+  free(buffers.acc);
+  return status;
+}
+
+static bool load_cache(const char* cache_path, const char* signature, struct autotune_result* result)
+{
+  FILE* file = fopen(cache_path, "r");
+  if (file == NULL) {
+    return false;
+  }
+
+  bool valid = false;
+  char line[256];
+  if (fgets(line, sizeof(line), file) == NULL) {
+    goto cleanup;
+  }
+  line[strcspn(line, "\n")] = '\0';
+  if (strcmp(line, AUTOTUNE_CACHE_HEADER) != 0) {
+    goto cleanup;
+  }
+  if (fgets(line, sizeof(line), file) == NULL) {
+    goto cleanup;
+  }
+  line[strcspn(line, "\n")] = '\0';
+  if (strcmp(line, signature) != 0) {
+    qnnp_log_info("autotune cache %s was produced on a different CPU", cache_path);
+    goto cleanup;
+  }
+
+  char name[64];
+  if (fscanf(file, "q8conv %63s\n", name) != 1) {
+    goto cleanup;
+  }
+  bool found = false;
+  for (size_t i = 0; i < qnnp_q8conv_ukernels_count; i++) {
+    if (strcmp(name, qnnp_q8conv_ukernels[i].name) == 0) {
+      result->q8conv_index = i;
+      found = true;
+    }
+  }
+  if (!found) {
+    goto cleanup;
+  }
+
+  char kthreshold[32];
+  if (fscanf(file, "q8conv_xzp.kthreshold %31s\n", kthreshold) != 1) {
+    goto cleanup;
+  }
+  if (strcmp(kthreshold, "none") == 0) {
+    result->q8conv_xzp_kthreshold = SIZE_MAX;
+  } else {
+    char* end = NULL;
+    result->q8conv_xzp_kthreshold = (size_t) strtoull(kthreshold, &end, 10);
+    if (*end != '\0') {
+      goto cleanup;
+    }
+  }
+
+  /* Micro-kernels which need an unsupported instruction set extension are rejected as if they were unknown */
+  if (fscanf(file, "q8dwconv %63s\n", name) != 1) {
+    goto cleanup;
+  }
+  found = false;
+  for (size_t i = 0; i < qnnp_q8dwconv_ukernels_count; i++) {
+    if (strcmp(name, qnnp_q8dwconv_ukernels[i].name) == 0 && is_supported(qnnp_q8dwconv_ukernels[i].is_supported)) {
+      result->q8dwconv_index = i;
+      found = true;
+    }
+  }
+  if (!found) {
+    goto cleanup;
+  }
+
+  if (fscanf(file, "q8avgpool %63s\n", name) != 1) {
+    goto cleanup;
+  }
+  found = false;
+  for (size_t i = 0; i < qnnp_q8avgpool_ukernels_count; i++) {
+    if (strcmp(name, qnnp_q8avgpool_ukernels[i].name) == 0 && is_supported(qnnp_q8avgpool_ukernels[i].is_supported)) {
+      result->q8avgpool_index = i;
+      found = true;
+    }
+  }
+  if (!found) {
+    goto cleanup;
+  }
+
+  if (fscanf(file, "q8gavgpool %63s\n", name) != 1) {
+    goto cleanup;
+  }
+  found = false;
+  for (size_t i = 0; i < qnnp_q8gavgpool_ukernels_count; i++) {
+    if (strcmp(name, qnnp_q8gavgpool_ukernels[i].name) == 0 && is_supported(qnnp_q8gavgpool_ukernels[i].is_supported)) {
+      result->q8gavgpool_index = i;
+      found = true;
+    }
+  }
+  if (!found) {
+    goto cleanup;
+  }
+
+  if (fscanf(file, "u8maxpool %63s\n", name) != 1) {
+    goto cleanup;
+  }
+  found = false;
+  for (size_t i = 0; i < qnnp_u8maxpool_ukernels_count; i++) {
+    if (strcmp(name, qnnp_u8maxpool_ukernels[i].name) == 0 && is_supported(qnnp_u8maxpool_ukernels[i].is_supported)) {
+      result->u8maxpool_index = i;
+      found = true;
+    }
+  }
+  if (!found) {
+    goto cleanup;
+  }
+  valid = true;
+
+cleanup:
+  fclose(file);
+  return valid;
+}
+
+static void save_cache(const char* cache_path, const char* signature, const struct autotune_result* result)
+{
+  FILE* file = fopen(cache_path, "w");
+  if (file == NULL) {
+    qnnp_log_warning("failed to open autotune cache %s for writing", cache_path);
+    return;
+  }
+
+  fprintf(file, "%s\n%s\n", AUTOTUNE_CACHE_HEADER, signature);
+  fprintf(file, "q8conv %s\n", qnnp_q8conv_ukernels[result->q8conv_index].name);
+  if (result->q8conv_xzp_kthreshold == SIZE_MAX) {
+    fprintf(file, "q8conv_xzp.kthreshold none\n");
+  } else {
+    fprintf(file, "q8conv_xzp.kthreshold %zu\n", result->q8conv_xzp_kthreshold);
+  }
+  fprintf(file, "q8dwconv %s\n", qnnp_q8dwconv_ukernels[result->q8dwconv_index].name);
+  fprintf(file, "q8avgpool %s\n", qnnp_q8avgpool_ukernels[result->q8avgpool_index].name);
+  fprintf(file, "q8gavgpool %s\n", qnnp_q8gavgpool_ukernels[result->q8gavgpool_index].name);
+  fprintf(file, "u8maxpool %s\n", qnnp_u8maxpool_ukernels[result->u8maxpool_index].name);
+  if (fclose(file) != 0) {
+    qnnp_log_warning("failed to write autotune cache %s", cache_path);
+  }
+}
+
+enum qnnp_status qnnp_autotune(const char* cache_path)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_autotune failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  char signature[160];
+  get_cpu_signature(signature, sizeof(signature));
+
+  struct autotune_result result;
+  if (cache_path == NULL || !load_cache(cache_path, signature, &result)) {
+    const enum qnnp_status status = run_autotune(&result);
+    if (status != qnnp_status_success) {
+      return status;
+    }
+    if (cache_path != NULL) {
+      save_cache(cache_path, signature, &result);
+    }
+  }
+
+  qnnp_params.q8conv = qnnp_q8conv_ukernels[result.q8conv_index].parameters;
+  qnnp_params.q8conv_xzp.kthreshold = result.q8conv_xzp_kthreshold;
+  qnnp_params.q8dw9 = qnnp_q8dwconv_ukernels[result.q8dwconv_index].q8dw9;
+  qnnp_params.q8dw25 = qnnp_q8dwconv_ukernels[result.q8dwconv_index].q8dw25;
+  qnnp_params.q8avgpool = qnnp_q8avgpool_ukernels[result.q8avgpool_index].parameters;
+  qnnp_params.q8gavgpool = qnnp_q8gavgpool_ukernels[result.q8gavgpool_index].parameters;
+  qnnp_params.u8maxpool = qnnp_u8maxpool_ukernels[result.u8maxpool_index].parameters;
+  return qnnp_status_success;
+}
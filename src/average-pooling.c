@@ -15,6 +15,7 @@
 #include <string.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/log.h>
 #include <qnnpack/common.h>
@@ -129,7 +130,7 @@ enum qnnp_status qnnp_create_average_pooling2d_nhwc_q8(
 
   status = qnnp_status_out_of_memory;
 
-  average_pooling = calloc(1, sizeof(struct qnnp_operator));
+  average_pooling = qnnp_allocate_operator();
   if (average_pooling == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
@@ -140,13 +141,14 @@ enum qnnp_status qnnp_create_average_pooling2d_nhwc_q8(
   const uint32_t mr = qnnp_params.q8avgpool.mr;
   const uint32_t qr = qnnp_params.q8avgpool.qr;
   if (any_padding || (channels >= kr || (pooling_size - mr) % qr != 0)) {
-    void* zero_buffer = malloc(channels);
+    void* zero_buffer = qnnp_operator_allocate(average_pooling, channels);
     if (zero_buffer == NULL) {
       qnnp_log_error("failed to allocate %zu bytes for zero padding", channels);
       goto error;
     }
     memset(zero_buffer, input_zero_point, channels);
     average_pooling->zero_buffer = zero_buffer;
+    average_pooling->zero_buffer_size = channels;
     average_pooling->zero_pointer = zero_buffer;
   }
 
@@ -257,12 +259,13 @@ enum qnnp_status qnnp_setup_average_pooling2d_nhwc_q8(
   const size_t step_height = pooling_size + (output_width * step_width - 1) * pooling_height;
   const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
 
-  const void** indirection_buffer = (const void**) realloc(average_pooling->indirection_buffer, indirection_buffer_size);
+  const void** indirection_buffer = (const void**) qnnp_operator_reallocate(average_pooling, average_pooling->indirection_buffer, indirection_buffer_size);
   if (indirection_buffer == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
     return qnnp_status_out_of_memory;
   }
   average_pooling->indirection_buffer = indirection_buffer;
+  average_pooling->indirection_buffer_size = indirection_buffer_size;
 
   qnnp_indirection_init_dwconv2d(average_pooling, valid_batch_size, step_height, step_width);
 
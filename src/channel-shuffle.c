@@ -13,6 +13,7 @@
 #include <stdlib.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/log.h>
 #include <qnnpack/params.h>
@@ -50,7 +51,7 @@ enum qnnp_status qnnp_create_channel_shuffle_nc_x8(
 
   status = qnnp_status_out_of_memory;
 
-  channel_shuffle_op = calloc(1, sizeof(struct qnnp_operator));
+  channel_shuffle_op = qnnp_allocate_operator();
   if (channel_shuffle_op == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
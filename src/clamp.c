@@ -13,6 +13,7 @@
 #include <stdlib.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/log.h>
 
@@ -49,7 +50,7 @@ enum qnnp_status qnnp_create_clamp_nc_u8(
 
   status = qnnp_status_out_of_memory;
 
-  clamp_op = calloc(1, sizeof(struct qnnp_operator));
+  clamp_op = qnnp_allocate_operator();
   if (clamp_op == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+
+
+enum qnnp_status qnnp_plan_concat_nc_x8(
+    size_t inputs_count,
+    const size_t* input_channels,
+    uint8_t* output,
+    size_t output_stride,
+    uint8_t** input_outputs)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_plan_concat_nc_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (inputs_count == 0) {
+    qnnp_log_error("failed to plan Concat with %zu inputs: number of inputs must be non-zero", inputs_count);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_channels == NULL || output == NULL || input_outputs == NULL) {
+    qnnp_log_error("failed to plan Concat: input channels, output, and input outputs pointers must be non-NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  size_t channels = 0;
+  for (size_t i = 0; i < inputs_count; i++) {
+    if (input_channels[i] == 0) {
+      qnnp_log_error(
+        "failed to plan Concat with %zu channels in input #%zu: number of channels must be non-zero",
+        input_channels[i], i);
+      return qnnp_status_invalid_parameter;
+    }
+    channels += input_channels[i];
+  }
+
+  if (output_stride < channels) {
+    qnnp_log_error(
+      "failed to plan Concat with %zu output stride: output stride must be at least the total of %zu channels",
+      output_stride, channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  size_t channel_offset = 0;
+  for (size_t i = 0; i < inputs_count; i++) {
+    input_outputs[i] = output + channel_offset;
+    channel_offset += input_channels[i];
+  }
+
+  return qnnp_status_success;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_constant_pad_nd_x8(
+    uint8_t padding_value,
+    uint32_t flags,
+    qnnp_operator_t* constant_pad_out)
+{
+  qnnp_operator_t constant_pad = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_constant_pad_nd_x8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  constant_pad = qnnp_allocate_operator();
+  if (constant_pad == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  constant_pad->padding_value = padding_value;
+
+  constant_pad->ukernel_type = qnnp_ukernel_type_constant_pad;
+  constant_pad->format = qnnp_format_quint8;
+
+  *constant_pad_out = constant_pad;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(constant_pad);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_constant_pad_nd_x8(
+    qnnp_operator_t constant_pad,
+    size_t num_dims,
+    const size_t* input_shape,
+    const size_t* pre_paddings,
+    const size_t* post_paddings,
+    const void* input,
+    void* output,
+    pthreadpool_t threadpool)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_constant_pad_nd_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (num_dims == 0 || num_dims > QNNP_MAX_TENSOR_DIMS) {
+    qnnp_log_error(
+      "failed to setup constant pad with %zu dimensions: number of dimensions must be in [1, %d] range",
+      num_dims, QNNP_MAX_TENSOR_DIMS);
+    return qnnp_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_dims; i++) {
+    if (input_shape[i] == 0) {
+      qnnp_log_error(
+        "failed to setup constant pad: input dimension #%zu is zero", i);
+      return qnnp_status_invalid_parameter;
+    }
+  }
+
+  /*
+   * Normalize the shape to QNNP_MAX_TENSOR_DIMS dimensions, innermost last. A dimension is merged into the inner
+   * one when the inner dimension has no padding, because its padded slices are then contiguous in memory.
+   */
+  size_t normalized_shape[QNNP_MAX_TENSOR_DIMS];
+  size_t normalized_pre_paddings[QNNP_MAX_TENSOR_DIMS];
+  size_t normalized_post_paddings[QNNP_MAX_TENSOR_DIMS];
+  for (size_t i = 0; i < QNNP_MAX_TENSOR_DIMS; i++) {
+    normalized_shape[i] = 1;
+    normalized_pre_paddings[i] = 0;
+    normalized_post_paddings[i] = 0;
+  }
+  size_t normalized_dim = QNNP_MAX_TENSOR_DIMS - 1;
+  normalized_shape[normalized_dim] = input_shape[num_dims - 1];
+  normalized_pre_paddings[normalized_dim] = pre_paddings[num_dims - 1];
+  normalized_post_paddings[normalized_dim] = post_paddings[num_dims - 1];
+  for (size_t i = num_dims - 1; i != 0; i--) {
+    const size_t dim = i - 1;
+    if (normalized_pre_paddings[normalized_dim] == 0 && normalized_post_paddings[normalized_dim] == 0) {
+      const size_t inner_size = normalized_shape[normalized_dim];
+      normalized_shape[normalized_dim] = input_shape[dim] * inner_size;
+      normalized_pre_paddings[normalized_dim] = pre_paddings[dim] * inner_size;
+      normalized_post_paddings[normalized_dim] = post_paddings[dim] * inner_size;
+    } else {
+      normalized_dim -= 1;
+      normalized_shape[normalized_dim] = input_shape[dim];
+      normalized_pre_paddings[normalized_dim] = pre_paddings[dim];
+      normalized_post_paddings[normalized_dim] = post_paddings[dim];
+    }
+  }
+
+  for (size_t i = 0; i < QNNP_MAX_TENSOR_DIMS; i++) {
+    constant_pad->pad_input_shape[i] = normalized_shape[i];
+    constant_pad->pad_pre_paddings[i] = normalized_pre_paddings[i];
+    constant_pad->pad_post_paddings[i] = normalized_post_paddings[i];
+  }
+  constant_pad->batch_size = 1;
+  constant_pad->input = input;
+  constant_pad->output = output;
+
+  return qnnp_status_success;
+}
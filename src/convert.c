@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+static enum qnnp_status create_convert(
+    size_t channels,
+    enum qnnp_ukernel_type ukernel_type,
+    enum qnnp_format format,
+    uint32_t flags,
+    qnnp_operator_t* convert_out)
+{
+  qnnp_operator_t convert_op = NULL;
+  enum qnnp_status status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create layout conversion operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  convert_op = qnnp_allocate_operator();
+  if (convert_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  convert_op->channels = channels;
+
+  convert_op->ukernel_type = ukernel_type;
+  convert_op->format = format;
+
+  *convert_out = convert_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(convert_op);
+  return status;
+}
+
+static enum qnnp_status setup_convert(
+    qnnp_operator_t convert_op,
+    enum qnnp_ukernel_type ukernel_type,
+    enum qnnp_format format,
+    size_t batch_size,
+    size_t height,
+    size_t width,
+    const void* input,
+    size_t input_stride,
+    void* output,
+    size_t output_stride)
+{
+  if (convert_op->ukernel_type != ukernel_type || convert_op->format != format) {
+    qnnp_log_error(
+      "failed to setup layout conversion operator: operator was created for a different layout or element type");
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error(
+      "failed to setup layout conversion operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (width == 0 || height == 0) {
+    qnnp_log_error(
+      "failed to setup layout conversion operator with %zux%zu input: input dimensions must be non-zero",
+      width, height);
+    return qnnp_status_invalid_parameter;
+  }
+
+  const size_t channels = convert_op->channels;
+  if (input_stride < channels || output_stride < channels) {
+    qnnp_log_error(
+      "failed to setup layout conversion operator with input stride %zu and output stride %zu: "
+      "pixel strides must be at least as large as the number of channels (%zu)",
+      input_stride, output_stride, channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  convert_op->batch_size = batch_size;
+  convert_op->input_height = height;
+  convert_op->input_width = width;
+  convert_op->input = input;
+  convert_op->input_pixel_stride = input_stride;
+  convert_op->output_height = height;
+  convert_op->output_width = width;
+  convert_op->output = output;
+  convert_op->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_create_convert_nchw_nhwc_x8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* convert_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convert_nchw_nhwc_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convert(channels, qnnp_ukernel_type_nchw_to_nhwc, qnnp_format_quint8, flags, convert_out);
+}
+
+enum qnnp_status qnnp_create_convert_nhwc_nchw_x8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* convert_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convert_nhwc_nchw_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convert(channels, qnnp_ukernel_type_nhwc_to_nchw, qnnp_format_quint8, flags, convert_out);
+}
+
+enum qnnp_status qnnp_create_convert_nchw_nhwc_x32(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* convert_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convert_nchw_nhwc_x32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convert(channels, qnnp_ukernel_type_nchw_to_nhwc, qnnp_format_float32, flags, convert_out);
+}
+
+enum qnnp_status qnnp_create_convert_nhwc_nchw_x32(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* convert_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convert_nhwc_nchw_x32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convert(channels, qnnp_ukernel_type_nhwc_to_nchw, qnnp_format_float32, flags, convert_out);
+}
+
+enum qnnp_status qnnp_setup_convert_nchw_nhwc_x8(
+    qnnp_operator_t convert,
+    size_t batch_size,
+    size_t height,
+    size_t width,
+    const uint8_t* input,
+    uint8_t* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convert_nchw_nhwc_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_convert(
+    convert, qnnp_ukernel_type_nchw_to_nhwc, qnnp_format_quint8,
+    batch_size, height, width,
+    input, convert->channels,
+    output, output_stride);
+}
+
+enum qnnp_status qnnp_setup_convert_nhwc_nchw_x8(
+    qnnp_operator_t convert,
+    size_t batch_size,
+    size_t height,
+    size_t width,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convert_nhwc_nchw_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_convert(
+    convert, qnnp_ukernel_type_nhwc_to_nchw, qnnp_format_quint8,
+    batch_size, height, width,
+    input, input_stride,
+    output, convert->channels);
+}
+
+enum qnnp_status qnnp_setup_convert_nchw_nhwc_x32(
+    qnnp_operator_t convert,
+    size_t batch_size,
+    size_t height,
+    size_t width,
+    const void* input,
+    void* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convert_nchw_nhwc_x32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_convert(
+    convert, qnnp_ukernel_type_nchw_to_nhwc, qnnp_format_float32,
+    batch_size, height, width,
+    input, convert->channels,
+    output, output_stride);
+}
+
+enum qnnp_status qnnp_setup_convert_nhwc_nchw_x32(
+    qnnp_operator_t convert,
+    size_t batch_size,
+    size_t height,
+    size_t width,
+    const void* input,
+    size_t input_stride,
+    void* output)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convert_nhwc_nchw_x32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return setup_convert(
+    convert, qnnp_ukernel_type_nhwc_to_nchw, qnnp_format_float32,
+    batch_size, height, width,
+    input, input_stride,
+    output, convert->channels);
+}
@@ -17,6 +17,7 @@
 #include <fxdiv.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/log.h>
 #include <qnnpack/common.h>
@@ -36,7 +37,7 @@ static inline size_t compute_output_dimension(
   return (padded_input_dimension - effective_kernel_dimension) / subsampling_dimension + 1;
 }
 
-enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
+static enum qnnp_status create_convolution2d_nhwc_q8(
     uint32_t input_padding_top,
     uint32_t input_padding_right,
     uint32_t input_padding_bottom,
@@ -56,22 +57,15 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
     float kernel_scale,
     const uint8_t* kernel,
     const int32_t* bias,
+    enum qnnp_conv_output_type output_type,
     uint8_t output_zero_point,
     float output_scale,
     uint8_t output_min,
     uint8_t output_max,
-    uint32_t flags,
     qnnp_operator_t* convolution_out)
 {
   qnnp_operator_t convolution = NULL;
-  enum qnnp_status status = qnnp_status_uninitialized;
-
-  if (!qnnp_params.initialized) {
-    qnnp_log_error("qnnp_create_convolution2d_nhwc_q8 failed because QNNPACK is not properly initialized");
-    goto error;
-  }
-
-  status = qnnp_status_invalid_parameter;
+  enum qnnp_status status = qnnp_status_invalid_parameter;
 
   if (kernel_width == 0 || kernel_height == 0) {
     qnnp_log_error(
@@ -108,7 +102,7 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
     goto error;
   }
 
-  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+  if (output_type == qnnp_conv_output_type_quint8 && (output_scale <= 0.0f || !isnormal(output_scale))) {
     qnnp_log_error(
       "failed to create convolution with %.7g output scale: scale must be finite and positive", output_scale);
     goto error;
@@ -159,7 +153,7 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
   }
 
   const float convolution_scale = input_scale * kernel_scale / output_scale;
-  if (convolution_scale >= 1.0f) {
+  if (output_type == qnnp_conv_output_type_quint8 && convolution_scale >= 1.0f) {
     qnnp_log_error(
       "failed to create convolution with %.7g input scale, %.7g kernel scale, and %.7g output scale: "
       "convolution scale %.7g is greater or equal to 1.0",
@@ -169,7 +163,7 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
 
   status = qnnp_status_out_of_memory;
 
-  convolution = calloc(1, sizeof(struct qnnp_operator));
+  convolution = qnnp_allocate_operator();
   if (convolution == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
@@ -179,10 +173,14 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
 
   enum qnnp_ukernel_type ukernel_type = qnnp_ukernel_type_none;
   const bool any_padding = (input_padding_left | input_padding_top | input_padding_right | input_padding_bottom) != 0;
-  if ((kernel_size == 9 || kernel_size == 25) && group_input_channels == 1 && group_output_channels == 1 && groups > 1) {
+  /* Depthwise and XZP GEMM micro-kernels always requantize, other outputs use GEMM and CONV micro-kernels */
+  const bool requantize = output_type == qnnp_conv_output_type_quint8;
+  if (requantize && (kernel_size == 9 || kernel_size == 25) &&
+      group_input_channels == 1 && group_output_channels == 1 && groups > 1)
+  {
     ukernel_type = qnnp_ukernel_type_dwconv;
   } else if (kernel_size == 1 && subsampling_height == 1 && subsampling_width == 1 && !any_padding) {
-    ukernel_type = group_input_channels >= qnnp_params.q8conv_xzp.kthreshold ?
+    ukernel_type = requantize && group_input_channels >= qnnp_params.q8conv_xzp.kthreshold ?
       qnnp_ukernel_type_xzp_gemm : qnnp_ukernel_type_gemm;
   } else {
     ukernel_type = qnnp_ukernel_type_conv;
@@ -192,15 +190,18 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
   switch (ukernel_type) {
     case qnnp_ukernel_type_dwconv:
     {
-      const uint32_t cr = qnnp_params.q8dw9.cr;
+      convolution->ukernel.q8dwconv.q8dw9 = qnnp_params.q8dw9;
+      convolution->ukernel.q8dwconv.q8dw25 = qnnp_params.q8dw25;
+      const uint32_t cr = convolution->ukernel.q8dwconv.q8dw9.cr;
       const uint32_t c_stride = (groups + (cr - 1)) & -cr;
       convolution->group_stride = c_stride;
       const size_t packed_weights_size = (sizeof(uint8_t) * kernel_size + sizeof(int32_t)) * c_stride;
-      convolution->packed_weights = malloc(packed_weights_size);
+      convolution->packed_weights = qnnp_operator_allocate_weights(convolution, packed_weights_size);
       if (convolution->packed_weights == NULL) {
         qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
         goto error;
       }
+      convolution->packed_weights_size = packed_weights_size;
 
       switch (kernel_size) {
         case 9:
@@ -251,11 +252,12 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
 
       const size_t packed_group_weights_size =
         (sizeof(uint8_t) * kernel_size * k_stride + sizeof(int32_t)) * n_stride;
-      convolution->packed_weights = malloc(packed_group_weights_size * groups);
+      convolution->packed_weights = qnnp_operator_allocate_weights(convolution, packed_group_weights_size * groups);
       if (convolution->packed_weights == NULL) {
         qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_group_weights_size * groups);
         goto error;
       }
+      convolution->packed_weights_size = packed_group_weights_size * groups;
       /* The XZP ukernel needs the padding to be 0 */
       memset(convolution->packed_weights, 0, packed_group_weights_size * groups);
 
@@ -273,18 +275,35 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
     case qnnp_ukernel_type_gemm:
     case qnnp_ukernel_type_conv:
     {
-      const uint32_t nr = qnnp_params.q8conv.nr;
-      const uint32_t kr = qnnp_params.q8conv.kr;
+      uint32_t nr = 0, kr = 0;
+      switch (output_type) {
+        case qnnp_conv_output_type_quint8:
+          convolution->ukernel.q8conv = qnnp_params.q8conv;
+          nr = qnnp_params.q8conv.nr;
+          kr = qnnp_params.q8conv.kr;
+          break;
+        case qnnp_conv_output_type_int32:
+          convolution->ukernel.q8conv_i32 = qnnp_params.q8conv_i32;
+          nr = qnnp_params.q8conv_i32.nr;
+          kr = qnnp_params.q8conv_i32.kr;
+          break;
+        case qnnp_conv_output_type_float32:
+          convolution->ukernel.q8conv_f32 = qnnp_params.q8conv_f32;
+          nr = qnnp_params.q8conv_f32.nr;
+          kr = qnnp_params.q8conv_f32.kr;
+          break;
+      }
       const uint32_t n_stride = (group_output_channels + (nr - 1)) & -nr;
       const uint32_t k_stride = (group_input_channels + (kr - 1)) & -kr;
 
       const size_t packed_group_weights_size =
         (sizeof(uint8_t) * kernel_size * k_stride + sizeof(int32_t)) * n_stride;
-      convolution->packed_weights = malloc(packed_group_weights_size * groups);
+      convolution->packed_weights = qnnp_operator_allocate_weights(convolution, packed_group_weights_size * groups);
       if (convolution->packed_weights == NULL) {
         qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_group_weights_size * groups);
         goto error;
       }
+      convolution->packed_weights_size = packed_group_weights_size * groups;
       memset(convolution->packed_weights, kernel_zero_point, packed_group_weights_size * groups);
 
       switch (ukernel_type) {
@@ -328,13 +347,14 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
   }
 
   if (any_padding) {
-    void* zero_buffer = malloc(zero_size);
+    void* zero_buffer = qnnp_operator_allocate(convolution, zero_size);
     if (zero_buffer == NULL) {
       qnnp_log_error("failed to allocate %zu bytes for zero padding", zero_size);
       goto error;
     }
     memset(zero_buffer, input_zero_point, zero_size);
     convolution->zero_buffer = zero_buffer;
+    convolution->zero_buffer_size = zero_size;
     convolution->zero_pointer = (void*) ((uintptr_t) zero_buffer + zero_offset);
   }
 
@@ -353,21 +373,36 @@ enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
   convolution->group_input_channels = group_input_channels;
   convolution->group_output_channels = group_output_channels;
 
+  convolution->input_zero_point = input_zero_point;
   convolution->kernel_zero_point = kernel_zero_point;
 
-  if (ukernel_type == qnnp_ukernel_type_xzp_gemm) {
-    convolution->requantization_params =
-      qnnp_compute_requantization_params(
-        convolution_scale, output_zero_point, output_min, output_max);
-  } else {
-    convolution->conv_quantization_params =
-      qnnp_compute_conv_quantization_params(
-        input_zero_point, kernel_zero_point,
-        convolution_scale, output_zero_point, output_min, output_max);
+  switch (output_type) {
+    case qnnp_conv_output_type_quint8:
+      if (ukernel_type == qnnp_ukernel_type_xzp_gemm) {
+        convolution->requantization_params =
+          qnnp_compute_requantization_params(
+            convolution_scale, output_zero_point, output_min, output_max);
+      } else {
+        convolution->conv_quantization_params =
+          qnnp_compute_conv_quantization_params(
+            input_zero_point, kernel_zero_point,
+            convolution_scale, output_zero_point, output_min, output_max);
+      }
+      convolution->format = qnnp_format_quint8;
+      break;
+    case qnnp_conv_output_type_int32:
+      convolution->kernel_zero_point_params = qnnp_compute_kernel_zero_point_params(kernel_zero_point);
+      convolution->format = qnnp_format_quint8_with_wide_output;
+      break;
+    case qnnp_conv_output_type_float32:
+      convolution->conv_dequantization_params =
+        qnnp_compute_conv_dequantization_params(kernel_zero_point, input_scale * kernel_scale);
+      convolution->format = qnnp_format_quint8_with_wide_output;
+      break;
   }
 
   convolution->ukernel_type = ukernel_type;
-  convolution->format = qnnp_format_quint8;
+  convolution->conv_output_type = output_type;
 
   *convolution_out = convolution;
   return qnnp_status_success;
@@ -377,22 +412,144 @@ error:
   return status;
 }
 
-enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
+enum qnnp_status qnnp_create_convolution2d_nhwc_q8(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* convolution_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convolution2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convolution2d_nhwc_q8(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    kernel, bias,
+    qnnp_conv_output_type_quint8,
+    output_zero_point, output_scale, output_min, output_max,
+    convolution_out);
+}
+
+enum qnnp_status qnnp_create_convolution2d_nhwc_q8_s32(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    uint8_t kernel_zero_point,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    qnnp_operator_t* convolution_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convolution2d_nhwc_q8_s32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convolution2d_nhwc_q8(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_zero_point, 1.0f /* input scale */,
+    kernel_zero_point, 1.0f /* kernel scale */,
+    kernel, bias,
+    qnnp_conv_output_type_int32,
+    0 /* output zero point */, 1.0f /* output scale */, 0 /* output min */, 255 /* output max */,
+    convolution_out);
+}
+
+enum qnnp_status qnnp_create_convolution2d_nhwc_q8_f32(
+    uint32_t input_padding_top,
+    uint32_t input_padding_right,
+    uint32_t input_padding_bottom,
+    uint32_t input_padding_left,
+    uint32_t kernel_height,
+    uint32_t kernel_width,
+    uint32_t subsampling_height,
+    uint32_t subsampling_width,
+    uint32_t dilation_height,
+    uint32_t dilation_width,
+    uint32_t groups,
+    size_t group_input_channels,
+    size_t group_output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    qnnp_operator_t* convolution_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_convolution2d_nhwc_q8_f32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_convolution2d_nhwc_q8(
+    input_padding_top, input_padding_right, input_padding_bottom, input_padding_left,
+    kernel_height, kernel_width,
+    subsampling_height, subsampling_width,
+    dilation_height, dilation_width,
+    groups, group_input_channels, group_output_channels,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    kernel, bias,
+    qnnp_conv_output_type_float32,
+    0 /* output zero point */, 1.0f /* output scale */, 0 /* output min */, 255 /* output max */,
+    convolution_out);
+}
+
+static enum qnnp_status setup_convolution2d_nhwc(
     qnnp_operator_t convolution,
     size_t batch_size,
     size_t input_height,
     size_t input_width,
     const uint8_t* input,
     size_t input_pixel_stride,
-    uint8_t* output,
-    size_t output_pixel_stride,
-    pthreadpool_t threadpool)
+    void* output,
+    size_t output_pixel_stride)
 {
-  if (!qnnp_params.initialized) {
-    qnnp_log_error("qnnp_setup_convolution2d_nhwc_q8 failed because QNNPACK is not properly initialized");
-    return qnnp_status_uninitialized;
-  }
-
   if (batch_size == 0) {
     qnnp_log_error("failed to setup convolution with batch size %zu: batch size must be non-zero", batch_size);
     return qnnp_status_invalid_parameter;
@@ -432,13 +589,14 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
     case qnnp_ukernel_type_xzp_gemm:
     {
       const size_t groups = convolution->groups;
-      void* a_sum = (void*) realloc(convolution->a_sum, sizeof(int32_t) * batch_size * groups * input_height * input_width);
+      const size_t a_sum_size = sizeof(int32_t) * batch_size * groups * input_height * input_width;
+      void* a_sum = (void*) qnnp_operator_reallocate(convolution, convolution->a_sum, a_sum_size);
       if (a_sum == NULL) {
-        qnnp_log_error("failed to allocate %zu bytes for row sum data",
-          sizeof(int32_t) * batch_size * groups * input_height * input_width);
+        qnnp_log_error("failed to allocate %zu bytes for row sum data", a_sum_size);
         return qnnp_status_out_of_memory;
       }
       convolution->a_sum = a_sum;
+      convolution->a_sum_size = a_sum_size;
       return qnnp_status_success;
     }
     case qnnp_ukernel_type_conv:
@@ -450,16 +608,28 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
       const size_t output_height = convolution->output_height;
       const size_t output_width = convolution->output_width;
       const size_t output_size = output_height * output_width;
-      const size_t output_tile_size = qnnp_params.q8conv.mr;
+      size_t output_tile_size = 0;
+      switch (convolution->conv_output_type) {
+        case qnnp_conv_output_type_quint8:
+          output_tile_size = convolution->ukernel.q8conv.mr;
+          break;
+        case qnnp_conv_output_type_int32:
+          output_tile_size = convolution->ukernel.q8conv_i32.mr;
+          break;
+        case qnnp_conv_output_type_float32:
+          output_tile_size = convolution->ukernel.q8conv_f32.mr;
+          break;
+      }
       const size_t tiled_output_size = round_up(output_size, output_tile_size);
       const size_t indirection_buffer_size = sizeof(void*) * batch_size * groups * tiled_output_size * kernel_size;
 
-      const void** indirection_buffer = (const void**) realloc(convolution->indirection_buffer, indirection_buffer_size);
+      const void** indirection_buffer = (const void**) qnnp_operator_reallocate(convolution, convolution->indirection_buffer, indirection_buffer_size);
       if (indirection_buffer == NULL) {
         qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
         return qnnp_status_out_of_memory;
       }
       convolution->indirection_buffer = indirection_buffer;
+      convolution->indirection_buffer_size = indirection_buffer_size;
 
       qnnp_indirection_init_conv2d(convolution, output_tile_size, tiled_output_size);
       return qnnp_status_success;
@@ -476,12 +646,13 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
       const size_t indirection_buffer_size = sizeof(void*) * batch_size * output_height * step_height;
 
       const void** indirection_buffer =
-        (const void**) realloc(convolution->indirection_buffer, indirection_buffer_size);
+        (const void**) qnnp_operator_reallocate(convolution, convolution->indirection_buffer, indirection_buffer_size);
       if (indirection_buffer == NULL) {
         qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
         return qnnp_status_out_of_memory;
       }
       convolution->indirection_buffer = indirection_buffer;
+      convolution->indirection_buffer_size = indirection_buffer_size;
 
       qnnp_indirection_init_dwconv2d(convolution, 0, step_height, step_width);
       return qnnp_status_success;
@@ -490,3 +661,120 @@ enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
       QNNP_UNREACHABLE;
   }
 }
+
+enum qnnp_status qnnp_setup_convolution2d_nhwc_q8(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convolution2d_nhwc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (convolution->conv_output_type != qnnp_conv_output_type_quint8) {
+    qnnp_log_error("failed to setup convolution: operator was not created with quantized 8-bit output");
+    return qnnp_status_invalid_parameter;
+  }
+
+  return setup_convolution2d_nhwc(
+    convolution, batch_size, input_height, input_width,
+    input, input_pixel_stride, output, output_pixel_stride);
+}
+
+enum qnnp_status qnnp_setup_convolution2d_nhwc_q8_s32(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    int32_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convolution2d_nhwc_q8_s32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (convolution->conv_output_type != qnnp_conv_output_type_int32) {
+    qnnp_log_error("failed to setup convolution: operator was not created with 32-bit integer output");
+    return qnnp_status_invalid_parameter;
+  }
+
+  return setup_convolution2d_nhwc(
+    convolution, batch_size, input_height, input_width,
+    input, input_pixel_stride, output, output_pixel_stride);
+}
+
+enum qnnp_status qnnp_setup_convolution2d_nhwc_q8_f32(
+    qnnp_operator_t convolution,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    float* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_convolution2d_nhwc_q8_f32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (convolution->conv_output_type != qnnp_conv_output_type_float32) {
+    qnnp_log_error("failed to setup convolution: operator was not created with fp32 output");
+    return qnnp_status_invalid_parameter;
+  }
+
+  return setup_convolution2d_nhwc(
+    convolution, batch_size, input_height, input_width,
+    input, input_pixel_stride, output, output_pixel_stride);
+}
+
+enum qnnp_status qnnp_fold_constant_pad_into_convolution2d_nhwc_q8(
+    const size_t pre_paddings[4],
+    const size_t post_paddings[4],
+    uint8_t padding_value,
+    uint8_t input_zero_point,
+    uint32_t* input_padding_top,
+    uint32_t* input_padding_right,
+    uint32_t* input_padding_bottom,
+    uint32_t* input_padding_left)
+{
+  if (pre_paddings[0] != 0 || post_paddings[0] != 0 || pre_paddings[3] != 0 || post_paddings[3] != 0) {
+    qnnp_log_info(
+      "constant pad is not folded into convolution: it pads batch or channel dimensions");
+    return qnnp_status_unsupported_parameter;
+  }
+
+  if (padding_value != input_zero_point) {
+    qnnp_log_info(
+      "constant pad is not folded into convolution: padding value %" PRIu8 " differs from input zero point %" PRIu8,
+      padding_value, input_zero_point);
+    return qnnp_status_unsupported_parameter;
+  }
+
+  const uint64_t padding_top = (uint64_t) *input_padding_top + (uint64_t) pre_paddings[1];
+  const uint64_t padding_bottom = (uint64_t) *input_padding_bottom + (uint64_t) post_paddings[1];
+  const uint64_t padding_left = (uint64_t) *input_padding_left + (uint64_t) pre_paddings[2];
+  const uint64_t padding_right = (uint64_t) *input_padding_right + (uint64_t) post_paddings[2];
+  if ((padding_top | padding_bottom | padding_left | padding_right) > UINT32_MAX) {
+    qnnp_log_info("constant pad is not folded into convolution: combined padding overflows");
+    return qnnp_status_unsupported_parameter;
+  }
+
+  *input_padding_top = (uint32_t) padding_top;
+  *input_padding_right = (uint32_t) padding_right;
+  *input_padding_bottom = (uint32_t) padding_bottom;
+  *input_padding_left = (uint32_t) padding_left;
+  return qnnp_status_success;
+}
@@ -14,6 +14,7 @@
 #include <math.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/requantization.h>
 #include <qnnpack/log.h>
@@ -128,24 +129,26 @@ enum qnnp_status qnnp_create_deconvolution2d_nhwc_q8(
 
   status = qnnp_status_out_of_memory;
 
-  deconvolution = calloc(1, sizeof(struct qnnp_operator));
+  deconvolution = qnnp_allocate_operator();
   if (deconvolution == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
   }
 
-  const uint32_t nr = qnnp_params.q8conv.nr;
-  const uint32_t kr = qnnp_params.q8conv.kr;
+  deconvolution->ukernel.q8conv = qnnp_params.q8conv;
+  const uint32_t nr = deconvolution->ukernel.q8conv.nr;
+  const uint32_t kr = deconvolution->ukernel.q8conv.kr;
 
   const uint32_t n_stride = (group_output_channels + (nr - 1)) & -nr;
   const uint32_t k_stride = (group_input_channels + (kr - 1)) & -kr;
   const uint32_t kernel_size = kernel_height * kernel_width;
   const size_t packed_group_weights_size = (sizeof(uint8_t) * kernel_size * k_stride + sizeof(int32_t)) * n_stride;
-  deconvolution->packed_weights = malloc(packed_group_weights_size * groups);
+  deconvolution->packed_weights = qnnp_operator_allocate_weights(deconvolution, packed_group_weights_size * groups);
   if (deconvolution->packed_weights == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_group_weights_size * groups);
     goto error;
   }
+  deconvolution->packed_weights_size = packed_group_weights_size * groups;
   memset(deconvolution->packed_weights, kernel_zero_point, packed_group_weights_size * groups);
 
   for (uint32_t group = 0; group < groups; group++) {
@@ -165,13 +168,14 @@ enum qnnp_status qnnp_create_deconvolution2d_nhwc_q8(
     zero_offset = 8;
   }
 
-  void* zero_buffer = malloc(zero_size);
+  void* zero_buffer = qnnp_operator_allocate(deconvolution, zero_size);
   if (zero_buffer == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for zero padding", zero_size);
     goto error;
   }
   memset(zero_buffer, input_zero_point, zero_size);
   deconvolution->zero_buffer = zero_buffer;
+  deconvolution->zero_buffer_size = zero_size;
   deconvolution->zero_pointer = (void*) ((uintptr_t) zero_buffer + zero_offset);
 
   deconvolution->input_padding_top = input_padding_top;
@@ -191,6 +195,7 @@ enum qnnp_status qnnp_create_deconvolution2d_nhwc_q8(
   deconvolution->group_input_channels = group_input_channels;
   deconvolution->group_output_channels = group_output_channels;
 
+  deconvolution->input_zero_point = input_zero_point;
   deconvolution->kernel_zero_point = kernel_zero_point;
 
   deconvolution->conv_quantization_params =
@@ -199,6 +204,7 @@ enum qnnp_status qnnp_create_deconvolution2d_nhwc_q8(
       deconvolution_scale, output_zero_point, output_min, output_max);
 
   deconvolution->ukernel_type = qnnp_ukernel_type_conv;
+  deconvolution->transposed = true;
   deconvolution->format = qnnp_format_quint8;
 
   *deconvolution_out = deconvolution;
@@ -260,16 +266,17 @@ enum qnnp_status qnnp_setup_deconvolution2d_nhwc_q8(
 
   const size_t groups = deconvolution->groups;
   const size_t output_size = output_height * output_width;
-  const size_t output_tile_size = qnnp_params.q8conv.mr;
+  const size_t output_tile_size = deconvolution->ukernel.q8conv.mr;
   const size_t tiled_output_size = round_up(output_size, output_tile_size);
   const size_t indirection_buffer_size = sizeof(void*) * batch_size * groups * tiled_output_size * kernel_size;
 
-  const void** indirection_buffer = (const void**) realloc(deconvolution->indirection_buffer, indirection_buffer_size);
+  const void** indirection_buffer = (const void**) qnnp_operator_reallocate(deconvolution, deconvolution->indirection_buffer, indirection_buffer_size);
   if (indirection_buffer == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
     return qnnp_status_out_of_memory;
   }
   deconvolution->indirection_buffer = indirection_buffer;
+  deconvolution->indirection_buffer_size = indirection_buffer_size;
 
   qnnp_indirection_init_deconv2d(deconvolution, output_tile_size, tiled_output_size);
 
@@ -14,6 +14,8 @@
 #include <math.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/compute.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/requantization.h>
 #include <qnnpack/log.h>
@@ -22,7 +24,7 @@
 #include <qnnpack/params.h>
 
 
-enum qnnp_status qnnp_create_fully_connected_nc_q8(
+static enum qnnp_status create_fully_connected_nc_q8(
     size_t input_channels,
     size_t output_channels,
     uint8_t input_zero_point,
@@ -31,22 +33,15 @@ enum qnnp_status qnnp_create_fully_connected_nc_q8(
     float kernel_scale,
     const uint8_t* kernel,
     const int32_t* bias,
+    enum qnnp_conv_output_type output_type,
     uint8_t output_zero_point,
     float output_scale,
     uint8_t output_min,
     uint8_t output_max,
-    uint32_t flags,
     qnnp_operator_t* fully_connected_out)
 {
   qnnp_operator_t fully_connected = NULL;
-  enum qnnp_status status = qnnp_status_uninitialized;
-
-  if (!qnnp_params.initialized) {
-    qnnp_log_error("qnnp_create_fully_connected_nc_q8 failed because QNNPACK is not properly initialized");
-    goto error;
-  }
-
-  status = qnnp_status_invalid_parameter;
+  enum qnnp_status status = qnnp_status_invalid_parameter;
 
   if (input_scale <= 0.0f || !isnormal(input_scale)) {
     qnnp_log_error(
@@ -60,7 +55,7 @@ enum qnnp_status qnnp_create_fully_connected_nc_q8(
     goto error;
   }
 
-  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+  if (output_type == qnnp_conv_output_type_quint8 && (output_scale <= 0.0f || !isnormal(output_scale))) {
     qnnp_log_error(
       "failed to create fully connected operator with %.7g output scale: scale must be finite and positive", output_scale);
     goto error;
@@ -69,7 +64,7 @@ enum qnnp_status qnnp_create_fully_connected_nc_q8(
   status = qnnp_status_unsupported_parameter;
 
   const float requantization_scale = input_scale * kernel_scale / output_scale;
-  if (requantization_scale >= 1.0f) {
+  if (output_type == qnnp_conv_output_type_quint8 && requantization_scale >= 1.0f) {
     qnnp_log_error(
       "failed to create fully connected operator with %.7g input scale, %.7g kernel scale, and %.7g output scale: "
       "requantization scale %.7g is greater or equal to 1.0",
@@ -79,25 +74,42 @@ enum qnnp_status qnnp_create_fully_connected_nc_q8(
 
   status = qnnp_status_out_of_memory;
 
-  fully_connected = calloc(1, sizeof(struct qnnp_operator));
+  fully_connected = qnnp_allocate_operator();
   if (fully_connected == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
   }
 
-  const uint32_t nr = qnnp_params.q8conv.nr;
-  const uint32_t kr = qnnp_params.q8conv.kr;
+  uint32_t nr = 0, kr = 0;
+  switch (output_type) {
+    case qnnp_conv_output_type_quint8:
+      fully_connected->ukernel.q8conv = qnnp_params.q8conv;
+      nr = qnnp_params.q8conv.nr;
+      kr = qnnp_params.q8conv.kr;
+      break;
+    case qnnp_conv_output_type_int32:
+      fully_connected->ukernel.q8conv_i32 = qnnp_params.q8conv_i32;
+      nr = qnnp_params.q8conv_i32.nr;
+      kr = qnnp_params.q8conv_i32.kr;
+      break;
+    case qnnp_conv_output_type_float32:
+      fully_connected->ukernel.q8conv_f32 = qnnp_params.q8conv_f32;
+      nr = qnnp_params.q8conv_f32.nr;
+      kr = qnnp_params.q8conv_f32.kr;
+      break;
+  }
 
   const uint32_t n_stride = (output_channels + (nr - 1)) & -nr;
   const uint32_t k_stride = (input_channels + (kr - 1)) & -kr;
 
-  fully_connected->packed_weights = malloc(n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+  const size_t packed_weights_size = n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t));
+  fully_connected->packed_weights = qnnp_operator_allocate_weights(fully_connected, packed_weights_size);
   if (fully_connected->packed_weights == NULL) {
-    qnnp_log_error("failed to allocate %zu bytes for packed weights",
-      n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+    qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
     goto error;
   }
-  memset(fully_connected->packed_weights, kernel_zero_point, n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t)));
+  fully_connected->packed_weights_size = packed_weights_size;
+  memset(fully_connected->packed_weights, kernel_zero_point, packed_weights_size);
 
   pack_q8gemm_w(
     output_channels, input_channels,
@@ -110,15 +122,30 @@ enum qnnp_status qnnp_create_fully_connected_nc_q8(
   fully_connected->group_input_channels = input_channels;
   fully_connected->group_output_channels = output_channels;
 
+  fully_connected->input_zero_point = input_zero_point;
   fully_connected->kernel_zero_point = kernel_zero_point;
 
-  fully_connected->conv_quantization_params =
-    qnnp_compute_conv_quantization_params(
-      input_zero_point, kernel_zero_point,
-      requantization_scale, output_zero_point, output_min, output_max);
+  switch (output_type) {
+    case qnnp_conv_output_type_quint8:
+      fully_connected->conv_quantization_params =
+        qnnp_compute_conv_quantization_params(
+          input_zero_point, kernel_zero_point,
+          requantization_scale, output_zero_point, output_min, output_max);
+      fully_connected->format = qnnp_format_quint8;
+      break;
+    case qnnp_conv_output_type_int32:
+      fully_connected->kernel_zero_point_params = qnnp_compute_kernel_zero_point_params(kernel_zero_point);
+      fully_connected->format = qnnp_format_quint8_with_wide_output;
+      break;
+    case qnnp_conv_output_type_float32:
+      fully_connected->conv_dequantization_params =
+        qnnp_compute_conv_dequantization_params(kernel_zero_point, input_scale * kernel_scale);
+      fully_connected->format = qnnp_format_quint8_with_wide_output;
+      break;
+  }
 
   fully_connected->ukernel_type = qnnp_ukernel_type_gemm;
-  fully_connected->format = qnnp_format_quint8;
+  fully_connected->conv_output_type = output_type;
 
   *fully_connected_out = fully_connected;
   return qnnp_status_success;
@@ -128,19 +155,97 @@ error:
   return status;
 }
 
-enum qnnp_status qnnp_setup_fully_connected_nc_q8(
+enum qnnp_status qnnp_create_fully_connected_nc_q8(
+    size_t input_channels,
+    size_t output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* fully_connected_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_fully_connected_nc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_fully_connected_nc_q8(
+    input_channels, output_channels,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    kernel, bias,
+    qnnp_conv_output_type_quint8,
+    output_zero_point, output_scale, output_min, output_max,
+    fully_connected_out);
+}
+
+enum qnnp_status qnnp_create_fully_connected_nc_q8_s32(
+    size_t input_channels,
+    size_t output_channels,
+    uint8_t input_zero_point,
+    uint8_t kernel_zero_point,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    qnnp_operator_t* fully_connected_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_fully_connected_nc_q8_s32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_fully_connected_nc_q8(
+    input_channels, output_channels,
+    input_zero_point, 1.0f /* input scale */,
+    kernel_zero_point, 1.0f /* kernel scale */,
+    kernel, bias,
+    qnnp_conv_output_type_int32,
+    0 /* output zero point */, 1.0f /* output scale */, 0 /* output min */, 255 /* output max */,
+    fully_connected_out);
+}
+
+enum qnnp_status qnnp_create_fully_connected_nc_q8_f32(
+    size_t input_channels,
+    size_t output_channels,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const int32_t* bias,
+    uint32_t flags,
+    qnnp_operator_t* fully_connected_out)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_fully_connected_nc_q8_f32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  return create_fully_connected_nc_q8(
+    input_channels, output_channels,
+    input_zero_point, input_scale,
+    kernel_zero_point, kernel_scale,
+    kernel, bias,
+    qnnp_conv_output_type_float32,
+    0 /* output zero point */, 1.0f /* output scale */, 0 /* output min */, 255 /* output max */,
+    fully_connected_out);
+}
+
+static enum qnnp_status setup_fully_connected_nc(
     qnnp_operator_t convolution,
     size_t batch_size,
     const uint8_t* input,
     size_t input_stride,
-    uint8_t* output,
+    void* output,
     size_t output_stride)
 {
-  if (!qnnp_params.initialized) {
-    qnnp_log_error("qnnp_setup_fully_connected_nc_q8 failed because QNNPACK is not properly initialized");
-    return qnnp_status_uninitialized;
-  }
-
   if (batch_size == 0) {
     qnnp_log_error("failed to setup fully connected operator with batch size %zu: batch size must be non-zero", batch_size);
     return qnnp_status_invalid_parameter;
@@ -159,3 +264,223 @@ enum qnnp_status qnnp_setup_fully_connected_nc_q8(
 
   return qnnp_status_success;
 }
+
+enum qnnp_status qnnp_setup_fully_connected_nc_q8(
+    qnnp_operator_t fully_connected,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_fully_connected_nc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (fully_connected->conv_output_type != qnnp_conv_output_type_quint8) {
+    qnnp_log_error("failed to setup fully connected operator: operator was not created with quantized 8-bit output");
+    return qnnp_status_invalid_parameter;
+  }
+
+  return setup_fully_connected_nc(fully_connected, batch_size, input, input_stride, output, output_stride);
+}
+
+enum qnnp_status qnnp_setup_fully_connected_nc_q8_s32(
+    qnnp_operator_t fully_connected,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    int32_t* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_fully_connected_nc_q8_s32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (fully_connected->conv_output_type != qnnp_conv_output_type_int32) {
+    qnnp_log_error("failed to setup fully connected operator: operator was not created with 32-bit integer output");
+    return qnnp_status_invalid_parameter;
+  }
+
+  return setup_fully_connected_nc(fully_connected, batch_size, input, input_stride, output, output_stride);
+}
+
+enum qnnp_status qnnp_setup_fully_connected_nc_q8_f32(
+    qnnp_operator_t fully_connected,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    float* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_fully_connected_nc_q8_f32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (fully_connected->conv_output_type != qnnp_conv_output_type_float32) {
+    qnnp_log_error("failed to setup fully connected operator: operator was not created with fp32 output");
+    return qnnp_status_invalid_parameter;
+  }
+
+  return setup_fully_connected_nc(fully_connected, batch_size, input, input_stride, output, output_stride);
+}
+
+enum qnnp_status qnnp_create_dynamic_fully_connected_nc_f32(
+    size_t input_channels,
+    size_t output_channels,
+    uint8_t kernel_zero_point,
+    float kernel_scale,
+    const uint8_t* kernel,
+    const float* bias,
+    uint32_t flags,
+    qnnp_operator_t* fully_connected_out)
+{
+  qnnp_operator_t fully_connected = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_dynamic_fully_connected_nc_f32 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (input_channels == 0) {
+    qnnp_log_error(
+      "failed to create dynamic fully connected operator with %zu input channels: number of channels must be non-zero",
+      input_channels);
+    goto error;
+  }
+
+  if (output_channels == 0) {
+    qnnp_log_error(
+      "failed to create dynamic fully connected operator with %zu output channels: number of channels must be non-zero",
+      output_channels);
+    goto error;
+  }
+
+  if (kernel_scale <= 0.0f || !isnormal(kernel_scale)) {
+    qnnp_log_error(
+      "failed to create dynamic fully connected operator with %.7g kernel scale: scale must be finite and positive",
+      kernel_scale);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  /* 32-bit accumulators of the micro-kernel hold the sum of input_channels products of at most 255 * 255 */
+  if (input_channels > (size_t) (INT32_MAX / (255 * 255))) {
+    qnnp_log_error(
+      "failed to create dynamic fully connected operator with %zu input channels: "
+      "number of input channels must not exceed %d", input_channels, INT32_MAX / (255 * 255));
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  fully_connected = qnnp_allocate_operator();
+  if (fully_connected == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  fully_connected->ukernel.q8conv_i32 = qnnp_params.q8conv_i32;
+  const uint32_t nr = fully_connected->ukernel.q8conv_i32.nr;
+  const uint32_t kr = fully_connected->ukernel.q8conv_i32.kr;
+
+  const uint32_t n_stride = (output_channels + (nr - 1)) & -nr;
+  const uint32_t k_stride = (input_channels + (kr - 1)) & -kr;
+
+  /*
+   * Packed weights are followed by per-channel sums of the kernel less its zero point, which correct for the zero
+   * point of each dynamically quantized input row, and by the fp32 bias.
+   */
+  const size_t packed_weights_size = n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t));
+  const size_t packed_size = packed_weights_size + n_stride * (sizeof(int32_t) + sizeof(float));
+  fully_connected->packed_weights = qnnp_operator_allocate_weights(fully_connected, packed_size);
+  if (fully_connected->packed_weights == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_size);
+    goto error;
+  }
+  fully_connected->packed_weights_size = packed_size;
+  memset(fully_connected->packed_weights, kernel_zero_point, packed_weights_size);
+  int32_t* kernel_sums = (int32_t*) ((uintptr_t) fully_connected->packed_weights + packed_weights_size);
+  float* packed_bias = (float*) (kernel_sums + n_stride);
+  memset(kernel_sums, 0, n_stride * (sizeof(int32_t) + sizeof(float)));
+
+  /* Input zero point is chosen per row at run time, so the packed 32-bit bias (kernel_sums is still zero) is zero */
+  pack_q8gemm_w(
+    output_channels, input_channels,
+    nr, nr, kr,
+    0 /* input zero point */, kernel_zero_point,
+    kernel, kernel_sums,
+    fully_connected->packed_weights);
+
+  for (size_t n = 0; n < output_channels; n++) {
+    int32_t kernel_sum = 0;
+    for (size_t k = 0; k < input_channels; k++) {
+      kernel_sum += (int32_t) kernel[n * input_channels + k] - (int32_t) kernel_zero_point;
+    }
+    kernel_sums[n] = kernel_sum;
+    packed_bias[n] = bias[n];
+  }
+
+  fully_connected->groups = 1;
+  fully_connected->group_input_channels = input_channels;
+  fully_connected->group_output_channels = output_channels;
+
+  fully_connected->kernel_zero_point = kernel_zero_point;
+  fully_connected->kernel_scale = kernel_scale;
+
+  fully_connected->ukernel_type = qnnp_ukernel_type_dynamic_gemm;
+  fully_connected->format = qnnp_format_float32_with_quint8_kernel;
+
+  *fully_connected_out = fully_connected;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(fully_connected);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_dynamic_fully_connected_nc_f32(
+    qnnp_operator_t fully_connected,
+    size_t batch_size,
+    const float* input,
+    size_t input_stride,
+    float* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_dynamic_fully_connected_nc_f32 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error(
+      "failed to setup dynamic fully connected operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  const size_t k_stride = round_up(fully_connected->group_input_channels, fully_connected->ukernel.q8conv_i32.kr);
+  struct qnnp_dynamic_gemm_scratch_layout layout;
+  qnnp_compute_dynamic_gemm_scratch_layout(batch_size, k_stride, &layout);
+  void* a_sum = qnnp_operator_reallocate(fully_connected, fully_connected->a_sum, layout.size);
+  if (a_sum == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for quantized input rows", layout.size);
+    return qnnp_status_out_of_memory;
+  }
+  fully_connected->a_sum = a_sum;
+  fully_connected->a_sum_size = layout.size;
+
+  fully_connected->batch_size = batch_size;
+  fully_connected->input = input;
+  fully_connected->input_pixel_stride = input_stride;
+  fully_connected->output = output;
+  fully_connected->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
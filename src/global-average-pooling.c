@@ -13,6 +13,7 @@
 #include <stdlib.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/requantization.h>
 #include <qnnpack/log.h>
@@ -71,18 +72,19 @@ enum qnnp_status qnnp_create_global_average_pooling_nwc_q8(
 
   status = qnnp_status_out_of_memory;
 
-  global_average_pooling_op = calloc(1, sizeof(struct qnnp_operator));
+  global_average_pooling_op = qnnp_allocate_operator();
   if (global_average_pooling_op == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
   }
 
-  void* zero_buffer = calloc(channels, sizeof(uint8_t));
+  void* zero_buffer = qnnp_operator_allocate_zero(global_average_pooling_op, channels * sizeof(uint8_t));
   if (zero_buffer == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for zero padding", channels * sizeof(uint8_t));
     goto error;
   }
   global_average_pooling_op->zero_buffer = zero_buffer;
+  global_average_pooling_op->zero_buffer_size = channels * sizeof(uint8_t);
   global_average_pooling_op->zero_pointer = zero_buffer;
 
   global_average_pooling_op->channels = channels;
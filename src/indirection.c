@@ -6,6 +6,7 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <math.h>
 #include <stddef.h>
 
 #include <fxdiv.h>
@@ -259,3 +260,114 @@ void qnnp_indirection_init_maxpool2d(
     }
   }
 }
+
+static inline float compute_resize_coordinate(
+  size_t output_index,
+  size_t input_size,
+  size_t output_size,
+  uint32_t flags)
+{
+  if (flags & QNNP_FLAG_ALIGN_CORNERS) {
+    if (output_size == 1) {
+      return 0.0f;
+    }
+    return (float) output_index * ((float) (input_size - 1) / (float) (output_size - 1));
+  } else {
+    const float scale = (float) input_size / (float) output_size;
+    if (flags & QNNP_FLAG_TENSORFLOW_LEGACY_MODE) {
+      return (float) output_index * scale;
+    }
+    const float coordinate = ((float) output_index + 0.5f) * scale - 0.5f;
+    return coordinate < 0.0f ? 0.0f : coordinate;
+  }
+}
+
+static inline size_t compute_nearest_index(
+  size_t output_index,
+  size_t input_size,
+  size_t output_size,
+  uint32_t flags)
+{
+  size_t input_index;
+  if (flags & QNNP_FLAG_ALIGN_CORNERS) {
+    input_index = (size_t) lrintf(compute_resize_coordinate(output_index, input_size, output_size, flags));
+  } else if (flags & QNNP_FLAG_TENSORFLOW_LEGACY_MODE) {
+    input_index = (size_t) compute_resize_coordinate(output_index, input_size, output_size, flags);
+  } else {
+    input_index = (size_t) (((float) output_index + 0.5f) * ((float) input_size / (float) output_size));
+  }
+  return min(input_index, input_size - 1);
+}
+
+/**
+ * Each output pixel gets 4 pointers to its top-left, top-right, bottom-left and bottom-right input pixels, and a pair
+ * of horizontal and vertical interpolation weights in Q11 format. Weights do not depend on the image in the batch, and
+ * are written to packed_weights only when the buffer is initialized from the first image.
+ */
+void qnnp_indirection_init_resize_bilinear2d(
+  qnnp_operator_t op,
+  size_t batch_start)
+{
+  const void** indirection_buffer = op->indirection_buffer;
+  int16_t* weights                = op->packed_weights;
+  const void* input               = op->input;
+  const size_t input_pixel_stride = op->input_pixel_stride;
+  const size_t batch_size         = op->batch_size;
+  const size_t input_height       = op->input_height;
+  const size_t input_width        = op->input_width;
+  const size_t output_height      = op->output_height;
+  const size_t output_width       = op->output_width;
+  const uint32_t flags            = op->flags;
+
+  for (size_t output_y = 0; output_y < output_height; output_y++) {
+    const float input_y = compute_resize_coordinate(output_y, input_height, output_height, flags);
+    const size_t input_top = min((size_t) input_y, input_height - 1);
+    const size_t input_bottom = min(input_top + 1, input_height - 1);
+    const int16_t alpha_v = (int16_t) lrintf((input_y - (float) input_top) * 2048.0f);
+    for (size_t output_x = 0; output_x < output_width; output_x++) {
+      const float input_x = compute_resize_coordinate(output_x, input_width, output_width, flags);
+      const size_t input_left = min((size_t) input_x, input_width - 1);
+      const size_t input_right = min(input_left + 1, input_width - 1);
+      if (batch_start == 0) {
+        const size_t weights_index = (output_y * output_width + output_x) * 2;
+        weights[weights_index] = (int16_t) lrintf((input_x - (float) input_left) * 2048.0f);
+        weights[weights_index + 1] = alpha_v;
+      }
+      for (size_t image = batch_start; image < batch_size; image++) {
+        const size_t index = ((image * output_height + output_y) * output_width + output_x) * 4;
+        const size_t input_row_top = (image * input_height + input_top) * input_width;
+        const size_t input_row_bottom = (image * input_height + input_bottom) * input_width;
+        indirection_buffer[index + 0] = input + (input_row_top + input_left) * input_pixel_stride;
+        indirection_buffer[index + 1] = input + (input_row_top + input_right) * input_pixel_stride;
+        indirection_buffer[index + 2] = input + (input_row_bottom + input_left) * input_pixel_stride;
+        indirection_buffer[index + 3] = input + (input_row_bottom + input_right) * input_pixel_stride;
+      }
+    }
+  }
+}
+
+void qnnp_indirection_init_resize_nearest2d(
+  qnnp_operator_t op,
+  size_t batch_start)
+{
+  const void** indirection_buffer = op->indirection_buffer;
+  const void* input               = op->input;
+  const size_t input_pixel_stride = op->input_pixel_stride;
+  const size_t batch_size         = op->batch_size;
+  const size_t input_height       = op->input_height;
+  const size_t input_width        = op->input_width;
+  const size_t output_height      = op->output_height;
+  const size_t output_width       = op->output_width;
+  const uint32_t flags            = op->flags;
+
+  for (size_t output_y = 0; output_y < output_height; output_y++) {
+    const size_t input_y = compute_nearest_index(output_y, input_height, output_height, flags);
+    for (size_t output_x = 0; output_x < output_width; output_x++) {
+      const size_t input_x = compute_nearest_index(output_x, input_width, output_width, flags);
+      for (size_t image = batch_start; image < batch_size; image++) {
+        const size_t index = (image * output_height + output_y) * output_width + output_x;
+        indirection_buffer[index] = input + ((image * input_height + input_y) * input_width + input_x) * input_pixel_stride;
+      }
+    }
+  }
+}
@@ -22,12 +22,21 @@
 #include <qnnpack/q8gavgpool.h>
 #include <qnnpack/q8gemm.h>
 #include <qnnpack/q8vadd.h>
+#include <qnnpack/q8vdequantize.h>
+#include <qnnpack/q8vmul.h>
+#include <qnnpack/q8vquantize.h>
+#include <qnnpack/srminmax.h>
 #include <qnnpack/u8clamp.h>
+#include <qnnpack/u8ibilinear.h>
 #include <qnnpack/u8lut32norm.h>
 #include <qnnpack/u8maxpool.h>
 #include <qnnpack/u8rmax.h>
+#include <qnnpack/u8rsum.h>
+#include <qnnpack/u8softargmax.h>
 #include <qnnpack/x8lut.h>
+#include <qnnpack/x8pad.h>
 #include <qnnpack/x8zip.h>
+#include <qnnpack/xtranspose.h>
 
 static pthread_once_t init_guard = PTHREAD_ONCE_INIT;
 
@@ -48,6 +57,20 @@ static void init(void) {
       .nr = 8,
       .kr = 1,
   };
+  qnnp_params.q8conv_i32 = (struct q8conv_i32_parameters) {
+      .gemm = q8gemm_i32_ukernel_4x8__neon,
+      .conv = q8conv_i32_ukernel_4x8__neon,
+      .mr = 4,
+      .nr = 8,
+      .kr = 1,
+  };
+  qnnp_params.q8conv_f32 = (struct q8conv_f32_parameters) {
+      .gemm = q8gemm_f32_ukernel_4x8__neon,
+      .conv = q8conv_f32_ukernel_4x8__neon,
+      .mr = 4,
+      .nr = 8,
+      .kr = 1,
+  };
   qnnp_params.q8conv_xzp = (struct q8conv_xzp_parameters) {
       .gemm = q8gemm_xzp_ukernel_4x8c2__aarch32_neon,
       .mr = 4,
@@ -86,6 +109,10 @@ static void init(void) {
       .m = 4,
   };
   qnnp_params.q8vadd = q8vadd_ukernel__neon;
+  qnnp_params.q8vaddc = q8vaddc_ukernel__neon;
+  qnnp_params.q8vmul = q8vmul_ukernel__neon;
+  qnnp_params.q8vquantize = q8vquantize_ukernel__neon;
+  qnnp_params.q8vdequantize = q8vdequantize_ukernel__neon;
   qnnp_params.q8gavgpool = (struct q8gavgpool_parameters) {
       .ltnr = q8gavgpool_ukernel_up8xm__neon,
       .genr_lemr = q8gavgpool_ukernel_up8x7__neon,
@@ -116,8 +143,15 @@ static void init(void) {
   };
   qnnp_params.u8clamp = u8clamp_ukernel__neon;
   qnnp_params.u8rmax = u8rmax_ukernel__neon;
+  qnnp_params.u8rsum = u8rsum_ukernel__neon;
+  qnnp_params.srminmax = srminmax_ukernel__neon;
+  qnnp_params.u8softargmax = u8softargmax_ukernel__neon;
+  qnnp_params.u8ibilinear = u8ibilinear_ukernel_c8__neon;
   qnnp_params.u8lut32norm = u8lut32norm_ukernel__scalar;
-  qnnp_params.x8lut = x8lut_ukernel__scalar;
+  qnnp_params.x8lut = x8lut_ukernel__neon;
+  qnnp_params.x8pad = x8pad_ukernel__neon;
+  qnnp_params.x8transpose = x8transpose_ukernel__neon;
+  qnnp_params.x32transpose = x32transpose_ukernel__neon;
 #elif CPUINFO_ARCH_ARM64
   qnnp_params.q8conv = (struct q8conv_parameters) {
       .gemm = q8gemm_ukernel_8x8__aarch64_neon,
@@ -126,6 +160,20 @@ static void init(void) {
       .nr = 8,
       .kr = 1,
   };
+  qnnp_params.q8conv_i32 = (struct q8conv_i32_parameters) {
+      .gemm = q8gemm_i32_ukernel_4x8__neon,
+      .conv = q8conv_i32_ukernel_4x8__neon,
+      .mr = 4,
+      .nr = 8,
+      .kr = 1,
+  };
+  qnnp_params.q8conv_f32 = (struct q8conv_f32_parameters) {
+      .gemm = q8gemm_f32_ukernel_4x8__neon,
+      .conv = q8conv_f32_ukernel_4x8__neon,
+      .mr = 4,
+      .nr = 8,
+      .kr = 1,
+  };
   qnnp_params.q8conv_xzp = (struct q8conv_xzp_parameters) {
       .kthreshold = SIZE_MAX,
   };
@@ -138,6 +186,10 @@ static void init(void) {
       .cr = 8,
   };
   qnnp_params.q8vadd = q8vadd_ukernel__neon;
+  qnnp_params.q8vaddc = q8vaddc_ukernel__neon;
+  qnnp_params.q8vmul = q8vmul_ukernel__neon;
+  qnnp_params.q8vquantize = q8vquantize_ukernel__neon;
+  qnnp_params.q8vdequantize = q8vdequantize_ukernel__neon;
   qnnp_params.q8gavgpool = (struct q8gavgpool_parameters) {
       .ltnr = q8gavgpool_ukernel_up8xm__neon,
       .genr_lemr = q8gavgpool_ukernel_up8x7__neon,
@@ -168,8 +220,15 @@ static void init(void) {
   };
   qnnp_params.u8clamp = u8clamp_ukernel__neon;
   qnnp_params.u8rmax = u8rmax_ukernel__neon;
+  qnnp_params.u8rsum = u8rsum_ukernel__neon;
+  qnnp_params.srminmax = srminmax_ukernel__neon;
+  qnnp_params.u8softargmax = u8softargmax_ukernel__neon;
+  qnnp_params.u8ibilinear = u8ibilinear_ukernel_c8__neon;
   qnnp_params.u8lut32norm = u8lut32norm_ukernel__scalar;
-  qnnp_params.x8lut = x8lut_ukernel__scalar;
+  qnnp_params.x8lut = x8lut_ukernel__neon;
+  qnnp_params.x8pad = x8pad_ukernel__neon;
+  qnnp_params.x8transpose = x8transpose_ukernel__neon;
+  qnnp_params.x32transpose = x32transpose_ukernel__neon;
 #elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
   if (!cpuinfo_has_x86_sse2()) {
     qnnp_log_error("QNNPACK initialization failed: SSE2 is not supported");
@@ -182,6 +241,20 @@ static void init(void) {
       .nr = 4,
       .kr = 2,
   };
+  qnnp_params.q8conv_i32 = (struct q8conv_i32_parameters) {
+      .gemm = q8gemm_i32_ukernel_4x4c2__sse2,
+      .conv = q8conv_i32_ukernel_4x4c2__sse2,
+      .mr = 4,
+      .nr = 4,
+      .kr = 2,
+  };
+  qnnp_params.q8conv_f32 = (struct q8conv_f32_parameters) {
+      .gemm = q8gemm_f32_ukernel_4x4c2__sse2,
+      .conv = q8conv_f32_ukernel_4x4c2__sse2,
+      .mr = 4,
+      .nr = 4,
+      .kr = 2,
+  };
   qnnp_params.q8conv_xzp = (struct q8conv_xzp_parameters) {
       .kthreshold = SIZE_MAX,
   };
@@ -193,7 +266,24 @@ static void init(void) {
       .mpdw = q8dwconv_ukernel_mp8x25__sse2,
       .cr = 8,
   };
+  if (cpuinfo_has_x86_avx2()) {
+    qnnp_params.q8dw9 = (struct q8dwconv_up_parameters) {
+        .updw = q8dwconv_ukernel_up32x9__avx2,
+        .cr = 32,
+    };
+    qnnp_params.q8dw25 = (struct q8dwconv_mp_parameters) {
+        .mpdw = q8dwconv_ukernel_mp32x25__avx2,
+        .cr = 32,
+    };
+  }
   qnnp_params.q8vadd = q8vadd_ukernel__sse2;
+  qnnp_params.q8vaddc = q8vaddc_ukernel__sse2;
+  qnnp_params.q8vmul = q8vmul_ukernel__sse2;
+  if (cpuinfo_has_x86_avx2()) {
+    qnnp_params.q8vmul = q8vmul_ukernel__avx2;
+  }
+  qnnp_params.q8vquantize = q8vquantize_ukernel__sse2;
+  qnnp_params.q8vdequantize = q8vdequantize_ukernel__sse2;
   qnnp_params.q8gavgpool = (struct q8gavgpool_parameters) {
       .ltnr = q8gavgpool_ukernel_up8xm__sse2,
       .genr_lemr = q8gavgpool_ukernel_up8x7__sse2,
@@ -216,6 +306,30 @@ static void init(void) {
       .qr = 8,
       .kr = 16,
   };
+  if (cpuinfo_has_x86_avx2()) {
+    qnnp_params.q8gavgpool = (struct q8gavgpool_parameters) {
+        .ltnr = q8gavgpool_ukernel_up16xm__avx2,
+        .genr_lemr = q8gavgpool_ukernel_up16x7__avx2,
+        .genr_gtmr = q8gavgpool_ukernel_mp16x7p7q__avx2,
+        .mr = 7,
+        .nr = 16,
+    };
+    qnnp_params.q8avgpool = (struct q8avgpool_parameters) {
+        .ltkr = q8avgpool_ukernel_up16xm__avx2,
+        .gekr_lemr = q8avgpool_ukernel_up16x9__avx2,
+        .gekr_gtmr = q8avgpool_ukernel_mp16x9p8q__avx2,
+        .mr = 9,
+        .qr = 8,
+        .kr = 16,
+    };
+    qnnp_params.u8maxpool = (struct u8maxpool_parameters) {
+        .ltkr = u8maxpool_ukernel_sub32__avx2,
+        .gekr = u8maxpool_ukernel_32x9p8q__avx2,
+        .mr = 9,
+        .qr = 8,
+        .kr = 32,
+    };
+  }
   qnnp_params.x8zip = (struct x8zip_parameters) {
       .x2 = qnnp_x8zip_x2__sse2,
       .x3 = qnnp_x8zip_x3__sse2,
@@ -224,8 +338,24 @@ static void init(void) {
   };
   qnnp_params.u8clamp = u8clamp_ukernel__sse2;
   qnnp_params.u8rmax = u8rmax_ukernel__sse2;
+  qnnp_params.u8rsum = u8rsum_ukernel__sse2;
+  qnnp_params.srminmax = srminmax_ukernel__sse2;
+  qnnp_params.u8softargmax = u8softargmax_ukernel__sse2;
+  qnnp_params.u8ibilinear = u8ibilinear_ukernel_c8__sse2;
   qnnp_params.u8lut32norm = u8lut32norm_ukernel__scalar;
   qnnp_params.x8lut = x8lut_ukernel__scalar;
+  qnnp_params.x8pad = x8pad_ukernel__sse2;
+  qnnp_params.x8transpose = x8transpose_ukernel__sse2;
+  qnnp_params.x32transpose = x32transpose_ukernel__sse2;
+  if (cpuinfo_has_x86_ssse3()) {
+    qnnp_params.x8lut = x8lut_ukernel__ssse3;
+  }
+  if (cpuinfo_has_x86_avx2()) {
+    qnnp_params.u8lut32norm = u8lut32norm_ukernel__avx2;
+    qnnp_params.u8softargmax = u8softargmax_ukernel__avx2;
+    qnnp_params.u8ibilinear = u8ibilinear_ukernel_c16__avx2;
+    qnnp_params.x8lut = x8lut_ukernel__avx2;
+  }
 #else
   #error "Unsupported architecture"
 #endif
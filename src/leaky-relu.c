@@ -13,6 +13,7 @@
 #include <stdlib.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/log.h>
 
@@ -89,17 +90,18 @@ enum qnnp_status qnnp_create_leaky_relu_nc_q8(
 
   status = qnnp_status_out_of_memory;
 
-  leaky_relu_op = calloc(1, sizeof(struct qnnp_operator));
+  leaky_relu_op = qnnp_allocate_operator();
   if (leaky_relu_op == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
   }
 
-  leaky_relu_op->lookup_table = malloc(256 * sizeof(uint8_t));
+  leaky_relu_op->lookup_table = qnnp_operator_allocate(leaky_relu_op, 256 * sizeof(uint8_t));
   if (leaky_relu_op->lookup_table == NULL) {
     qnnp_log_error("failed to allocate 256 bytes for Leaky ReLU lookup table");
     goto error;
   }
+  leaky_relu_op->lookup_table_size = 256 * sizeof(uint8_t);
 
   uint8_t* lookup_table = leaky_relu_op->lookup_table;
   const float scaled_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+
+
+static enum qnnp_status allocate_lut_operator(
+    size_t channels,
+    qnnp_operator_t* lut_out)
+{
+  qnnp_operator_t lut_op = qnnp_allocate_operator();
+  if (lut_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    return qnnp_status_out_of_memory;
+  }
+  *lut_out = lut_op;
+
+  lut_op->lookup_table = qnnp_operator_allocate(lut_op, 256 * sizeof(uint8_t));
+  if (lut_op->lookup_table == NULL) {
+    qnnp_log_error("failed to allocate 256 bytes for LUT lookup table");
+    return qnnp_status_out_of_memory;
+  }
+  lut_op->lookup_table_size = 256 * sizeof(uint8_t);
+
+  lut_op->channels = channels;
+
+  lut_op->ukernel_type = qnnp_ukernel_type_lut;
+  lut_op->format = qnnp_format_quint8;
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_create_lut_nc_x8(
+    size_t channels,
+    const uint8_t* lookup_table,
+    uint32_t flags,
+    qnnp_operator_t* lut_out)
+{
+  qnnp_operator_t lut_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_lut_nc_x8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create LUT operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (lookup_table == NULL) {
+    qnnp_log_error("failed to create LUT operator: lookup table must be non-NULL");
+    goto error;
+  }
+
+  status = allocate_lut_operator(channels, &lut_op);
+  if (status != qnnp_status_success) {
+    goto error;
+  }
+
+  memcpy(lut_op->lookup_table, lookup_table, 256 * sizeof(uint8_t));
+
+  *lut_out = lut_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(lut_op);
+  return status;
+}
+
+enum qnnp_status qnnp_create_lut_nc_q8(
+    size_t channels,
+    qnnp_lut_function function,
+    void* function_context,
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* lut_out)
+{
+  qnnp_operator_t lut_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_lut_nc_q8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create LUT operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (function == NULL) {
+    qnnp_log_error("failed to create LUT operator: function must be non-NULL");
+    goto error;
+  }
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    qnnp_log_error(
+      "failed to create LUT operator with %.7g input scale: scale must be finite and positive", input_scale);
+    goto error;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    qnnp_log_error(
+      "failed to create LUT operator with %.7g output scale: scale must be finite and positive", output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    qnnp_log_error(
+      "failed to create LUT operator with [%" PRIu8 ", %" PRIu8 "] output range: range min must be below range max",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = allocate_lut_operator(channels, &lut_op);
+  if (status != qnnp_status_success) {
+    goto error;
+  }
+
+  uint8_t* lookup_table = lut_op->lookup_table;
+  const float scaled_min_less_zero_point = (float) ((int32_t) output_min - (int32_t) output_zero_point);
+  const float scaled_max_less_zero_point = (float) ((int32_t) output_max - (int32_t) output_zero_point);
+  for (int32_t i = 0; i < 256; i++) {
+    const float x = input_scale * (float) (i - (int32_t) (uint32_t) input_zero_point);
+    float y = function(x, function_context) / output_scale;
+    /* Negated comparison also maps NaN results to the lower end of the output range */
+    if (!(y >= scaled_min_less_zero_point)) {
+      y = scaled_min_less_zero_point;
+    }
+    if (y > scaled_max_less_zero_point) {
+      y = scaled_max_less_zero_point;
+    }
+    lookup_table[(uint32_t) i] = (uint8_t) (lrintf(y) + (long) output_zero_point);
+  }
+
+  *lut_out = lut_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(lut_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_lut_nc_x8(
+    qnnp_operator_t lut,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output,
+    size_t output_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_lut_nc_x8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup LUT operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  lut->batch_size = batch_size;
+  lut->input = input;
+  lut->input_pixel_stride = input_stride;
+  lut->output = output;
+  lut->output_pixel_stride = output_stride;
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_set_operator_output_lut(
+    qnnp_operator_t op,
+    const uint8_t* lookup_table)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_set_operator_output_lut failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (op == NULL) {
+    qnnp_log_error("failed to set operator output lookup table: operator is NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  switch (op->ukernel_type) {
+    case qnnp_ukernel_type_gemm:
+    case qnnp_ukernel_type_xzp_gemm:
+    case qnnp_ukernel_type_conv:
+    case qnnp_ukernel_type_dwconv:
+      break;
+    default:
+      qnnp_log_error("failed to set operator output lookup table: operator does not support fused output lookup");
+      return qnnp_status_unsupported_parameter;
+  }
+
+  if (op->conv_output_type != qnnp_conv_output_type_quint8) {
+    qnnp_log_error("failed to set operator output lookup table: operators with 32-bit output are not requantized");
+    return qnnp_status_unsupported_parameter;
+  }
+
+  if (lookup_table == NULL) {
+    qnnp_operator_deallocate(op, op->lookup_table);
+    op->lookup_table = NULL;
+    op->lookup_table_size = 0;
+    return qnnp_status_success;
+  }
+
+  if (op->lookup_table == NULL) {
+    op->lookup_table = qnnp_operator_allocate(op, 256 * sizeof(uint8_t));
+    if (op->lookup_table == NULL) {
+      qnnp_log_error("failed to allocate 256 bytes for output lookup table");
+      return qnnp_status_out_of_memory;
+    }
+    op->lookup_table_size = 256 * sizeof(uint8_t);
+  }
+  memcpy(op->lookup_table, lookup_table, 256 * sizeof(uint8_t));
+
+  return qnnp_status_success;
+}
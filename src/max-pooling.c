@@ -15,6 +15,7 @@
 #include <string.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/log.h>
 #include <qnnpack/common.h>
@@ -102,7 +103,7 @@ enum qnnp_status qnnp_create_max_pooling2d_nhwc_u8(
 
   status = qnnp_status_out_of_memory;
 
-  max_pooling = calloc(1, sizeof(struct qnnp_operator));
+  max_pooling = qnnp_allocate_operator();
   if (max_pooling == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
@@ -205,12 +206,13 @@ enum qnnp_status qnnp_setup_max_pooling2d_nhwc_u8(
   const size_t step_height = pooling_size + (output_width * step_width - 1) * pooling_height;
   const size_t indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
 
-  const void** indirection_buffer = (const void**) realloc(max_pooling->indirection_buffer, indirection_buffer_size);
+  const void** indirection_buffer = (const void**) qnnp_operator_reallocate(max_pooling, max_pooling->indirection_buffer, indirection_buffer_size);
   if (indirection_buffer == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
     return qnnp_status_out_of_memory;
   }
   max_pooling->indirection_buffer = indirection_buffer;
+  max_pooling->indirection_buffer_size = indirection_buffer_size;
 
   qnnp_indirection_init_maxpool2d(max_pooling, valid_batch_size, step_height, step_width);
 
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack.h>
+#include <qnnpack/compute.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/params.h>
+
+
+static void compute_total_size(struct qnnp_operator_memory_info* memory_info) {
+  memory_info->total_size = memory_info->operator_size + memory_info->packed_weights_size +
+    memory_info->indirection_buffer_size + memory_info->a_sum_size +
+    memory_info->zero_buffer_size + memory_info->lookup_table_size;
+}
+
+enum qnnp_status qnnp_get_operator_memory_info(
+    qnnp_operator_t op,
+    struct qnnp_operator_memory_info* memory_info)
+{
+  if (op == NULL || memory_info == NULL) {
+    qnnp_log_error("failed to get operator memory info: operator and memory info must be non-NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  memory_info->operator_size = sizeof(struct qnnp_operator);
+  memory_info->packed_weights_size = op->packed_weights_size;
+  memory_info->indirection_buffer_size = op->indirection_buffer_size;
+  memory_info->a_sum_size = op->a_sum_size;
+  memory_info->zero_buffer_size = op->zero_buffer_size;
+  memory_info->lookup_table_size = op->lookup_table_size;
+  compute_total_size(memory_info);
+  return qnnp_status_success;
+}
+
+/* Returns false if the kernel does not fit into the padded input */
+static bool compute_output_size(
+    const struct qnnp_operator* op,
+    size_t input_height,
+    size_t input_width,
+    size_t* output_height,
+    size_t* output_width)
+{
+  const size_t kernel_height = (op->kernel_height - 1) * op->dilation_height + 1;
+  const size_t kernel_width = (op->kernel_width - 1) * op->dilation_width + 1;
+  const size_t padding_height = op->input_padding_top + op->input_padding_bottom;
+  const size_t padding_width = op->input_padding_left + op->input_padding_right;
+  if (op->transposed) {
+    const size_t padded_output_height = op->stride_height * (input_height - 1) + op->adjustment_height + kernel_height;
+    const size_t padded_output_width = op->stride_width * (input_width - 1) + op->adjustment_width + kernel_width;
+    if (padded_output_height <= padding_height || padded_output_width <= padding_width) {
+      return false;
+    }
+    *output_height = padded_output_height - padding_height;
+    *output_width = padded_output_width - padding_width;
+  } else {
+    const size_t padded_input_height = padding_height + input_height;
+    const size_t padded_input_width = padding_width + input_width;
+    if (padded_input_height < kernel_height || padded_input_width < kernel_width) {
+      return false;
+    }
+    *output_height = (padded_input_height - kernel_height) / op->stride_height + 1;
+    *output_width = (padded_input_width - kernel_width) / op->stride_width + 1;
+  }
+  return true;
+}
+
+enum qnnp_status qnnp_predict_operator_memory_info(
+    qnnp_operator_t op,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    struct qnnp_operator_memory_info* memory_info)
+{
+  const enum qnnp_status status = qnnp_get_operator_memory_info(op, memory_info);
+  if (status != qnnp_status_success) {
+    return status;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to predict operator memory info with batch size %zu: batch size must be non-zero",
+      batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  switch (op->ukernel_type) {
+    case qnnp_ukernel_type_conv:
+    case qnnp_ukernel_type_dwconv:
+    case qnnp_ukernel_type_average_pooling:
+    case qnnp_ukernel_type_max_pooling:
+      if (input_height == 0 || input_width == 0 ||
+          !compute_output_size(op, input_height, input_width, &output_height, &output_width))
+      {
+        qnnp_log_error(
+          "failed to predict operator memory info with %zux%zu input: input is empty or smaller than the kernel",
+          input_width, input_height);
+        return qnnp_status_invalid_parameter;
+      }
+      break;
+    case qnnp_ukernel_type_xzp_gemm:
+      if (input_height == 0 || input_width == 0) {
+        qnnp_log_error(
+          "failed to predict operator memory info with %zux%zu input: input dimensions must be non-zero",
+          input_width, input_height);
+        return qnnp_status_invalid_parameter;
+      }
+      break;
+    case qnnp_ukernel_type_resize_bilinear:
+    case qnnp_ukernel_type_resize_nearest:
+      if (output_height == 0 || output_width == 0) {
+        qnnp_log_error(
+          "failed to predict operator memory info with %zux%zu output: output dimensions must be non-zero",
+          output_width, output_height);
+        return qnnp_status_invalid_parameter;
+      }
+      break;
+    default:
+      break;
+  }
+
+  const size_t kernel_size = op->kernel_height * op->kernel_width;
+  switch (op->ukernel_type) {
+    case qnnp_ukernel_type_xzp_gemm:
+      memory_info->a_sum_size = sizeof(int32_t) * batch_size * op->groups * input_height * input_width;
+      break;
+    case qnnp_ukernel_type_dynamic_gemm:
+    {
+      struct qnnp_dynamic_gemm_scratch_layout layout;
+      qnnp_compute_dynamic_gemm_scratch_layout(
+        batch_size, round_up(op->group_input_channels, op->ukernel.q8conv_i32.kr), &layout);
+      memory_info->a_sum_size = layout.size;
+      break;
+    }
+    case qnnp_ukernel_type_conv:
+    {
+      size_t output_tile_size = 0;
+      switch (op->conv_output_type) {
+        case qnnp_conv_output_type_quint8:
+          output_tile_size = op->ukernel.q8conv.mr;
+          break;
+        case qnnp_conv_output_type_int32:
+          output_tile_size = op->ukernel.q8conv_i32.mr;
+          break;
+        case qnnp_conv_output_type_float32:
+          output_tile_size = op->ukernel.q8conv_f32.mr;
+          break;
+      }
+      const size_t tiled_output_size = round_up(output_height * output_width, output_tile_size);
+      memory_info->indirection_buffer_size = sizeof(void*) * batch_size * op->groups * tiled_output_size * kernel_size;
+      break;
+    }
+    case qnnp_ukernel_type_dwconv:
+    {
+      const size_t step_width = op->dilation_width == 1 ? op->stride_width : op->kernel_width;
+      const size_t step_height = kernel_size + (output_width * step_width - 1) * op->kernel_height;
+      memory_info->indirection_buffer_size = sizeof(void*) * batch_size * output_height * step_height;
+      break;
+    }
+    case qnnp_ukernel_type_average_pooling:
+    case qnnp_ukernel_type_max_pooling:
+    {
+      /* Micro-kernels may read up to (mr - 1) elements after the end of indirection buffer */
+      size_t step_width = min(op->stride_width, op->kernel_width);
+      uint32_t mr = qnnp_params.q8avgpool.mr;
+      if (op->ukernel_type == qnnp_ukernel_type_max_pooling) {
+        mr = qnnp_params.u8maxpool.mr;
+        if (op->dilation_width > 1) {
+          step_width = op->kernel_width;
+        }
+      }
+      const size_t step_height = kernel_size + (output_width * step_width - 1) * op->kernel_height;
+      memory_info->indirection_buffer_size = sizeof(void*) * ((mr - 1) + batch_size * output_height * step_height);
+      if (input_height == op->last_input_height && input_width == op->last_input_width) {
+        /* Setup for a smaller batch of the same input keeps the larger indirection buffer */
+        memory_info->indirection_buffer_size = max(memory_info->indirection_buffer_size, op->indirection_buffer_size);
+      }
+      break;
+    }
+    case qnnp_ukernel_type_resize_bilinear:
+    case qnnp_ukernel_type_resize_nearest:
+    {
+      const size_t pointers_per_pixel = op->ukernel_type == qnnp_ukernel_type_resize_bilinear ? 4 : 1;
+      memory_info->indirection_buffer_size =
+        sizeof(void*) * batch_size * output_height * output_width * pointers_per_pixel;
+      if (op->ukernel_type == qnnp_ukernel_type_resize_bilinear) {
+        memory_info->packed_weights_size = sizeof(int16_t) * 2 * output_height * output_width;
+      }
+      if (input_height == op->last_input_height && input_width == op->last_input_width &&
+          output_height == op->last_output_height && output_width == op->last_output_width)
+      {
+        /* Setup for a smaller batch of the same input and output keeps the larger indirection buffer */
+        memory_info->indirection_buffer_size = max(memory_info->indirection_buffer_size, op->indirection_buffer_size);
+      }
+      break;
+    }
+    default:
+      /* Setup of other operators does not allocate memory */
+      break;
+  }
+  compute_total_size(memory_info);
+  return qnnp_status_success;
+}
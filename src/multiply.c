@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+enum qnnp_status qnnp_create_multiply_nc_q8(
+    size_t channels,
+    uint8_t a_zero_point,
+    float a_scale,
+    uint8_t b_zero_point,
+    float b_scale,
+    uint8_t product_zero_point,
+    float product_scale,
+    uint8_t product_min,
+    uint8_t product_max,
+    uint32_t flags,
+    qnnp_operator_t* multiply_out)
+{
+  qnnp_operator_t multiply_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_multiply_nc_q8 failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create multiply operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (a_scale <= 0.0f || !isnormal(a_scale)) {
+    qnnp_log_error(
+      "failed to create multiply operator with %.7g A scale: scale must be finite and positive", a_scale);
+    goto error;
+  }
+
+  if (b_scale <= 0.0f || !isnormal(b_scale)) {
+    qnnp_log_error(
+      "failed to create multiply operator with %.7g B scale: scale must be finite and positive", b_scale);
+    goto error;
+  }
+
+  if (product_scale <= 0.0f || !isnormal(product_scale)) {
+    qnnp_log_error(
+      "failed to create multiply operator with %.7g output scale: scale must be finite and positive", product_scale);
+    goto error;
+  }
+
+  if (product_min >= product_max) {
+    qnnp_log_error(
+      "failed to create multiply operator with [%" PRIu8 ", %" PRIu8 "] output range: range min must be below range max",
+      product_min, product_max);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  const float multiply_scale = a_scale * b_scale / product_scale;
+  if (multiply_scale >= 1.0f || multiply_scale < 0x1.0p-32f) {
+    qnnp_log_error(
+      "failed to create multiply operator with %.7g A scale, %.7g B scale, and %.7g output scale: "
+      "multiply scale %.7g must be in [2**-32, 1) range",
+      a_scale, b_scale, product_scale, multiply_scale);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  multiply_op = qnnp_allocate_operator();
+  if (multiply_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  multiply_op->channels = channels;
+  multiply_op->mul_quantization_params =
+    qnnp_compute_mul_quantization_params(
+      a_zero_point, b_zero_point, product_zero_point,
+      multiply_scale, product_min, product_max);
+
+  multiply_op->ukernel_type = qnnp_ukernel_type_multiply;
+  multiply_op->format = qnnp_format_quint8;
+
+  *multiply_out = multiply_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(multiply_op);
+  return status;
+}
+
+enum qnnp_status qnnp_setup_multiply_nc_q8(
+    qnnp_operator_t multiply_op,
+    size_t batch_size,
+    const uint8_t* a,
+    size_t a_stride,
+    const uint8_t* b,
+    size_t b_batch_size,
+    size_t b_stride,
+    uint8_t* product,
+    size_t product_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_multiply_nc_q8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup multiply operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (b_batch_size == 0 || batch_size % b_batch_size != 0) {
+    qnnp_log_error(
+      "failed to setup multiply operator with B batch size %zu: B batch size must divide batch size %zu",
+      b_batch_size, batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  multiply_op->batch_size = batch_size;
+  multiply_op->input = a;
+  multiply_op->input_pixel_stride = a_stride;
+  multiply_op->input2 = b;
+  multiply_op->input2_pixel_stride = b_stride;
+  multiply_op->input2_batch_size = b_batch_size;
+  multiply_op->input2_channels = multiply_op->channels;
+  multiply_op->output = product;
+  multiply_op->output_pixel_stride = product_stride;
+
+  return qnnp_status_success;
+}
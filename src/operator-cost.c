@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/common.h>
+#include <qnnpack/log.h>
+#include <qnnpack/compute.h>
+#include <qnnpack/math.h>
+
+/* Approximate single-core throughput, used to convert operation and memory traffic counts into cycles */
+#define QNNP_COST_MACS_PER_CYCLE 16
+#define QNNP_COST_BYTES_PER_CYCLE 8
+/* Minimal amount of work for one thread, which pays off the cost of waking it up and synchronizing with it */
+#define QNNP_COST_MIN_CYCLES_PER_THREAD 16384
+
+static uint64_t constant_pad_elements(const struct qnnp_operator* op, bool output)
+{
+  uint64_t elements = 1;
+  for (size_t dim = 0; dim < QNNP_MAX_TENSOR_DIMS; dim++) {
+    uint64_t size = op->pad_input_shape[dim];
+    if (output) {
+      size += op->pad_pre_paddings[dim] + op->pad_post_paddings[dim];
+    }
+    elements *= size;
+  }
+  return elements;
+}
+
+/*
+ * Number of multiply-accumulate (or, for element-wise operators, per-element) operations in a set-up operator.
+ */
+uint64_t qnnp_operator_estimate_macs(const struct qnnp_operator* op)
+{
+  const uint64_t batch_size = op->batch_size;
+  switch (op->ukernel_type) {
+    case qnnp_ukernel_type_conv:
+      return batch_size * op->output_height * op->output_width *
+        op->kernel_height * op->kernel_width *
+        op->groups * op->group_input_channels * op->group_output_channels;
+    case qnnp_ukernel_type_gemm:
+      return batch_size * op->output_height * op->output_width *
+        op->groups * op->group_input_channels * op->group_output_channels;
+    case qnnp_ukernel_type_xzp_gemm:
+      return batch_size * op->input_height * op->input_width *
+        op->groups * op->group_input_channels * (op->group_output_channels + 1);
+    case qnnp_ukernel_type_dynamic_gemm:
+      return batch_size * op->group_input_channels * (op->group_output_channels + 1);
+    case qnnp_ukernel_type_dwconv:
+      return batch_size * op->output_height * op->output_width *
+        op->kernel_height * op->kernel_width * op->groups;
+    case qnnp_ukernel_type_average_pooling:
+    case qnnp_ukernel_type_max_pooling:
+      return batch_size * op->output_height * op->output_width *
+        op->kernel_height * op->kernel_width * op->channels;
+    case qnnp_ukernel_type_global_average_pooling:
+    case qnnp_ukernel_type_reduce_mean:
+    case qnnp_ukernel_type_reduce_sum:
+      return batch_size * op->input_width * op->channels;
+    case qnnp_ukernel_type_softargmax:
+      return 2 * batch_size * op->channels;
+    case qnnp_ukernel_type_top_k:
+      return op->top_k == 1 ? 2 * batch_size * op->channels : batch_size * (2 * op->channels + 256);
+    case qnnp_ukernel_type_channel_shuffle:
+      return batch_size * op->groups * op->group_channels;
+    case qnnp_ukernel_type_nchw_to_nhwc:
+    case qnnp_ukernel_type_nhwc_to_nchw:
+      return batch_size * op->input_height * op->input_width * op->channels;
+    case qnnp_ukernel_type_resize_bilinear:
+      return 4 * batch_size * op->output_height * op->output_width * op->channels;
+    case qnnp_ukernel_type_resize_nearest:
+      return batch_size * op->output_height * op->output_width * op->channels;
+    case qnnp_ukernel_type_constant_pad:
+      return constant_pad_elements(op, true);
+    case qnnp_ukernel_type_add:
+    case qnnp_ukernel_type_clamp:
+    case qnnp_ukernel_type_dequantize:
+    case qnnp_ukernel_type_lut:
+    case qnnp_ukernel_type_multiply:
+    case qnnp_ukernel_type_quantize:
+      return batch_size * op->channels;
+    default:
+      QNNP_UNREACHABLE;
+  }
+}
+
+/*
+ * Number of bytes of input, output, and weights which a set-up operator reads or writes.
+ */
+uint64_t qnnp_operator_estimate_bytes(const struct qnnp_operator* op)
+{
+  const uint64_t batch_size = op->batch_size;
+  const uint64_t input_pixels = batch_size * op->input_height * op->input_width;
+  const uint64_t output_pixels = batch_size * op->output_height * op->output_width;
+  switch (op->ukernel_type) {
+    case qnnp_ukernel_type_conv:
+    {
+      const uint64_t kernel_size = op->kernel_height * op->kernel_width;
+      const uint32_t log2_output_element_size = qnnp_operator_get_log2_output_element_size(op);
+      return op->groups * (input_pixels * op->group_input_channels +
+        (output_pixels * op->group_output_channels << log2_output_element_size) +
+        op->group_output_channels * (kernel_size * op->group_input_channels + sizeof(int32_t)));
+    }
+    case qnnp_ukernel_type_gemm:
+    {
+      const uint32_t log2_output_element_size = qnnp_operator_get_log2_output_element_size(op);
+      return op->groups * (output_pixels * op->group_input_channels +
+        (output_pixels * op->group_output_channels << log2_output_element_size) +
+        op->group_output_channels * (op->group_input_channels + sizeof(int32_t)));
+    }
+    case qnnp_ukernel_type_xzp_gemm:
+      return op->groups * (input_pixels * (op->group_input_channels + op->group_output_channels + sizeof(int32_t)) +
+        op->group_output_channels * (op->group_input_channels + sizeof(int32_t)));
+    case qnnp_ukernel_type_dynamic_gemm:
+      return sizeof(float) * batch_size * (op->group_input_channels + op->group_output_channels) +
+        op->group_output_channels * (op->group_input_channels + sizeof(int32_t) + sizeof(float));
+    case qnnp_ukernel_type_dwconv:
+      return op->groups * (input_pixels + output_pixels +
+        op->kernel_height * op->kernel_width + sizeof(int32_t));
+    case qnnp_ukernel_type_average_pooling:
+    case qnnp_ukernel_type_max_pooling:
+      return (input_pixels + output_pixels) * op->channels;
+    case qnnp_ukernel_type_global_average_pooling:
+    case qnnp_ukernel_type_reduce_mean:
+    case qnnp_ukernel_type_reduce_sum:
+      return batch_size * (op->input_width + 1) * op->channels;
+    case qnnp_ukernel_type_add:
+    case qnnp_ukernel_type_multiply:
+      return 2 * batch_size * op->channels + op->input2_batch_size * op->input2_channels;
+    case qnnp_ukernel_type_softargmax:
+      return 3 * batch_size * op->channels;
+    case qnnp_ukernel_type_top_k:
+      return batch_size * (op->channels + op->top_k * (sizeof(uint8_t) + sizeof(uint32_t)));
+    case qnnp_ukernel_type_channel_shuffle:
+      return 2 * batch_size * op->groups * op->group_channels;
+    case qnnp_ukernel_type_nchw_to_nhwc:
+    case qnnp_ukernel_type_nhwc_to_nchw:
+      return (2 * input_pixels * op->channels) << qnnp_operator_get_log2_input_element_size(op);
+    case qnnp_ukernel_type_resize_bilinear:
+    case qnnp_ukernel_type_resize_nearest:
+      return (input_pixels + output_pixels) * op->channels;
+    case qnnp_ukernel_type_constant_pad:
+      return constant_pad_elements(op, false) + constant_pad_elements(op, true);
+    case qnnp_ukernel_type_clamp:
+    case qnnp_ukernel_type_lut:
+      return 2 * batch_size * op->channels;
+    case qnnp_ukernel_type_dequantize:
+    case qnnp_ukernel_type_quantize:
+      return (sizeof(uint8_t) + sizeof(float)) * batch_size * op->channels;
+    default:
+      QNNP_UNREACHABLE;
+  }
+}
+
+/*
+ * Number of threads which should run the set-up operator: an explicit limit, if set, or else the number of threads
+ * which the cost model expects to keep busy. The result is between 1 and the number of threads in the threadpool.
+ */
+size_t qnnp_operator_get_threads_count(const struct qnnp_operator* op, size_t threadpool_threads_count)
+{
+  size_t threads_count = op->max_threads;
+  if (threads_count == 0) {
+    const uint64_t cycles =
+      qnnp_operator_estimate_macs(op) / QNNP_COST_MACS_PER_CYCLE +
+      qnnp_operator_estimate_bytes(op) / QNNP_COST_BYTES_PER_CYCLE;
+    const uint64_t busy_threads = cycles / QNNP_COST_MIN_CYCLES_PER_THREAD;
+    threads_count = busy_threads < (uint64_t) threadpool_threads_count ? (size_t) busy_threads : threadpool_threads_count;
+  }
+  return max(min(threads_count, threadpool_threads_count), 1);
+}
+
+enum qnnp_status qnnp_set_operator_max_threads(
+    qnnp_operator_t op,
+    size_t max_threads)
+{
+  if (op == NULL) {
+    qnnp_log_error("failed to set operator thread limit: operator is NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  op->max_threads = max_threads;
+  return qnnp_status_success;
+}
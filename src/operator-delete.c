@@ -6,9 +6,8 @@
  * LICENSE file in the root directory of this source tree.
  */
 
-#include <stdlib.h>
-
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 
 
@@ -18,11 +17,12 @@ enum qnnp_status qnnp_delete_operator(qnnp_operator_t op)
     return qnnp_status_invalid_parameter;
   }
 
-  free(op->indirection_buffer);
-  free(op->packed_weights);
-  free(op->a_sum);
-  free(op->zero_buffer);
-  free(op->lookup_table);
-  free(op);
+  const struct qnnp_allocator allocator = op->allocator;
+  qnnp_operator_deallocate(op, op->indirection_buffer);
+  qnnp_operator_deallocate(op, op->packed_weights);
+  qnnp_operator_deallocate(op, op->a_sum);
+  qnnp_operator_deallocate(op, op->zero_buffer);
+  qnnp_operator_deallocate(op, op->lookup_table);
+  allocator.deallocate(allocator.context, op);
   return qnnp_status_success;
 }
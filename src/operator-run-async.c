@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <pthread.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+/*
+ * Asynchronous runs are queued per threadpool: each threadpool, and the NULL threadpool, has its own queue and worker
+ * thread, so that runs on different threadpools overlap, while runs on the same threadpool, which is not reentrant,
+ * are serialized in submission order. A worker is started by the first run queued to its threadpool and exits after
+ * its queue stays empty for QNNP_ASYNC_WORKER_IDLE_SECONDS.
+ */
+#define QNNP_ASYNC_WORKER_IDLE_SECONDS 1
+
+struct qnnp_task {
+  struct qnnp_task* next;
+  bool detached;
+  bool completed;
+  enum qnnp_status status;
+  pthreadpool_t threadpool;
+  qnnp_task_callback_t callback;
+  void* callback_context;
+  size_t operators_count;
+  qnnp_operator_t operators[];
+};
+
+struct task_queue {
+  struct task_queue* next;
+  pthreadpool_t threadpool;
+  pthread_cond_t cond;
+  struct qnnp_task* head;
+  struct qnnp_task* tail;
+};
+
+/* Guards the list of queues, all queued tasks, and completion flags */
+static pthread_mutex_t queues_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t completion_cond = PTHREAD_COND_INITIALIZER;
+static struct task_queue* queues;
+
+static void unlink_queue(struct task_queue* queue)
+{
+  struct task_queue** link = &queues;
+  while (*link != queue) {
+    link = &(*link)->next;
+  }
+  *link = queue->next;
+  pthread_cond_destroy(&queue->cond);
+  free(queue);
+}
+
+static void* run_tasks(void* arg)
+{
+  struct task_queue* queue = (struct task_queue*) arg;
+  pthread_mutex_lock(&queues_mutex);
+  for (;;) {
+    if (queue->head == NULL) {
+      struct timespec deadline;
+      clock_gettime(CLOCK_REALTIME, &deadline);
+      deadline.tv_sec += QNNP_ASYNC_WORKER_IDLE_SECONDS;
+      while (queue->head == NULL) {
+        if (pthread_cond_timedwait(&queue->cond, &queues_mutex, &deadline) == ETIMEDOUT && queue->head == NULL) {
+          /* Submitters start a new worker for a queue which is no longer in the list */
+          unlink_queue(queue);
+          pthread_mutex_unlock(&queues_mutex);
+          return NULL;
+        }
+      }
+    }
+
+    struct qnnp_task* task = queue->head;
+    queue->head = task->next;
+    if (queue->head == NULL) {
+      queue->tail = NULL;
+    }
+    pthread_mutex_unlock(&queues_mutex);
+
+    const enum qnnp_status status =
+      qnnp_run_operators(task->operators_count, task->operators, task->threadpool);
+
+    if (task->callback != NULL) {
+      task->callback(task->callback_context, status);
+    }
+
+    pthread_mutex_lock(&queues_mutex);
+    if (task->detached) {
+      free(task);
+    } else {
+      task->status = status;
+      task->completed = true;
+      pthread_cond_broadcast(&completion_cond);
+    }
+  }
+}
+
+/* Must be called with queues_mutex held; returns the error code of thread creation */
+static int start_worker(struct task_queue* queue)
+{
+  pthread_attr_t attr;
+  int result = pthread_attr_init(&attr);
+  if (result != 0) {
+    return result;
+  }
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+  pthread_t thread;
+  result = pthread_create(&thread, &attr, run_tasks, queue);
+  pthread_attr_destroy(&attr);
+  return result;
+}
+
+enum qnnp_status qnnp_run_operators_async(
+    size_t operators_count,
+    const qnnp_operator_t* operators,
+    pthreadpool_t threadpool,
+    qnnp_task_callback_t callback,
+    void* callback_context,
+    qnnp_task_t* task_out)
+{
+  struct qnnp_task* task = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_run_operators_async failed because QNNPACK is not properly initialized");
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (operators_count == 0) {
+    qnnp_log_error("failed to run operators asynchronously: operators count is zero");
+    goto error;
+  }
+
+  if (operators == NULL) {
+    qnnp_log_error("failed to run operators asynchronously: operators array is NULL");
+    goto error;
+  }
+
+  for (size_t i = 0; i < operators_count; i++) {
+    if (operators[i] == NULL) {
+      qnnp_log_error("failed to run operators asynchronously: operator #%zu is NULL", i);
+      goto error;
+    }
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  const size_t task_size = sizeof(struct qnnp_task) + operators_count * sizeof(qnnp_operator_t);
+  task = calloc(1, task_size);
+  if (task == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_task structure", task_size);
+    goto error;
+  }
+
+  task->detached = task_out == NULL;
+  task->status = qnnp_status_success;
+  task->threadpool = threadpool;
+  task->callback = callback;
+  task->callback_context = callback_context;
+  task->operators_count = operators_count;
+  memcpy(task->operators, operators, operators_count * sizeof(qnnp_operator_t));
+
+  pthread_mutex_lock(&queues_mutex);
+  struct task_queue* queue = queues;
+  while (queue != NULL && queue->threadpool != threadpool) {
+    queue = queue->next;
+  }
+  if (queue != NULL) {
+    if (queue->tail != NULL) {
+      queue->tail->next = task;
+    } else {
+      queue->head = task;
+    }
+    queue->tail = task;
+    pthread_cond_signal(&queue->cond);
+  } else {
+    /* No worker serves this threadpool: start one, and retry on the next run if that fails */
+    queue = calloc(1, sizeof(struct task_queue));
+    if (queue == NULL) {
+      pthread_mutex_unlock(&queues_mutex);
+      qnnp_log_error("failed to allocate %zu bytes for task queue structure", sizeof(struct task_queue));
+      goto error;
+    }
+    pthread_cond_init(&queue->cond, NULL);
+    queue->threadpool = threadpool;
+    queue->head = task;
+    queue->tail = task;
+    queue->next = queues;
+    queues = queue;
+    const int result = start_worker(queue);
+    if (result != 0) {
+      unlink_queue(queue);
+      pthread_mutex_unlock(&queues_mutex);
+      qnnp_log_error("failed to create worker thread for asynchronous runs: error code %d", result);
+      goto error;
+    }
+  }
+  pthread_mutex_unlock(&queues_mutex);
+
+  if (task_out != NULL) {
+    *task_out = task;
+  }
+  return qnnp_status_success;
+
+error:
+  free(task);
+  return status;
+}
+
+enum qnnp_status qnnp_run_operator_async(
+    qnnp_operator_t op,
+    pthreadpool_t threadpool,
+    qnnp_task_callback_t callback,
+    void* callback_context,
+    qnnp_task_t* task)
+{
+  return qnnp_run_operators_async(1, &op, threadpool, callback, callback_context, task);
+}
+
+enum qnnp_status qnnp_wait_task(qnnp_task_t task)
+{
+  if (task == NULL) {
+    return qnnp_status_invalid_parameter;
+  }
+
+  pthread_mutex_lock(&queues_mutex);
+  while (!task->completed) {
+    pthread_cond_wait(&completion_cond, &queues_mutex);
+  }
+  pthread_mutex_unlock(&queues_mutex);
+
+  const enum qnnp_status status = task->status;
+  free(task);
+  return status;
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+#include <qnnpack/compute.h>
+
+
+/*
+ * Runs a set of mutually independent operators concurrently.
+ * Every operator gets a number of slots proportional to its estimated MAC count, but no more than its thread limit,
+ * and each slot processes a contiguous range of the operator's tiles. Stages of multi-stage operators are separated by barriers.
+ */
+static enum qnnp_status run_independent_operators(
+    size_t operators_count,
+    const qnnp_operator_t* operators,
+    struct qnnp_compute_plan* plans,
+    size_t* workers,
+    struct qnnp_compute_slot* slots,
+    size_t threads_count,
+    pthreadpool_t threadpool)
+{
+  uint64_t total_macs = 0;
+  size_t stages_count = 0;
+  /* Prepare all plans before dispatching any of them, so that a failed plan stops the wave before it runs */
+  for (size_t i = 0; i < operators_count; i++) {
+    const enum qnnp_status status = qnnp_prepare_compute_plan(operators[i], &plans[i]);
+    if (status != qnnp_status_success) {
+      return status;
+    }
+    stages_count = max(stages_count, plans[i].stages_count);
+    total_macs += qnnp_operator_estimate_macs(operators[i]);
+  }
+
+  for (size_t i = 0; i < operators_count; i++) {
+    const uint64_t macs = qnnp_operator_estimate_macs(operators[i]);
+    size_t operator_workers = 1;
+    if (total_macs != 0) {
+      operator_workers = (size_t) ((macs * threads_count + total_macs / 2) / total_macs);
+    }
+    workers[i] = min(max(operator_workers, 1), qnnp_operator_get_threads_count(operators[i], threads_count));
+  }
+
+  for (size_t stage = 0; stage < stages_count; stage++) {
+    size_t slots_count = 0;
+    for (size_t i = 0; i < operators_count; i++) {
+      if (stage < plans[i].stages_count) {
+        slots_count += qnnp_compute_partition(&plans[i].stages[stage], workers[i], slots + slots_count);
+      }
+    }
+    qnnp_compute_slots(slots_count, slots, threadpool);
+  }
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_run_operator_graph(
+    size_t operators_count,
+    const qnnp_operator_t* operators,
+    size_t dependencies_count,
+    const struct qnnp_operator_dependency* dependencies,
+    pthreadpool_t threadpool)
+{
+  size_t* successors_offset = NULL;
+  size_t* successors = NULL;
+  size_t* pending_count = NULL;
+  size_t* order = NULL;
+  size_t* wave_offset = NULL;
+  qnnp_operator_t* wave_operators = NULL;
+  struct qnnp_compute_plan* plans = NULL;
+  size_t* workers = NULL;
+  struct qnnp_compute_slot* slots = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_run_operator_graph failed because QNNPACK is not properly initialized");
+    goto cleanup;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (operators_count != 0 && operators == NULL) {
+    qnnp_log_error("failed to run operator graph: operators array is NULL");
+    goto cleanup;
+  }
+
+  if (dependencies_count != 0 && dependencies == NULL) {
+    qnnp_log_error("failed to run operator graph: dependencies array is NULL");
+    goto cleanup;
+  }
+
+  for (size_t i = 0; i < operators_count; i++) {
+    if (operators[i] == NULL) {
+      qnnp_log_error("failed to run operator graph: operator #%zu is NULL", i);
+      goto cleanup;
+    }
+  }
+
+  for (size_t i = 0; i < dependencies_count; i++) {
+    const size_t producer = dependencies[i].producer;
+    const size_t consumer = dependencies[i].consumer;
+    if (producer >= operators_count || consumer >= operators_count) {
+      qnnp_log_error(
+        "failed to run operator graph: dependency #%zu (%zu -> %zu) refers to a non-existent operator",
+        i, producer, consumer);
+      goto cleanup;
+    }
+    if (producer == consumer) {
+      qnnp_log_error(
+        "failed to run operator graph: dependency #%zu makes operator #%zu depend on itself", i, producer);
+      goto cleanup;
+    }
+  }
+
+  if (operators_count == 0) {
+    status = qnnp_status_success;
+    goto cleanup;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  successors_offset = calloc(operators_count + 1, sizeof(size_t));
+  successors = malloc(max(dependencies_count, 1) * sizeof(size_t));
+  pending_count = calloc(operators_count, sizeof(size_t));
+  order = malloc(operators_count * sizeof(size_t));
+  wave_offset = malloc((operators_count + 1) * sizeof(size_t));
+  if (successors_offset == NULL || successors == NULL || pending_count == NULL || order == NULL || wave_offset == NULL) {
+    qnnp_log_error("failed to allocate memory for operator graph with %zu operators and %zu dependencies",
+      operators_count, dependencies_count);
+    goto cleanup;
+  }
+
+  /* Build adjacency lists in compressed sparse row format */
+  for (size_t i = 0; i < dependencies_count; i++) {
+    successors_offset[dependencies[i].producer + 1] += 1;
+    pending_count[dependencies[i].consumer] += 1;
+  }
+  for (size_t i = 0; i < operators_count; i++) {
+    successors_offset[i + 1] += successors_offset[i];
+  }
+  /* order doubles as a per-operator insertion cursor until the topological sort */
+  for (size_t i = 0; i < operators_count; i++) {
+    order[i] = successors_offset[i];
+  }
+  for (size_t i = 0; i < dependencies_count; i++) {
+    successors[order[dependencies[i].producer]++] = dependencies[i].consumer;
+  }
+
+  /* Topological sort into waves of mutually independent operators */
+  size_t sorted_count = 0;
+  for (size_t i = 0; i < operators_count; i++) {
+    if (pending_count[i] == 0) {
+      order[sorted_count++] = i;
+    }
+  }
+  size_t waves_count = 0;
+  size_t max_wave_size = 0;
+  wave_offset[0] = 0;
+  for (size_t wave_start = 0; wave_start != sorted_count; ) {
+    const size_t wave_end = sorted_count;
+    for (size_t i = wave_start; i < wave_end; i++) {
+      const size_t producer = order[i];
+      for (size_t j = successors_offset[producer]; j < successors_offset[producer + 1]; j++) {
+        const size_t consumer = successors[j];
+        if (--pending_count[consumer] == 0) {
+          order[sorted_count++] = consumer;
+        }
+      }
+    }
+    max_wave_size = max(max_wave_size, wave_end - wave_start);
+    wave_offset[++waves_count] = wave_end;
+    wave_start = wave_end;
+  }
+  if (sorted_count != operators_count) {
+    qnnp_log_error("failed to run operator graph: dependencies between %zu operators form a cycle",
+      operators_count - sorted_count);
+    status = qnnp_status_invalid_parameter;
+    goto cleanup;
+  }
+
+  const size_t threads_count = pthreadpool_get_threads_count(threadpool);
+  if (threads_count > 1 && max_wave_size > 1) {
+    wave_operators = malloc(max_wave_size * sizeof(qnnp_operator_t));
+    plans = malloc(max_wave_size * sizeof(struct qnnp_compute_plan));
+    workers = malloc(max_wave_size * sizeof(size_t));
+    slots = malloc((threads_count + max_wave_size) * sizeof(struct qnnp_compute_slot));
+    if (wave_operators == NULL || plans == NULL || workers == NULL || slots == NULL) {
+      qnnp_log_error("failed to allocate memory for scheduling %zu concurrent operators", max_wave_size);
+      goto cleanup;
+    }
+  }
+
+  for (size_t wave = 0; wave < waves_count; wave++) {
+    const size_t wave_start = wave_offset[wave];
+    const size_t wave_size = wave_offset[wave + 1] - wave_start;
+    if (threads_count > 1 && wave_size > 1) {
+      for (size_t i = 0; i < wave_size; i++) {
+        wave_operators[i] = operators[order[wave_start + i]];
+      }
+      status = run_independent_operators(
+        wave_size, wave_operators, plans, workers, slots, threads_count, threadpool);
+      if (status != qnnp_status_success) {
+        goto cleanup;
+      }
+    } else {
+      for (size_t i = 0; i < wave_size; i++) {
+        status = qnnp_run_operator(operators[order[wave_start + i]], threadpool);
+        if (status != qnnp_status_success) {
+          goto cleanup;
+        }
+      }
+    }
+  }
+  status = qnnp_status_success;
+
+cleanup:
+  free(successors_offset);
+  free(successors);
+  free(pending_count);
+  free(order);
+  free(wave_offset);
+  free(wave_operators);
+  free(plans);
+  free(workers);
+  free(slots);
+  return status;
+}
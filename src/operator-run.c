@@ -7,6 +7,8 @@
  */
 
 #include <assert.h>
+#include <math.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -15,23 +17,34 @@
 #include <qnnpack/operator.h>
 #include <qnnpack/log.h>
 #include <qnnpack/common.h>
+#include <qnnpack/compute.h>
 #include <qnnpack/math.h>
 #include <qnnpack/params.h>
+#include <qnnpack/requantization.h>
 
 
-struct q8gemm_context {
-  size_t k;
-  size_t k_stride;
-  size_t n;
-  size_t n_stride;
-  const uint8_t* a;
-  size_t a_stride;
-  const uint8_t* packed_w;
-  uint8_t* c;
-  size_t c_stride;
-  union qnnp_conv_quantization_params quantization_params;
-  const q8gemm_ukernel_function ukernel;
-};
+/*
+ * Maps a block of output rows through the fused output lookup table right after the micro-kernel has stored it, while
+ * the block is still in cache. Rows of a block which spans all output channels are contiguous when the output is not
+ * strided, and are mapped in a single call.
+ */
+static inline void apply_output_lut(
+    x8lut_ukernel_function lut_ukernel,
+    const uint8_t* t,
+    size_t rows,
+    size_t columns,
+    uint8_t* c,
+    size_t c_stride)
+{
+  if (c_stride == columns) {
+    lut_ukernel(rows * columns, c, t, c);
+    return;
+  }
+  do {
+    lut_ukernel(columns, c, t, c);
+    c += c_stride;
+  } while (--rows != 0);
+}
 
 static void compute_q8gemm(
     const struct q8gemm_context context[restrict static 1],
@@ -54,6 +67,44 @@ static void compute_q8gemm(
   uint8_t* restrict c = context->c;
   const size_t c_stride = context->c_stride;
 
+  uint8_t* c_block = c + (pixel_index + mr_block_start) * c_stride + nr_block_start + group_index * n;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      k,
+      a + (pixel_index + mr_block_start) * a_stride + group_index * k,
+      a_stride,
+      (const void*) ((uintptr_t) packed_w + (nr_block_start + group_index * n_stride) * (k_stride * sizeof(uint8_t) + sizeof(int32_t))),
+      c_block,
+      c_stride,
+      &context->quantization_params);
+
+  if (context->output_lut != NULL) {
+    apply_output_lut(context->lut_ukernel, context->output_lut, mr_block_size, nr_block_size, c_block, c_stride);
+  }
+}
+
+static void compute_q8gemm_s32(
+    const struct q8gemm_s32_context context[restrict static 1],
+    size_t group_index,
+    size_t pixel_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t group_range /* always 1 */,
+    size_t pixel_range,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t k = context->k;
+  const size_t k_stride = context->k_stride;
+  const size_t n = context->n;
+  const size_t n_stride = context->n_stride;
+  const uint8_t* restrict a = context->a;
+  const size_t a_stride = context->a_stride;
+  const void* restrict packed_w = context->packed_w;
+  const size_t c_stride = context->c_stride;
+
   context->ukernel(
       mr_block_size,
       nr_block_size,
@@ -61,22 +112,115 @@ static void compute_q8gemm(
       a + (pixel_index + mr_block_start) * a_stride + group_index * k,
       a_stride,
       (const void*) ((uintptr_t) packed_w + (nr_block_start + group_index * n_stride) * (k_stride * sizeof(uint8_t) + sizeof(int32_t))),
-      c + (pixel_index + mr_block_start) * c_stride + nr_block_start + group_index * n,
+      (int32_t*) ((uintptr_t) context->c + (pixel_index + mr_block_start) * c_stride) + nr_block_start + group_index * n,
       c_stride,
       &context->quantization_params);
 }
 
-struct q8sum_rows_context {
-  const uint8_t* a;
-  size_t groups;
-  size_t m;
-  size_t k;
-  size_t a_stride;
-  const int32_t multiplier;
-  int32_t* a_sum;
-  size_t a_sum_stride;
-  const q8sum_rows_ukernel_function ukernel;
-};
+static void compute_q8gemm_f32(
+    const struct q8gemm_f32_context context[restrict static 1],
+    size_t group_index,
+    size_t pixel_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t group_range /* always 1 */,
+    size_t pixel_range,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t k = context->k;
+  const size_t k_stride = context->k_stride;
+  const size_t n = context->n;
+  const size_t n_stride = context->n_stride;
+  const uint8_t* restrict a = context->a;
+  const size_t a_stride = context->a_stride;
+  const void* restrict packed_w = context->packed_w;
+  const size_t c_stride = context->c_stride;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      k,
+      a + (pixel_index + mr_block_start) * a_stride + group_index * k,
+      a_stride,
+      (const void*) ((uintptr_t) packed_w + (nr_block_start + group_index * n_stride) * (k_stride * sizeof(uint8_t) + sizeof(int32_t))),
+      (float*) ((uintptr_t) context->c + (pixel_index + mr_block_start) * c_stride) + nr_block_start + group_index * n,
+      c_stride,
+      &context->dequantization_params);
+}
+
+static void compute_q8gemm_dq_quantize(
+    const struct q8gemm_dq_context context[restrict static 1],
+    size_t batch_index)
+{
+  const size_t k = context->k;
+  const float* a_row = (const float*) ((uintptr_t) context->a + batch_index * context->a_stride);
+
+  /* Asymmetric quantization of [min(x, 0), max(x, 0)] to [0, 255], so that 0.0 is exactly representable */
+  float minmax[2];
+  context->rminmax_ukernel(k, a_row, minmax);
+  const float range_min = fminf(minmax[0], 0.0f);
+  const float range_max = fmaxf(minmax[1], 0.0f);
+  float scale = (range_max - range_min) / 255.0f;
+  if (!isnormal(scale)) {
+    scale = 1.0f;
+  }
+  const uint8_t zero_point = (uint8_t) lrintf(fminf(fmaxf(-range_min / scale, 0.0f), 255.0f));
+
+  const union qnnp_f32_quantization_params quantization_params =
+    qnnp_compute_f32_quantization_params(zero_point, scale, 0, 255);
+  context->quantize_ukernel(k, a_row, context->a_quantized + batch_index * context->k_stride, &quantization_params);
+  context->row_scale[batch_index] = scale * context->kernel_scale;
+  context->row_zero_point[batch_index] = (int32_t) (uint32_t) zero_point;
+}
+
+static void compute_q8gemm_dq(
+    const struct q8gemm_dq_context context[restrict static 1],
+    size_t group_index /* always 0 */,
+    size_t mr_block_start,
+    size_t nc_block_start,
+    size_t group_range /* always 1 */,
+    size_t mr_block_size,
+    size_t nc_block_size)
+{
+  const size_t k = context->k;
+  const size_t k_stride = context->k_stride;
+  const uint32_t nr = context->nr;
+
+  QNNP_ALIGN(16) int32_t c_scratch[QNNP_Q8GEMM_DQ_MAX_MR * QNNP_Q8GEMM_DQ_MAX_NR];
+  const uint8_t* a_block = context->a_quantized + mr_block_start * k_stride;
+  const float* row_scale = context->row_scale + mr_block_start;
+  const int32_t* row_zero_point = context->row_zero_point + mr_block_start;
+
+  const size_t nc_block_end = nc_block_start + nc_block_size;
+  for (size_t nr_block_start = nc_block_start; nr_block_start < nc_block_end; nr_block_start += nr) {
+    const size_t nr_block_size = min(nc_block_end - nr_block_start, nr);
+    context->gemm_ukernel(
+        mr_block_size,
+        nr_block_size,
+        k,
+        a_block,
+        k_stride * sizeof(uint8_t),
+        (const void*) ((uintptr_t) context->packed_w + nr_block_start * (k_stride * sizeof(uint8_t) + sizeof(int32_t))),
+        c_scratch,
+        nr * sizeof(int32_t),
+        &context->quantization_params);
+
+    const int32_t* kernel_sums = context->kernel_sums + nr_block_start;
+    const float* bias = context->bias + nr_block_start;
+    for (size_t m = 0; m < mr_block_size; m++) {
+      float* c = (float*) ((uintptr_t) context->c + (mr_block_start + m) * context->c_stride) + nr_block_start;
+      const int32_t* acc = c_scratch + m * nr;
+      const float scale = row_scale[m];
+      const int32_t zero_point = row_zero_point[m];
+      for (size_t n = 0; n < nr_block_size; n++) {
+        /* The corrected accumulator fits into int32, intermediate products may wrap around */
+        const int32_t vacc = (int32_t) ((uint32_t) acc[n] - (uint32_t) zero_point * (uint32_t) kernel_sums[n]);
+        c[n] = (float) vacc * scale + bias[n];
+      }
+    }
+  }
+}
 
 static void compute_sum_rows(
     const struct q8sum_rows_context context[restrict static 1],
@@ -105,24 +249,6 @@ static void compute_sum_rows(
       a_sum + batch_index * groups * a_sum_stride + group_index * a_sum_stride + block_start);
 }
 
-struct q8gemm_xzp_context {
-  size_t k;
-  size_t k_stride;
-  size_t n;
-  size_t n_stride;
-  const uint8_t* a;
-  size_t a_stride;
-  const void* packed_w;
-  uint8_t* c;
-  size_t c_stride;
-  const int32_t* a_sum;
-  size_t groups;
-  size_t batch_size;
-  size_t a_sum_stride;
-  union qnnp_q31_requantization_params requantization_params;
-  const q8gemm_xzp_ukernel_function ukernel;
-};
-
 static void compute_q8gemm_xzp(
     const struct q8gemm_xzp_context context[restrict static 1],
     size_t group_index,
@@ -147,6 +273,8 @@ static void compute_q8gemm_xzp(
   const size_t groups = context->groups;
   const size_t a_sum_stride = context->a_sum_stride;
 
+  uint8_t* c_block = c + (pixel_index + mr_block_start) * c_stride + nr_block_start + group_index * n;
+
   context->ukernel(
       mr_block_size,
       nr_block_size,
@@ -155,27 +283,15 @@ static void compute_q8gemm_xzp(
       a_stride,
       a_sum + pixel_index * groups + group_index * a_sum_stride + mr_block_start,
       (const void*) ((uintptr_t) packed_w + (nr_block_start + group_index * n_stride) * (k_stride * sizeof(uint8_t) + sizeof(int32_t))),
-      c + (pixel_index + mr_block_start) * c_stride + nr_block_start + group_index * n,
+      c_block,
       c_stride,
       &context->requantization_params);
+
+  if (context->output_lut != NULL) {
+    apply_output_lut(context->lut_ukernel, context->output_lut, mr_block_size, nr_block_size, c_block, c_stride);
+  }
 }
 
-struct q8conv_context {
-  size_t bs;
-  size_t ks;
-  size_t kc;
-  size_t kc_stride;
-  size_t m;
-  size_t m_stride;
-  size_t n;
-  size_t n_stride;
-  const uint8_t** indirect_a;
-  const void* packed_w;
-  uint8_t* c;
-  size_t c_stride;
-  union qnnp_conv_quantization_params quantization_params;
-  const q8conv_ukernel_function ukernel;
-};
 
 /**
  * Computing a mr*nr block of output.
@@ -212,6 +328,47 @@ static void compute_q8conv(
   uint8_t* restrict c = context->c;
   const size_t c_stride = context->c_stride;
 
+  uint8_t* c_block = c + (mr_block_start + image_index * m) * c_stride + group_index * n + nr_block_start;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      kc,
+      ks,
+      indirect_a + (mr_block_start + (image_index + group_index * bs) * m_stride) * ks,
+      (const void*) ((uintptr_t) packed_w + (nr_block_start + group_index * n_stride) * (kc_stride * sizeof(uint8_t) + sizeof(int32_t))),
+      c_block,
+      c_stride,
+      &context->quantization_params);
+
+  if (context->output_lut != NULL) {
+    apply_output_lut(context->lut_ukernel, context->output_lut, mr_block_size, nr_block_size, c_block, c_stride);
+  }
+}
+
+static void compute_q8conv_s32(
+    const struct q8conv_s32_context context[restrict static 1],
+    size_t group_index,
+    size_t image_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t group_range /* always 1 */,
+    size_t image_range /* always 1 */,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t bs = context->bs;
+  const size_t ks = context->ks;
+  const size_t kc = context->kc;
+  const size_t kc_stride = context->kc_stride;
+  const size_t m = context->m;
+  const size_t m_stride = context->m_stride;
+  const size_t n = context->n;
+  const size_t n_stride = context->n_stride;
+  const uint8_t** restrict indirect_a = context->indirect_a;
+  const void* restrict packed_w = context->packed_w;
+  const size_t c_stride = context->c_stride;
+
   context->ukernel(
       mr_block_size,
       nr_block_size,
@@ -219,29 +376,45 @@ static void compute_q8conv(
       ks,
       indirect_a + (mr_block_start + (image_index + group_index * bs) * m_stride) * ks,
       (const void*) ((uintptr_t) packed_w + (nr_block_start + group_index * n_stride) * (kc_stride * sizeof(uint8_t) + sizeof(int32_t))),
-      c + (mr_block_start + image_index * m) * c_stride + group_index * n + nr_block_start,
+      (int32_t*) ((uintptr_t) context->c + (mr_block_start + image_index * m) * c_stride) + group_index * n + nr_block_start,
       c_stride,
       &context->quantization_params);
 }
 
-struct q8dwconv_context {
-  size_t groups;
-  size_t group_stride;
-  const uint8_t** indirection_buffer;
-  size_t indirection_buffer_row_stride;
-  size_t indirection_buffer_col_stride;
-  const void* packed_weights;
-  uint8_t* output;
-  size_t output_height;
-  size_t output_width;
-  size_t output_row_stride;
-  size_t output_col_increment;
-  union qnnp_conv_quantization_params quantization_params;
-  union {
-    const q8dwconv_up_ukernel_function unipass_ukernel;
-    const q8dwconv_mp_ukernel_function multipass_ukernel;
-  };
-};
+static void compute_q8conv_f32(
+    const struct q8conv_f32_context context[restrict static 1],
+    size_t group_index,
+    size_t image_index,
+    size_t mr_block_start,
+    size_t nr_block_start,
+    size_t group_range /* always 1 */,
+    size_t image_range /* always 1 */,
+    size_t mr_block_size,
+    size_t nr_block_size)
+{
+  const size_t bs = context->bs;
+  const size_t ks = context->ks;
+  const size_t kc = context->kc;
+  const size_t kc_stride = context->kc_stride;
+  const size_t m = context->m;
+  const size_t m_stride = context->m_stride;
+  const size_t n = context->n;
+  const size_t n_stride = context->n_stride;
+  const uint8_t** restrict indirect_a = context->indirect_a;
+  const void* restrict packed_w = context->packed_w;
+  const size_t c_stride = context->c_stride;
+
+  context->ukernel(
+      mr_block_size,
+      nr_block_size,
+      kc,
+      ks,
+      indirect_a + (mr_block_start + (image_index + group_index * bs) * m_stride) * ks,
+      (const void*) ((uintptr_t) packed_w + (nr_block_start + group_index * n_stride) * (kc_stride * sizeof(uint8_t) + sizeof(int32_t))),
+      (float*) ((uintptr_t) context->c + (mr_block_start + image_index * m) * c_stride) + group_index * n + nr_block_start,
+      c_stride,
+      &context->dequantization_params);
+}
 
 static void compute_dwconv_unipass(
     const struct q8dwconv_context context[restrict static 1],
@@ -249,16 +422,22 @@ static void compute_dwconv_unipass(
     size_t output_y)
 {
   const size_t output_height = context->output_height;
+  uint8_t* output = context->output + (image * output_height + output_y) * context->output_row_stride;
 
   context->unipass_ukernel(
     context->groups,
     context->output_width,
     context->indirection_buffer + (image * output_height + output_y) * context->indirection_buffer_row_stride,
     context->packed_weights,
-    context->output + (image * output_height + output_y) * context->output_row_stride,
+    output,
     context->indirection_buffer_col_stride,
     context->output_col_increment,
     &context->quantization_params);
+
+  if (context->output_lut != NULL) {
+    apply_output_lut(context->lut_ukernel, context->output_lut, context->output_width, context->groups,
+      output, context->groups + context->output_col_increment);
+  }
 }
 
 static void compute_dwconv_multiipass(
@@ -267,6 +446,7 @@ static void compute_dwconv_multiipass(
     size_t output_y)
 {
   const size_t output_height = context->output_height;
+  uint8_t* output = context->output + (image * output_height + output_y) * context->output_row_stride;
   QNNP_ALIGN(16) int32_t multipass_acc[context->group_stride];
 
   context->multipass_ukernel(
@@ -275,27 +455,16 @@ static void compute_dwconv_multiipass(
     context->indirection_buffer + (image * output_height + output_y) * context->indirection_buffer_row_stride,
     context->packed_weights,
     multipass_acc,
-    context->output + (image * output_height + output_y) * context->output_row_stride,
+    output,
     context->indirection_buffer_col_stride,
     context->output_col_increment,
     &context->quantization_params);
-}
 
-struct max_pooling_context {
-  const void** indirect_input;
-  size_t indirect_input_batch_stride;
-  size_t indirect_input_height_stride;
-  void* output;
-  size_t output_batch_stride;
-  size_t output_height_stride;
-  size_t output_width;
-  size_t pooling_size;
-  size_t channels;
-  size_t input_increment;
-  size_t output_increment;
-  union qnnp_u8_clamping_params params;
-  u8maxpool_ukernel_function ukernel;
-};
+  if (context->output_lut != NULL) {
+    apply_output_lut(context->lut_ukernel, context->output_lut, context->output_width, context->groups,
+      output, context->groups + context->output_col_increment);
+  }
+}
 
 static void compute_max_pooling(
     const struct max_pooling_context context[restrict static 1],
@@ -315,26 +484,43 @@ static void compute_max_pooling(
     &context->params);
 }
 
-struct average_pooling_context {
-  const void** indirect_input;
-  size_t indirect_input_batch_stride;
-  size_t indirect_input_height_stride;
-  void* output;
-  size_t output_batch_stride;
-  size_t output_height_stride;
-  size_t output_width;
-  size_t pooling_size;
-  size_t channels;
-  size_t packed_channels;
-  const void* zero;
-  size_t input_increment;
-  size_t output_increment;
-  union qnnp_avgpool_quantization_params quantization_params;
-  union {
-    q8avgpool_up_ukernel_function unipass_ukernel;
-    q8avgpool_mp_ukernel_function multipass_ukernel;
-  };
-};
+static void compute_resize_bilinear(
+    const struct resize_bilinear_context context[restrict static 1],
+    size_t batch_index,
+    size_t output_y)
+{
+  const void** indirect_input =
+    (const void**) ((uintptr_t) context->indirect_input +
+      batch_index * context->indirect_input_batch_stride + output_y * context->indirect_input_height_stride);
+  const int16_t* weights =
+    (const int16_t*) ((uintptr_t) context->weights + output_y * context->weights_height_stride);
+  void* output =
+    (void*) ((uintptr_t) context->output + batch_index * context->output_batch_stride + output_y * context->output_height_stride);
+
+  context->ukernel(
+    context->output_width, context->channels,
+    (const uint8_t**) indirect_input, weights, output,
+    context->output_increment);
+}
+
+static void compute_resize_nearest(
+    const struct resize_nearest_context context[restrict static 1],
+    size_t batch_index,
+    size_t output_y)
+{
+  const void** indirect_input =
+    (const void**) ((uintptr_t) context->indirect_input +
+      batch_index * context->indirect_input_batch_stride + output_y * context->indirect_input_height_stride);
+  void* output =
+    (void*) ((uintptr_t) context->output + batch_index * context->output_batch_stride + output_y * context->output_height_stride);
+
+  const size_t channels = context->channels;
+  const size_t output_pixel_stride = context->output_pixel_stride;
+  for (size_t output_x = context->output_width; output_x != 0; output_x--) {
+    memcpy(output, *indirect_input++, channels);
+    output = (void*) ((uintptr_t) output + output_pixel_stride);
+  }
+}
 
 static void compute_average_pooling_unipass(
     const struct average_pooling_context context[restrict static 1],
@@ -373,23 +559,6 @@ static void compute_average_pooling_multipass(
     &context->quantization_params);
 }
 
-struct global_average_pooling_context {
-  const void* input;
-  const void* zero;
-  size_t input_pixel_stride;
-  size_t input_batch_stride;
-  size_t input_elements;
-  size_t channels;
-  size_t packed_channels;
-  void* output;
-  size_t output_batch_stride;
-  union qnnp_avgpool_quantization_params quantization_params;
-  union {
-    q8gavgpool_up_ukernel_function unipass_ukernel;
-    q8gavgpool_mp_ukernel_function multipass_ukernel;
-  };
-};
-
 static void compute_global_average_pooling_unipass(
     const struct global_average_pooling_context context[restrict static 1],
     size_t batch_index)
@@ -430,17 +599,49 @@ static void compute_global_average_pooling_multipass(
     &context->quantization_params);
 }
 
-struct q8add_strided_context {
-  size_t n;
-  const uint8_t* a;
-  size_t a_stride;
-  const uint8_t* b;
-  size_t b_stride;
-  const uint8_t* y;
-  size_t y_stride;
-  union qnnp_add_quantization_params quantization_params;
-  q8vadd_ukernel_function ukernel;
-};
+static void compute_reduce_channels(
+    const struct reduce_context context[restrict static 1],
+    size_t batch_index,
+    size_t channel_tile_index)
+{
+  const size_t channel_start = channel_tile_index * context->channel_tile;
+  const size_t channels = min(context->channels - channel_start, context->channel_tile);
+  const void* input = (const void*) ((uintptr_t) context->input +
+    batch_index * context->input_batch_stride + channel_start * sizeof(uint8_t));
+  uint8_t* output = (uint8_t*) ((uintptr_t) context->output +
+    batch_index * context->output_batch_stride + channel_start * sizeof(uint8_t));
+  const size_t reduction_size = context->reduction_size;
+
+  if (channels < context->nr) {
+    context->ltnr_ukernel(
+      reduction_size, channels, input, context->input_stride, context->zero, output, &context->quantization_params);
+  } else if (reduction_size <= context->mr) {
+    context->genr_lemr_ukernel(
+      reduction_size, channels, input, context->input_stride, context->zero, output, &context->quantization_params);
+  } else {
+    QNNP_ALIGN(16) int32_t multipass_buffer[context->channel_tile];
+
+    context->genr_gtmr_ukernel(
+      reduction_size, channels, input, context->input_stride, context->zero,
+      multipass_buffer, output, &context->quantization_params);
+  }
+}
+
+static void compute_reduce_rows(
+    const struct reduce_context context[restrict static 1],
+    size_t batch_start,
+    size_t batch_range)
+{
+  const size_t reduction_size = context->reduction_size;
+  const int32_t bias = context->quantization_params.scalar.bias;
+  const uint8_t* input = (const uint8_t*) ((uintptr_t) context->input + batch_start * context->input_batch_stride);
+  uint8_t* output = (uint8_t*) context->output + batch_start;
+  while (batch_range-- != 0) {
+    const uint32_t sum = context->rsum_ukernel(reduction_size, input);
+    *output++ = qnnp_avgpool_quantize((int32_t) sum + bias, context->quantization_params);
+    input = (const uint8_t*) ((uintptr_t) input + context->input_batch_stride);
+  }
+}
 
 static void compute_q8add_strided(
     const struct q8add_strided_context context[restrict static 1],
@@ -460,14 +661,6 @@ static void compute_q8add_strided(
   context->ukernel(n, a, b, y, &context->quantization_params);
 }
 
-struct q8add_contiguous_context {
-  const uint8_t* a;
-  const uint8_t* b;
-  uint8_t* y;
-  union qnnp_add_quantization_params quantization_params;
-  q8vadd_ukernel_function ukernel;
-};
-
 static void compute_q8add_contiguous(
     const struct q8add_contiguous_context context[restrict static 1],
     size_t offset,
@@ -479,18 +672,40 @@ static void compute_q8add_contiguous(
   context->ukernel(size, a, b, y, &context->quantization_params);
 }
 
-struct channel_shuffle_context {
-  const void* x;
-  size_t x_stride;
-  void* y;
-  size_t y_stride;
-  size_t n;
-  size_t m;
-  union {
-    xzipc_ukernel_function fixed_ukernel;
-    xzipv_ukernel_function variable_ukernel;
-  };
-};
+static void compute_q8addc_contiguous(
+    const struct q8add_contiguous_context context[restrict static 1],
+    size_t offset,
+    size_t size)
+{
+  const void* a = (const void*) ((uintptr_t) context->a + offset);
+  void* y = (void*) ((uintptr_t) context->y + offset);
+  context->ukernel(size, a, context->b, y, &context->quantization_params);
+}
+
+static void compute_q8mul_strided(
+    const struct q8mul_strided_context context[restrict static 1],
+    size_t batch_offset,
+    size_t batch_range /* always 1 */)
+{
+  assert(batch_range == 1);
+
+  const void* a = (const void*) ((uintptr_t) context->a + context->a_stride * batch_offset);
+  const void* b = (const void*) ((uintptr_t) context->b + context->b_stride * (batch_offset / context->b_group));
+  void* y = (void*) ((uintptr_t) context->y + context->y_stride * batch_offset);
+
+  context->ukernel(context->n, a, b, y, &context->quantization_params);
+}
+
+static void compute_q8mul_contiguous(
+    const struct q8mul_contiguous_context context[restrict static 1],
+    size_t offset,
+    size_t size)
+{
+  const void* a = (const void*) ((uintptr_t) context->a + offset);
+  const void* b = (const void*) ((uintptr_t) context->b + offset);
+  void* y = (void*) ((uintptr_t) context->y + offset);
+  context->ukernel(size, a, b, y, &context->quantization_params);
+}
 
 static void compute_channel_shuffle_fixed(
     const struct channel_shuffle_context context[restrict static 1],
@@ -512,15 +727,75 @@ static void compute_channel_shuffle_variable(
   context->variable_ukernel(context->n, context->m, x, y);
 }
 
-struct lut_strided_context {
-  size_t n;
-  const void* x;
-  size_t x_stride;
-  const void* t;
-  void* y;
-  size_t y_stride;
-  x8lut_ukernel_function ukernel;
-};
+static void compute_constant_pad(
+    const struct constant_pad_context context[restrict static 1],
+    size_t ij, size_t k, size_t l, size_t row_start,
+    size_t ij_range /* always 1 */, size_t k_range /* always 1 */, size_t l_range /* always 1 */, size_t row_count)
+{
+  const size_t index[4] = { ij / context->output_size[1], ij % context->output_size[1], k, l };
+  const void* input = context->input;
+  void* output = context->output;
+  bool padding = false;
+  for (size_t dim = 0; dim < 4; dim++) {
+    output = (void*) ((uintptr_t) output + index[dim] * context->output_stride[dim]);
+    const size_t input_index = index[dim] - context->pre_paddings[dim];
+    if (index[dim] < context->pre_paddings[dim] || input_index >= context->input_size[dim]) {
+      padding = true;
+    } else {
+      input = (const void*) ((uintptr_t) input + input_index * context->input_stride[dim]);
+    }
+  }
+
+  const size_t pre_rows = context->pre_paddings[4];
+  const size_t input_rows = context->input_size[4];
+  const size_t output_row_stride = context->output_stride[4];
+  const size_t left = context->pre_paddings[5];
+  const size_t row_size = context->input_size[5];
+  const size_t right = context->post_paddings[5];
+  const uint8_t padding_value = context->padding_value;
+  const x8pad_ukernel_function ukernel = context->ukernel;
+  output = (void*) ((uintptr_t) output + row_start * output_row_stride);
+  if (padding) {
+    ukernel(row_count, 0, left + row_size + right, 0, padding_value, NULL, 0, output, output_row_stride);
+    return;
+  }
+
+  /* Split the tile of rows into leading padding, input, and trailing padding rows */
+  const size_t row_end = row_start + row_count;
+  const size_t input_row_start = min(max(row_start, pre_rows), row_end);
+  const size_t input_row_end = max(min(row_end, pre_rows + input_rows), input_row_start);
+  if (input_row_start != row_start) {
+    ukernel(input_row_start - row_start, 0, left + row_size + right, 0, padding_value, NULL, 0, output, output_row_stride);
+    output = (void*) ((uintptr_t) output + (input_row_start - row_start) * output_row_stride);
+  }
+  if (input_row_end != input_row_start) {
+    ukernel(input_row_end - input_row_start, row_size, left, right, padding_value,
+      (const void*) ((uintptr_t) input + (input_row_start - pre_rows) * context->input_stride[4]), context->input_stride[4],
+      output, output_row_stride);
+    output = (void*) ((uintptr_t) output + (input_row_end - input_row_start) * output_row_stride);
+  }
+  if (input_row_end != row_end) {
+    ukernel(row_end - input_row_end, 0, left + row_size + right, 0, padding_value, NULL, 0, output, output_row_stride);
+  }
+}
+
+static void compute_transpose(
+    const struct transpose_context context[restrict static 1],
+    size_t batch_index,
+    size_t row_start,
+    size_t column_start,
+    size_t batch_range /* always 1 */,
+    size_t row_range,
+    size_t column_range)
+{
+  const uint32_t log2_element_size = context->log2_element_size;
+  const void* x = (const void*) ((uintptr_t) context->x + batch_index * context->x_batch_stride +
+    row_start * context->x_stride + (column_start << log2_element_size));
+  void* y = (void*) ((uintptr_t) context->y + batch_index * context->y_batch_stride +
+    column_start * context->y_stride + (row_start << log2_element_size));
+
+  context->ukernel(row_range, column_range, x, context->x_stride, y, context->y_stride);
+}
 
 static void compute_lut_strided(
     const struct lut_strided_context context[restrict static 1],
@@ -532,15 +807,6 @@ static void compute_lut_strided(
   context->ukernel(context->n, x, context->t, y);
 }
 
-struct lut_contiguous_context {
-  const void* x;
-  size_t x_stride;
-  const void* t;
-  void* y;
-  size_t y_stride;
-  x8lut_ukernel_function ukernel;
-};
-
 static void compute_lut_contiguous(
     const struct lut_contiguous_context context[restrict static 1],
     size_t offset,
@@ -552,16 +818,6 @@ static void compute_lut_contiguous(
   context->ukernel(size, x, context->t, y);
 }
 
-struct clamp_strided_context {
-  size_t n;
-  const void* x;
-  size_t x_stride;
-  void* y;
-  size_t y_stride;
-  u8clamp_ukernel_function ukernel;
-  union qnnp_u8_clamping_params params;
-};
-
 static void compute_clamp_strided(
     const struct clamp_strided_context context[restrict static 1],
     size_t batch_index)
@@ -571,15 +827,6 @@ static void compute_clamp_strided(
   context->ukernel(context->n, x, y, &context->params);
 }
 
-struct clamp_contiguous_context {
-  const void* x;
-  size_t x_stride;
-  void* y;
-  size_t y_stride;
-  u8clamp_ukernel_function ukernel;
-  union qnnp_u8_clamping_params params;
-};
-
 static void compute_clamp_contiguous(
     const struct clamp_contiguous_context context[restrict static 1],
     size_t offset,
@@ -590,49 +837,135 @@ static void compute_clamp_contiguous(
   context->ukernel(size, x, y, &context->params);
 }
 
-struct u8softargmax_context {
-  size_t n;
-  const uint8_t* x;
-  size_t x_stride;
-  const uint32_t* t;
-  uint8_t* y;
-  size_t y_stride;
-  u8rmax_ukernel_function rmax_ukernel;
-  u8lut32norm_ukernel_function lut_norm_ukernel;
-};
-
-static void compute_u8softargmax(
-    const struct u8softargmax_context context[restrict static 1],
+static void compute_quantize_strided(
+    const struct quantize_strided_context context[restrict static 1],
     size_t batch_index)
 {
-  const uint8_t* x = (const uint8_t*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  const float* x = (const float*) ((uintptr_t) context->x + context->x_stride * batch_index);
   uint8_t* y = (uint8_t*) ((uintptr_t) context->y + context->y_stride * batch_index);
-  const size_t n = context->n;
-
-  const uint8_t x_max = context->rmax_ukernel(n, x);
-  const size_t adjustment = x_max ^ 255;
-  const uint32_t* t = (const uint32_t*) context->t + adjustment;
-  context->lut_norm_ukernel(n, x, t, y);
+  context->ukernel(context->n, x, y, &context->params);
 }
 
-enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
+static void compute_quantize_contiguous(
+    const struct quantize_contiguous_context context[restrict static 1],
+    size_t offset,
+    size_t size)
 {
-  switch (op->ukernel_type) {
-    case qnnp_ukernel_type_dwconv:
-    {
-      const size_t batch_size = op->batch_size;
-      const size_t groups = op->groups;
-      const size_t kernel_height = op->kernel_height;
-      const size_t kernel_width = op->kernel_width;
-      const size_t kernel_size = kernel_height * kernel_width;
-      const size_t width_step = op->dilation_width == 1 ? op->stride_width : op->kernel_width;
-      const size_t output_height = op->output_height;
-      const size_t output_width = op->output_width;
+  context->ukernel(size, context->x + offset, context->y + offset, &context->params);
+}
+
+static void compute_dequantize_strided(
+    const struct dequantize_strided_context context[restrict static 1],
+    size_t batch_index)
+{
+  const uint8_t* x = (const uint8_t*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  float* y = (float*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  context->ukernel(context->n, x, y, &context->params);
+}
+
+static void compute_dequantize_contiguous(
+    const struct dequantize_contiguous_context context[restrict static 1],
+    size_t offset,
+    size_t size)
+{
+  context->ukernel(size, context->x + offset, context->y + offset, &context->params);
+}
+
+static void compute_u8softargmax(
+    const struct u8softargmax_context context[restrict static 1],
+    size_t batch_index)
+{
+  const uint8_t* x = (const uint8_t*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  uint8_t* y = (uint8_t*) ((uintptr_t) context->y + context->y_stride * batch_index);
+  context->ukernel(context->n, x, context->t, y, &context->params);
+}
+
+static void compute_argmax(
+    const struct top_k_context context[restrict static 1],
+    size_t batch_index)
+{
+  const uint8_t* x = (const uint8_t*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  const uint8_t vmax = context->rmax_ukernel(context->n, x);
+  /* memchr is vectorized in every major C library, and stops at the first (lowest index) maximum */
+  const uint8_t* xmax = (const uint8_t*) memchr(x, vmax, context->n);
+  assert(xmax != NULL);
+
+  context->y_indices[batch_index * context->y_indices_stride] = (uint32_t) (xmax - x);
+  if (context->y_values != NULL) {
+    context->y_values[batch_index * context->y_values_stride] = vmax;
+  }
+}
+
+static void compute_top_k(
+    const struct top_k_context context[restrict static 1],
+    size_t batch_index)
+{
+  const size_t n = context->n;
+  const size_t k = context->k;
+  const uint8_t* x = (const uint8_t*) ((uintptr_t) context->x + context->x_stride * batch_index);
+  uint8_t* y_values = context->y_values == NULL ? NULL : context->y_values + batch_index * context->y_values_stride;
+  uint32_t* y_indices = context->y_indices + batch_index * context->y_indices_stride;
+
+  uint32_t histogram[256] = { 0 };
+  for (size_t i = 0; i < n; i++) {
+    histogram[x[i]] += 1;
+  }
+
+  /* The K-th largest value: all larger values and the first (k - count_above) equal ones make the output */
+  size_t count_above = 0;
+  uint32_t threshold = 255;
+  while (count_above + histogram[threshold] < k) {
+    count_above += histogram[threshold];
+    threshold -= 1;
+  }
+
+  /* Output position of the next element of every value, so that a single in-order scan emits sorted outputs */
+  uint32_t position[256];
+  uint32_t next_position = 0;
+  for (uint32_t value = 255; value > threshold; value--) {
+    position[value] = next_position;
+    next_position += histogram[value];
+  }
+  position[threshold] = next_position;
+
+  size_t remaining = k;
+  for (size_t i = 0; remaining != 0; i++) {
+    const uint8_t vx = x[i];
+    if (vx > threshold || (vx == threshold && position[vx] < k)) {
+      const uint32_t output_index = position[vx]++;
+      y_indices[output_index] = (uint32_t) i;
+      if (y_values != NULL) {
+        y_values[output_index] = vx;
+      }
+      remaining -= 1;
+    }
+  }
+}
+
+enum qnnp_status qnnp_prepare_compute_plan(qnnp_operator_t op, struct qnnp_compute_plan* plan)
+{
+  if (op->batch_size == 0) {
+    qnnp_log_error("failed to run operator: operator is not set up");
+    return qnnp_status_invalid_parameter;
+  }
+
+  plan->stages_count = 1;
+  switch (op->ukernel_type) {
+    case qnnp_ukernel_type_dwconv:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t groups = op->groups;
+      const size_t kernel_height = op->kernel_height;
+      const size_t kernel_width = op->kernel_width;
+      const size_t kernel_size = kernel_height * kernel_width;
+      const size_t width_step = op->dilation_width == 1 ? op->stride_width : op->kernel_width;
+      const size_t output_height = op->output_height;
+      const size_t output_width = op->output_width;
 
       switch (kernel_size) {
         case 9:
         {
-          struct q8dwconv_context context = {
+          plan->context.q8dwconv = (struct q8dwconv_context) {
               .groups = groups,
               .indirection_buffer = (const uint8_t**) op->indirection_buffer,
               .indirection_buffer_row_stride = kernel_size + (output_width * width_step - 1) * kernel_height,
@@ -644,18 +977,21 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
               .output_row_stride = output_width * op->output_pixel_stride,
               .output_col_increment = (op->output_pixel_stride - groups) * sizeof(uint8_t),
               .quantization_params = op->conv_quantization_params,
-              .unipass_ukernel = qnnp_params.q8dw9.updw,
+              .unipass_ukernel = op->ukernel.q8dwconv.q8dw9.updw,
+              .output_lut = op->lookup_table,
+              .lut_ukernel = qnnp_params.x8lut,
+          };
+          plan->stages[0] = (struct qnnp_compute) {
+              .type = qnnp_parallelization_type_2d,
+              .function_2d = (pthreadpool_function_2d_t) compute_dwconv_unipass,
+              .context = &plan->context.q8dwconv,
+              .range = { batch_size, output_height },
           };
-          pthreadpool_compute_2d(
-              threadpool,
-              (pthreadpool_function_2d_t) compute_dwconv_unipass,
-              &context,
-              batch_size, output_height);
           break;
         }
         case 25:
         {
-          struct q8dwconv_context context = {
+          plan->context.q8dwconv = (struct q8dwconv_context) {
               .groups = groups,
               .group_stride = op->group_stride,
               .indirection_buffer = (const uint8_t**) op->indirection_buffer,
@@ -668,13 +1004,16 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
               .output_row_stride = output_width * op->output_pixel_stride,
               .output_col_increment = (op->output_pixel_stride - groups) * sizeof(uint8_t),
               .quantization_params = op->conv_quantization_params,
-              .multipass_ukernel = qnnp_params.q8dw25.mpdw,
+              .multipass_ukernel = op->ukernel.q8dwconv.q8dw25.mpdw,
+              .output_lut = op->lookup_table,
+              .lut_ukernel = qnnp_params.x8lut,
+          };
+          plan->stages[0] = (struct qnnp_compute) {
+              .type = qnnp_parallelization_type_2d,
+              .function_2d = (pthreadpool_function_2d_t) compute_dwconv_multiipass,
+              .context = &plan->context.q8dwconv,
+              .range = { batch_size, output_height },
           };
-          pthreadpool_compute_2d(
-              threadpool,
-              (pthreadpool_function_2d_t) compute_dwconv_multiipass,
-              &context,
-              batch_size, output_height);
           break;
         }
         default:
@@ -698,7 +1037,7 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       const size_t input_size = op->input_height * op->input_width;
       int32_t* a_sum = (int32_t*) op->a_sum;
 
-      struct q8sum_rows_context context = {
+      plan->context.xzp.q8sum_rows = (struct q8sum_rows_context) {
           .a = op->input,
           .groups = groups,
           .m = input_size,
@@ -709,14 +1048,15 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .a_sum_stride = input_size,
           .ukernel = qnnp_params.q8sum_rows.sum_rows,
       };
-      pthreadpool_compute_3d_tiled(
-        threadpool,
-        (pthreadpool_function_3d_tiled_t) compute_sum_rows,
-        &context,
-        groups, batch_size, input_size,
-        1, 1, qnnp_params.q8sum_rows.m);
+      plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_3d_tiled,
+          .function_3d_tiled = (pthreadpool_function_3d_tiled_t) compute_sum_rows,
+          .context = &plan->context.xzp.q8sum_rows,
+          .range = { groups, batch_size, input_size },
+          .tile = { 1, 1, qnnp_params.q8sum_rows.m },
+      };
 
-      struct q8gemm_xzp_context q8gemm_xzp_context = {
+      plan->context.xzp.q8gemm_xzp = (struct q8gemm_xzp_context) {
           .k = group_input_channels,
           .k_stride = k_stride,
           .n = group_output_channels,
@@ -732,13 +1072,17 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .a_sum_stride = input_size,
           .requantization_params = op->requantization_params,
           .ukernel = qnnp_params.q8conv_xzp.gemm,
+          .output_lut = op->lookup_table,
+          .lut_ukernel = qnnp_params.x8lut,
       };
-      pthreadpool_compute_4d_tiled(
-          threadpool,
-          (pthreadpool_function_4d_tiled_t) compute_q8gemm_xzp,
-          &q8gemm_xzp_context,
-          groups, batch_size * input_size, input_size, group_output_channels,
-          1, input_size, mr, nr);
+      plan->stages[1] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_4d_tiled,
+          .function_4d_tiled = (pthreadpool_function_4d_tiled_t) compute_q8gemm_xzp,
+          .context = &plan->context.xzp.q8gemm_xzp,
+          .range = { groups, batch_size * input_size, input_size, group_output_channels },
+          .tile = { 1, input_size, mr, nr },
+      };
+      plan->stages_count = 2;
       break;
     }
     case qnnp_ukernel_type_gemm:
@@ -747,33 +1091,151 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       const size_t groups = op->groups;
       const size_t group_input_channels = op->group_input_channels;
       const size_t group_output_channels = op->group_output_channels;
-      const uint32_t mr = qnnp_params.q8conv.mr;
-      const uint32_t nr = qnnp_params.q8conv.nr;
-      const uint32_t kr = qnnp_params.q8conv.kr;
+      const size_t output_size = op->output_height * op->output_width;
+      switch (op->conv_output_type) {
+        case qnnp_conv_output_type_quint8:
+        {
+          const uint32_t mr = op->ukernel.q8conv.mr;
+          const uint32_t nr = op->ukernel.q8conv.nr;
+          const uint32_t kr = op->ukernel.q8conv.kr;
+          const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
+          const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+          plan->context.q8gemm = (struct q8gemm_context) {
+              .k = group_input_channels,
+              .k_stride = k_stride,
+              .n = group_output_channels,
+              .n_stride = n_stride,
+              .a = op->input,
+              .a_stride = op->input_pixel_stride,
+              .packed_w = op->packed_weights,
+              .c = op->output,
+              .c_stride = op->output_pixel_stride,
+              .quantization_params = op->conv_quantization_params,
+              .ukernel = op->ukernel.q8conv.gemm,
+              .output_lut = op->lookup_table,
+              .lut_ukernel = qnnp_params.x8lut,
+          };
+          plan->stages[0] = (struct qnnp_compute) {
+              .type = qnnp_parallelization_type_4d_tiled,
+              .function_4d_tiled = (pthreadpool_function_4d_tiled_t) compute_q8gemm,
+              .context = &plan->context.q8gemm,
+              .range = { groups, batch_size * output_size, output_size, group_output_channels },
+              .tile = { 1, output_size, mr, nr },
+          };
+          break;
+        }
+        case qnnp_conv_output_type_int32:
+        {
+          const uint32_t mr = op->ukernel.q8conv_i32.mr;
+          const uint32_t nr = op->ukernel.q8conv_i32.nr;
+          const uint32_t kr = op->ukernel.q8conv_i32.kr;
+          const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
+          const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+          plan->context.q8gemm_s32 = (struct q8gemm_s32_context) {
+              .k = group_input_channels,
+              .k_stride = k_stride,
+              .n = group_output_channels,
+              .n_stride = n_stride,
+              .a = op->input,
+              .a_stride = op->input_pixel_stride,
+              .packed_w = op->packed_weights,
+              .c = op->output,
+              .c_stride = op->output_pixel_stride * sizeof(int32_t),
+              .quantization_params = op->kernel_zero_point_params,
+              .ukernel = op->ukernel.q8conv_i32.gemm,
+          };
+          plan->stages[0] = (struct qnnp_compute) {
+              .type = qnnp_parallelization_type_4d_tiled,
+              .function_4d_tiled = (pthreadpool_function_4d_tiled_t) compute_q8gemm_s32,
+              .context = &plan->context.q8gemm_s32,
+              .range = { groups, batch_size * output_size, output_size, group_output_channels },
+              .tile = { 1, output_size, mr, nr },
+          };
+          break;
+        }
+        case qnnp_conv_output_type_float32:
+        {
+          const uint32_t mr = op->ukernel.q8conv_f32.mr;
+          const uint32_t nr = op->ukernel.q8conv_f32.nr;
+          const uint32_t kr = op->ukernel.q8conv_f32.kr;
+          const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
+          const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+          plan->context.q8gemm_f32 = (struct q8gemm_f32_context) {
+              .k = group_input_channels,
+              .k_stride = k_stride,
+              .n = group_output_channels,
+              .n_stride = n_stride,
+              .a = op->input,
+              .a_stride = op->input_pixel_stride,
+              .packed_w = op->packed_weights,
+              .c = op->output,
+              .c_stride = op->output_pixel_stride * sizeof(float),
+              .dequantization_params = op->conv_dequantization_params,
+              .ukernel = op->ukernel.q8conv_f32.gemm,
+          };
+          plan->stages[0] = (struct qnnp_compute) {
+              .type = qnnp_parallelization_type_4d_tiled,
+              .function_4d_tiled = (pthreadpool_function_4d_tiled_t) compute_q8gemm_f32,
+              .context = &plan->context.q8gemm_f32,
+              .range = { groups, batch_size * output_size, output_size, group_output_channels },
+              .tile = { 1, output_size, mr, nr },
+          };
+          break;
+        }
+      }
+      break;
+    }
+    case qnnp_ukernel_type_dynamic_gemm:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t group_input_channels = op->group_input_channels;
+      const size_t group_output_channels = op->group_output_channels;
+      const uint32_t mr = op->ukernel.q8conv_i32.mr;
+      const uint32_t nr = op->ukernel.q8conv_i32.nr;
+      const uint32_t kr = op->ukernel.q8conv_i32.kr;
       const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
       const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+      const size_t packed_weights_size = n_stride * (k_stride * sizeof(uint8_t) + sizeof(int32_t));
+      const int32_t* kernel_sums = (const int32_t*) ((uintptr_t) op->packed_weights + packed_weights_size);
 
-      const size_t output_size = op->output_height * op->output_width;
-      struct q8gemm_context q8gemm_context = {
+      struct qnnp_dynamic_gemm_scratch_layout layout;
+      qnnp_compute_dynamic_gemm_scratch_layout(batch_size, k_stride, &layout);
+      const size_t nc = min(n_stride, 16 * nr);
+      plan->context.q8gemm_dq = (struct q8gemm_dq_context) {
           .k = group_input_channels,
           .k_stride = k_stride,
-          .n = group_output_channels,
-          .n_stride = n_stride,
           .a = op->input,
-          .a_stride = op->input_pixel_stride,
+          .a_stride = op->input_pixel_stride * sizeof(float),
+          .a_quantized = (uint8_t*) ((uintptr_t) op->a_sum + layout.a_offset),
+          .row_scale = (float*) ((uintptr_t) op->a_sum + layout.row_scale_offset),
+          .row_zero_point = (int32_t*) ((uintptr_t) op->a_sum + layout.row_zero_point_offset),
           .packed_w = op->packed_weights,
+          .kernel_sums = kernel_sums,
+          .bias = (const float*) (kernel_sums + n_stride),
+          .kernel_scale = op->kernel_scale,
           .c = op->output,
-          .c_stride = op->output_pixel_stride,
-          .quantization_params = op->conv_quantization_params,
-          .ukernel = qnnp_params.q8conv.gemm,
+          .c_stride = op->output_pixel_stride * sizeof(float),
+          .mr = mr,
+          .nr = nr,
+          .quantization_params = qnnp_compute_kernel_zero_point_params(op->kernel_zero_point),
+          .gemm_ukernel = op->ukernel.q8conv_i32.gemm,
+          .rminmax_ukernel = qnnp_params.srminmax,
+          .quantize_ukernel = qnnp_params.q8vquantize,
       };
-
-      pthreadpool_compute_4d_tiled(
-          threadpool,
-          (pthreadpool_function_4d_tiled_t) compute_q8gemm,
-          &q8gemm_context,
-          groups, batch_size * output_size, output_size, group_output_channels,
-          1, output_size, mr, nr);
+      plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d,
+          .function_1d = (pthreadpool_function_1d_t) compute_q8gemm_dq_quantize,
+          .context = &plan->context.q8gemm_dq,
+          .range = { batch_size },
+      };
+      plan->stages[1] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_3d_tiled,
+          .function_3d_tiled = (pthreadpool_function_3d_tiled_t) compute_q8gemm_dq,
+          .context = &plan->context.q8gemm_dq,
+          .range = { 1, batch_size, group_output_channels },
+          .tile = { 1, mr, nc },
+      };
+      plan->stages_count = 2;
       break;
     }
     case qnnp_ukernel_type_conv:
@@ -782,38 +1244,111 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       const size_t groups = op->groups;
       const size_t group_input_channels = op->group_input_channels;
       const size_t group_output_channels = op->group_output_channels;
-      const uint32_t mr = qnnp_params.q8conv.mr;
-      const uint32_t nr = qnnp_params.q8conv.nr;
-      const uint32_t kr = qnnp_params.q8conv.kr;
-      const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
-      const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
-
       const size_t output_size = op->output_height * op->output_width;
       const size_t kernel_size = op->kernel_height * op->kernel_width;
-      const size_t m_stride = round_up(output_size, mr);
-      struct q8conv_context q8conv_context = {
-          .bs = batch_size,
-          .ks = kernel_size,
-          .kc = group_input_channels,
-          .kc_stride = k_stride * kernel_size,
-          .m = output_size,
-          .m_stride = m_stride,
-          .n = group_output_channels,
-          .n_stride = n_stride,
-          .indirect_a = (const uint8_t**) op->indirection_buffer,
-          .packed_w = op->packed_weights,
-          .c = op->output,
-          .c_stride = op->output_pixel_stride,
-          .quantization_params = op->conv_quantization_params,
-          .ukernel = qnnp_params.q8conv.conv,
-      };
-
-      pthreadpool_compute_4d_tiled(
-          threadpool,
-          (pthreadpool_function_4d_tiled_t) compute_q8conv,
-          &q8conv_context,
-          groups, batch_size, output_size, group_output_channels,
-          1, 1, mr, nr);
+      switch (op->conv_output_type) {
+        case qnnp_conv_output_type_quint8:
+        {
+          const uint32_t mr = op->ukernel.q8conv.mr;
+          const uint32_t nr = op->ukernel.q8conv.nr;
+          const uint32_t kr = op->ukernel.q8conv.kr;
+          const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
+          const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+          const size_t m_stride = round_up(output_size, mr);
+          plan->context.q8conv = (struct q8conv_context) {
+              .bs = batch_size,
+              .ks = kernel_size,
+              .kc = group_input_channels,
+              .kc_stride = k_stride * kernel_size,
+              .m = output_size,
+              .m_stride = m_stride,
+              .n = group_output_channels,
+              .n_stride = n_stride,
+              .indirect_a = (const uint8_t**) op->indirection_buffer,
+              .packed_w = op->packed_weights,
+              .c = op->output,
+              .c_stride = op->output_pixel_stride,
+              .quantization_params = op->conv_quantization_params,
+              .ukernel = op->ukernel.q8conv.conv,
+              .output_lut = op->lookup_table,
+              .lut_ukernel = qnnp_params.x8lut,
+          };
+          plan->stages[0] = (struct qnnp_compute) {
+              .type = qnnp_parallelization_type_4d_tiled,
+              .function_4d_tiled = (pthreadpool_function_4d_tiled_t) compute_q8conv,
+              .context = &plan->context.q8conv,
+              .range = { groups, batch_size, output_size, group_output_channels },
+              .tile = { 1, 1, mr, nr },
+          };
+          break;
+        }
+        case qnnp_conv_output_type_int32:
+        {
+          const uint32_t mr = op->ukernel.q8conv_i32.mr;
+          const uint32_t nr = op->ukernel.q8conv_i32.nr;
+          const uint32_t kr = op->ukernel.q8conv_i32.kr;
+          const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
+          const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+          const size_t m_stride = round_up(output_size, mr);
+          plan->context.q8conv_s32 = (struct q8conv_s32_context) {
+              .bs = batch_size,
+              .ks = kernel_size,
+              .kc = group_input_channels,
+              .kc_stride = k_stride * kernel_size,
+              .m = output_size,
+              .m_stride = m_stride,
+              .n = group_output_channels,
+              .n_stride = n_stride,
+              .indirect_a = (const uint8_t**) op->indirection_buffer,
+              .packed_w = op->packed_weights,
+              .c = op->output,
+              .c_stride = op->output_pixel_stride * sizeof(int32_t),
+              .quantization_params = op->kernel_zero_point_params,
+              .ukernel = op->ukernel.q8conv_i32.conv,
+          };
+          plan->stages[0] = (struct qnnp_compute) {
+              .type = qnnp_parallelization_type_4d_tiled,
+              .function_4d_tiled = (pthreadpool_function_4d_tiled_t) compute_q8conv_s32,
+              .context = &plan->context.q8conv_s32,
+              .range = { groups, batch_size, output_size, group_output_channels },
+              .tile = { 1, 1, mr, nr },
+          };
+          break;
+        }
+        case qnnp_conv_output_type_float32:
+        {
+          const uint32_t mr = op->ukernel.q8conv_f32.mr;
+          const uint32_t nr = op->ukernel.q8conv_f32.nr;
+          const uint32_t kr = op->ukernel.q8conv_f32.kr;
+          const size_t k_stride = (group_input_channels + (kr - 1)) & -kr;
+          const size_t n_stride = (group_output_channels + (nr - 1)) & -nr;
+          const size_t m_stride = round_up(output_size, mr);
+          plan->context.q8conv_f32 = (struct q8conv_f32_context) {
+              .bs = batch_size,
+              .ks = kernel_size,
+              .kc = group_input_channels,
+              .kc_stride = k_stride * kernel_size,
+              .m = output_size,
+              .m_stride = m_stride,
+              .n = group_output_channels,
+              .n_stride = n_stride,
+              .indirect_a = (const uint8_t**) op->indirection_buffer,
+              .packed_w = op->packed_weights,
+              .c = op->output,
+              .c_stride = op->output_pixel_stride * sizeof(float),
+              .dequantization_params = op->conv_dequantization_params,
+              .ukernel = op->ukernel.q8conv_f32.conv,
+          };
+          plan->stages[0] = (struct qnnp_compute) {
+              .type = qnnp_parallelization_type_4d_tiled,
+              .function_4d_tiled = (pthreadpool_function_4d_tiled_t) compute_q8conv_f32,
+              .context = &plan->context.q8conv_f32,
+              .range = { groups, batch_size, output_size, group_output_channels },
+              .tile = { 1, 1, mr, nr },
+          };
+          break;
+        }
+      }
       break;
     }
     case qnnp_ukernel_type_average_pooling:
@@ -836,7 +1371,8 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       if (channels >= kr && pooling_size > mr) {
         multipass_adjustment = round_up(pooling_size - mr, qr) + mr - qr;
       }
-      struct average_pooling_context context = {
+      struct average_pooling_context* context = &plan->context.average_pooling;
+      *context = (struct average_pooling_context) {
           .indirect_input = op->indirection_buffer,
           .indirect_input_batch_stride = output_height * indirect_input_height_stride,
           .indirect_input_height_stride = indirect_input_height_stride,
@@ -856,18 +1392,23 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       pthreadpool_function_2d_t compute_function = NULL;
       if (channels < kr) {
         compute_function = (pthreadpool_function_2d_t) compute_average_pooling_unipass;
-        context.unipass_ukernel = qnnp_params.q8avgpool.ltkr;
+        context->unipass_ukernel = qnnp_params.q8avgpool.ltkr;
       } else {
         if (pooling_size <= mr) {
           compute_function = (pthreadpool_function_2d_t) compute_average_pooling_unipass;
-          context.unipass_ukernel = qnnp_params.q8avgpool.gekr_lemr;
+          context->unipass_ukernel = qnnp_params.q8avgpool.gekr_lemr;
         } else {
           compute_function = (pthreadpool_function_2d_t) compute_average_pooling_multipass;
-          context.multipass_ukernel = qnnp_params.q8avgpool.gekr_gtmr;
+          context->multipass_ukernel = qnnp_params.q8avgpool.gekr_gtmr;
         }
       }
 
-      pthreadpool_compute_2d(threadpool, compute_function, &context, op->batch_size, output_height);
+      plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_2d,
+          .function_2d = compute_function,
+          .context = context,
+          .range = { op->batch_size, output_height },
+      };
       break;
     }
     case qnnp_ukernel_type_max_pooling:
@@ -890,7 +1431,7 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       if (channels >= kr) {
         multipass_adjustment = round_up(doz(pooling_size, mr), qr) + mr;
       }
-      struct max_pooling_context context = {
+      plan->context.max_pooling = (struct max_pooling_context) {
           .indirect_input = op->indirection_buffer,
           .indirect_input_batch_stride = output_height * indirect_input_height_stride,
           .indirect_input_height_stride = indirect_input_height_stride,
@@ -906,11 +1447,67 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .ukernel = channels < kr ? qnnp_params.u8maxpool.ltkr : qnnp_params.u8maxpool.gekr,
       };
 
-      pthreadpool_compute_2d(threadpool,
-        (pthreadpool_function_2d_t) compute_max_pooling, &context,
-        op->batch_size, output_height);
+      plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_2d,
+          .function_2d = (pthreadpool_function_2d_t) compute_max_pooling,
+          .context = &plan->context.max_pooling,
+          .range = { op->batch_size, output_height },
+      };
       break;
     };
+    case qnnp_ukernel_type_resize_bilinear:
+    {
+      const size_t output_width = op->output_width;
+      const size_t output_height = op->output_height;
+      const size_t indirect_input_height_stride = output_width * 4 * sizeof(void*);
+      const size_t output_height_stride = output_width * op->output_pixel_stride;
+      plan->context.resize_bilinear = (struct resize_bilinear_context) {
+          .indirect_input = op->indirection_buffer,
+          .indirect_input_batch_stride = output_height * indirect_input_height_stride,
+          .indirect_input_height_stride = indirect_input_height_stride,
+          .weights = op->packed_weights,
+          .weights_height_stride = output_width * 2 * sizeof(int16_t),
+          .output = op->output,
+          .output_batch_stride = output_height * output_height_stride,
+          .output_height_stride = output_height_stride,
+          .output_width = output_width,
+          .channels = op->channels,
+          .output_increment = (op->output_pixel_stride - op->channels) * sizeof(uint8_t),
+          .ukernel = qnnp_params.u8ibilinear,
+      };
+      plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_2d,
+          .function_2d = (pthreadpool_function_2d_t) compute_resize_bilinear,
+          .context = &plan->context.resize_bilinear,
+          .range = { op->batch_size, output_height },
+      };
+      break;
+    }
+    case qnnp_ukernel_type_resize_nearest:
+    {
+      const size_t output_width = op->output_width;
+      const size_t output_height = op->output_height;
+      const size_t indirect_input_height_stride = output_width * sizeof(void*);
+      const size_t output_height_stride = output_width * op->output_pixel_stride;
+      plan->context.resize_nearest = (struct resize_nearest_context) {
+          .indirect_input = op->indirection_buffer,
+          .indirect_input_batch_stride = output_height * indirect_input_height_stride,
+          .indirect_input_height_stride = indirect_input_height_stride,
+          .output = op->output,
+          .output_batch_stride = output_height * output_height_stride,
+          .output_height_stride = output_height_stride,
+          .output_width = output_width,
+          .output_pixel_stride = op->output_pixel_stride,
+          .channels = op->channels,
+      };
+      plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_2d,
+          .function_2d = (pthreadpool_function_2d_t) compute_resize_nearest,
+          .context = &plan->context.resize_nearest,
+          .range = { op->batch_size, output_height },
+      };
+      break;
+    }
     case qnnp_ukernel_type_add:
     {
       const size_t batch_size = op->batch_size;
@@ -918,22 +1515,33 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       const size_t a_stride = op->input_pixel_stride;
       const size_t b_stride = op->input2_pixel_stride;
       const size_t y_stride = op->output_pixel_stride;
-      if ((((a_stride ^ channels) | (b_stride ^ channels) | (y_stride ^ channels)) == 0) || batch_size == 1) {
+      /* A B element broadcast over a whole row is kept in registers by the q8vaddc micro-kernel */
+      const bool b_scalar = op->input2_channels == 1 && (channels != 1 || op->input2_batch_size != batch_size);
+      const bool b_constant = b_scalar && op->input2_batch_size == 1;
+      const q8vadd_ukernel_function ukernel = b_scalar ? qnnp_params.q8vaddc : qnnp_params.q8vadd;
+      bool contiguous = (((a_stride ^ channels) | (y_stride ^ channels)) == 0) || batch_size == 1;
+      if (!b_constant && batch_size != 1) {
+        contiguous &= !b_scalar && op->input2_batch_size == batch_size && b_stride == channels;
+      }
+      if (contiguous) {
         const size_t block_size = 4096;
-        struct q8add_contiguous_context add_context = {
+        plan->context.q8add_contiguous = (struct q8add_contiguous_context) {
           .a = op->input,
           .b = op->input2,
           .y = op->output,
           .quantization_params = op->add_quantization_params,
-          .ukernel = qnnp_params.q8vadd,
+          .ukernel = ukernel,
+        };
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d_tiled,
+          .function_1d_tiled = (pthreadpool_function_1d_tiled_t)
+            (b_constant ? compute_q8addc_contiguous : compute_q8add_contiguous),
+          .context = &plan->context.q8add_contiguous,
+          .range = { batch_size * channels * sizeof(uint8_t) },
+          .tile = { block_size },
         };
-        pthreadpool_compute_1d_tiled(
-          threadpool,
-          (pthreadpool_function_1d_tiled_t) compute_q8add_contiguous,
-          &add_context,
-          batch_size * channels * sizeof(uint8_t), block_size);
       } else {
-        struct q8add_strided_context add_context = {
+        plan->context.q8add_strided = (struct q8add_strided_context) {
           .a = op->input,
           .a_stride = a_stride * sizeof(uint8_t),
           .b = op->input2,
@@ -942,13 +1550,64 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .y_stride = y_stride * sizeof(uint8_t),
           .n = channels,
           .quantization_params = op->add_quantization_params,
-          .ukernel = qnnp_params.q8vadd,
+          .ukernel = ukernel,
+        };
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d_tiled,
+          .function_1d_tiled = (pthreadpool_function_1d_tiled_t) compute_q8add_strided,
+          .context = &plan->context.q8add_strided,
+          .range = { batch_size },
+          .tile = { 1 },
+        };
+      }
+      break;
+    }
+    case qnnp_ukernel_type_multiply:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t b_batch_size = op->input2_batch_size;
+      const size_t channels = op->channels;
+      const size_t a_stride = op->input_pixel_stride;
+      const size_t b_stride = op->input2_pixel_stride;
+      const size_t y_stride = op->output_pixel_stride;
+      if ((b_batch_size == batch_size && ((a_stride ^ channels) | (b_stride ^ channels) | (y_stride ^ channels)) == 0) ||
+          batch_size == 1)
+      {
+        const size_t block_size = 4096;
+        plan->context.q8mul_contiguous = (struct q8mul_contiguous_context) {
+          .a = op->input,
+          .b = op->input2,
+          .y = op->output,
+          .quantization_params = op->mul_quantization_params,
+          .ukernel = qnnp_params.q8vmul,
+        };
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d_tiled,
+          .function_1d_tiled = (pthreadpool_function_1d_tiled_t) compute_q8mul_contiguous,
+          .context = &plan->context.q8mul_contiguous,
+          .range = { batch_size * channels * sizeof(uint8_t) },
+          .tile = { block_size },
+        };
+      } else {
+        plan->context.q8mul_strided = (struct q8mul_strided_context) {
+          .a = op->input,
+          .a_stride = a_stride * sizeof(uint8_t),
+          .b = op->input2,
+          .b_stride = b_stride * sizeof(uint8_t),
+          .b_group = batch_size / b_batch_size,
+          .y = op->output,
+          .y_stride = y_stride * sizeof(uint8_t),
+          .n = channels,
+          .quantization_params = op->mul_quantization_params,
+          .ukernel = qnnp_params.q8vmul,
+        };
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d_tiled,
+          .function_1d_tiled = (pthreadpool_function_1d_tiled_t) compute_q8mul_strided,
+          .context = &plan->context.q8mul_strided,
+          .range = { batch_size },
+          .tile = { 1 },
         };
-        pthreadpool_compute_1d_tiled(
-          threadpool,
-          (pthreadpool_function_1d_tiled_t) compute_q8add_strided,
-          &add_context,
-          batch_size, 1);
       }
       break;
     }
@@ -959,7 +1618,8 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       const size_t input_pixel_stride = op->input_pixel_stride * sizeof(uint8_t);
       const size_t input_width = op->input_width;
       const size_t channels = op->channels;
-      struct global_average_pooling_context context = {
+      struct global_average_pooling_context* context = &plan->context.global_average_pooling;
+      *context = (struct global_average_pooling_context) {
           .input = op->input,
           .zero = op->zero_pointer,
           .input_pixel_stride = input_pixel_stride,
@@ -974,18 +1634,66 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       pthreadpool_function_1d_t compute_function = NULL;
       if (channels < nr) {
         compute_function = (pthreadpool_function_1d_t) compute_global_average_pooling_unipass;
-        context.unipass_ukernel = qnnp_params.q8gavgpool.ltnr;
+        context->unipass_ukernel = qnnp_params.q8gavgpool.ltnr;
       } else {
         if (input_width <= mr) {
           compute_function = (pthreadpool_function_1d_t) compute_global_average_pooling_unipass;
-          context.unipass_ukernel = qnnp_params.q8gavgpool.genr_lemr;
+          context->unipass_ukernel = qnnp_params.q8gavgpool.genr_lemr;
         } else {
           compute_function = (pthreadpool_function_1d_t) compute_global_average_pooling_multipass;
-          context.multipass_ukernel = qnnp_params.q8gavgpool.genr_gtmr;
+          context->multipass_ukernel = qnnp_params.q8gavgpool.genr_gtmr;
         }
       }
 
-      pthreadpool_compute_1d(threadpool, compute_function, &context, op->batch_size);
+      plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d,
+          .function_1d = compute_function,
+          .context = context,
+          .range = { op->batch_size },
+      };
+      break;
+    }
+    case qnnp_ukernel_type_reduce_mean:
+    case qnnp_ukernel_type_reduce_sum:
+    {
+      const size_t reduction_size = op->input_width;
+      const size_t channels = op->channels;
+      struct reduce_context* context = &plan->context.reduce;
+      *context = (struct reduce_context) {
+          .input = op->input,
+          .input_batch_stride = reduction_size * channels * sizeof(uint8_t),
+          .input_stride = channels * sizeof(uint8_t),
+          .reduction_size = reduction_size,
+          .channels = channels,
+          .channel_tile = QNNP_REDUCE_CHANNEL_TILE,
+          .zero = op->zero_pointer,
+          .output = op->output,
+          .output_batch_stride = channels * sizeof(uint8_t),
+          .quantization_params = op->avgpool_quantization_params,
+          .ltnr_ukernel = qnnp_params.q8gavgpool.ltnr,
+          .genr_lemr_ukernel = qnnp_params.q8gavgpool.genr_lemr,
+          .genr_gtmr_ukernel = qnnp_params.q8gavgpool.genr_gtmr,
+          .rsum_ukernel = qnnp_params.u8rsum,
+          .mr = qnnp_params.q8gavgpool.mr,
+          .nr = qnnp_params.q8gavgpool.nr,
+      };
+      if (channels == 1) {
+        /* Reduction over the innermost axes: every output is a sum of one contiguous row */
+        plan->stages[0] = (struct qnnp_compute) {
+            .type = qnnp_parallelization_type_1d_tiled,
+            .function_1d_tiled = (pthreadpool_function_1d_tiled_t) compute_reduce_rows,
+            .context = context,
+            .range = { op->batch_size },
+            .tile = { max(divide_round_up(4096, reduction_size), 1) },
+        };
+      } else {
+        plan->stages[0] = (struct qnnp_compute) {
+            .type = qnnp_parallelization_type_2d,
+            .function_2d = (pthreadpool_function_2d_t) compute_reduce_channels,
+            .context = context,
+            .range = { op->batch_size, divide_round_up(channels, context->channel_tile) },
+        };
+      }
       break;
     }
     case qnnp_ukernel_type_lut:
@@ -996,7 +1704,7 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       const size_t y_stride = op->output_pixel_stride;
       if ((((x_stride ^ channels) | (y_stride ^ channels)) == 0) || batch_size == 1) {
         const size_t block_size = 1024;
-        struct lut_contiguous_context context = {
+        plan->context.lut_contiguous = (struct lut_contiguous_context) {
           .x = op->input,
           .x_stride = x_stride * sizeof(uint8_t),
           .t = op->lookup_table,
@@ -1004,12 +1712,15 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .y_stride = y_stride * sizeof(uint8_t),
           .ukernel = qnnp_params.x8lut,
         };
-        pthreadpool_compute_1d_tiled(
-          threadpool,
-          (pthreadpool_function_1d_tiled_t) compute_lut_contiguous, &context,
-          batch_size * channels * sizeof(uint8_t), block_size);
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d_tiled,
+          .function_1d_tiled = (pthreadpool_function_1d_tiled_t) compute_lut_contiguous,
+          .context = &plan->context.lut_contiguous,
+          .range = { batch_size * channels * sizeof(uint8_t) },
+          .tile = { block_size },
+        };
       } else {
-        struct lut_strided_context context = {
+        plan->context.lut_strided = (struct lut_strided_context) {
           .n = channels,
           .x = op->input,
           .x_stride = x_stride * sizeof(uint8_t),
@@ -1018,10 +1729,12 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .y_stride = y_stride * sizeof(uint8_t),
           .ukernel = qnnp_params.x8lut,
         };
-        pthreadpool_compute_1d(
-          threadpool,
-          (pthreadpool_function_1d_t) compute_lut_strided, &context,
-          batch_size);
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d,
+          .function_1d = (pthreadpool_function_1d_t) compute_lut_strided,
+          .context = &plan->context.lut_strided,
+          .range = { batch_size },
+        };
       }
       break;
     }
@@ -1033,7 +1746,7 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       const size_t y_stride = op->output_pixel_stride;
       if ((((x_stride ^ channels) | (y_stride ^ channels)) == 0) || batch_size == 1) {
         const size_t block_size = 4096;
-        struct clamp_contiguous_context context = {
+        plan->context.clamp_contiguous = (struct clamp_contiguous_context) {
           .x = op->input,
           .x_stride = x_stride * sizeof(uint8_t),
           .y = op->output,
@@ -1041,12 +1754,15 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .ukernel = qnnp_params.u8clamp,
           .params = op->u8_clamping_params,
         };
-        pthreadpool_compute_1d_tiled(
-          threadpool,
-          (pthreadpool_function_1d_tiled_t) compute_clamp_contiguous, &context,
-          batch_size * channels * sizeof(uint8_t), block_size);
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d_tiled,
+          .function_1d_tiled = (pthreadpool_function_1d_tiled_t) compute_clamp_contiguous,
+          .context = &plan->context.clamp_contiguous,
+          .range = { batch_size * channels * sizeof(uint8_t) },
+          .tile = { block_size },
+        };
       } else {
-        struct clamp_strided_context context = {
+        plan->context.clamp_strided = (struct clamp_strided_context) {
           .n = channels,
           .x = op->input,
           .x_stride = x_stride * sizeof(uint8_t),
@@ -1055,35 +1771,143 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
           .ukernel = qnnp_params.u8clamp,
           .params = op->u8_clamping_params,
         };
-        pthreadpool_compute_1d(
-          threadpool,
-          (pthreadpool_function_1d_t) compute_clamp_strided, &context,
-          batch_size);
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d,
+          .function_1d = (pthreadpool_function_1d_t) compute_clamp_strided,
+          .context = &plan->context.clamp_strided,
+          .range = { batch_size },
+        };
+      }
+      break;
+    }
+    case qnnp_ukernel_type_quantize:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t channels = op->channels;
+      const size_t x_stride = op->input_pixel_stride;
+      const size_t y_stride = op->output_pixel_stride;
+      if ((((x_stride ^ channels) | (y_stride ^ channels)) == 0) || batch_size == 1) {
+        /* Tiles are counted in elements: 1024 elements read 4 KB of fp32 input */
+        const size_t block_size = 1024;
+        plan->context.quantize_contiguous = (struct quantize_contiguous_context) {
+          .x = op->input,
+          .y = op->output,
+          .ukernel = qnnp_params.q8vquantize,
+          .params = op->f32_quantization_params,
+        };
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d_tiled,
+          .function_1d_tiled = (pthreadpool_function_1d_tiled_t) compute_quantize_contiguous,
+          .context = &plan->context.quantize_contiguous,
+          .range = { batch_size * channels },
+          .tile = { block_size },
+        };
+      } else {
+        plan->context.quantize_strided = (struct quantize_strided_context) {
+          .n = channels,
+          .x = op->input,
+          .x_stride = x_stride * sizeof(float),
+          .y = op->output,
+          .y_stride = y_stride * sizeof(uint8_t),
+          .ukernel = qnnp_params.q8vquantize,
+          .params = op->f32_quantization_params,
+        };
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d,
+          .function_1d = (pthreadpool_function_1d_t) compute_quantize_strided,
+          .context = &plan->context.quantize_strided,
+          .range = { batch_size },
+        };
+      }
+      break;
+    }
+    case qnnp_ukernel_type_dequantize:
+    {
+      const size_t batch_size = op->batch_size;
+      const size_t channels = op->channels;
+      const size_t x_stride = op->input_pixel_stride;
+      const size_t y_stride = op->output_pixel_stride;
+      if ((((x_stride ^ channels) | (y_stride ^ channels)) == 0) || batch_size == 1) {
+        /* Tiles are counted in elements: 1024 elements write 4 KB of fp32 output */
+        const size_t block_size = 1024;
+        plan->context.dequantize_contiguous = (struct dequantize_contiguous_context) {
+          .x = op->input,
+          .y = op->output,
+          .ukernel = qnnp_params.q8vdequantize,
+          .params = op->f32_dequantization_params,
+        };
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d_tiled,
+          .function_1d_tiled = (pthreadpool_function_1d_tiled_t) compute_dequantize_contiguous,
+          .context = &plan->context.dequantize_contiguous,
+          .range = { batch_size * channels },
+          .tile = { block_size },
+        };
+      } else {
+        plan->context.dequantize_strided = (struct dequantize_strided_context) {
+          .n = channels,
+          .x = op->input,
+          .x_stride = x_stride * sizeof(uint8_t),
+          .y = op->output,
+          .y_stride = y_stride * sizeof(float),
+          .ukernel = qnnp_params.q8vdequantize,
+          .params = op->f32_dequantization_params,
+        };
+        plan->stages[0] = (struct qnnp_compute) {
+          .type = qnnp_parallelization_type_1d,
+          .function_1d = (pthreadpool_function_1d_t) compute_dequantize_strided,
+          .context = &plan->context.dequantize_strided,
+          .range = { batch_size },
+        };
       }
       break;
     }
     case qnnp_ukernel_type_softargmax:
     {
-      struct u8softargmax_context context = {
+      plan->context.u8softargmax = (struct u8softargmax_context) {
         .n = op->channels,
         .x = op->input,
         .x_stride = op->input_pixel_stride * sizeof(uint8_t),
         .t = op->lookup_table,
         .y = op->output,
         .y_stride = op->output_pixel_stride * sizeof(uint8_t),
+        .ukernel = qnnp_params.u8softargmax,
+        .params = op->softargmax_params,
+      };
+      plan->stages[0] = (struct qnnp_compute) {
+        .type = qnnp_parallelization_type_1d,
+        .function_1d = (pthreadpool_function_1d_t) compute_u8softargmax,
+        .context = &plan->context.u8softargmax,
+        .range = { op->batch_size },
+      };
+      break;
+    }
+    case qnnp_ukernel_type_top_k:
+    {
+      plan->context.top_k = (struct top_k_context) {
+        .n = op->channels,
+        .k = op->top_k,
+        .x = op->input,
+        .x_stride = op->input_pixel_stride * sizeof(uint8_t),
+        .y_values = op->output,
+        .y_values_stride = op->output_pixel_stride,
+        .y_indices = op->output2,
+        .y_indices_stride = op->output2_pixel_stride,
         .rmax_ukernel = qnnp_params.u8rmax,
-        .lut_norm_ukernel = qnnp_params.u8lut32norm,
       };
-      pthreadpool_compute_1d(
-        threadpool,
-        (pthreadpool_function_1d_t) compute_u8softargmax, &context,
-        op->batch_size);
+      plan->stages[0] = (struct qnnp_compute) {
+        .type = qnnp_parallelization_type_1d,
+        .function_1d = (pthreadpool_function_1d_t) (op->top_k == 1 ? compute_argmax : compute_top_k),
+        .context = &plan->context.top_k,
+        .range = { op->batch_size },
+      };
       break;
     }
     case qnnp_ukernel_type_channel_shuffle:
     {
       const size_t groups = op->groups;
-      struct channel_shuffle_context channel_shuffle_context = {
+      struct channel_shuffle_context* channel_shuffle_context = &plan->context.channel_shuffle;
+      *channel_shuffle_context = (struct channel_shuffle_context) {
         .x = op->input,
         .x_stride = op->input_pixel_stride * sizeof(uint8_t),
         .y = op->output,
@@ -1095,33 +1919,329 @@ enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
       switch (groups) {
         case 2:
           compute_function = (pthreadpool_function_1d_t) compute_channel_shuffle_fixed;
-          channel_shuffle_context.fixed_ukernel = qnnp_params.x8zip.x2;
+          channel_shuffle_context->fixed_ukernel = qnnp_params.x8zip.x2;
           break;
         case 3:
           compute_function = (pthreadpool_function_1d_t) compute_channel_shuffle_fixed;
-          channel_shuffle_context.fixed_ukernel = qnnp_params.x8zip.x3;
+          channel_shuffle_context->fixed_ukernel = qnnp_params.x8zip.x3;
           break;
         case 4:
           compute_function = (pthreadpool_function_1d_t) compute_channel_shuffle_fixed;
-          channel_shuffle_context.fixed_ukernel = qnnp_params.x8zip.x4;
+          channel_shuffle_context->fixed_ukernel = qnnp_params.x8zip.x4;
           break;
         default:
           compute_function = (pthreadpool_function_1d_t) compute_channel_shuffle_variable;
-          channel_shuffle_context.variable_ukernel = qnnp_params.x8zip.xm;
+          channel_shuffle_context->variable_ukernel = qnnp_params.x8zip.xm;
           break;
         case 0:
         case 1:
           QNNP_UNREACHABLE;
       }
+      plan->stages[0] = (struct qnnp_compute) {
+        .type = qnnp_parallelization_type_1d,
+        .function_1d = compute_function,
+        .context = channel_shuffle_context,
+        .range = { op->batch_size },
+      };
+      break;
+    }
+    case qnnp_ukernel_type_constant_pad:
+    {
+      /*
+       * Shape is normalized to QNNP_MAX_TENSOR_DIMS (6) dimensions. The outer four (with the first two merged) and the
+       * rows of the fifth dimension are parallelized, so that padding of a single image, which normalizes to
+       * { 1, 1, 1, 1, H, W * C }, is split across threads too. Each task pads about 4 KB of output rows.
+       */
+      struct constant_pad_context* constant_pad_context = &plan->context.constant_pad;
+      constant_pad_context->input = op->input;
+      constant_pad_context->output = op->output;
+      size_t input_stride = 1;
+      size_t output_stride = 1;
+      for (size_t dim = QNNP_MAX_TENSOR_DIMS - 1; dim != 0; dim--) {
+        input_stride *= op->pad_input_shape[dim];
+        output_stride *= op->pad_pre_paddings[dim] + op->pad_input_shape[dim] + op->pad_post_paddings[dim];
+        constant_pad_context->input_stride[dim - 1] = input_stride;
+        constant_pad_context->output_stride[dim - 1] = output_stride;
+      }
+      const size_t* output_size = constant_pad_context->output_size;
+      for (size_t dim = 0; dim < QNNP_MAX_TENSOR_DIMS; dim++) {
+        constant_pad_context->input_size[dim] = op->pad_input_shape[dim];
+        constant_pad_context->pre_paddings[dim] = op->pad_pre_paddings[dim];
+        constant_pad_context->post_paddings[dim] = op->pad_post_paddings[dim];
+        constant_pad_context->output_size[dim] =
+          op->pad_pre_paddings[dim] + op->pad_input_shape[dim] + op->pad_post_paddings[dim];
+      }
+      constant_pad_context->padding_value = op->padding_value;
+      constant_pad_context->ukernel = qnnp_params.x8pad;
+      const size_t row_tile = divide_round_up(4096, max(output_size[5], 1));
+      plan->stages[0] = (struct qnnp_compute) {
+        .type = qnnp_parallelization_type_4d_tiled,
+        .function_4d_tiled = (pthreadpool_function_4d_tiled_t) compute_constant_pad,
+        .context = constant_pad_context,
+        .range = { output_size[0] * output_size[1], output_size[2], output_size[3], output_size[4] },
+        .tile = { 1, 1, 1, row_tile },
+      };
+      break;
+    }
+    case qnnp_ukernel_type_nchw_to_nhwc:
+    case qnnp_ukernel_type_nhwc_to_nchw:
+    {
+      /*
+       * Each image is transposed as a matrix: channels x pixels for NCHW, pixels x channels for NHWC.
+       * Tiles of 4 KB keep both the rows being read and the rows being written in L1 cache.
+       */
+      const uint32_t log2_element_size = qnnp_operator_get_log2_input_element_size(op);
+      const size_t pixels = op->input_height * op->input_width;
+      const size_t channels = op->channels;
+      const size_t tile = log2_element_size == 0 ? 64 : 32;
+      size_t rows, columns;
+      if (op->ukernel_type == qnnp_ukernel_type_nchw_to_nhwc) {
+        rows = channels;
+        columns = pixels;
+        plan->context.transpose = (struct transpose_context) {
+          .x = op->input,
+          .x_stride = pixels << log2_element_size,
+          .x_batch_stride = (channels * pixels) << log2_element_size,
+          .y = op->output,
+          .y_stride = op->output_pixel_stride << log2_element_size,
+          .y_batch_stride = (pixels * op->output_pixel_stride) << log2_element_size,
+        };
+      } else {
+        rows = pixels;
+        columns = channels;
+        plan->context.transpose = (struct transpose_context) {
+          .x = op->input,
+          .x_stride = op->input_pixel_stride << log2_element_size,
+          .x_batch_stride = (pixels * op->input_pixel_stride) << log2_element_size,
+          .y = op->output,
+          .y_stride = pixels << log2_element_size,
+          .y_batch_stride = (channels * pixels) << log2_element_size,
+        };
+      }
+      plan->context.transpose.log2_element_size = log2_element_size;
+      plan->context.transpose.ukernel =
+        log2_element_size == 0 ? qnnp_params.x8transpose : qnnp_params.x32transpose;
+      plan->stages[0] = (struct qnnp_compute) {
+        .type = qnnp_parallelization_type_3d_tiled,
+        .function_3d_tiled = (pthreadpool_function_3d_tiled_t) compute_transpose,
+        .context = &plan->context.transpose,
+        .range = { op->batch_size, rows, columns },
+        .tile = { 1, tile, tile },
+      };
+      break;
+    }
+    default:
+      qnnp_log_error("failed to run operator: micro-kernel type %d has no compute plan", (int) op->ukernel_type);
+      return qnnp_status_invalid_parameter;
+  }
+  return qnnp_status_success;
+}
+
+void qnnp_compute_parallel(const struct qnnp_compute* compute, pthreadpool_t threadpool)
+{
+  switch (compute->type) {
+    case qnnp_parallelization_type_1d:
       pthreadpool_compute_1d(
-        threadpool,
-        compute_function,
-        &channel_shuffle_context,
-        op->batch_size);
+          threadpool,
+          compute->function_1d,
+          compute->context,
+          compute->range[0]);
+      break;
+    case qnnp_parallelization_type_1d_tiled:
+      pthreadpool_compute_1d_tiled(
+          threadpool,
+          compute->function_1d_tiled,
+          compute->context,
+          compute->range[0],
+          compute->tile[0]);
+      break;
+    case qnnp_parallelization_type_2d:
+      pthreadpool_compute_2d(
+          threadpool,
+          compute->function_2d,
+          compute->context,
+          compute->range[0], compute->range[1]);
+      break;
+    case qnnp_parallelization_type_3d_tiled:
+      pthreadpool_compute_3d_tiled(
+          threadpool,
+          compute->function_3d_tiled,
+          compute->context,
+          compute->range[0], compute->range[1], compute->range[2],
+          compute->tile[0], compute->tile[1], compute->tile[2]);
+      break;
+    case qnnp_parallelization_type_4d_tiled:
+      pthreadpool_compute_4d_tiled(
+          threadpool,
+          compute->function_4d_tiled,
+          compute->context,
+          compute->range[0], compute->range[1], compute->range[2], compute->range[3],
+          compute->tile[0], compute->tile[1], compute->tile[2], compute->tile[3]);
+      break;
+    default:
+      QNNP_UNREACHABLE;
+  }
+}
+
+size_t qnnp_compute_get_tiles_count(const struct qnnp_compute* compute)
+{
+  switch (compute->type) {
+    case qnnp_parallelization_type_1d:
+      return compute->range[0];
+    case qnnp_parallelization_type_1d_tiled:
+      return divide_round_up(compute->range[0], compute->tile[0]);
+    case qnnp_parallelization_type_2d:
+      return compute->range[0] * compute->range[1];
+    case qnnp_parallelization_type_3d_tiled:
+      return divide_round_up(compute->range[0], compute->tile[0]) *
+        divide_round_up(compute->range[1], compute->tile[1]) *
+        divide_round_up(compute->range[2], compute->tile[2]);
+    case qnnp_parallelization_type_4d_tiled:
+      return divide_round_up(compute->range[0], compute->tile[0]) *
+        divide_round_up(compute->range[1], compute->tile[1]) *
+        divide_round_up(compute->range[2], compute->tile[2]) *
+        divide_round_up(compute->range[3], compute->tile[3]);
+    default:
+      QNNP_UNREACHABLE;
+  }
+}
+
+/*
+ * Runs tiles [tile_start, tile_end) of a parallel loop on the calling thread.
+ * Tiles are numbered in the same (row-major) order as pthreadpool iterates them.
+ */
+void qnnp_compute_tiles(const struct qnnp_compute* compute, size_t tile_start, size_t tile_end)
+{
+  const size_t* range = compute->range;
+  const size_t* tile = compute->tile;
+  void* context = compute->context;
+  switch (compute->type) {
+    case qnnp_parallelization_type_1d:
+      for (size_t i = tile_start; i < tile_end; i++) {
+        compute->function_1d(context, i);
+      }
+      break;
+    case qnnp_parallelization_type_1d_tiled:
+      for (size_t t = tile_start; t < tile_end; t++) {
+        const size_t i = t * tile[0];
+        compute->function_1d_tiled(context, i, min(tile[0], range[0] - i));
+      }
+      break;
+    case qnnp_parallelization_type_2d:
+      for (size_t t = tile_start; t < tile_end; t++) {
+        compute->function_2d(context, t / range[1], t % range[1]);
+      }
+      break;
+    case qnnp_parallelization_type_3d_tiled:
+    {
+      const size_t tiles_j = divide_round_up(range[1], tile[1]);
+      const size_t tiles_k = divide_round_up(range[2], tile[2]);
+      for (size_t t = tile_start; t < tile_end; t++) {
+        const size_t i = t / (tiles_j * tiles_k) * tile[0];
+        const size_t j = t / tiles_k % tiles_j * tile[1];
+        const size_t k = t % tiles_k * tile[2];
+        compute->function_3d_tiled(context, i, j, k,
+          min(tile[0], range[0] - i), min(tile[1], range[1] - j), min(tile[2], range[2] - k));
+      }
+      break;
+    }
+    case qnnp_parallelization_type_4d_tiled:
+    {
+      const size_t tiles_j = divide_round_up(range[1], tile[1]);
+      const size_t tiles_k = divide_round_up(range[2], tile[2]);
+      const size_t tiles_l = divide_round_up(range[3], tile[3]);
+      for (size_t t = tile_start; t < tile_end; t++) {
+        const size_t i = t / (tiles_j * tiles_k * tiles_l) * tile[0];
+        const size_t j = t / (tiles_k * tiles_l) % tiles_j * tile[1];
+        const size_t k = t / tiles_l % tiles_k * tile[2];
+        const size_t l = t % tiles_l * tile[3];
+        compute->function_4d_tiled(context, i, j, k, l,
+          min(tile[0], range[0] - i), min(tile[1], range[1] - j),
+          min(tile[2], range[2] - k), min(tile[3], range[3] - l));
+      }
       break;
     }
     default:
       QNNP_UNREACHABLE;
   }
+}
+
+size_t qnnp_compute_partition(
+    const struct qnnp_compute* compute,
+    size_t slots_count,
+    struct qnnp_compute_slot* slots)
+{
+  const size_t tiles_count = qnnp_compute_get_tiles_count(compute);
+  slots_count = min(slots_count, tiles_count);
+  for (size_t slot = 0; slot < slots_count; slot++) {
+    slots[slot] = (struct qnnp_compute_slot) {
+      .compute = compute,
+      .tile_start = tiles_count * slot / slots_count,
+      .tile_end = tiles_count * (slot + 1) / slots_count,
+    };
+  }
+  return slots_count;
+}
+
+static void compute_slot(
+    const struct qnnp_compute_slot slots[restrict static 1],
+    size_t slot_index)
+{
+  const struct qnnp_compute_slot* slot = &slots[slot_index];
+  qnnp_compute_tiles(slot->compute, slot->tile_start, slot->tile_end);
+}
+
+void qnnp_compute_slots(
+    size_t slots_count,
+    const struct qnnp_compute_slot* slots,
+    pthreadpool_t threadpool)
+{
+  pthreadpool_compute_1d(
+    threadpool,
+    (pthreadpool_function_1d_t) compute_slot,
+    (void*) slots,
+    slots_count);
+}
+
+enum qnnp_status qnnp_run_operator(qnnp_operator_t op, pthreadpool_t threadpool)
+{
+  struct qnnp_compute_plan plan;
+  const enum qnnp_status status = qnnp_prepare_compute_plan(op, &plan);
+  if (status != qnnp_status_success) {
+    return status;
+  }
+
+  const size_t threadpool_threads_count = pthreadpool_get_threads_count(threadpool);
+  const size_t threads_count = qnnp_operator_get_threads_count(op, threadpool_threads_count);
+  if (threads_count == threadpool_threads_count) {
+    for (size_t i = 0; i < plan.stages_count; i++) {
+      qnnp_compute_parallel(&plan.stages[i], threadpool);
+    }
+  } else if (threads_count == 1) {
+    /* Too little work to amortize waking up the threadpool: compute on the caller thread */
+    for (size_t i = 0; i < plan.stages_count; i++) {
+      qnnp_compute_parallel(&plan.stages[i], NULL);
+    }
+  } else {
+    struct qnnp_compute_slot slots[threads_count];
+    for (size_t i = 0; i < plan.stages_count; i++) {
+      const size_t slots_count = qnnp_compute_partition(&plan.stages[i], threads_count, slots);
+      qnnp_compute_slots(slots_count, slots, threadpool);
+    }
+  }
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_run_operators(
+    size_t operators_count,
+    const qnnp_operator_t* operators,
+    pthreadpool_t threadpool)
+{
+  for (size_t i = 0; i < operators_count; i++) {
+    const enum qnnp_status status = qnnp_run_operator(operators[i], threadpool);
+    if (status != qnnp_status_success) {
+      return status;
+    }
+  }
   return qnnp_status_success;
 }
@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <immintrin.h>
+
+#include <qnnpack/q8dwconv.h>
+
+
+/*
+ * Accumulators hold 32 channels as [0-3|8-11], [4-7|12-15], [16-19|24-27], [20-23|28-31] to match the lane order of
+ * _mm256_madd_epi16 on zero-extended inputs. The same order is used for the 32 partial sums in the buffer.
+ */
+static QNNP_INLINE void accumulate_taps(
+    __m256i vacc[restrict static 4],
+    size_t taps,
+    const uint8_t* const i[restrict static 1],
+    size_t offset,
+    const uint8_t* k,
+    __m256i vinput_zero_point,
+    __m256i vkernel_zero_point)
+{
+  for (size_t t = 0; t < taps; t += 2) {
+    for (size_t h = 0; h < 2; h++) {
+      const __m256i vxia = _mm256_sub_epi16(
+        _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (i[t] + offset + 16 * h))), vinput_zero_point);
+      const __m256i vxka = _mm256_sub_epi16(
+        _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (k + 32 * t + 16 * h))), vkernel_zero_point);
+      __m256i vxib = _mm256_setzero_si256();
+      __m256i vxkb = _mm256_setzero_si256();
+      if (t + 1 < taps) {
+        vxib = _mm256_sub_epi16(
+          _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (i[t + 1] + offset + 16 * h))), vinput_zero_point);
+        vxkb = _mm256_sub_epi16(
+          _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (k + 32 * (t + 1) + 16 * h))), vkernel_zero_point);
+      }
+
+      vacc[2 * h] = _mm256_add_epi32(vacc[2 * h],
+        _mm256_madd_epi16(_mm256_unpacklo_epi16(vxia, vxib), _mm256_unpacklo_epi16(vxka, vxkb)));
+      vacc[2 * h + 1] = _mm256_add_epi32(vacc[2 * h + 1],
+        _mm256_madd_epi16(_mm256_unpackhi_epi16(vxia, vxib), _mm256_unpackhi_epi16(vxka, vxkb)));
+    }
+  }
+}
+
+static QNNP_INLINE __m256i requantize(
+    __m256i vacc,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m256i vmultiplier = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.multiplier));
+  const __m256i vrounding = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.rounding));
+  const __m256i vremainder_mask = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.remainder_mask));
+  const __m256i vremainder_threshold = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.remainder_threshold));
+  const __m128i vshift = _mm_load_si128((const __m128i*) quantization_params->sse2.shift);
+
+  const __m256i vnmask = _mm256_cmpgt_epi32(_mm256_setzero_si256(), vacc);
+  const __m256i vabsacc = _mm256_sub_epi32(_mm256_xor_si256(vacc, vnmask), vnmask);
+
+  const __m256i vabsprod_even = _mm256_mul_epu32(vabsacc, vmultiplier);
+  const __m256i vabsprod_odd = _mm256_mul_epu32(_mm256_shuffle_epi32(vabsacc, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+
+  const __m256i vnmask_even = _mm256_shuffle_epi32(vnmask, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m256i vnmask_odd = _mm256_shuffle_epi32(vnmask, _MM_SHUFFLE(3, 3, 1, 1));
+
+  const __m256i vprod_even = _mm256_sub_epi64(_mm256_xor_si256(vabsprod_even, vnmask_even), vnmask_even);
+  const __m256i vprod_odd = _mm256_sub_epi64(_mm256_xor_si256(vabsprod_odd, vnmask_odd), vnmask_odd);
+
+  const __m256i vq31prod_even = _mm256_srli_epi64(_mm256_add_epi64(vprod_even, vrounding), 31);
+  const __m256i vq31prod_odd = _mm256_srli_epi64(_mm256_add_epi64(vprod_odd, vrounding), 31);
+
+  const __m256i vq31prod = _mm256_shuffle_epi32(
+    _mm256_castps_si256(_mm256_shuffle_ps(
+      _mm256_castsi256_ps(vq31prod_even), _mm256_castsi256_ps(vq31prod_odd), _MM_SHUFFLE(2, 0, 2, 0))),
+    _MM_SHUFFLE(3, 1, 2, 0));
+
+  const __m256i vrem =
+    _mm256_add_epi32(_mm256_and_si256(vq31prod, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod));
+
+  return _mm256_sub_epi32(_mm256_sra_epi32(vq31prod, vshift), _mm256_cmpgt_epi32(vrem, vremainder_threshold));
+}
+
+static QNNP_INLINE __m256i output_x32(
+    const __m256i vacc[restrict static 4],
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m256i voutput_zero_point = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point));
+  const __m256i vout01 = _mm256_adds_epi16(
+    _mm256_packs_epi32(requantize(vacc[0], quantization_params), requantize(vacc[1], quantization_params)), voutput_zero_point);
+  const __m256i vout23 = _mm256_adds_epi16(
+    _mm256_packs_epi32(requantize(vacc[2], quantization_params), requantize(vacc[3], quantization_params)), voutput_zero_point);
+  __m256i vout = _mm256_permute4x64_epi64(_mm256_packus_epi16(vout01, vout23), _MM_SHUFFLE(3, 1, 2, 0));
+  vout = _mm256_min_epu8(vout, _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.output_max)));
+  vout = _mm256_max_epu8(vout, _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.output_min)));
+  return vout;
+}
+
+static QNNP_INLINE void load_bias(__m256i vacc[restrict static 4], const void* w)
+{
+  const __m256i vb0 = _mm256_loadu_si256((const __m256i*) w);
+  const __m256i vb1 = _mm256_loadu_si256((const __m256i*) ((uintptr_t) w + 32));
+  const __m256i vb2 = _mm256_loadu_si256((const __m256i*) ((uintptr_t) w + 64));
+  const __m256i vb3 = _mm256_loadu_si256((const __m256i*) ((uintptr_t) w + 96));
+  vacc[0] = _mm256_permute2x128_si256(vb0, vb1, 0x20);
+  vacc[1] = _mm256_permute2x128_si256(vb0, vb1, 0x31);
+  vacc[2] = _mm256_permute2x128_si256(vb2, vb3, 0x20);
+  vacc[3] = _mm256_permute2x128_si256(vb2, vb3, 0x31);
+}
+
+static QNNP_INLINE void load_outacc(__m256i vacc[restrict static 4], const int32_t* outacc)
+{
+  vacc[0] = _mm256_loadu_si256((const __m256i*) outacc);
+  vacc[1] = _mm256_loadu_si256((const __m256i*) (outacc + 8));
+  vacc[2] = _mm256_loadu_si256((const __m256i*) (outacc + 16));
+  vacc[3] = _mm256_loadu_si256((const __m256i*) (outacc + 24));
+}
+
+static QNNP_INLINE void store_outacc(int32_t* outacc, const __m256i vacc[restrict static 4])
+{
+  _mm256_storeu_si256((__m256i*) outacc, vacc[0]);
+  _mm256_storeu_si256((__m256i*) (outacc + 8), vacc[1]);
+  _mm256_storeu_si256((__m256i*) (outacc + 16), vacc[2]);
+  _mm256_storeu_si256((__m256i*) (outacc + 24), vacc[3]);
+}
+
+/*
+ * Remainder channels are processed 8 at a time with accumulators (and partial sums in the buffer) in channel order.
+ * The last group of fewer than 8 channels re-reads preceding channels (or the zero padding in front of the zero buffer)
+ * like the SSE2 micro-kernel, and shifts them out, so the micro-kernel never reads past the end of input rows.
+ */
+static QNNP_INLINE __m256i interleave_x8(__m128i va, __m128i vb)
+{
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(va, vb)), _mm_unpackhi_epi16(va, vb), 1);
+}
+
+static QNNP_INLINE __m256i accumulate_taps_x8(
+    __m256i vacc,
+    size_t taps,
+    const uint8_t* const i[restrict static 1],
+    size_t offset,
+    size_t i_predecrement,
+    const uint8_t* k,
+    __m256i vinput_zero_point,
+    __m256i vkernel_zero_point)
+{
+  const __m128i vi_shift = _mm_cvtsi32_si128(8 * i_predecrement);
+  for (size_t t = 0; t < taps; t += 2) {
+    const __m128i vxia = _mm_sub_epi16(_mm_cvtepu8_epi16(
+      _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (i[t] + offset - i_predecrement)), vi_shift)),
+      _mm256_castsi256_si128(vinput_zero_point));
+    const __m128i vxka = _mm_sub_epi16(_mm_cvtepu8_epi16(
+      _mm_loadl_epi64((const __m128i*) (k + 32 * t))), _mm256_castsi256_si128(vkernel_zero_point));
+    __m128i vxib = _mm_setzero_si128();
+    __m128i vxkb = _mm_setzero_si128();
+    if (t + 1 < taps) {
+      vxib = _mm_sub_epi16(_mm_cvtepu8_epi16(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (i[t + 1] + offset - i_predecrement)), vi_shift)),
+        _mm256_castsi256_si128(vinput_zero_point));
+      vxkb = _mm_sub_epi16(_mm_cvtepu8_epi16(
+        _mm_loadl_epi64((const __m128i*) (k + 32 * (t + 1)))), _mm256_castsi256_si128(vkernel_zero_point));
+    }
+    vacc = _mm256_add_epi32(vacc, _mm256_madd_epi16(interleave_x8(vxia, vxib), interleave_x8(vxka, vxkb)));
+  }
+  return vacc;
+}
+
+static QNNP_INLINE uint8_t* output_x8(
+    uint8_t* output,
+    __m256i vacc,
+    size_t n,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m256i vout32 = requantize(vacc, quantization_params);
+  __m128i vout = _mm_adds_epi16(
+    _mm_packs_epi32(_mm256_castsi256_si128(vout32), _mm256_extracti128_si256(vout32, 1)),
+    _mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point));
+  vout = _mm_packus_epi16(vout, vout);
+  vout = _mm_min_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_max));
+  vout = _mm_max_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_min));
+
+  if (n >= 8) {
+    _mm_storel_epi64((__m128i*) output, vout);
+    return output + 8;
+  }
+  if (n & 4) {
+    *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+    output += 4;
+    vout = _mm_srli_epi64(vout, 32);
+  }
+  if (n & 2) {
+    *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+    output += 2;
+    vout = _mm_srli_epi32(vout, 16);
+  }
+  if (n & 1) {
+    *((uint8_t*) output) = (uint8_t) _mm_cvtsi128_si32(vout);
+    output += 1;
+  }
+  return output;
+}
+
+void q8dwconv_ukernel_mp32x25__avx2(
+    size_t channels,
+    size_t output_width,
+    const uint8_t** input,
+    const void* weights,
+    int32_t* outacc32,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m256i vinput_zero_point = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.input_zero_point));
+  const __m256i vkernel_zero_point = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.kernel_zero_point));
+
+  do {
+    __m256i vacc[4];
+
+    int32_t* outacc = outacc32;
+    const void* w = weights;
+    {
+      const uint8_t* i[10] = {
+        input[0], input[1], input[2], input[3], input[4],
+        input[5], input[6], input[7], input[8], input[9],
+      };
+
+      size_t c = channels;
+      size_t offset = 0;
+      for (; c >= 32; c -= 32) {
+        load_bias(vacc, w);
+        accumulate_taps(vacc, 10, i, offset, (const uint8_t*) ((uintptr_t) w + 128), vinput_zero_point, vkernel_zero_point);
+        store_outacc(outacc, vacc); outacc += 32;
+
+        offset += 32;
+        w = (const void*) ((uintptr_t) w + 448);
+      }
+      if (c != 0) {
+        for (size_t j = 0; j < c; j += 8) {
+          const size_t i_predecrement = c - j < 8 ? 8 - (c - j) : 0;
+          __m256i vacc_x8 = _mm256_loadu_si256((const __m256i*) ((uintptr_t) w + j * sizeof(int32_t)));
+          vacc_x8 = accumulate_taps_x8(vacc_x8, 10, i, offset + j, i_predecrement,
+            (const uint8_t*) ((uintptr_t) w + 128 + j), vinput_zero_point, vkernel_zero_point);
+          _mm256_storeu_si256((__m256i*) (outacc + j), vacc_x8);
+        }
+
+        w = (const void*) ((uintptr_t) w + 448);
+      }
+    }
+    outacc = outacc32;
+    {
+      const uint8_t* i[10] = {
+        input[10], input[11], input[12], input[13], input[14],
+        input[15], input[16], input[17], input[18], input[19],
+      };
+
+      size_t c = channels;
+      size_t offset = 0;
+      for (; c >= 32; c -= 32) {
+        load_outacc(vacc, outacc);
+        accumulate_taps(vacc, 10, i, offset, (const uint8_t*) w, vinput_zero_point, vkernel_zero_point);
+        store_outacc(outacc, vacc); outacc += 32;
+
+        offset += 32;
+        w = (const void*) ((uintptr_t) w + 320);
+      }
+      if (c != 0) {
+        for (size_t j = 0; j < c; j += 8) {
+          const size_t i_predecrement = c - j < 8 ? 8 - (c - j) : 0;
+          __m256i vacc_x8 = _mm256_loadu_si256((const __m256i*) (outacc + j));
+          vacc_x8 = accumulate_taps_x8(vacc_x8, 10, i, offset + j, i_predecrement,
+            (const uint8_t*) ((uintptr_t) w + j), vinput_zero_point, vkernel_zero_point);
+          _mm256_storeu_si256((__m256i*) (outacc + j), vacc_x8);
+        }
+
+        w = (const void*) ((uintptr_t) w + 320);
+      }
+    }
+    outacc = outacc32;
+    {
+      const uint8_t* i[5] = {
+        input[20], input[21], input[22], input[23], input[24],
+      };
+      input = (const uint8_t**) ((uintptr_t) input + input_stride);
+
+      size_t c = channels;
+      size_t offset = 0;
+      for (; c >= 32; c -= 32) {
+        load_outacc(vacc, outacc); outacc += 32;
+        accumulate_taps(vacc, 5, i, offset, (const uint8_t*) w, vinput_zero_point, vkernel_zero_point);
+        _mm256_storeu_si256((__m256i*) output, output_x32(vacc, quantization_params)); output += 32;
+
+        offset += 32;
+        w = (const void*) ((uintptr_t) w + 160);
+      }
+      if (c != 0) {
+        for (size_t j = 0; j < c; j += 8) {
+          const size_t i_predecrement = c - j < 8 ? 8 - (c - j) : 0;
+          __m256i vacc_x8 = _mm256_loadu_si256((const __m256i*) (outacc + j));
+          vacc_x8 = accumulate_taps_x8(vacc_x8, 5, i, offset + j, i_predecrement,
+            (const uint8_t*) ((uintptr_t) w + j), vinput_zero_point, vkernel_zero_point);
+          output = output_x8(output, vacc_x8, c - j, quantization_params);
+        }
+      }
+    }
+
+    output = (uint8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <immintrin.h>
+
+#include <qnnpack/q8dwconv.h>
+
+
+/*
+ * Accumulators hold 32 channels as [0-3|8-11], [4-7|12-15], [16-19|24-27], [20-23|28-31] to match the lane order of
+ * _mm256_madd_epi16 on zero-extended inputs. Two taps are multiplied and summed in one _mm256_madd_epi16.
+ */
+static QNNP_INLINE void accumulate_tap_pair(
+    __m256i vacc[restrict static 4],
+    const uint8_t* ia,
+    const uint8_t* ib,
+    const uint8_t* ka,
+    const uint8_t* kb,
+    __m256i vkernel_zero_point)
+{
+  for (size_t h = 0; h < 2; h++) {
+    const __m256i vxia = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (ia + 16 * h)));
+    const __m256i vxib = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (ib + 16 * h)));
+    const __m256i vxka = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (ka + 16 * h))), vkernel_zero_point);
+    const __m256i vxkb = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (kb + 16 * h))), vkernel_zero_point);
+
+    vacc[2 * h] = _mm256_add_epi32(vacc[2 * h],
+      _mm256_madd_epi16(_mm256_unpacklo_epi16(vxia, vxib), _mm256_unpacklo_epi16(vxka, vxkb)));
+    vacc[2 * h + 1] = _mm256_add_epi32(vacc[2 * h + 1],
+      _mm256_madd_epi16(_mm256_unpackhi_epi16(vxia, vxib), _mm256_unpackhi_epi16(vxka, vxkb)));
+  }
+}
+
+static QNNP_INLINE void accumulate_tap(
+    __m256i vacc[restrict static 4],
+    const uint8_t* i,
+    const uint8_t* k,
+    __m256i vkernel_zero_point)
+{
+  const __m256i vzero = _mm256_setzero_si256();
+  for (size_t h = 0; h < 2; h++) {
+    const __m256i vxi = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (i + 16 * h)));
+    const __m256i vxk = _mm256_sub_epi16(_mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) (k + 16 * h))), vkernel_zero_point);
+
+    vacc[2 * h] = _mm256_add_epi32(vacc[2 * h],
+      _mm256_madd_epi16(_mm256_unpacklo_epi16(vxi, vzero), _mm256_unpacklo_epi16(vxk, vzero)));
+    vacc[2 * h + 1] = _mm256_add_epi32(vacc[2 * h + 1],
+      _mm256_madd_epi16(_mm256_unpackhi_epi16(vxi, vzero), _mm256_unpackhi_epi16(vxk, vzero)));
+  }
+}
+
+static QNNP_INLINE __m256i requantize(
+    __m256i vacc,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m256i vmultiplier = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.multiplier));
+  const __m256i vrounding = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.rounding));
+  const __m256i vremainder_mask = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.remainder_mask));
+  const __m256i vremainder_threshold = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.remainder_threshold));
+  const __m128i vshift = _mm_load_si128((const __m128i*) quantization_params->sse2.shift);
+
+  const __m256i vnmask = _mm256_cmpgt_epi32(_mm256_setzero_si256(), vacc);
+  const __m256i vabsacc = _mm256_sub_epi32(_mm256_xor_si256(vacc, vnmask), vnmask);
+
+  const __m256i vabsprod_even = _mm256_mul_epu32(vabsacc, vmultiplier);
+  const __m256i vabsprod_odd = _mm256_mul_epu32(_mm256_shuffle_epi32(vabsacc, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+
+  const __m256i vnmask_even = _mm256_shuffle_epi32(vnmask, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m256i vnmask_odd = _mm256_shuffle_epi32(vnmask, _MM_SHUFFLE(3, 3, 1, 1));
+
+  const __m256i vprod_even = _mm256_sub_epi64(_mm256_xor_si256(vabsprod_even, vnmask_even), vnmask_even);
+  const __m256i vprod_odd = _mm256_sub_epi64(_mm256_xor_si256(vabsprod_odd, vnmask_odd), vnmask_odd);
+
+  const __m256i vq31prod_even = _mm256_srli_epi64(_mm256_add_epi64(vprod_even, vrounding), 31);
+  const __m256i vq31prod_odd = _mm256_srli_epi64(_mm256_add_epi64(vprod_odd, vrounding), 31);
+
+  const __m256i vq31prod = _mm256_shuffle_epi32(
+    _mm256_castps_si256(_mm256_shuffle_ps(
+      _mm256_castsi256_ps(vq31prod_even), _mm256_castsi256_ps(vq31prod_odd), _MM_SHUFFLE(2, 0, 2, 0))),
+    _MM_SHUFFLE(3, 1, 2, 0));
+
+  const __m256i vrem =
+    _mm256_add_epi32(_mm256_and_si256(vq31prod, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod));
+
+  return _mm256_sub_epi32(_mm256_sra_epi32(vq31prod, vshift), _mm256_cmpgt_epi32(vrem, vremainder_threshold));
+}
+
+static QNNP_INLINE __m256i compute_x32(
+    const uint8_t* i0,
+    const uint8_t* i1,
+    const uint8_t* i2,
+    const uint8_t* i3,
+    const uint8_t* i4,
+    const uint8_t* i5,
+    const uint8_t* i6,
+    const uint8_t* i7,
+    const uint8_t* i8,
+    const void* w,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m256i vkernel_zero_point = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.kernel_zero_point));
+
+  const __m256i vb0 = _mm256_loadu_si256((const __m256i*) w);
+  const __m256i vb1 = _mm256_loadu_si256((const __m256i*) ((uintptr_t) w + 32));
+  const __m256i vb2 = _mm256_loadu_si256((const __m256i*) ((uintptr_t) w + 64));
+  const __m256i vb3 = _mm256_loadu_si256((const __m256i*) ((uintptr_t) w + 96));
+  __m256i vacc[4] = {
+    _mm256_permute2x128_si256(vb0, vb1, 0x20),
+    _mm256_permute2x128_si256(vb0, vb1, 0x31),
+    _mm256_permute2x128_si256(vb2, vb3, 0x20),
+    _mm256_permute2x128_si256(vb2, vb3, 0x31),
+  };
+
+  const uint8_t* k = (const uint8_t*) ((uintptr_t) w + 128);
+  accumulate_tap_pair(vacc, i0, i1, k, k + 32, vkernel_zero_point);
+  accumulate_tap_pair(vacc, i2, i3, k + 64, k + 96, vkernel_zero_point);
+  accumulate_tap_pair(vacc, i4, i5, k + 128, k + 160, vkernel_zero_point);
+  accumulate_tap_pair(vacc, i6, i7, k + 192, k + 224, vkernel_zero_point);
+  accumulate_tap(vacc, i8, k + 256, vkernel_zero_point);
+
+  const __m256i voutput_zero_point = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point));
+  const __m256i vout01 = _mm256_adds_epi16(
+    _mm256_packs_epi32(requantize(vacc[0], quantization_params), requantize(vacc[1], quantization_params)), voutput_zero_point);
+  const __m256i vout23 = _mm256_adds_epi16(
+    _mm256_packs_epi32(requantize(vacc[2], quantization_params), requantize(vacc[3], quantization_params)), voutput_zero_point);
+  __m256i vout = _mm256_permute4x64_epi64(_mm256_packus_epi16(vout01, vout23), _MM_SHUFFLE(3, 1, 2, 0));
+  vout = _mm256_min_epu8(vout, _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.output_max)));
+  vout = _mm256_max_epu8(vout, _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.output_min)));
+  return vout;
+}
+
+/*
+ * Remainder channels are processed 8 at a time with accumulators in channel order. The last group of fewer than 8
+ * channels re-reads preceding channels (or the zero padding in front of the zero buffer) like the SSE2 micro-kernel,
+ * and shifts them out, so the micro-kernel never reads past the end of input rows.
+ */
+static QNNP_INLINE __m256i interleave_x8(__m128i va, __m128i vb)
+{
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(va, vb)), _mm_unpackhi_epi16(va, vb), 1);
+}
+
+static QNNP_INLINE __m128i compute_x8(
+    const uint8_t* const i[restrict static 9],
+    size_t offset,
+    size_t i_predecrement,
+    const void* w,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  const __m128i vkernel_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.kernel_zero_point);
+  const __m128i vi_shift = _mm_cvtsi32_si128(8 * i_predecrement);
+
+  __m256i vacc = _mm256_loadu_si256((const __m256i*) ((uintptr_t) w + offset * sizeof(int32_t)));
+  const uint8_t* k = (const uint8_t*) ((uintptr_t) w + 128 + offset);
+  for (size_t t = 0; t < 9; t += 2) {
+    const __m128i vxia = _mm_cvtepu8_epi16(
+      _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (i[t] + offset - i_predecrement)), vi_shift));
+    const __m128i vxka = _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) (k + 32 * t))), vkernel_zero_point);
+    __m128i vxib = _mm_setzero_si128();
+    __m128i vxkb = _mm_setzero_si128();
+    if (t + 1 < 9) {
+      vxib = _mm_cvtepu8_epi16(
+        _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (i[t + 1] + offset - i_predecrement)), vi_shift));
+      vxkb = _mm_sub_epi16(_mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) (k + 32 * (t + 1)))), vkernel_zero_point);
+    }
+    vacc = _mm256_add_epi32(vacc, _mm256_madd_epi16(interleave_x8(vxia, vxib), interleave_x8(vxka, vxkb)));
+  }
+
+  const __m256i vout32 = requantize(vacc, quantization_params);
+  __m128i vout = _mm_adds_epi16(
+    _mm_packs_epi32(_mm256_castsi256_si128(vout32), _mm256_extracti128_si256(vout32, 1)),
+    _mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point));
+  vout = _mm_packus_epi16(vout, vout);
+  vout = _mm_min_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_max));
+  vout = _mm_max_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_min));
+  return vout;
+}
+
+static QNNP_INLINE uint8_t* store_x8(uint8_t* output, __m128i vout, size_t n)
+{
+  if (n >= 8) {
+    _mm_storel_epi64((__m128i*) output, vout);
+    return output + 8;
+  }
+  if (n & 4) {
+    *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+    output += 4;
+    vout = _mm_srli_epi64(vout, 32);
+  }
+  if (n & 2) {
+    *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+    output += 2;
+    vout = _mm_srli_epi32(vout, 16);
+  }
+  if (n & 1) {
+    *((uint8_t*) output) = (uint8_t) _mm_cvtsi128_si32(vout);
+    output += 1;
+  }
+  return output;
+}
+
+void q8dwconv_ukernel_up32x9__avx2(
+    size_t channels,
+    size_t output_width,
+    const uint8_t** input,
+    const void* weights,
+    uint8_t* output,
+    size_t input_stride,
+    size_t output_increment,
+    const union qnnp_conv_quantization_params quantization_params[restrict static 1])
+{
+  do {
+    const uint8_t* i0 = input[0];
+    const uint8_t* i1 = input[1];
+    const uint8_t* i2 = input[2];
+    const uint8_t* i3 = input[3];
+    const uint8_t* i4 = input[4];
+    const uint8_t* i5 = input[5];
+    const uint8_t* i6 = input[6];
+    const uint8_t* i7 = input[7];
+    const uint8_t* i8 = input[8];
+
+    input = (const uint8_t**) ((uintptr_t) input + input_stride);
+
+    size_t c = channels;
+    const void* w = weights;
+    for (; c >= 32; c -= 32) {
+      const __m256i vout = compute_x32(i0, i1, i2, i3, i4, i5, i6, i7, i8, w, quantization_params);
+      _mm256_storeu_si256((__m256i*) output, vout); output += 32;
+
+      i0 += 32;
+      i1 += 32;
+      i2 += 32;
+      i3 += 32;
+      i4 += 32;
+      i5 += 32;
+      i6 += 32;
+      i7 += 32;
+      i8 += 32;
+      w = (const void*) ((uintptr_t) w + 416);
+    }
+    if (c != 0) {
+      const uint8_t* i[9] = { i0, i1, i2, i3, i4, i5, i6, i7, i8 };
+      for (size_t offset = 0; offset < c; offset += 8) {
+        const size_t n = c - offset;
+        const size_t i_predecrement = n < 8 ? 8 - n : 0;
+        output = store_x8(output, compute_x8(i, offset, i_predecrement, w, quantization_params), n);
+      }
+    }
+
+    output = (uint8_t*) ((uintptr_t) output + output_increment);
+  } while (--output_width != 0);
+}
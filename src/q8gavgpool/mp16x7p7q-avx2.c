@@ -0,0 +1,391 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/q8gavgpool.h>
+
+
+static QNNP_INLINE __m256i scale(
+    __m256i vacc,
+    __m256i vmultiplier,
+    __m256i vrounding,
+    __m128i vright_shift)
+{
+  const __m256i vneg_mask = _mm256_cmpgt_epi32(_mm256_setzero_si256(), vacc);
+  const __m256i vabs = _mm256_sub_epi32(_mm256_xor_si256(vacc, vneg_mask), vneg_mask);
+
+  const __m256i vabsmul_even = _mm256_mul_epu32(vabs, vmultiplier);
+  const __m256i vabsmul_odd = _mm256_mul_epu32(_mm256_shuffle_epi32(vabs, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+
+  const __m256i vabs_scaled_even = _mm256_srl_epi64(_mm256_add_epi64(vabsmul_even, vrounding), vright_shift);
+  const __m256i vabs_scaled_odd = _mm256_srl_epi64(_mm256_add_epi64(vabsmul_odd, vrounding), vright_shift);
+
+  const __m256i vabs_scaled = _mm256_shuffle_epi32(
+    _mm256_castps_si256(_mm256_shuffle_ps(
+      _mm256_castsi256_ps(vabs_scaled_even), _mm256_castsi256_ps(vabs_scaled_odd), _MM_SHUFFLE(2, 0, 2, 0))),
+    _MM_SHUFFLE(3, 1, 2, 0));
+
+  return _mm256_sub_epi32(_mm256_xor_si256(vabs_scaled, vneg_mask), vneg_mask);
+}
+
+/* Converts scaled accumulators of 16 consecutive channels into clamped 8-bit outputs */
+static QNNP_INLINE __m128i pack_x16(
+    __m256i vscaled_lo,
+    __m256i vscaled_hi,
+    const union qnnp_avgpool_quantization_params quantization_params[restrict static 1])
+{
+  __m256i vout16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(vscaled_lo, vscaled_hi), _MM_SHUFFLE(3, 1, 2, 0));
+  vout16 = _mm256_adds_epi16(vout16,
+    _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point)));
+  __m128i vout = _mm_packus_epi16(_mm256_castsi256_si128(vout16), _mm256_extracti128_si256(vout16, 1));
+  vout = _mm_min_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_max));
+  vout = _mm_max_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_min));
+  return vout;
+}
+
+/* Converts scaled accumulators of 8 consecutive channels into clamped 8-bit outputs in the low half */
+static QNNP_INLINE __m128i pack_x8(
+    __m256i vscaled,
+    const union qnnp_avgpool_quantization_params quantization_params[restrict static 1])
+{
+  __m128i vout = _mm_packs_epi32(_mm256_castsi256_si128(vscaled), _mm256_extracti128_si256(vscaled, 1));
+  vout = _mm_adds_epi16(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point));
+  vout = _mm_packus_epi16(vout, vout);
+  vout = _mm_min_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_max));
+  vout = _mm_max_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_min));
+  return vout;
+}
+
+void q8gavgpool_ukernel_mp16x7p7q__avx2(
+    size_t m,
+    size_t n,
+    const uint8_t* input,
+    size_t input_stride,
+    const uint8_t* zero,
+    int32_t* buffer,
+    uint8_t* output,
+    const union qnnp_avgpool_quantization_params quantization_params[restrict static 1])
+{
+  assert(m > 7);
+  assert(n >= 16);
+
+  const __m256i vbias = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) &quantization_params->sse2.bias));
+  const __m256i vmultiplier = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.multiplier));
+  const __m256i vrounding = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.rounding));
+  const __m128i vright_shift = _mm_loadl_epi64((const __m128i*) quantization_params->sse2.right_shift);
+
+  {
+    const uint8_t* i0 = input;
+    const uint8_t* i1 = i0 + input_stride;
+    const uint8_t* i2 = i1 + input_stride;
+    const uint8_t* i3 = i2 + input_stride;
+    const uint8_t* i4 = i3 + input_stride;
+    const uint8_t* i5 = i4 + input_stride;
+    const uint8_t* i6 = i5 + input_stride;
+
+    size_t k = n;
+    int32_t* acc = buffer;
+    while (k >= 16) {
+      const __m256i vxi0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i0)); i0 += 16;
+      const __m256i vxi1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i1)); i1 += 16;
+      const __m256i vxi2 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i2)); i2 += 16;
+      const __m256i vxi3 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i3)); i3 += 16;
+      const __m256i vxi4 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i4)); i4 += 16;
+      const __m256i vxi5 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i5)); i5 += 16;
+      const __m256i vxi6 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i6)); i6 += 16;
+
+      const __m256i vsum01 = _mm256_add_epi16(vxi0, vxi1);
+      const __m256i vsum23 = _mm256_add_epi16(vxi2, vxi3);
+      const __m256i vsum45 = _mm256_add_epi16(vxi4, vxi5);
+      const __m256i vsum0123 = _mm256_add_epi16(vsum01, vsum23);
+      const __m256i vsum456 = _mm256_add_epi16(vsum45, vxi6);
+      const __m256i vsum0123456 = _mm256_add_epi16(vsum0123, vsum456);
+
+      const __m256i vacc_lo = _mm256_add_epi32(vbias, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(vsum0123456)));
+      const __m256i vacc_hi = _mm256_add_epi32(vbias, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(vsum0123456, 1)));
+
+      _mm256_storeu_si256((__m256i*) acc, vacc_lo);
+      _mm256_storeu_si256((__m256i*) (acc + 8), vacc_hi);
+      acc += 16;
+
+      k -= 16;
+    }
+    if (k >= 8) {
+      const __m128i vxi0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i0)); i0 += 8;
+      const __m128i vxi1 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i1)); i1 += 8;
+      const __m128i vxi2 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i2)); i2 += 8;
+      const __m128i vxi3 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i3)); i3 += 8;
+      const __m128i vxi4 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i4)); i4 += 8;
+      const __m128i vxi5 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i5)); i5 += 8;
+      const __m128i vxi6 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i6)); i6 += 8;
+
+      const __m128i vsum01 = _mm_add_epi16(vxi0, vxi1);
+      const __m128i vsum23 = _mm_add_epi16(vxi2, vxi3);
+      const __m128i vsum45 = _mm_add_epi16(vxi4, vxi5);
+      const __m128i vsum0123 = _mm_add_epi16(vsum01, vsum23);
+      const __m128i vsum456 = _mm_add_epi16(vsum45, vxi6);
+      const __m128i vsum0123456 = _mm_add_epi16(vsum0123, vsum456);
+
+      const __m256i vacc = _mm256_add_epi32(vbias, _mm256_cvtepu16_epi32(vsum0123456));
+
+      _mm256_storeu_si256((__m256i*) acc, vacc);
+      acc += 8;
+
+      k -= 8;
+    }
+    if (k != 0) {
+      const size_t address_decrement = 8 - k;
+      i0 = (const uint8_t*) ((uintptr_t) i0 - address_decrement);
+      i1 = (const uint8_t*) ((uintptr_t) i1 - address_decrement);
+      i2 = (const uint8_t*) ((uintptr_t) i2 - address_decrement);
+      i3 = (const uint8_t*) ((uintptr_t) i3 - address_decrement);
+      i4 = (const uint8_t*) ((uintptr_t) i4 - address_decrement);
+      i5 = (const uint8_t*) ((uintptr_t) i5 - address_decrement);
+      i6 = (const uint8_t*) ((uintptr_t) i6 - address_decrement);
+      const __m128i vshift = _mm_cvtsi32_si128(8 * address_decrement);
+
+      const __m128i vxi0 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i0), vshift));
+      const __m128i vxi1 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i1), vshift));
+      const __m128i vxi2 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i2), vshift));
+      const __m128i vxi3 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i3), vshift));
+      const __m128i vxi4 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i4), vshift));
+      const __m128i vxi5 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i5), vshift));
+      const __m128i vxi6 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i6), vshift));
+
+      const __m128i vsum01 = _mm_add_epi16(vxi0, vxi1);
+      const __m128i vsum23 = _mm_add_epi16(vxi2, vxi3);
+      const __m128i vsum45 = _mm_add_epi16(vxi4, vxi5);
+      const __m128i vsum0123 = _mm_add_epi16(vsum01, vsum23);
+      const __m128i vsum456 = _mm_add_epi16(vsum45, vxi6);
+      const __m128i vsum0123456 = _mm_add_epi16(vsum0123, vsum456);
+
+      const __m256i vacc = _mm256_add_epi32(vbias, _mm256_cvtepu16_epi32(vsum0123456));
+
+      _mm256_storeu_si256((__m256i*) acc, vacc);
+    }
+  }
+  for (m -= 7; m > 7; m -= 7) {
+    input += 7 * input_stride;
+    const uint8_t* i0 = input;
+    const uint8_t* i1 = i0 + input_stride;
+    const uint8_t* i2 = i1 + input_stride;
+    const uint8_t* i3 = i2 + input_stride;
+    const uint8_t* i4 = i3 + input_stride;
+    const uint8_t* i5 = i4 + input_stride;
+    const uint8_t* i6 = i5 + input_stride;
+
+    size_t k = n;
+    int32_t* acc = buffer;
+    while (k >= 16) {
+      const __m256i vxi0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i0)); i0 += 16;
+      const __m256i vxi1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i1)); i1 += 16;
+      const __m256i vxi2 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i2)); i2 += 16;
+      const __m256i vxi3 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i3)); i3 += 16;
+      const __m256i vxi4 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i4)); i4 += 16;
+      const __m256i vxi5 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i5)); i5 += 16;
+      const __m256i vxi6 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i6)); i6 += 16;
+
+      const __m256i vsum01 = _mm256_add_epi16(vxi0, vxi1);
+      const __m256i vsum23 = _mm256_add_epi16(vxi2, vxi3);
+      const __m256i vsum45 = _mm256_add_epi16(vxi4, vxi5);
+      const __m256i vsum0123 = _mm256_add_epi16(vsum01, vsum23);
+      const __m256i vsum456 = _mm256_add_epi16(vsum45, vxi6);
+      const __m256i vsum0123456 = _mm256_add_epi16(vsum0123, vsum456);
+
+      const __m256i vacc_lo = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) acc), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(vsum0123456)));
+      const __m256i vacc_hi = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) (acc + 8)), _mm256_cvtepu16_epi32(_mm256_extracti128_si256(vsum0123456, 1)));
+
+      _mm256_storeu_si256((__m256i*) acc, vacc_lo);
+      _mm256_storeu_si256((__m256i*) (acc + 8), vacc_hi);
+      acc += 16;
+
+      k -= 16;
+    }
+    if (k >= 8) {
+      const __m128i vxi0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i0)); i0 += 8;
+      const __m128i vxi1 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i1)); i1 += 8;
+      const __m128i vxi2 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i2)); i2 += 8;
+      const __m128i vxi3 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i3)); i3 += 8;
+      const __m128i vxi4 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i4)); i4 += 8;
+      const __m128i vxi5 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i5)); i5 += 8;
+      const __m128i vxi6 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i6)); i6 += 8;
+
+      const __m128i vsum01 = _mm_add_epi16(vxi0, vxi1);
+      const __m128i vsum23 = _mm_add_epi16(vxi2, vxi3);
+      const __m128i vsum45 = _mm_add_epi16(vxi4, vxi5);
+      const __m128i vsum0123 = _mm_add_epi16(vsum01, vsum23);
+      const __m128i vsum456 = _mm_add_epi16(vsum45, vxi6);
+      const __m128i vsum0123456 = _mm_add_epi16(vsum0123, vsum456);
+
+      const __m256i vacc = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) acc), _mm256_cvtepu16_epi32(vsum0123456));
+
+      _mm256_storeu_si256((__m256i*) acc, vacc);
+      acc += 8;
+
+      k -= 8;
+    }
+    if (k != 0) {
+      const size_t address_decrement = 8 - k;
+      i0 = (const uint8_t*) ((uintptr_t) i0 - address_decrement);
+      i1 = (const uint8_t*) ((uintptr_t) i1 - address_decrement);
+      i2 = (const uint8_t*) ((uintptr_t) i2 - address_decrement);
+      i3 = (const uint8_t*) ((uintptr_t) i3 - address_decrement);
+      i4 = (const uint8_t*) ((uintptr_t) i4 - address_decrement);
+      i5 = (const uint8_t*) ((uintptr_t) i5 - address_decrement);
+      i6 = (const uint8_t*) ((uintptr_t) i6 - address_decrement);
+      const __m128i vshift = _mm_cvtsi32_si128(8 * address_decrement);
+
+      const __m128i vxi0 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i0), vshift));
+      const __m128i vxi1 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i1), vshift));
+      const __m128i vxi2 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i2), vshift));
+      const __m128i vxi3 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i3), vshift));
+      const __m128i vxi4 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i4), vshift));
+      const __m128i vxi5 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i5), vshift));
+      const __m128i vxi6 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i6), vshift));
+
+      const __m128i vsum01 = _mm_add_epi16(vxi0, vxi1);
+      const __m128i vsum23 = _mm_add_epi16(vxi2, vxi3);
+      const __m128i vsum45 = _mm_add_epi16(vxi4, vxi5);
+      const __m128i vsum0123 = _mm_add_epi16(vsum01, vsum23);
+      const __m128i vsum456 = _mm_add_epi16(vsum45, vxi6);
+      const __m128i vsum0123456 = _mm_add_epi16(vsum0123, vsum456);
+
+      const __m256i vacc = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) acc), _mm256_cvtepu16_epi32(vsum0123456));
+
+      _mm256_storeu_si256((__m256i*) acc, vacc);
+    }
+  }
+  {
+    input += 7 * input_stride;
+    const uint8_t* i0 = input;
+    const uint8_t* i1 = i0 + input_stride;
+    if (m < 2) {
+      i1 = zero;
+    }
+    const uint8_t* i2 = i1 + input_stride;
+    if (m <= 2) {
+      i2 = zero;
+    }
+    const uint8_t* i3 = i2 + input_stride;
+    if (m < 4) {
+      i3 = zero;
+    }
+    const uint8_t* i4 = i3 + input_stride;
+    if (m <= 4) {
+      i4 = zero;
+    }
+    const uint8_t* i5 = i4 + input_stride;
+    if (m < 6) {
+      i5 = zero;
+    }
+    const uint8_t* i6 = i5 + input_stride;
+    if (m <= 6) {
+      i6 = zero;
+    }
+
+    size_t k = n;
+    int32_t* acc = buffer;
+    while (k >= 16) {
+      const __m256i vxi0 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i0)); i0 += 16;
+      const __m256i vxi1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i1)); i1 += 16;
+      const __m256i vxi2 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i2)); i2 += 16;
+      const __m256i vxi3 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i3)); i3 += 16;
+      const __m256i vxi4 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i4)); i4 += 16;
+      const __m256i vxi5 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i5)); i5 += 16;
+      const __m256i vxi6 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i6)); i6 += 16;
+
+      const __m256i vsum01 = _mm256_add_epi16(vxi0, vxi1);
+      const __m256i vsum23 = _mm256_add_epi16(vxi2, vxi3);
+      const __m256i vsum45 = _mm256_add_epi16(vxi4, vxi5);
+      const __m256i vsum0123 = _mm256_add_epi16(vsum01, vsum23);
+      const __m256i vsum456 = _mm256_add_epi16(vsum45, vxi6);
+      const __m256i vsum0123456 = _mm256_add_epi16(vsum0123, vsum456);
+
+      const __m256i vacc_lo = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) acc), _mm256_cvtepu16_epi32(_mm256_castsi256_si128(vsum0123456)));
+      const __m256i vacc_hi = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) (acc + 8)), _mm256_cvtepu16_epi32(_mm256_extracti128_si256(vsum0123456, 1)));
+
+      acc += 16;
+      const __m128i vout = pack_x16(
+        scale(vacc_lo, vmultiplier, vrounding, vright_shift), scale(vacc_hi, vmultiplier, vrounding, vright_shift), quantization_params);
+      _mm_storeu_si128((__m128i*) output, vout); output += 16;
+
+      k -= 16;
+    }
+    if (k >= 8) {
+      const __m128i vxi0 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i0)); i0 += 8;
+      const __m128i vxi1 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i1)); i1 += 8;
+      const __m128i vxi2 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i2)); i2 += 8;
+      const __m128i vxi3 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i3)); i3 += 8;
+      const __m128i vxi4 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i4)); i4 += 8;
+      const __m128i vxi5 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i5)); i5 += 8;
+      const __m128i vxi6 = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i6)); i6 += 8;
+
+      const __m128i vsum01 = _mm_add_epi16(vxi0, vxi1);
+      const __m128i vsum23 = _mm_add_epi16(vxi2, vxi3);
+      const __m128i vsum45 = _mm_add_epi16(vxi4, vxi5);
+      const __m128i vsum0123 = _mm_add_epi16(vsum01, vsum23);
+      const __m128i vsum456 = _mm_add_epi16(vsum45, vxi6);
+      const __m128i vsum0123456 = _mm_add_epi16(vsum0123, vsum456);
+
+      const __m256i vacc = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) acc), _mm256_cvtepu16_epi32(vsum0123456));
+
+      acc += 8;
+      const __m128i vout = pack_x8(scale(vacc, vmultiplier, vrounding, vright_shift), quantization_params);
+      _mm_storel_epi64((__m128i*) output, vout); output += 8;
+
+      k -= 8;
+    }
+    if (k != 0) {
+      const size_t address_decrement = 8 - k;
+      i0 = (const uint8_t*) ((uintptr_t) i0 - address_decrement);
+      i1 = (const uint8_t*) ((uintptr_t) i1 - address_decrement);
+      i2 = (const uint8_t*) ((uintptr_t) i2 - address_decrement);
+      i3 = (const uint8_t*) ((uintptr_t) i3 - address_decrement);
+      i4 = (const uint8_t*) ((uintptr_t) i4 - address_decrement);
+      i5 = (const uint8_t*) ((uintptr_t) i5 - address_decrement);
+      i6 = (const uint8_t*) ((uintptr_t) i6 - address_decrement);
+      const __m128i vshift = _mm_cvtsi32_si128(8 * address_decrement);
+
+      const __m128i vxi0 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i0), vshift));
+      const __m128i vxi1 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i1), vshift));
+      const __m128i vxi2 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i2), vshift));
+      const __m128i vxi3 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i3), vshift));
+      const __m128i vxi4 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i4), vshift));
+      const __m128i vxi5 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i5), vshift));
+      const __m128i vxi6 = _mm_cvtepu8_epi16(_mm_srl_epi64(_mm_loadl_epi64((const __m128i*) i6), vshift));
+
+      const __m128i vsum01 = _mm_add_epi16(vxi0, vxi1);
+      const __m128i vsum23 = _mm_add_epi16(vxi2, vxi3);
+      const __m128i vsum45 = _mm_add_epi16(vxi4, vxi5);
+      const __m128i vsum0123 = _mm_add_epi16(vsum01, vsum23);
+      const __m128i vsum456 = _mm_add_epi16(vsum45, vxi6);
+      const __m128i vsum0123456 = _mm_add_epi16(vsum0123, vsum456);
+
+      const __m256i vacc = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*) acc), _mm256_cvtepu16_epi32(vsum0123456));
+
+      __m128i vout = pack_x8(scale(vacc, vmultiplier, vrounding, vright_shift), quantization_params);
+      if (k & 4) {
+        *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+        output += 4;
+        vout = _mm_srli_epi64(vout, 32);
+      }
+      if (k & 2) {
+        *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+        output += 2;
+        vout = _mm_srli_epi32(vout, 16);
+      }
+      if (k & 1) {
+        *((uint8_t*) output) = (uint8_t) _mm_cvtsi128_si32(vout);
+        output += 1;
+      }
+    }
+  }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/q8gavgpool.h>
+
+
+static QNNP_INLINE __m256i scale(
+    __m256i vacc,
+    __m256i vmultiplier,
+    __m256i vrounding,
+    __m128i vright_shift)
+{
+  const __m256i vneg_mask = _mm256_cmpgt_epi32(_mm256_setzero_si256(), vacc);
+  const __m256i vabs = _mm256_sub_epi32(_mm256_xor_si256(vacc, vneg_mask), vneg_mask);
+
+  const __m256i vabsmul_even = _mm256_mul_epu32(vabs, vmultiplier);
+  const __m256i vabsmul_odd = _mm256_mul_epu32(_mm256_shuffle_epi32(vabs, _MM_SHUFFLE(2, 3, 0, 1)), vmultiplier);
+
+  const __m256i vabs_scaled_even = _mm256_srl_epi64(_mm256_add_epi64(vabsmul_even, vrounding), vright_shift);
+  const __m256i vabs_scaled_odd = _mm256_srl_epi64(_mm256_add_epi64(vabsmul_odd, vrounding), vright_shift);
+
+  const __m256i vabs_scaled = _mm256_shuffle_epi32(
+    _mm256_castps_si256(_mm256_shuffle_ps(
+      _mm256_castsi256_ps(vabs_scaled_even), _mm256_castsi256_ps(vabs_scaled_odd), _MM_SHUFFLE(2, 0, 2, 0))),
+    _MM_SHUFFLE(3, 1, 2, 0));
+
+  return _mm256_sub_epi32(_mm256_xor_si256(vabs_scaled, vneg_mask), vneg_mask);
+}
+
+/* Converts scaled accumulators of 16 consecutive channels into clamped 8-bit outputs */
+static QNNP_INLINE __m128i pack_x16(
+    __m256i vscaled_lo,
+    __m256i vscaled_hi,
+    const union qnnp_avgpool_quantization_params quantization_params[restrict static 1])
+{
+  __m256i vout16 = _mm256_permute4x64_epi64(_mm256_packs_epi32(vscaled_lo, vscaled_hi), _MM_SHUFFLE(3, 1, 2, 0));
+  vout16 = _mm256_adds_epi16(vout16,
+    _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.output_zero_point)));
+  __m128i vout = _mm_packus_epi16(_mm256_castsi256_si128(vout16), _mm256_extracti128_si256(vout16, 1));
+  vout = _mm_min_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_max));
+  vout = _mm_max_epu8(vout, _mm_load_si128((const __m128i*) quantization_params->sse2.output_min));
+  return vout;
+}
+
+void q8gavgpool_ukernel_up16xm__avx2(
+    size_t m,
+    size_t n,
+    const uint8_t* input,
+    size_t input_stride,
+    const uint8_t* zero,
+    uint8_t* output,
+    const union qnnp_avgpool_quantization_params quantization_params[restrict static 1])
+{
+  assert(m >= 1);
+  assert(n < 16);
+
+  const __m256i vbias = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) &quantization_params->sse2.bias));
+  const __m256i vmultiplier = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.multiplier));
+  const __m256i vrounding = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) quantization_params->sse2.rounding));
+  const __m128i vright_shift = _mm_loadl_epi64((const __m128i*) quantization_params->sse2.right_shift);
+
+  __m256i vacc_lo = vbias;
+  __m256i vacc_hi = vbias;
+  do {
+    const uint8_t* i = input;
+    i += n;
+    __m128i vi = _mm_setzero_si128();
+    if (n & 1) {
+      i -= 1;
+      vi = _mm_cvtsi32_si128((int) (uint32_t) *i);
+    }
+    if (n & 2) {
+      vi = _mm_slli_epi32(vi, 16);
+      i -= 2;
+      vi = _mm_insert_epi16(vi, *((const uint16_t*) i), 0);
+    }
+    if (n & 4) {
+      i -= 4;
+      vi = _mm_unpacklo_epi32(_mm_cvtsi32_si128((int) *((const uint32_t*) i)), vi);
+    }
+    if (n & 8) {
+      i -= 8;
+      vi = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i*) i), vi);
+    }
+    vacc_lo = _mm256_add_epi32(vacc_lo, _mm256_cvtepu8_epi32(vi));
+    vacc_hi = _mm256_add_epi32(vacc_hi, _mm256_cvtepu8_epi32(_mm_unpackhi_epi64(vi, vi)));
+    input += input_stride;
+  } while (--m != 0);
+
+  __m128i vout = pack_x16(scale(vacc_lo, vmultiplier, vrounding, vright_shift), scale(vacc_hi, vmultiplier, vrounding, vright_shift), quantization_params);
+  if (n & 8) {
+    _mm_storel_epi64((__m128i*) output, vout);
+    output += 8;
+    vout = _mm_unpackhi_epi64(vout, vout);
+  }
+  if (n & 4) {
+    *((uint32_t*) output) = (uint32_t) _mm_cvtsi128_si32(vout);
+    output += 4;
+    vout = _mm_srli_epi64(vout, 32);
+  }
+  if (n & 2) {
+    *((uint16_t*) output) = (uint16_t) _mm_extract_epi16(vout, 0);
+    output += 2;
+    vout = _mm_srli_epi32(vout, 16);
+  }
+  if (n & 1) {
+    *((uint8_t*) output) = (uint8_t) _mm_cvtsi128_si32(vout);
+    output += 1;
+  }
+}
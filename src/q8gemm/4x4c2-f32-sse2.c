@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <immintrin.h>
+
+#include <qnnpack/q8gemm.h>
+
+
+void q8gemm_f32_ukernel_4x4c2__sse2(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const uint8_t* restrict a,
+    size_t a_stride,
+    const void* restrict w,
+    float* restrict c,
+    size_t c_stride,
+    const union qnnp_conv_dequantization_params dequantization_params[restrict static 1])
+{
+  __m128i vacc0x0123 = _mm_loadu_si128((const __m128i*) w);
+  __m128i vacc1x0123 = vacc0x0123;
+  __m128i vacc2x0123 = vacc0x0123;
+  __m128i vacc3x0123 = vacc0x0123;
+  w = (const void*) ((uintptr_t) w + 16);
+
+  const uint8_t* a0 = a;
+  const uint8_t* a1 = (const uint8_t*) ((uintptr_t) a0 + a_stride);
+  if (mr < 2) {
+    a1 = a0;
+  }
+  const uint8_t* a2 = (const uint8_t*) ((uintptr_t) a1 + a_stride);
+  if (mr <= 2) {
+    a2 = a1;
+  }
+  const uint8_t* a3 = (const uint8_t*) ((uintptr_t) a2 + a_stride);
+  if (mr != 4) {
+    a3 = a2;
+  }
+
+  const __m128i vb_zero_point = _mm_load_si128((const __m128i*) dequantization_params->sse2.kernel_zero_point);
+  const __m128i vzero = _mm_setzero_si128();
+  for (; k >= 8; k -= 8) {
+    const __m128i va0 = _mm_loadl_epi64((const __m128i*) a0);
+    const __m128i vxa0 = _mm_unpacklo_epi8(va0, vzero);
+    a0 += 8;
+    const __m128i va1 = _mm_loadl_epi64((const __m128i*) a1);
+    const __m128i vxa1 = _mm_unpacklo_epi8(va1, vzero);
+    a1 += 8;
+    const __m128i va2 = _mm_loadl_epi64((const __m128i*) a2);
+    const __m128i vxa2 = _mm_unpacklo_epi8(va2, vzero);
+    a2 += 8;
+    const __m128i va3 = _mm_loadl_epi64((const __m128i*) a3);
+    const __m128i vxa3 = _mm_unpacklo_epi8(va3, vzero);
+    a3 += 8;
+
+    const __m128i vb0 = _mm_loadl_epi64((const __m128i*) w);
+    const __m128i vxb0 = _mm_sub_epi16(_mm_unpacklo_epi8(vb0, vzero), vb_zero_point);
+
+    vacc0x0123 = _mm_add_epi32(vacc0x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(0, 0, 0, 0)), vxb0));
+    vacc1x0123 = _mm_add_epi32(vacc1x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(0, 0, 0, 0)), vxb0));
+    vacc2x0123 = _mm_add_epi32(vacc2x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(0, 0, 0, 0)), vxb0));
+    vacc3x0123 = _mm_add_epi32(vacc3x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(0, 0, 0, 0)), vxb0));
+
+    const __m128i vb1 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 8));
+    const __m128i vxb1 = _mm_sub_epi16(_mm_unpacklo_epi8(vb1, vzero), vb_zero_point);
+
+    vacc0x0123 = _mm_add_epi32(vacc0x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(1, 1, 1, 1)), vxb1));
+    vacc1x0123 = _mm_add_epi32(vacc1x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(1, 1, 1, 1)), vxb1));
+    vacc2x0123 = _mm_add_epi32(vacc2x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(1, 1, 1, 1)), vxb1));
+    vacc3x0123 = _mm_add_epi32(vacc3x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(1, 1, 1, 1)), vxb1));
+
+    const __m128i vb2 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 16));
+    const __m128i vxb2 = _mm_sub_epi16(_mm_unpacklo_epi8(vb2, vzero), vb_zero_point);
+
+    vacc0x0123 = _mm_add_epi32(vacc0x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(2, 2, 2, 2)), vxb2));
+    vacc1x0123 = _mm_add_epi32(vacc1x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(2, 2, 2, 2)), vxb2));
+    vacc2x0123 = _mm_add_epi32(vacc2x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(2, 2, 2, 2)), vxb2));
+    vacc3x0123 = _mm_add_epi32(vacc3x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(2, 2, 2, 2)), vxb2));
+
+    const __m128i vb3 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 24));
+    const __m128i vxb3 = _mm_sub_epi16(_mm_unpacklo_epi8(vb3, vzero), vb_zero_point);
+    w = (const void*) ((uintptr_t) w + 32);
+
+    vacc0x0123 = _mm_add_epi32(vacc0x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(3, 3, 3, 3)), vxb3));
+    vacc1x0123 = _mm_add_epi32(vacc1x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(3, 3, 3, 3)), vxb3));
+    vacc2x0123 = _mm_add_epi32(vacc2x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(3, 3, 3, 3)), vxb3));
+    vacc3x0123 = _mm_add_epi32(vacc3x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(3, 3, 3, 3)), vxb3));
+  }
+  if (k != 0) {
+    const size_t a_predecrement = 8 - k;
+    const __m128i va_shift = _mm_cvtsi32_si128(8 * a_predecrement);
+
+    const __m128i va0 = _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a0 - a_predecrement)), va_shift);
+    const __m128i vxa0 = _mm_unpacklo_epi8(va0, vzero);
+    const __m128i va1 = _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a1 - a_predecrement)), va_shift);
+    const __m128i vxa1 = _mm_unpacklo_epi8(va1, vzero);
+    const __m128i va2 = _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a2 - a_predecrement)), va_shift);
+    const __m128i vxa2 = _mm_unpacklo_epi8(va2, vzero);
+    const __m128i va3 = _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a3 - a_predecrement)), va_shift);
+    const __m128i vxa3 = _mm_unpacklo_epi8(va3, vzero);
+
+    const __m128i vb0 = _mm_loadl_epi64((const __m128i*) w);
+    const __m128i vxb0 = _mm_sub_epi16(_mm_unpacklo_epi8(vb0, vzero), vb_zero_point);
+
+    vacc0x0123 = _mm_add_epi32(vacc0x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(0, 0, 0, 0)), vxb0));
+    vacc1x0123 = _mm_add_epi32(vacc1x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(0, 0, 0, 0)), vxb0));
+    vacc2x0123 = _mm_add_epi32(vacc2x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(0, 0, 0, 0)), vxb0));
+    vacc3x0123 = _mm_add_epi32(vacc3x0123,
+      _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(0, 0, 0, 0)), vxb0));
+
+    if (k > 2) {
+      const __m128i vb1 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 8));
+      const __m128i vxb1 = _mm_sub_epi16(_mm_unpacklo_epi8(vb1, vzero), vb_zero_point);
+
+      vacc0x0123 = _mm_add_epi32(vacc0x0123,
+        _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(1, 1, 1, 1)), vxb1));
+      vacc1x0123 = _mm_add_epi32(vacc1x0123,
+        _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(1, 1, 1, 1)), vxb1));
+      vacc2x0123 = _mm_add_epi32(vacc2x0123,
+        _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(1, 1, 1, 1)), vxb1));
+      vacc3x0123 = _mm_add_epi32(vacc3x0123,
+        _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(1, 1, 1, 1)), vxb1));
+
+      if (k > 4) {
+        const __m128i vb2 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 16));
+        const __m128i vxb2 = _mm_sub_epi16(_mm_unpacklo_epi8(vb2, vzero), vb_zero_point);
+
+        vacc0x0123 = _mm_add_epi32(vacc0x0123,
+          _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(2, 2, 2, 2)), vxb2));
+        vacc1x0123 = _mm_add_epi32(vacc1x0123,
+          _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(2, 2, 2, 2)), vxb2));
+        vacc2x0123 = _mm_add_epi32(vacc2x0123,
+          _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(2, 2, 2, 2)), vxb2));
+        vacc3x0123 = _mm_add_epi32(vacc3x0123,
+          _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(2, 2, 2, 2)), vxb2));
+
+        if (k > 6) {
+          const __m128i vb3 = _mm_loadl_epi64((const __m128i*) ((uintptr_t) w + 24));
+          const __m128i vxb3 = _mm_sub_epi16(_mm_unpacklo_epi8(vb3, vzero), vb_zero_point);
+
+          vacc0x0123 = _mm_add_epi32(vacc0x0123,
+            _mm_madd_epi16(_mm_shuffle_epi32(vxa0, _MM_SHUFFLE(3, 3, 3, 3)), vxb3));
+          vacc1x0123 = _mm_add_epi32(vacc1x0123,
+            _mm_madd_epi16(_mm_shuffle_epi32(vxa1, _MM_SHUFFLE(3, 3, 3, 3)), vxb3));
+          vacc2x0123 = _mm_add_epi32(vacc2x0123,
+            _mm_madd_epi16(_mm_shuffle_epi32(vxa2, _MM_SHUFFLE(3, 3, 3, 3)), vxb3));
+          vacc3x0123 = _mm_add_epi32(vacc3x0123,
+            _mm_madd_epi16(_mm_shuffle_epi32(vxa3, _MM_SHUFFLE(3, 3, 3, 3)), vxb3));
+        }
+      }
+    }
+  }
+
+  const __m128 vscale = _mm_load_ps(dequantization_params->sse2.scale);
+  __m128 vout0x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc0x0123), vscale);
+  __m128 vout1x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc1x0123), vscale);
+  __m128 vout2x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc2x0123), vscale);
+  __m128 vout3x0123 = _mm_mul_ps(_mm_cvtepi32_ps(vacc3x0123), vscale);
+
+  float* c0 = c;
+  float* c1 = (float*) ((uintptr_t) c0 + c_stride);
+  if (mr < 2) {
+    c1 = c0;
+  }
+  float* c2 = (float*) ((uintptr_t) c1 + c_stride);
+  if (mr <= 2) {
+    c2 = c1;
+  }
+  float* c3 = (float*) ((uintptr_t) c2 + c_stride);
+  if (mr != 4) {
+    c3 = c2;
+  }
+  if (nr == 4) {
+    _mm_storeu_ps(c0, vout0x0123);
+    _mm_storeu_ps(c1, vout1x0123);
+    _mm_storeu_ps(c2, vout2x0123);
+    _mm_storeu_ps(c3, vout3x0123);
+  } else {
+    if (nr >= 2) {
+      _mm_storel_pi((__m64*) c0, vout0x0123); c0 += 2;
+      _mm_storel_pi((__m64*) c1, vout1x0123); c1 += 2;
+      _mm_storel_pi((__m64*) c2, vout2x0123); c2 += 2;
+      _mm_storel_pi((__m64*) c3, vout3x0123); c3 += 2;
+      vout0x0123 = _mm_movehl_ps(vout0x0123, vout0x0123);
+      vout1x0123 = _mm_movehl_ps(vout1x0123, vout1x0123);
+      vout2x0123 = _mm_movehl_ps(vout2x0123, vout2x0123);
+      vout3x0123 = _mm_movehl_ps(vout3x0123, vout3x0123);
+      nr -= 2;
+    }
+    if (nr != 0) {
+      _mm_store_ss(c0, vout0x0123);
+      _mm_store_ss(c1, vout1x0123);
+      _mm_store_ss(c2, vout2x0123);
+      _mm_store_ss(c3, vout3x0123);
+    }
+  }
+}
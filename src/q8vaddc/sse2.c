@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <immintrin.h>
+
+#include <qnnpack/common.h>
+#include <qnnpack/scalar-utils.h>
+#include <qnnpack/q8vadd.h>
+
+
+void q8vaddc_ukernel__sse2(
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* y,
+    const union qnnp_add_quantization_params quantization_params[restrict static 1])
+{
+  /* B is the same for all elements: fold its product into the zero point product */
+  const int32_t vbias = quantization_params->sse2.zero_point_product[0] +
+    (int32_t) ((uint32_t) *b * quantization_params->sse2.b_multiplier);
+  if QNNP_LIKELY(n >= 8) {
+    const __m128i vbias_product = _mm_set1_epi32(vbias);
+    const __m128i va_multiplier_lo = _mm_load_si128((const __m128i*) &quantization_params->sse2.a_multiplier_lo);
+    const __m128i va_multiplier_hi = _mm_load_si128((const __m128i*) &quantization_params->sse2.a_multiplier_hi);
+    const __m128i vremainder_mask = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_mask);
+    const __m128i vremainder_threshold = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_threshold);
+    const __m128i vshift = _mm_cvtsi32_si128((int) quantization_params->sse2.shift);
+    const __m128i vy_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.y_zero_point);
+    const __m128i vy_min = _mm_load_si128((const __m128i*) quantization_params->sse2.y_min);
+    const __m128i vy_max = _mm_load_si128((const __m128i*) quantization_params->sse2.y_max);
+
+    const __m128i vzero = _mm_setzero_si128();
+    for (; n >= 16; n -= 16) {
+      const __m128i va = _mm_loadu_si128((const __m128i*) a);
+      a += 16;
+
+      const __m128i vxa0 = _mm_unpacklo_epi8(va, vzero);
+      const __m128i vxa1 = _mm_unpackhi_epi8(va, vzero);
+
+      /* Multiply by factor */
+      const __m128i va0_product_lo = _mm_mullo_epi16(vxa0, va_multiplier_lo);
+      const __m128i va0_product_hi =
+        _mm_add_epi16(_mm_mulhi_epu16(vxa0, va_multiplier_lo), _mm_mullo_epi16(vxa0, va_multiplier_hi));
+      const __m128i va1_product_lo = _mm_mullo_epi16(vxa1, va_multiplier_lo);
+      const __m128i va1_product_hi =
+        _mm_add_epi16(_mm_mulhi_epu16(vxa1, va_multiplier_lo), _mm_mullo_epi16(vxa1, va_multiplier_hi));
+
+      /* Accumulate products */
+      __m128i vacc0_lo = _mm_add_epi32(vbias_product, _mm_unpacklo_epi16(va0_product_lo, va0_product_hi));
+      __m128i vacc0_hi = _mm_add_epi32(vbias_product, _mm_unpackhi_epi16(va0_product_lo, va0_product_hi));
+      __m128i vacc1_lo = _mm_add_epi32(vbias_product, _mm_unpacklo_epi16(va1_product_lo, va1_product_hi));
+      __m128i vacc1_hi = _mm_add_epi32(vbias_product, _mm_unpackhi_epi16(va1_product_lo, va1_product_hi));
+
+      /* Shift right and round */
+      const __m128i vrem0_lo =
+        _mm_add_epi32(_mm_and_si128(vacc0_lo, vremainder_mask), _mm_cmpgt_epi32(vzero, vacc0_lo));
+      const __m128i vrem0_hi =
+        _mm_add_epi32(_mm_and_si128(vacc0_hi, vremainder_mask), _mm_cmpgt_epi32(vzero, vacc0_hi));
+      const __m128i vrem1_lo =
+        _mm_add_epi32(_mm_and_si128(vacc1_lo, vremainder_mask), _mm_cmpgt_epi32(vzero, vacc1_lo));
+      const __m128i vrem1_hi =
+        _mm_add_epi32(_mm_and_si128(vacc1_hi, vremainder_mask), _mm_cmpgt_epi32(vzero, vacc1_hi));
+
+      vacc0_lo = _mm_sub_epi32(_mm_sra_epi32(vacc0_lo, vshift), _mm_cmpgt_epi32(vrem0_lo, vremainder_threshold));
+      vacc0_hi = _mm_sub_epi32(_mm_sra_epi32(vacc0_hi, vshift), _mm_cmpgt_epi32(vrem0_hi, vremainder_threshold));
+      vacc1_lo = _mm_sub_epi32(_mm_sra_epi32(vacc1_lo, vshift), _mm_cmpgt_epi32(vrem1_lo, vremainder_threshold));
+      vacc1_hi = _mm_sub_epi32(_mm_sra_epi32(vacc1_hi, vshift), _mm_cmpgt_epi32(vrem1_hi, vremainder_threshold));
+
+      /* Pack, saturate, and add output zero point */
+      const __m128i vacc0 = _mm_adds_epi16(_mm_packs_epi32(vacc0_lo, vacc0_hi), vy_zero_point);
+      const __m128i vacc1 = _mm_adds_epi16(_mm_packs_epi32(vacc1_lo, vacc1_hi), vy_zero_point);
+      __m128i vy = _mm_packus_epi16(vacc0, vacc1);
+      vy = _mm_max_epu8(vy, vy_min);
+      vy = _mm_min_epu8(vy, vy_max);
+
+      _mm_storeu_si128((__m128i*) y, vy);
+      y += 16;
+    }
+    if (n >= 8) {
+      const __m128i va = _mm_loadl_epi64((const __m128i*) a);
+      a += 8;
+
+      const __m128i vxa = _mm_unpacklo_epi8(va, vzero);
+
+      /* Multiply by factor */
+      const __m128i va_product_lo = _mm_mullo_epi16(vxa, va_multiplier_lo);
+      const __m128i va_product_hi =
+        _mm_add_epi16(_mm_mulhi_epu16(vxa, va_multiplier_lo), _mm_mullo_epi16(vxa, va_multiplier_hi));
+
+      /* Accumulate products */
+      __m128i vacc_lo = _mm_add_epi32(vbias_product, _mm_unpacklo_epi16(va_product_lo, va_product_hi));
+      __m128i vacc_hi = _mm_add_epi32(vbias_product, _mm_unpackhi_epi16(va_product_lo, va_product_hi));
+
+      /* Shift right and round */
+      const __m128i vrem_lo =
+        _mm_add_epi32(_mm_and_si128(vacc_lo, vremainder_mask), _mm_cmpgt_epi32(vzero, vacc_lo));
+      const __m128i vrem_hi =
+        _mm_add_epi32(_mm_and_si128(vacc_hi, vremainder_mask), _mm_cmpgt_epi32(vzero, vacc_hi));
+
+      vacc_lo = _mm_sub_epi32(_mm_sra_epi32(vacc_lo, vshift), _mm_cmpgt_epi32(vrem_lo, vremainder_threshold));
+      vacc_hi = _mm_sub_epi32(_mm_sra_epi32(vacc_hi, vshift), _mm_cmpgt_epi32(vrem_hi, vremainder_threshold));
+
+      /* Pack, saturate, and add output zero point */
+      const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(vacc_lo, vacc_hi), vy_zero_point);
+      __m128i vy = _mm_packus_epi16(vacc, vacc);
+      vy = _mm_max_epu8(vy, vy_min);
+      vy = _mm_min_epu8(vy, vy_max);
+
+      _mm_storel_epi64((__m128i*) y, vy);
+      y += 8;
+
+      n -= 8;
+    }
+    if (n != 0) {
+      const size_t n_decrement = 8 - n;
+      const __m128i vload_shift = _mm_cvtsi32_si128(8 * (int32_t) n_decrement);
+
+      const __m128i va = _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a - n_decrement)), vload_shift);
+
+      const __m128i vxa = _mm_unpacklo_epi8(va, vzero);
+
+      /* Multiply by factor */
+      const __m128i va_product_lo = _mm_mullo_epi16(vxa, va_multiplier_lo);
+      const __m128i va_product_hi =
+        _mm_add_epi16(_mm_mulhi_epu16(vxa, va_multiplier_lo), _mm_mullo_epi16(vxa, va_multiplier_hi));
+
+      /* Accumulate products */
+      __m128i vacc_lo = _mm_add_epi32(vbias_product, _mm_unpacklo_epi16(va_product_lo, va_product_hi));
+      __m128i vacc_hi = _mm_add_epi32(vbias_product, _mm_unpackhi_epi16(va_product_lo, va_product_hi));
+
+      /* Shift right and round */
+      const __m128i vrem_lo =
+        _mm_add_epi32(_mm_and_si128(vacc_lo, vremainder_mask), _mm_cmpgt_epi32(vzero, vacc_lo));
+      const __m128i vrem_hi =
+        _mm_add_epi32(_mm_and_si128(vacc_hi, vremainder_mask), _mm_cmpgt_epi32(vzero, vacc_hi));
+
+      vacc_lo = _mm_sub_epi32(_mm_sra_epi32(vacc_lo, vshift), _mm_cmpgt_epi32(vrem_lo, vremainder_threshold));
+      vacc_hi = _mm_sub_epi32(_mm_sra_epi32(vacc_hi, vshift), _mm_cmpgt_epi32(vrem_hi, vremainder_threshold));
+
+      /* Pack, saturate, and add output zero point */
+      const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(vacc_lo, vacc_hi), vy_zero_point);
+      __m128i vy = _mm_packus_epi16(vacc, vacc);
+      vy = _mm_max_epu8(vy, vy_min);
+      vy = _mm_min_epu8(vy, vy_max);
+
+      if (n & 4) {
+        *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vy);
+        vy = _mm_shuffle_epi32(vy, _MM_SHUFFLE(3, 2, 1, 1));
+        y += 4;
+      }
+      if (n & 2) {
+        *((uint16_t*) y) = (uint16_t) _mm_extract_epi16(vy, 0);
+        vy = _mm_srli_epi32(vy, 16);
+        y += 2;
+      }
+      if (n & 1) {
+        *((uint8_t*) y) = (uint8_t) _mm_cvtsi128_si32(vy);
+      }
+    }
+  } else {
+    const uint32_t va_multiplier = quantization_params->sse2.a_multiplier;
+    const int32_t vremainder_mask = quantization_params->sse2.remainder_mask[0];
+    const int32_t vremainder_threshold = quantization_params->sse2.remainder_threshold[0];
+    const uint32_t vshift = quantization_params->sse2.shift;
+    const int32_t vy_zero_point = (int32_t) quantization_params->sse2.y_zero_point[0];
+    const int32_t vy_max = (int32_t) (uint32_t) quantization_params->sse2.y_max[0];
+    const int32_t vy_min = (int32_t) (uint32_t) quantization_params->sse2.y_min[0];
+
+    while (n-- != 0) {
+      const uint32_t vxa = (uint32_t) *a++;
+
+      /* Multiply by factor and accumulate products */
+      int32_t vacc = vbias + (int32_t) (vxa * va_multiplier);
+
+      /* Shift right and round */
+      const int32_t vrem = (vacc & vremainder_mask) - (int32_t) (vacc < 0);
+
+      vacc = asr_s32(vacc, vshift) + (int32_t) (vrem > vremainder_threshold);
+
+      /* Clamp and add output zero point */
+      int32_t vy = vacc + vy_zero_point;
+      vy = vy >= vy_min ? vy : vy_min;
+      vy = vy <= vy_max ? vy : vy_max;
+
+      *y++ = (uint8_t) vy;
+    }
+  }
+}
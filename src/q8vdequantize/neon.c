@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/q8vdequantize.h>
+
+
+void q8vdequantize_ukernel__neon(
+    size_t n,
+    const uint8_t* x,
+    float* y,
+    const union qnnp_f32_dequantization_params dequantization_params[restrict static 1])
+{
+  assert(n != 0);
+
+  const uint8x8_t vzero_point = vdup_n_u8(dequantization_params->neon.zero_point);
+  const float32x4_t vscale = vdupq_n_f32(dequantization_params->neon.scale);
+  for (;;) {
+    uint8_t xbuffer[8];
+    float ybuffer[8];
+    const uint8_t* xptr = x;
+    float* yptr = y;
+    if QNNP_UNLIKELY(n < 8) {
+      memcpy(xbuffer, x, n * sizeof(uint8_t));
+      xptr = xbuffer;
+      yptr = ybuffer;
+    }
+
+    const int16x8_t vx = vreinterpretq_s16_u16(vsubl_u8(vld1_u8(xptr), vzero_point));
+    const int32x4_t vx0123 = vmovl_s16(vget_low_s16(vx));
+    const int32x4_t vx4567 = vmovl_s16(vget_high_s16(vx));
+    vst1q_f32(yptr, vmulq_f32(vcvtq_f32_s32(vx0123), vscale));
+    vst1q_f32(yptr + 4, vmulq_f32(vcvtq_f32_s32(vx4567), vscale));
+
+    if QNNP_LIKELY(n >= 8) {
+      x += 8;
+      y += 8;
+      n -= 8;
+      if (n == 0) {
+        break;
+      }
+    } else {
+      memcpy(y, ybuffer, n * sizeof(float));
+      break;
+    }
+  }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/q8vdequantize.h>
+
+
+void q8vdequantize_ukernel__sse2(
+    size_t n,
+    const uint8_t* x,
+    float* y,
+    const union qnnp_f32_dequantization_params dequantization_params[restrict static 1])
+{
+  assert(n != 0);
+
+  const __m128i vzero_point = _mm_load_si128((const __m128i*) dequantization_params->sse2.zero_point);
+  const __m128 vscale = _mm_load_ps(dequantization_params->sse2.scale);
+  const __m128i vzero = _mm_setzero_si128();
+  for (;;) {
+    uint8_t xbuffer[8];
+    float ybuffer[8];
+    const uint8_t* xptr = x;
+    float* yptr = y;
+    if QNNP_UNLIKELY(n < 8) {
+      memcpy(xbuffer, x, n * sizeof(uint8_t));
+      xptr = xbuffer;
+      yptr = ybuffer;
+    }
+
+    const __m128i vx = _mm_sub_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) xptr), vzero), vzero_point);
+    const __m128i vx0123 = _mm_srai_epi32(_mm_unpacklo_epi16(vx, vx), 16);
+    const __m128i vx4567 = _mm_srai_epi32(_mm_unpackhi_epi16(vx, vx), 16);
+    _mm_storeu_ps(yptr, _mm_mul_ps(_mm_cvtepi32_ps(vx0123), vscale));
+    _mm_storeu_ps(yptr + 4, _mm_mul_ps(_mm_cvtepi32_ps(vx4567), vscale));
+
+    if QNNP_LIKELY(n >= 8) {
+      x += 8;
+      y += 8;
+      n -= 8;
+      if (n == 0) {
+        break;
+      }
+    } else {
+      memcpy(y, ybuffer, n * sizeof(float));
+      break;
+    }
+  }
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <string.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/common.h>
+#include <qnnpack/q8vmul.h>
+
+
+void q8vmul_ukernel__avx2(
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* y,
+    const union qnnp_mul_quantization_params quantization_params[restrict static 1])
+{
+  const __m256i va_zero_point = _mm256_broadcastsi128_si256(
+    _mm_load_si128((const __m128i*) quantization_params->sse2.a_zero_point));
+  const __m256i vb_zero_point = _mm256_broadcastsi128_si256(
+    _mm_load_si128((const __m128i*) quantization_params->sse2.b_zero_point));
+  const __m128i vleft_shift = _mm_load_si128((const __m128i*) quantization_params->sse2.left_shift);
+  const __m256i vmultiplier = _mm256_broadcastsi128_si256(
+    _mm_load_si128((const __m128i*) quantization_params->sse2.multiplier));
+  const __m256i vrounding = _mm256_broadcastsi128_si256(
+    _mm_load_si128((const __m128i*) quantization_params->sse2.rounding));
+  const __m256i vremainder_mask = _mm256_broadcastsi128_si256(
+    _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_mask));
+  const __m256i vremainder_threshold = _mm256_broadcastsi128_si256(
+    _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_threshold));
+  const __m128i vshift = _mm_load_si128((const __m128i*) quantization_params->sse2.shift);
+  const __m256i vy_zero_point = _mm256_broadcastsi128_si256(
+    _mm_load_si128((const __m128i*) quantization_params->sse2.y_zero_point));
+  const __m128i vy_min = _mm_load_si128((const __m128i*) quantization_params->sse2.y_min);
+  const __m128i vy_max = _mm_load_si128((const __m128i*) quantization_params->sse2.y_max);
+
+  while (n != 0) {
+    __m128i va, vb;
+    if QNNP_LIKELY(n >= 16) {
+      va = _mm_loadu_si128((const __m128i*) a);
+      a += 16;
+      vb = _mm_loadu_si128((const __m128i*) b);
+      b += 16;
+    } else {
+      /* Copy the remainder to a temporary buffer: re-loading processed elements is unsafe for in-place operation */
+      QNNP_ALIGN(16) uint8_t a_tail[16];
+      QNNP_ALIGN(16) uint8_t b_tail[16];
+      memcpy(a_tail, a, n);
+      memcpy(b_tail, b, n);
+      va = _mm_load_si128((const __m128i*) a_tail);
+      vb = _mm_load_si128((const __m128i*) b_tail);
+    }
+
+    /* Subtract zero points and multiply */
+    const __m256i vxa = _mm256_sub_epi16(_mm256_cvtepu8_epi16(va), va_zero_point);
+    const __m256i vxb = _mm256_sub_epi16(_mm256_cvtepu8_epi16(vb), vb_zero_point);
+    const __m256i vprod_lo = _mm256_mullo_epi16(vxa, vxb);
+    const __m256i vprod_hi = _mm256_mulhi_epi16(vxa, vxb);
+    /* Elements 0-3 and 8-11 */
+    const __m256i vacc_lo = _mm256_sll_epi32(_mm256_unpacklo_epi16(vprod_lo, vprod_hi), vleft_shift);
+    /* Elements 4-7 and 12-15 */
+    const __m256i vacc_hi = _mm256_sll_epi32(_mm256_unpackhi_epi16(vprod_lo, vprod_hi), vleft_shift);
+
+    /* Multiply by Q31 multiplier with rounding: even elements in low and odd elements in high 32 bits of 64-bit lanes */
+    const __m256i vprod_lo_even = _mm256_add_epi64(_mm256_mul_epi32(vacc_lo, vmultiplier), vrounding);
+    const __m256i vprod_lo_odd = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(vacc_lo, 32), vmultiplier), vrounding);
+    const __m256i vprod_hi_even = _mm256_add_epi64(_mm256_mul_epi32(vacc_hi, vmultiplier), vrounding);
+    const __m256i vprod_hi_odd = _mm256_add_epi64(_mm256_mul_epi32(_mm256_srli_epi64(vacc_hi, 32), vmultiplier), vrounding);
+    const __m256i vq31prod_lo = _mm256_blend_epi32(
+      _mm256_srli_epi64(vprod_lo_even, 31), _mm256_slli_epi64(vprod_lo_odd, 1), 0xAA);
+    const __m256i vq31prod_hi = _mm256_blend_epi32(
+      _mm256_srli_epi64(vprod_hi_even, 31), _mm256_slli_epi64(vprod_hi_odd, 1), 0xAA);
+
+    /* Shift right and round */
+    const __m256i vrem_lo = _mm256_add_epi32(
+      _mm256_and_si256(vq31prod_lo, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod_lo));
+    const __m256i vrem_hi = _mm256_add_epi32(
+      _mm256_and_si256(vq31prod_hi, vremainder_mask), _mm256_cmpgt_epi32(_mm256_setzero_si256(), vq31prod_hi));
+    const __m256i vout_lo =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod_lo, vshift), _mm256_cmpgt_epi32(vrem_lo, vremainder_threshold));
+    const __m256i vout_hi =
+      _mm256_sub_epi32(_mm256_sra_epi32(vq31prod_hi, vshift), _mm256_cmpgt_epi32(vrem_hi, vremainder_threshold));
+
+    /* Pack, saturate, and add output zero point: in-lane packing restores the order of elements */
+    const __m256i vout = _mm256_adds_epi16(_mm256_packs_epi32(vout_lo, vout_hi), vy_zero_point);
+    const __m128i vout16 = _mm256_castsi256_si128(
+      _mm256_permute4x64_epi64(_mm256_packus_epi16(vout, vout), _MM_SHUFFLE(3, 1, 2, 0)));
+    __m128i vy = _mm_max_epu8(vout16, vy_min);
+    vy = _mm_min_epu8(vy, vy_max);
+
+    if QNNP_LIKELY(n >= 16) {
+      _mm_storeu_si128((__m128i*) y, vy);
+      y += 16;
+      n -= 16;
+    } else {
+      if (n & 8) {
+        _mm_storel_epi64((__m128i*) y, vy);
+        y += 8;
+        vy = _mm_unpackhi_epi64(vy, vy);
+      }
+      if (n & 4) {
+        *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vy);
+        y += 4;
+        vy = _mm_srli_epi64(vy, 32);
+      }
+      if (n & 2) {
+        *((uint16_t*) y) = (uint16_t) _mm_extract_epi16(vy, 0);
+        y += 2;
+        vy = _mm_srli_epi32(vy, 16);
+      }
+      if (n & 1) {
+        *((uint8_t*) y) = (uint8_t) _mm_cvtsi128_si32(vy);
+      }
+      n = 0;
+    }
+  }
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <immintrin.h>
+
+#include <qnnpack/common.h>
+#include <qnnpack/q8vmul.h>
+#include <qnnpack/scalar-utils.h>
+
+
+/* Multiplies 4 signed 32-bit accumulators by a Q31 multiplier with rounding, using unsigned multiplication of the
+ * absolute values because SSE2 lacks signed 32x32->64-bit multiplication. */
+static inline __m128i q31_multiply(__m128i vacc, __m128i vmultiplier, __m128i vrounding)
+{
+  const __m128i vnmask = _mm_cmpgt_epi32(_mm_setzero_si128(), vacc);
+  const __m128i vabsacc = _mm_sub_epi32(_mm_xor_si128(vacc, vnmask), vnmask);
+  const __m128i vabsacc1032 = _mm_shuffle_epi32(vabsacc, _MM_SHUFFLE(2, 3, 0, 1));
+
+  const __m128i vabsprod02 = _mm_mul_epu32(vabsacc, vmultiplier);
+  const __m128i vnmask02 = _mm_shuffle_epi32(vnmask, _MM_SHUFFLE(2, 2, 0, 0));
+  const __m128i vprod02 = _mm_sub_epi64(_mm_xor_si128(vabsprod02, vnmask02), vnmask02);
+  const __m128i vq31prod02 = _mm_srli_epi64(_mm_add_epi64(vprod02, vrounding), 31);
+
+  const __m128i vabsprod13 = _mm_mul_epu32(vabsacc1032, vmultiplier);
+  const __m128i vnmask13 = _mm_shuffle_epi32(vnmask, _MM_SHUFFLE(3, 3, 1, 1));
+  const __m128i vprod13 = _mm_sub_epi64(_mm_xor_si128(vabsprod13, vnmask13), vnmask13);
+  const __m128i vq31prod13 = _mm_srli_epi64(_mm_add_epi64(vprod13, vrounding), 31);
+
+  const __m128i vq31prod0213 = _mm_castps_si128(_mm_shuffle_ps(
+      _mm_castsi128_ps(vq31prod02), _mm_castsi128_ps(vq31prod13), _MM_SHUFFLE(2, 0, 2, 0)));
+  return _mm_shuffle_epi32(vq31prod0213, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+void q8vmul_ukernel__sse2(
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* y,
+    const union qnnp_mul_quantization_params quantization_params[restrict static 1])
+{
+  if QNNP_LIKELY(n >= 8) {
+    const __m128i va_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.a_zero_point);
+    const __m128i vb_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.b_zero_point);
+    const __m128i vleft_shift = _mm_load_si128((const __m128i*) quantization_params->sse2.left_shift);
+    const __m128i vmultiplier = _mm_load_si128((const __m128i*) quantization_params->sse2.multiplier);
+    const __m128i vrounding = _mm_load_si128((const __m128i*) quantization_params->sse2.rounding);
+    const __m128i vremainder_mask = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_mask);
+    const __m128i vremainder_threshold = _mm_load_si128((const __m128i*) quantization_params->sse2.remainder_threshold);
+    const __m128i vshift = _mm_load_si128((const __m128i*) quantization_params->sse2.shift);
+    const __m128i vy_zero_point = _mm_load_si128((const __m128i*) quantization_params->sse2.y_zero_point);
+    const __m128i vy_min = _mm_load_si128((const __m128i*) quantization_params->sse2.y_min);
+    const __m128i vy_max = _mm_load_si128((const __m128i*) quantization_params->sse2.y_max);
+
+    const __m128i vzero = _mm_setzero_si128();
+    for (;;) {
+      __m128i va, vb;
+      if QNNP_LIKELY(n >= 8) {
+        va = _mm_loadl_epi64((const __m128i*) a);
+        a += 8;
+        vb = _mm_loadl_epi64((const __m128i*) b);
+        b += 8;
+      } else {
+        /* Re-load the last 8 elements and shift out the ones which were already processed */
+        const size_t n_decrement = 8 - n;
+        const __m128i vload_shift = _mm_cvtsi32_si128(8 * (int32_t) n_decrement);
+        va = _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (a - n_decrement)), vload_shift);
+        vb = _mm_srl_epi64(_mm_loadl_epi64((const __m128i*) (b - n_decrement)), vload_shift);
+      }
+
+      /* Subtract zero points and multiply */
+      const __m128i vxa = _mm_sub_epi16(_mm_unpacklo_epi8(va, vzero), va_zero_point);
+      const __m128i vxb = _mm_sub_epi16(_mm_unpacklo_epi8(vb, vzero), vb_zero_point);
+      const __m128i vprod_lo = _mm_mullo_epi16(vxa, vxb);
+      const __m128i vprod_hi = _mm_mulhi_epi16(vxa, vxb);
+      __m128i vacc_lo = _mm_sll_epi32(_mm_unpacklo_epi16(vprod_lo, vprod_hi), vleft_shift);
+      __m128i vacc_hi = _mm_sll_epi32(_mm_unpackhi_epi16(vprod_lo, vprod_hi), vleft_shift);
+
+      /* Multiply by Q31 multiplier, shift right and round */
+      const __m128i vq31prod_lo = q31_multiply(vacc_lo, vmultiplier, vrounding);
+      const __m128i vq31prod_hi = q31_multiply(vacc_hi, vmultiplier, vrounding);
+
+      const __m128i vrem_lo =
+        _mm_add_epi32(_mm_and_si128(vq31prod_lo, vremainder_mask), _mm_cmpgt_epi32(vzero, vq31prod_lo));
+      const __m128i vrem_hi =
+        _mm_add_epi32(_mm_and_si128(vq31prod_hi, vremainder_mask), _mm_cmpgt_epi32(vzero, vq31prod_hi));
+
+      vacc_lo = _mm_sub_epi32(_mm_sra_epi32(vq31prod_lo, vshift), _mm_cmpgt_epi32(vrem_lo, vremainder_threshold));
+      vacc_hi = _mm_sub_epi32(_mm_sra_epi32(vq31prod_hi, vshift), _mm_cmpgt_epi32(vrem_hi, vremainder_threshold));
+
+      /* Pack, saturate, and add output zero point */
+      const __m128i vacc = _mm_adds_epi16(_mm_packs_epi32(vacc_lo, vacc_hi), vy_zero_point);
+      __m128i vy = _mm_packus_epi16(vacc, vacc);
+      vy = _mm_max_epu8(vy, vy_min);
+      vy = _mm_min_epu8(vy, vy_max);
+
+      if QNNP_LIKELY(n >= 8) {
+        _mm_storel_epi64((__m128i*) y, vy);
+        y += 8;
+        n -= 8;
+        if (n == 0) {
+          break;
+        }
+      } else {
+        if (n & 4) {
+          *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vy);
+          vy = _mm_shuffle_epi32(vy, _MM_SHUFFLE(3, 2, 1, 1));
+          y += 4;
+        }
+        if (n & 2) {
+          *((uint16_t*) y) = (uint16_t) _mm_extract_epi16(vy, 0);
+          vy = _mm_srli_epi32(vy, 16);
+          y += 2;
+        }
+        if (n & 1) {
+          *((uint8_t*) y) = (uint8_t) _mm_cvtsi128_si32(vy);
+        }
+        break;
+      }
+    }
+  } else {
+    const int32_t va_zero_point = (int32_t) quantization_params->sse2.a_zero_point[0];
+    const int32_t vb_zero_point = (int32_t) quantization_params->sse2.b_zero_point[0];
+    const uint32_t vleft_shift = (uint32_t) quantization_params->sse2.left_shift[0];
+    const int64_t vmultiplier = (int64_t) (int32_t) quantization_params->sse2.multiplier[0];
+    const int32_t vremainder_mask = quantization_params->sse2.remainder_mask[0];
+    const int32_t vremainder_threshold = quantization_params->sse2.remainder_threshold[0];
+    const uint32_t vshift = (uint32_t) quantization_params->sse2.shift[0];
+    const int32_t vy_zero_point = (int32_t) quantization_params->sse2.y_zero_point[0];
+    const int32_t vy_max = (int32_t) (uint32_t) quantization_params->sse2.y_max[0];
+    const int32_t vy_min = (int32_t) (uint32_t) quantization_params->sse2.y_min[0];
+
+    while (n-- != 0) {
+      /* Subtract zero points and multiply */
+      const int32_t vprod = ((int32_t) (uint32_t) *a++ - va_zero_point) * ((int32_t) (uint32_t) *b++ - vb_zero_point);
+      const int32_t vacc = (int32_t) ((uint32_t) vprod << vleft_shift);
+
+      /* Multiply by Q31 multiplier, shift right and round */
+      const int64_t vproduct = (int64_t) vacc * vmultiplier;
+      const int32_t vq31product = (int32_t) (uint32_t) ((uint64_t) (vproduct + INT64_C(0x40000000)) >> 31);
+      const int32_t vrem = (vq31product & vremainder_mask) - (int32_t) (vq31product < 0);
+
+      /* Clamp and add output zero point */
+      int32_t vy = asr_s32(vq31product, vshift) + (int32_t) (vrem > vremainder_threshold) + vy_zero_point;
+      vy = vy >= vy_min ? vy : vy_min;
+      vy = vy <= vy_max ? vy : vy_max;
+
+      *y++ = (uint8_t) vy;
+    }
+  }
+}
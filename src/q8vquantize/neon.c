@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/q8vquantize.h>
+
+
+void q8vquantize_ukernel__neon(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union qnnp_f32_quantization_params quantization_params[restrict static 1])
+{
+  assert(n != 0);
+
+  const float32x4_t vscale = vdupq_n_f32(quantization_params->neon.scale);
+  const float32x4_t vmin = vdupq_n_f32(quantization_params->neon.min_less_zero_point);
+  const float32x4_t vmax = vdupq_n_f32(quantization_params->neon.max_less_zero_point);
+  const float32x4_t vfmagic = vdupq_n_f32(quantization_params->neon.magic);
+  const int32x4_t vimagic = vdupq_n_s32(quantization_params->neon.magic_less_zero_point);
+  for (;;) {
+    float xbuffer[8];
+    uint8_t ybuffer[8];
+    const float* xptr = x;
+    uint8_t* yptr = y;
+    if QNNP_UNLIKELY(n < 8) {
+      memcpy(xbuffer, x, n * sizeof(float));
+      xptr = xbuffer;
+      yptr = ybuffer;
+    }
+
+    const float32x4_t vx0123 = vld1q_f32(xptr);
+    const float32x4_t vx4567 = vld1q_f32(xptr + 4);
+
+    /*
+     * Clamp scaled values to [output_min - zero point, output_max - zero point] range, which also keeps them in the
+     * range where adding 1.5 * 2**23 rounds them to nearest integer with ties to even.
+     */
+    const float32x4_t vclamped0123 = vminq_f32(vmaxq_f32(vmulq_f32(vx0123, vscale), vmin), vmax);
+    const float32x4_t vclamped4567 = vminq_f32(vmaxq_f32(vmulq_f32(vx4567, vscale), vmin), vmax);
+    const int32x4_t vy0123 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vclamped0123, vfmagic)), vimagic);
+    const int32x4_t vy4567 = vsubq_s32(vreinterpretq_s32_f32(vaddq_f32(vclamped4567, vfmagic)), vimagic);
+
+    /* Results are already in [output_min, output_max] range, so the low 8 bits are the output */
+    const int16x8_t vy01234567 = vcombine_s16(vmovn_s32(vy0123), vmovn_s32(vy4567));
+    vst1_u8(yptr, vreinterpret_u8_s8(vmovn_s16(vy01234567)));
+
+    if QNNP_LIKELY(n >= 8) {
+      x += 8;
+      y += 8;
+      n -= 8;
+      if (n == 0) {
+        break;
+      }
+    } else {
+      memcpy(y, ybuffer, n * sizeof(uint8_t));
+      break;
+    }
+  }
+}
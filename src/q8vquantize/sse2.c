@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/q8vquantize.h>
+
+
+void q8vquantize_ukernel__sse2(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union qnnp_f32_quantization_params quantization_params[restrict static 1])
+{
+  assert(n != 0);
+
+  const __m128 vscale = _mm_load_ps(quantization_params->sse2.scale);
+  const __m128 vmin = _mm_load_ps(quantization_params->sse2.min_less_zero_point);
+  const __m128 vmax = _mm_load_ps(quantization_params->sse2.max_less_zero_point);
+  const __m128 vfmagic = _mm_load_ps(quantization_params->sse2.magic);
+  const __m128i vimagic = _mm_load_si128((const __m128i*) quantization_params->sse2.magic_less_zero_point);
+  for (;;) {
+    float xbuffer[8];
+    uint8_t ybuffer[8];
+    const float* xptr = x;
+    uint8_t* yptr = y;
+    if QNNP_UNLIKELY(n < 8) {
+      memcpy(xbuffer, x, n * sizeof(float));
+      xptr = xbuffer;
+      yptr = ybuffer;
+    }
+
+    const __m128 vx0123 = _mm_loadu_ps(xptr);
+    const __m128 vx4567 = _mm_loadu_ps(xptr + 4);
+
+    /*
+     * Clamp scaled values to [output_min - zero point, output_max - zero point] range, which also keeps them in the
+     * range where adding 1.5 * 2**23 rounds them to nearest integer with ties to even. MAXPS returns the second
+     * operand if either operand is NaN, so NaN inputs produce output_min.
+     */
+    const __m128 vclamped0123 = _mm_min_ps(_mm_max_ps(_mm_mul_ps(vx0123, vscale), vmin), vmax);
+    const __m128 vclamped4567 = _mm_min_ps(_mm_max_ps(_mm_mul_ps(vx4567, vscale), vmin), vmax);
+    const __m128i vy0123 = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(vclamped0123, vfmagic)), vimagic);
+    const __m128i vy4567 = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(vclamped4567, vfmagic)), vimagic);
+
+    /* Results are already in [output_min, output_max] range, so packing never saturates */
+    const __m128i vy01234567 = _mm_packs_epi32(vy0123, vy4567);
+    _mm_storel_epi64((__m128i*) yptr, _mm_packus_epi16(vy01234567, vy01234567));
+
+    if QNNP_LIKELY(n >= 8) {
+      x += 8;
+      y += 8;
+      n -= 8;
+      if (n == 0) {
+        break;
+      }
+    } else {
+      memcpy(y, ybuffer, n * sizeof(uint8_t));
+      break;
+    }
+  }
+}
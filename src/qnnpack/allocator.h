@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <string.h>
+
+#include <qnnpack.h>
+#include <qnnpack/common.h>
+#include <qnnpack/operator.h>
+
+/* Alignment of the operator structure and of buffers allocated when operators are created */
+#define QNNP_CACHE_LINE_SIZE 64
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Allocates a zero-initialized operator structure with the current allocator and weights policy, which it keeps */
+QNNP_INTERNAL qnnp_operator_t qnnp_allocate_operator(void);
+
+/* Allocates packed weights, placed according to the weights memory policy of the operator; contents are undefined */
+QNNP_INTERNAL void* qnnp_operator_allocate_weights(qnnp_operator_t op, size_t size);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+static inline void* qnnp_operator_allocate(qnnp_operator_t op, size_t size) {
+  return op->allocator.allocate(op->allocator.context, QNNP_CACHE_LINE_SIZE, size);
+}
+
+static inline void* qnnp_operator_allocate_zero(qnnp_operator_t op, size_t size) {
+  void* memory = qnnp_operator_allocate(op, size);
+  if (memory != NULL) {
+    memset(memory, 0, size);
+  }
+  return memory;
+}
+
+static inline void* qnnp_operator_reallocate(qnnp_operator_t op, void* memory, size_t size) {
+  return op->allocator.reallocate(op->allocator.context, memory, size);
+}
+
+static inline void qnnp_operator_deallocate(qnnp_operator_t op, void* memory) {
+  if (memory != NULL) {
+    op->allocator.deallocate(op->allocator.context, memory);
+  }
+}
@@ -0,0 +1,624 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <pthreadpool.h>
+
+#include <qnnpack.h>
+#include <qnnpack/common.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+
+
+struct q8gemm_context {
+  size_t k;
+  size_t k_stride;
+  size_t n;
+  size_t n_stride;
+  const uint8_t* a;
+  size_t a_stride;
+  const uint8_t* packed_w;
+  uint8_t* c;
+  size_t c_stride;
+  union qnnp_conv_quantization_params quantization_params;
+  q8gemm_ukernel_function ukernel;
+  const uint8_t* output_lut;
+  x8lut_ukernel_function lut_ukernel;
+};
+
+struct q8gemm_s32_context {
+  size_t k;
+  size_t k_stride;
+  size_t n;
+  size_t n_stride;
+  const uint8_t* a;
+  size_t a_stride;
+  const uint8_t* packed_w;
+  int32_t* c;
+  size_t c_stride;
+  union qnnp_kernel_zero_point_params quantization_params;
+  q8gemm_i32_ukernel_function ukernel;
+};
+
+struct q8gemm_f32_context {
+  size_t k;
+  size_t k_stride;
+  size_t n;
+  size_t n_stride;
+  const uint8_t* a;
+  size_t a_stride;
+  const uint8_t* packed_w;
+  float* c;
+  size_t c_stride;
+  union qnnp_conv_dequantization_params dequantization_params;
+  q8gemm_f32_ukernel_function ukernel;
+};
+
+/* Largest micro-kernel tile of the dynamic fully connected operator, which bounds its stack scratch */
+#define QNNP_Q8GEMM_DQ_MAX_MR 8
+#define QNNP_Q8GEMM_DQ_MAX_NR 8
+
+/*
+ * Fully connected layer with fp32 input and output: the first stage quantizes every row of A with per-row parameters
+ * into a buffer allocated at setup, and the second multiplies them by the quantized kernel with 32-bit output and
+ * dequantizes the result.
+ */
+struct q8gemm_dq_context {
+  size_t k;
+  size_t k_stride;
+  const float* a;
+  size_t a_stride;
+  uint8_t* a_quantized;
+  float* row_scale;
+  int32_t* row_zero_point;
+  const void* packed_w;
+  const int32_t* kernel_sums;
+  const float* bias;
+  float kernel_scale;
+  float* c;
+  size_t c_stride;
+  uint32_t mr;
+  uint32_t nr;
+  union qnnp_kernel_zero_point_params quantization_params;
+  q8gemm_i32_ukernel_function gemm_ukernel;
+  srminmax_ukernel_function rminmax_ukernel;
+  q8vquantize_ukernel_function quantize_ukernel;
+};
+
+/* Offsets into the per-row buffer of the dynamic fully connected operator, which it holds in a_sum */
+struct qnnp_dynamic_gemm_scratch_layout {
+  size_t a_offset;
+  size_t row_scale_offset;
+  size_t row_zero_point_offset;
+  size_t size;
+};
+
+static inline void qnnp_compute_dynamic_gemm_scratch_layout(
+    size_t batch_size,
+    size_t k_stride,
+    struct qnnp_dynamic_gemm_scratch_layout* layout)
+{
+  /* Micro-kernels may read up to 8 bytes before the current position of a row when k is not a multiple of 8 */
+  layout->a_offset = 8;
+  layout->row_scale_offset = round_up(layout->a_offset + batch_size * k_stride, 16);
+  layout->row_zero_point_offset = layout->row_scale_offset + batch_size * sizeof(float);
+  layout->size = layout->row_zero_point_offset + batch_size * sizeof(int32_t);
+}
+
+struct q8sum_rows_context {
+  const uint8_t* a;
+  size_t groups;
+  size_t m;
+  size_t k;
+  size_t a_stride;
+  int32_t multiplier;
+  int32_t* a_sum;
+  size_t a_sum_stride;
+  q8sum_rows_ukernel_function ukernel;
+};
+
+struct q8gemm_xzp_context {
+  size_t k;
+  size_t k_stride;
+  size_t n;
+  size_t n_stride;
+  const uint8_t* a;
+  size_t a_stride;
+  const void* packed_w;
+  uint8_t* c;
+  size_t c_stride;
+  const int32_t* a_sum;
+  size_t groups;
+  size_t batch_size;
+  size_t a_sum_stride;
+  union qnnp_q31_requantization_params requantization_params;
+  q8gemm_xzp_ukernel_function ukernel;
+  const uint8_t* output_lut;
+  x8lut_ukernel_function lut_ukernel;
+};
+
+struct q8conv_context {
+  size_t bs;
+  size_t ks;
+  size_t kc;
+  size_t kc_stride;
+  size_t m;
+  size_t m_stride;
+  size_t n;
+  size_t n_stride;
+  const uint8_t** indirect_a;
+  const void* packed_w;
+  uint8_t* c;
+  size_t c_stride;
+  union qnnp_conv_quantization_params quantization_params;
+  q8conv_ukernel_function ukernel;
+  const uint8_t* output_lut;
+  x8lut_ukernel_function lut_ukernel;
+};
+
+struct q8conv_s32_context {
+  size_t bs;
+  size_t ks;
+  size_t kc;
+  size_t kc_stride;
+  size_t m;
+  size_t m_stride;
+  size_t n;
+  size_t n_stride;
+  const uint8_t** indirect_a;
+  const void* packed_w;
+  int32_t* c;
+  size_t c_stride;
+  union qnnp_kernel_zero_point_params quantization_params;
+  q8conv_i32_ukernel_function ukernel;
+};
+
+struct q8conv_f32_context {
+  size_t bs;
+  size_t ks;
+  size_t kc;
+  size_t kc_stride;
+  size_t m;
+  size_t m_stride;
+  size_t n;
+  size_t n_stride;
+  const uint8_t** indirect_a;
+  const void* packed_w;
+  float* c;
+  size_t c_stride;
+  union qnnp_conv_dequantization_params dequantization_params;
+  q8conv_f32_ukernel_function ukernel;
+};
+
+struct q8dwconv_context {
+  size_t groups;
+  size_t group_stride;
+  const uint8_t** indirection_buffer;
+  size_t indirection_buffer_row_stride;
+  size_t indirection_buffer_col_stride;
+  const void* packed_weights;
+  uint8_t* output;
+  size_t output_height;
+  size_t output_width;
+  size_t output_row_stride;
+  size_t output_col_increment;
+  union qnnp_conv_quantization_params quantization_params;
+  union {
+    q8dwconv_up_ukernel_function unipass_ukernel;
+    q8dwconv_mp_ukernel_function multipass_ukernel;
+  };
+  const uint8_t* output_lut;
+  x8lut_ukernel_function lut_ukernel;
+};
+
+struct max_pooling_context {
+  const void** indirect_input;
+  size_t indirect_input_batch_stride;
+  size_t indirect_input_height_stride;
+  void* output;
+  size_t output_batch_stride;
+  size_t output_height_stride;
+  size_t output_width;
+  size_t pooling_size;
+  size_t channels;
+  size_t input_increment;
+  size_t output_increment;
+  union qnnp_u8_clamping_params params;
+  u8maxpool_ukernel_function ukernel;
+};
+
+struct resize_bilinear_context {
+  const void** indirect_input;
+  size_t indirect_input_batch_stride;
+  size_t indirect_input_height_stride;
+  const int16_t* weights;
+  size_t weights_height_stride;
+  void* output;
+  size_t output_batch_stride;
+  size_t output_height_stride;
+  size_t output_width;
+  size_t channels;
+  size_t output_increment;
+  u8ibilinear_ukernel_function ukernel;
+};
+
+struct resize_nearest_context {
+  const void** indirect_input;
+  size_t indirect_input_batch_stride;
+  size_t indirect_input_height_stride;
+  void* output;
+  size_t output_batch_stride;
+  size_t output_height_stride;
+  size_t output_width;
+  size_t output_pixel_stride;
+  size_t channels;
+};
+
+struct average_pooling_context {
+  const void** indirect_input;
+  size_t indirect_input_batch_stride;
+  size_t indirect_input_height_stride;
+  void* output;
+  size_t output_batch_stride;
+  size_t output_height_stride;
+  size_t output_width;
+  size_t pooling_size;
+  size_t channels;
+  size_t packed_channels;
+  const void* zero;
+  size_t input_increment;
+  size_t output_increment;
+  union qnnp_avgpool_quantization_params quantization_params;
+  union {
+    q8avgpool_up_ukernel_function unipass_ukernel;
+    q8avgpool_mp_ukernel_function multipass_ukernel;
+  };
+};
+
+struct global_average_pooling_context {
+  const void* input;
+  const void* zero;
+  size_t input_pixel_stride;
+  size_t input_batch_stride;
+  size_t input_elements;
+  size_t channels;
+  size_t packed_channels;
+  void* output;
+  size_t output_batch_stride;
+  union qnnp_avgpool_quantization_params quantization_params;
+  union {
+    q8gavgpool_up_ukernel_function unipass_ukernel;
+    q8gavgpool_mp_ukernel_function multipass_ukernel;
+  };
+};
+
+/* Channels per task of a reduction followed by kept axes; a multiple of every q8gavgpool NR */
+#define QNNP_REDUCE_CHANNEL_TILE 128
+
+struct reduce_context {
+  const void* input;
+  size_t input_batch_stride;
+  size_t input_stride;
+  size_t reduction_size;
+  size_t channels;
+  size_t channel_tile;
+  const void* zero;
+  void* output;
+  size_t output_batch_stride;
+  union qnnp_avgpool_quantization_params quantization_params;
+  q8gavgpool_up_ukernel_function ltnr_ukernel;
+  q8gavgpool_up_ukernel_function genr_lemr_ukernel;
+  q8gavgpool_mp_ukernel_function genr_gtmr_ukernel;
+  u8rsum_ukernel_function rsum_ukernel;
+  uint32_t mr;
+  uint32_t nr;
+};
+
+struct q8add_strided_context {
+  size_t n;
+  const uint8_t* a;
+  size_t a_stride;
+  const uint8_t* b;
+  size_t b_stride;
+  const uint8_t* y;
+  size_t y_stride;
+  union qnnp_add_quantization_params quantization_params;
+  q8vadd_ukernel_function ukernel;
+};
+
+struct q8add_contiguous_context {
+  const uint8_t* a;
+  const uint8_t* b;
+  uint8_t* y;
+  union qnnp_add_quantization_params quantization_params;
+  q8vadd_ukernel_function ukernel;
+};
+
+struct q8mul_strided_context {
+  size_t n;
+  const uint8_t* a;
+  size_t a_stride;
+  const uint8_t* b;
+  size_t b_stride;
+  /* Number of consecutive rows of A which are multiplied by the same row of B */
+  size_t b_group;
+  const uint8_t* y;
+  size_t y_stride;
+  union qnnp_mul_quantization_params quantization_params;
+  q8vmul_ukernel_function ukernel;
+};
+
+struct q8mul_contiguous_context {
+  const uint8_t* a;
+  const uint8_t* b;
+  uint8_t* y;
+  union qnnp_mul_quantization_params quantization_params;
+  q8vmul_ukernel_function ukernel;
+};
+
+struct channel_shuffle_context {
+  const void* x;
+  size_t x_stride;
+  void* y;
+  size_t y_stride;
+  size_t n;
+  size_t m;
+  union {
+    xzipc_ukernel_function fixed_ukernel;
+    xzipv_ukernel_function variable_ukernel;
+  };
+};
+
+struct lut_strided_context {
+  size_t n;
+  const void* x;
+  size_t x_stride;
+  const void* t;
+  void* y;
+  size_t y_stride;
+  x8lut_ukernel_function ukernel;
+};
+
+struct lut_contiguous_context {
+  const void* x;
+  size_t x_stride;
+  const void* t;
+  void* y;
+  size_t y_stride;
+  x8lut_ukernel_function ukernel;
+};
+
+struct clamp_strided_context {
+  size_t n;
+  const void* x;
+  size_t x_stride;
+  void* y;
+  size_t y_stride;
+  u8clamp_ukernel_function ukernel;
+  union qnnp_u8_clamping_params params;
+};
+
+struct clamp_contiguous_context {
+  const void* x;
+  size_t x_stride;
+  void* y;
+  size_t y_stride;
+  u8clamp_ukernel_function ukernel;
+  union qnnp_u8_clamping_params params;
+};
+
+struct quantize_strided_context {
+  size_t n;
+  const float* x;
+  size_t x_stride;
+  uint8_t* y;
+  size_t y_stride;
+  q8vquantize_ukernel_function ukernel;
+  union qnnp_f32_quantization_params params;
+};
+
+struct quantize_contiguous_context {
+  const float* x;
+  uint8_t* y;
+  q8vquantize_ukernel_function ukernel;
+  union qnnp_f32_quantization_params params;
+};
+
+struct dequantize_strided_context {
+  size_t n;
+  const uint8_t* x;
+  size_t x_stride;
+  float* y;
+  size_t y_stride;
+  q8vdequantize_ukernel_function ukernel;
+  union qnnp_f32_dequantization_params params;
+};
+
+struct dequantize_contiguous_context {
+  const uint8_t* x;
+  float* y;
+  q8vdequantize_ukernel_function ukernel;
+  union qnnp_f32_dequantization_params params;
+};
+
+struct u8softargmax_context {
+  size_t n;
+  const uint8_t* x;
+  size_t x_stride;
+  const uint32_t* t;
+  uint8_t* y;
+  size_t y_stride;
+  u8softargmax_ukernel_function ukernel;
+  union qnnp_softargmax_params params;
+};
+
+struct top_k_context {
+  size_t n;
+  size_t k;
+  const uint8_t* x;
+  size_t x_stride;
+  uint8_t* y_values;
+  size_t y_values_stride;
+  uint32_t* y_indices;
+  size_t y_indices_stride;
+  u8rmax_ukernel_function rmax_ukernel;
+};
+
+struct constant_pad_context {
+  const void* input;
+  size_t input_stride[QNNP_MAX_TENSOR_DIMS - 1];
+  void* output;
+  size_t output_stride[QNNP_MAX_TENSOR_DIMS - 1];
+  size_t input_size[QNNP_MAX_TENSOR_DIMS];
+  size_t output_size[QNNP_MAX_TENSOR_DIMS];
+  size_t pre_paddings[QNNP_MAX_TENSOR_DIMS];
+  size_t post_paddings[QNNP_MAX_TENSOR_DIMS];
+  uint8_t padding_value;
+  x8pad_ukernel_function ukernel;
+};
+
+struct transpose_context {
+  const void* x;
+  size_t x_stride;
+  size_t x_batch_stride;
+  void* y;
+  size_t y_stride;
+  size_t y_batch_stride;
+  uint32_t log2_element_size;
+  xtranspose_ukernel_function ukernel;
+};
+
+enum qnnp_parallelization_type {
+  qnnp_parallelization_type_1d,
+  qnnp_parallelization_type_1d_tiled,
+  qnnp_parallelization_type_2d,
+  qnnp_parallelization_type_3d_tiled,
+  qnnp_parallelization_type_4d_tiled,
+};
+
+/*
+ * One parallel loop of an operator: the arguments of a single pthreadpool_compute_* call.
+ */
+struct qnnp_compute {
+  enum qnnp_parallelization_type type;
+  union {
+    pthreadpool_function_1d_t function_1d;
+    pthreadpool_function_1d_tiled_t function_1d_tiled;
+    pthreadpool_function_2d_t function_2d;
+    pthreadpool_function_3d_tiled_t function_3d_tiled;
+    pthreadpool_function_4d_tiled_t function_4d_tiled;
+  };
+  void* context;
+  size_t range[4];
+  size_t tile[4];
+};
+
+#define QNNP_MAX_COMPUTE_STAGES 2
+
+/*
+ * Parallel loops of an operator, which must run one after another, with the contexts they refer to.
+ * Stages point into the plan, so a prepared plan must not be copied or moved.
+ */
+struct qnnp_compute_plan {
+  size_t stages_count;
+  struct qnnp_compute stages[QNNP_MAX_COMPUTE_STAGES];
+  union {
+    struct q8gemm_context q8gemm;
+    struct q8gemm_s32_context q8gemm_s32;
+    struct q8gemm_f32_context q8gemm_f32;
+    struct {
+      struct q8sum_rows_context q8sum_rows;
+      struct q8gemm_xzp_context q8gemm_xzp;
+    } xzp;
+    struct q8gemm_dq_context q8gemm_dq;
+    struct q8conv_context q8conv;
+    struct q8conv_s32_context q8conv_s32;
+    struct q8conv_f32_context q8conv_f32;
+    struct q8dwconv_context q8dwconv;
+    struct max_pooling_context max_pooling;
+    struct resize_bilinear_context resize_bilinear;
+    struct resize_nearest_context resize_nearest;
+    struct average_pooling_context average_pooling;
+    struct global_average_pooling_context global_average_pooling;
+    struct reduce_context reduce;
+    struct q8add_strided_context q8add_strided;
+    struct q8add_contiguous_context q8add_contiguous;
+    struct q8mul_strided_context q8mul_strided;
+    struct q8mul_contiguous_context q8mul_contiguous;
+    struct channel_shuffle_context channel_shuffle;
+    struct lut_strided_context lut_strided;
+    struct lut_contiguous_context lut_contiguous;
+    struct clamp_strided_context clamp_strided;
+    struct clamp_contiguous_context clamp_contiguous;
+    struct quantize_strided_context quantize_strided;
+    struct quantize_contiguous_context quantize_contiguous;
+    struct dequantize_strided_context dequantize_strided;
+    struct dequantize_contiguous_context dequantize_contiguous;
+    struct u8softargmax_context u8softargmax;
+    struct top_k_context top_k;
+    struct transpose_context transpose;
+    struct constant_pad_context constant_pad;
+  } context;
+};
+
+/*
+ * A contiguous range of tiles of a parallel loop, executed on a single thread.
+ */
+struct qnnp_compute_slot {
+  const struct qnnp_compute* compute;
+  size_t tile_start;
+  size_t tile_end;
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+QNNP_INTERNAL enum qnnp_status qnnp_prepare_compute_plan(
+  qnnp_operator_t op,
+  struct qnnp_compute_plan* plan);
+
+QNNP_INTERNAL void qnnp_compute_parallel(
+  const struct qnnp_compute* compute,
+  pthreadpool_t threadpool);
+
+QNNP_INTERNAL size_t qnnp_compute_get_tiles_count(
+  const struct qnnp_compute* compute);
+
+QNNP_INTERNAL void qnnp_compute_tiles(
+  const struct qnnp_compute* compute,
+  size_t tile_start,
+  size_t tile_end);
+
+QNNP_INTERNAL size_t qnnp_compute_partition(
+  const struct qnnp_compute* compute,
+  size_t slots_count,
+  struct qnnp_compute_slot* slots);
+
+QNNP_INTERNAL void qnnp_compute_slots(
+  size_t slots_count,
+  const struct qnnp_compute_slot* slots,
+  pthreadpool_t threadpool);
+
+QNNP_INTERNAL uint64_t qnnp_operator_estimate_macs(
+  const struct qnnp_operator* op);
+
+QNNP_INTERNAL uint64_t qnnp_operator_estimate_bytes(
+  const struct qnnp_operator* op);
+
+QNNP_INTERNAL size_t qnnp_operator_get_threads_count(
+  const struct qnnp_operator* op,
+  size_t threadpool_threads_count);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
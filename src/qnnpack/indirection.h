@@ -40,6 +40,14 @@ QNNP_INTERNAL void qnnp_indirection_init_maxpool2d(
   size_t step_height,
   size_t step_width);
 
+QNNP_INTERNAL void qnnp_indirection_init_resize_bilinear2d(
+  qnnp_operator_t op,
+  size_t batch_start);
+
+QNNP_INTERNAL void qnnp_indirection_init_resize_nearest2d(
+  qnnp_operator_t op,
+  size_t batch_start);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
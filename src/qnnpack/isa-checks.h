@@ -18,6 +18,20 @@
     } \
   } while (0)
 
+#define TEST_REQUIRES_X86_SSSE3 \
+  do { \
+    if (!cpuinfo_initialize() || !cpuinfo_has_x86_ssse3()) { \
+      return; \
+    } \
+  } while (0)
+
+#define TEST_REQUIRES_X86_AVX2 \
+  do { \
+    if (!cpuinfo_initialize() || !cpuinfo_has_x86_avx2()) { \
+      return; \
+    } \
+  } while (0)
+
 #define TEST_REQUIRES_ARM_NEON \
   do { \
     if (!cpuinfo_initialize() || !cpuinfo_has_arm_neon()) { \
@@ -8,9 +8,12 @@
 
 #pragma once
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
+#include <qnnpack.h>
+#include <qnnpack/params.h>
 #include <qnnpack/requantization.h>
 
 
@@ -18,6 +21,18 @@ enum qnnp_format {
   qnnp_format_quint8 = 0x02000000,
   qnnp_format_float32 = 0x02020202,
   qnnp_format_float16 = 0x01010101,
+  qnnp_format_float32_to_quint8 = 0x00000200,
+  qnnp_format_quint8_to_float32 = 0x00000002,
+  qnnp_format_float32_with_quint8_kernel = 0x02000202,
+  /* Quantized input and kernel with int32 or fp32 output */
+  qnnp_format_quint8_with_wide_output = 0x02000002,
+};
+
+/* Output of GEMM and CONV micro-kernels in convolution and fully connected operators */
+enum qnnp_conv_output_type {
+  qnnp_conv_output_type_quint8 = 0,
+  qnnp_conv_output_type_int32,
+  qnnp_conv_output_type_float32,
 };
 
 enum qnnp_ukernel_type {
@@ -26,13 +41,25 @@ enum qnnp_ukernel_type {
   qnnp_ukernel_type_average_pooling,
   qnnp_ukernel_type_channel_shuffle,
   qnnp_ukernel_type_clamp,
+  qnnp_ukernel_type_constant_pad,
   qnnp_ukernel_type_conv,
+  qnnp_ukernel_type_dequantize,
   qnnp_ukernel_type_dwconv,
+  qnnp_ukernel_type_dynamic_gemm,
   qnnp_ukernel_type_gemm,
   qnnp_ukernel_type_global_average_pooling,
   qnnp_ukernel_type_lut,
   qnnp_ukernel_type_max_pooling,
+  qnnp_ukernel_type_multiply,
+  qnnp_ukernel_type_nchw_to_nhwc,
+  qnnp_ukernel_type_nhwc_to_nchw,
+  qnnp_ukernel_type_quantize,
+  qnnp_ukernel_type_reduce_mean,
+  qnnp_ukernel_type_reduce_sum,
+  qnnp_ukernel_type_resize_bilinear,
+  qnnp_ukernel_type_resize_nearest,
   qnnp_ukernel_type_softargmax,
+  qnnp_ukernel_type_top_k,
   qnnp_ukernel_type_xzp_gemm,
 };
 
@@ -44,6 +71,8 @@ struct qnnp_operator {
   uint32_t input_padding_left;
   uint32_t adjustment_height;
   uint32_t adjustment_width;
+  /* Deconvolution operators share the conv micro-kernel type, but derive output size from input size differently */
+  bool transposed;
   uint32_t kernel_height;
   uint32_t kernel_width;
   uint32_t stride_height;
@@ -66,14 +95,21 @@ struct qnnp_operator {
 
   size_t input2_pixel_stride;
   const void* input2;
+  /* Either 1 (broadcast) or the same as batch_size and channels */
+  size_t input2_batch_size;
+  size_t input2_channels;
 
   size_t output_height;
   size_t output_width;
   size_t output_pixel_stride;
   void* output;
+  /* Indices output of the Top-K operator */
+  size_t output2_pixel_stride;
+  void* output2;
 
   void* packed_weights;
   float input_scale;
+  float kernel_scale;
   float output_scale;
   uint8_t input_zero_point;
   uint8_t kernel_zero_point;
@@ -84,21 +120,63 @@ struct qnnp_operator {
   size_t valid_batch_size;
   size_t last_input_height;
   size_t last_input_width;
+  size_t last_output_height;
+  size_t last_output_width;
   const void* last_input;
 
+  /* Shape of the constant pad operator, normalized to QNNP_MAX_TENSOR_DIMS dimensions with the innermost last */
+  size_t pad_input_shape[QNNP_MAX_TENSOR_DIMS];
+  size_t pad_pre_paddings[QNNP_MAX_TENSOR_DIMS];
+  size_t pad_post_paddings[QNNP_MAX_TENSOR_DIMS];
+  uint8_t padding_value;
+
+  size_t top_k;
+
   void* zero_buffer;
   void* zero_pointer;
   void* lookup_table;
 
+  /* Allocated sizes of the buffers above, in bytes */
+  size_t packed_weights_size;
+  size_t indirection_buffer_size;
+  size_t a_sum_size;
+  size_t zero_buffer_size;
+  size_t lookup_table_size;
+
   union {
     union qnnp_q31_requantization_params requantization_params;
     union qnnp_conv_quantization_params conv_quantization_params;
     union qnnp_add_quantization_params add_quantization_params;
+    union qnnp_mul_quantization_params mul_quantization_params;
     union qnnp_avgpool_quantization_params avgpool_quantization_params;
     union qnnp_u8_clamping_params u8_clamping_params;
+    union qnnp_softargmax_params softargmax_params;
+    union qnnp_f32_quantization_params f32_quantization_params;
+    union qnnp_f32_dequantization_params f32_dequantization_params;
+    union qnnp_kernel_zero_point_params kernel_zero_point_params;
+    union qnnp_conv_dequantization_params conv_dequantization_params;
   };
+  /* Micro-kernels which match the layout of packed weights, selected when the operator was created */
+  union {
+    struct q8conv_parameters q8conv;
+    struct q8conv_i32_parameters q8conv_i32;
+    struct q8conv_f32_parameters q8conv_f32;
+    struct {
+      struct q8dwconv_up_parameters q8dw9;
+      struct q8dwconv_mp_parameters q8dw25;
+    } q8dwconv;
+  } ukernel;
   enum qnnp_ukernel_type ukernel_type;
+  enum qnnp_conv_output_type conv_output_type;
   enum qnnp_format format;
+  /* QNNP_FLAG_* flags which change the semantics of the operator */
+  uint32_t flags;
+  /* 0 means the number of threads is chosen by the cost model */
+  size_t max_threads;
+  /* Allocator of the operator structure and all buffers it holds */
+  struct qnnp_allocator allocator;
+  /* Placement of packed weights, including weights repacked for a different micro-kernel */
+  struct qnnp_weights_memory_policy weights_memory_policy;
 };
 
 static inline uint32_t qnnp_operator_get_log2_output_element_size(const struct qnnp_operator* convolution) {
@@ -212,6 +212,130 @@ union qnnp_add_quantization_params {
 #endif
 };
 
+union qnnp_mul_quantization_params {
+  struct {
+    int32_t a_zero_point;
+    int32_t b_zero_point;
+    uint32_t left_shift;
+    int32_t multiplier;
+    int32_t remainder_mask;
+    int32_t remainder_threshold;
+    uint32_t shift;
+    int32_t y_zero_point;
+    int32_t y_max;
+    int32_t y_min;
+  } scalar;
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  struct {
+    uint8_t a_zero_point;
+    uint8_t b_zero_point;
+    int16_t y_zero_point;
+    int32_t left_shift;
+    int32_t multiplier;
+    int32_t right_shift;
+    uint8_t y_max;
+    uint8_t y_min;
+  } neon;
+#endif
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  struct {
+    QNNP_ALIGN(16) int16_t a_zero_point[8];
+    QNNP_ALIGN(16) int16_t b_zero_point[8];
+    QNNP_ALIGN(16) uint64_t left_shift[2];
+    QNNP_ALIGN(16) uint32_t multiplier[4];
+    QNNP_ALIGN(16) uint64_t rounding[2];
+    QNNP_ALIGN(16) int32_t remainder_mask[4];
+    QNNP_ALIGN(16) int32_t remainder_threshold[4];
+    QNNP_ALIGN(16) uint64_t shift[2];
+    QNNP_ALIGN(16) int16_t y_zero_point[8];
+    QNNP_ALIGN(16) uint8_t y_max[16];
+    QNNP_ALIGN(16) uint8_t y_min[16];
+  } sse2;
+#endif
+};
+
+union qnnp_kernel_zero_point_params {
+  struct {
+    int32_t kernel_zero_point;
+  } scalar;
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  struct {
+    uint8_t kernel_zero_point;
+  } neon;
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  struct {
+    QNNP_ALIGN(16) int16_t kernel_zero_point[8];
+  } sse2;
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+};
+
+union qnnp_conv_dequantization_params {
+  struct {
+    int32_t kernel_zero_point;
+    float scale;
+  } scalar;
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  struct {
+    uint8_t kernel_zero_point;
+    float scale;
+  } neon;
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  struct {
+    QNNP_ALIGN(16) int16_t kernel_zero_point[8];
+    QNNP_ALIGN(16) float scale[4];
+  } sse2;
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+};
+
+union qnnp_f32_quantization_params {
+  struct {
+    float scale;
+    float min_less_zero_point;
+    float max_less_zero_point;
+    float magic;
+    int32_t magic_less_zero_point;
+  } scalar;
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  struct {
+    float scale;
+    float min_less_zero_point;
+    float max_less_zero_point;
+    float magic;
+    int32_t magic_less_zero_point;
+  } neon;
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  struct {
+    QNNP_ALIGN(16) float scale[4];
+    QNNP_ALIGN(16) float min_less_zero_point[4];
+    QNNP_ALIGN(16) float max_less_zero_point[4];
+    QNNP_ALIGN(16) float magic[4];
+    QNNP_ALIGN(16) int32_t magic_less_zero_point[4];
+  } sse2;
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+};
+
+union qnnp_f32_dequantization_params {
+  struct {
+    int32_t zero_point;
+    float scale;
+  } scalar;
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  struct {
+    uint8_t zero_point;
+    float scale;
+  } neon;
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  struct {
+    QNNP_ALIGN(16) int16_t zero_point[8];
+    QNNP_ALIGN(16) float scale[4];
+  } sse2;
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+};
+
 union qnnp_avgpool_quantization_params {
   struct {
     int32_t bias;
@@ -264,6 +388,25 @@ union qnnp_u8_clamping_params {
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
 };
 
+union qnnp_softargmax_params {
+  struct {
+    float divisor_scale;
+    int32_t output_zero_point;
+  } scalar;
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  struct {
+    float divisor_scale;
+    uint16_t output_zero_point;
+  } neon;
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  struct {
+    float divisor_scale;
+    QNNP_ALIGN(16) int16_t output_zero_point[8];
+  } sse2;
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+};
+
 typedef void (*q8gemm_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -275,6 +418,18 @@ typedef void (*q8gemm_ukernel_function)(
     size_t c_stride,
     const union qnnp_conv_quantization_params* quantization_params);
 
+/* Same as q8gemm_ukernel_function, but stores 32-bit accumulators instead of requantized values */
+typedef void (*q8gemm_i32_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const uint8_t* a,
+    size_t a_stride,
+    const void* w,
+    int32_t* c,
+    size_t c_stride,
+    const union qnnp_kernel_zero_point_params* quantization_params);
+
 typedef void (*q8conv_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -286,6 +441,40 @@ typedef void (*q8conv_ukernel_function)(
     size_t c_stride,
     const union qnnp_conv_quantization_params* quantization_params);
 
+typedef void (*q8conv_i32_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t kc,
+    size_t ks,
+    const uint8_t** a,
+    const void* w,
+    int32_t* c,
+    size_t c_stride,
+    const union qnnp_kernel_zero_point_params* quantization_params);
+
+/* Same as q8gemm_ukernel_function, but stores 32-bit accumulators multiplied by a scale as fp32 values */
+typedef void (*q8gemm_f32_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t k,
+    const uint8_t* a,
+    size_t a_stride,
+    const void* w,
+    float* c,
+    size_t c_stride,
+    const union qnnp_conv_dequantization_params* dequantization_params);
+
+typedef void (*q8conv_f32_ukernel_function)(
+    size_t mr,
+    size_t nr,
+    size_t kc,
+    size_t ks,
+    const uint8_t** a,
+    const void* w,
+    float* c,
+    size_t c_stride,
+    const union qnnp_conv_dequantization_params* dequantization_params);
+
 typedef void (*q8gemm_xzp_ukernel_function)(
     size_t mr,
     size_t nr,
@@ -317,6 +506,25 @@ typedef void (*xzipv_ukernel_function)(
     const void* x,
     void* y);
 
+typedef void (*xtranspose_ukernel_function)(
+    size_t m,
+    size_t n,
+    const void* x,
+    size_t x_stride,
+    void* y,
+    size_t y_stride);
+
+typedef void (*x8pad_ukernel_function)(
+    size_t m,
+    size_t n,
+    size_t l,
+    size_t r,
+    uint8_t c,
+    const void* x,
+    size_t x_stride,
+    void* y,
+    size_t y_stride);
+
 typedef void (*x8lut_ukernel_function)(
     size_t n,
     const uint8_t* x,
@@ -435,16 +643,40 @@ typedef void (*u8clamp_ukernel_function)(
     uint8_t* y,
     const union qnnp_u8_clamping_params* params);
 
+typedef void (*srminmax_ukernel_function)(
+    size_t n,
+    const float* x,
+    float* y);
+
 typedef uint8_t (*u8rmax_ukernel_function)(
     size_t n,
     const uint8_t* x);
 
+typedef uint32_t (*u8rsum_ukernel_function)(
+    size_t n,
+    const uint8_t* x);
+
 typedef void (*u8lut32norm_ukernel_function)(
     size_t n,
     const uint8_t* x,
     const uint32_t* t,
     uint8_t* y);
 
+typedef void (*u8softargmax_ukernel_function)(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t,
+    uint8_t* y,
+    const union qnnp_softargmax_params* params);
+
+typedef void (*u8ibilinear_ukernel_function)(
+    size_t n,
+    size_t c,
+    const uint8_t** x,
+    const int16_t* w,
+    uint8_t* y,
+    size_t y_increment);
+
 typedef void (*q8vadd_ukernel_function)(
     size_t n,
     const uint8_t* a,
@@ -452,6 +684,25 @@ typedef void (*q8vadd_ukernel_function)(
     uint8_t* y,
     const union qnnp_add_quantization_params* quantization_params);
 
+typedef void (*q8vmul_ukernel_function)(
+    size_t n,
+    const uint8_t* a,
+    const uint8_t* b,
+    uint8_t* y,
+    const union qnnp_mul_quantization_params* quantization_params);
+
+typedef void (*q8vquantize_ukernel_function)(
+    size_t n,
+    const float* x,
+    uint8_t* y,
+    const union qnnp_f32_quantization_params* quantization_params);
+
+typedef void (*q8vdequantize_ukernel_function)(
+    size_t n,
+    const uint8_t* x,
+    float* y,
+    const union qnnp_f32_dequantization_params* dequantization_params);
+
 struct q8conv_parameters {
   q8gemm_ukernel_function gemm;
   q8conv_ukernel_function conv;
@@ -460,6 +711,22 @@ struct q8conv_parameters {
   uint8_t kr;
 };
 
+struct q8conv_i32_parameters {
+  q8gemm_i32_ukernel_function gemm;
+  q8conv_i32_ukernel_function conv;
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t kr;
+};
+
+struct q8conv_f32_parameters {
+  q8gemm_f32_ukernel_function gemm;
+  q8conv_f32_ukernel_function conv;
+  uint8_t mr;
+  uint8_t nr;
+  uint8_t kr;
+};
+
 struct q8conv_xzp_parameters {
   q8gemm_xzp_ukernel_function gemm;
   /* no conv ukernel */
@@ -520,18 +787,31 @@ struct x8zip_parameters {
 struct qnnp_parameters {
   struct q8conv_parameters q8conv;
   struct q8conv_xzp_parameters q8conv_xzp;
+  struct q8conv_i32_parameters q8conv_i32;
+  struct q8conv_f32_parameters q8conv_f32;
   struct q8dwconv_up_parameters q8dw9;
   struct q8dwconv_mp_parameters q8dw25;
   struct q8sum_rows_parameters q8sum_rows;
   q8vadd_ukernel_function q8vadd;
+  q8vadd_ukernel_function q8vaddc;
+  q8vmul_ukernel_function q8vmul;
+  q8vquantize_ukernel_function q8vquantize;
+  q8vdequantize_ukernel_function q8vdequantize;
   struct q8gavgpool_parameters q8gavgpool;
   struct q8avgpool_parameters q8avgpool;
   struct u8maxpool_parameters u8maxpool;
   u8lut32norm_ukernel_function u8lut32norm;
   u8clamp_ukernel_function u8clamp;
   u8rmax_ukernel_function u8rmax;
+  u8rsum_ukernel_function u8rsum;
+  srminmax_ukernel_function srminmax;
+  u8softargmax_ukernel_function u8softargmax;
+  u8ibilinear_ukernel_function u8ibilinear;
   struct x8zip_parameters x8zip;
   x8lut_ukernel_function x8lut;
+  x8pad_ukernel_function x8pad;
+  xtranspose_ukernel_function x8transpose;
+  xtranspose_ukernel_function x32transpose;
   bool initialized;
 };
 
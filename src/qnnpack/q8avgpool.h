@@ -33,6 +33,7 @@ extern "C" {
 
 DECLARE_Q8MPAVGPOOL_UKERNEL_FUNCTION(q8avgpool_ukernel_mp8x9p8q__neon)
 DECLARE_Q8MPAVGPOOL_UKERNEL_FUNCTION(q8avgpool_ukernel_mp8x9p8q__sse2)
+DECLARE_Q8MPAVGPOOL_UKERNEL_FUNCTION(q8avgpool_ukernel_mp16x9p8q__avx2)
 
 #define DECLARE_Q8UPAVGPOOL_UKERNEL_FUNCTION(fn_name)                     \
   QNNP_INTERNAL void fn_name(                                             \
@@ -50,6 +51,8 @@ DECLARE_Q8UPAVGPOOL_UKERNEL_FUNCTION(q8avgpool_ukernel_up8x9__neon)
 DECLARE_Q8UPAVGPOOL_UKERNEL_FUNCTION(q8avgpool_ukernel_up8xm__neon)
 DECLARE_Q8UPAVGPOOL_UKERNEL_FUNCTION(q8avgpool_ukernel_up8x9__sse2)
 DECLARE_Q8UPAVGPOOL_UKERNEL_FUNCTION(q8avgpool_ukernel_up8xm__sse2)
+DECLARE_Q8UPAVGPOOL_UKERNEL_FUNCTION(q8avgpool_ukernel_up16x9__avx2)
+DECLARE_Q8UPAVGPOOL_UKERNEL_FUNCTION(q8avgpool_ukernel_up16xm__avx2)
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -36,6 +36,36 @@ DECLARE_Q8CONV_UKERNEL_FUNCTION(q8conv_ukernel_8x8__aarch64_neon)
 DECLARE_Q8CONV_UKERNEL_FUNCTION(q8conv_ukernel_8x8__neon)
 DECLARE_Q8CONV_UKERNEL_FUNCTION(q8conv_ukernel_4x4c2__sse2)
 
+#define DECLARE_Q8CONV_I32_UKERNEL_FUNCTION(fn_name)                   \
+  QNNP_INTERNAL void fn_name(                                          \
+      size_t mr,                                                       \
+      size_t nr,                                                       \
+      size_t kc,                                                       \
+      size_t ks,                                                       \
+      const uint8_t** a,                                               \
+      const void* w,                                                   \
+      int32_t* c,                                                      \
+      size_t c_stride,                                                 \
+      const union qnnp_kernel_zero_point_params* quantization_params);
+
+DECLARE_Q8CONV_I32_UKERNEL_FUNCTION(q8conv_i32_ukernel_4x8__neon)
+DECLARE_Q8CONV_I32_UKERNEL_FUNCTION(q8conv_i32_ukernel_4x4c2__sse2)
+
+#define DECLARE_Q8CONV_F32_UKERNEL_FUNCTION(fn_name)                   \
+  QNNP_INTERNAL void fn_name(                                          \
+      size_t mr,                                                       \
+      size_t nr,                                                       \
+      size_t kc,                                                       \
+      size_t ks,                                                       \
+      const uint8_t** a,                                               \
+      const void* w,                                                   \
+      float* c,                                                        \
+      size_t c_stride,                                                 \
+      const union qnnp_conv_dequantization_params* dequantization_params);
+
+DECLARE_Q8CONV_F32_UKERNEL_FUNCTION(q8conv_f32_ukernel_4x8__neon)
+DECLARE_Q8CONV_F32_UKERNEL_FUNCTION(q8conv_f32_ukernel_4x4c2__sse2)
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
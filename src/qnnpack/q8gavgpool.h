@@ -31,6 +31,7 @@ extern "C" {
 
 DECLARE_Q8MPGAVGPOOL_UKERNEL_FUNCTION(q8gavgpool_ukernel_mp8x7p7q__neon)
 DECLARE_Q8MPGAVGPOOL_UKERNEL_FUNCTION(q8gavgpool_ukernel_mp8x7p7q__sse2)
+DECLARE_Q8MPGAVGPOOL_UKERNEL_FUNCTION(q8gavgpool_ukernel_mp16x7p7q__avx2)
 
 #define DECLARE_Q8UPGAVGPOOL_UKERNEL_FUNCTION(fn_name)                    \
   QNNP_INTERNAL void fn_name(                                             \
@@ -46,6 +47,8 @@ DECLARE_Q8UPGAVGPOOL_UKERNEL_FUNCTION(q8gavgpool_ukernel_up8x7__neon)
 DECLARE_Q8UPGAVGPOOL_UKERNEL_FUNCTION(q8gavgpool_ukernel_up8xm__neon)
 DECLARE_Q8UPGAVGPOOL_UKERNEL_FUNCTION(q8gavgpool_ukernel_up8x7__sse2)
 DECLARE_Q8UPGAVGPOOL_UKERNEL_FUNCTION(q8gavgpool_ukernel_up8xm__sse2)
+DECLARE_Q8UPGAVGPOOL_UKERNEL_FUNCTION(q8gavgpool_ukernel_up16x7__avx2)
+DECLARE_Q8UPGAVGPOOL_UKERNEL_FUNCTION(q8gavgpool_ukernel_up16xm__avx2)
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -43,6 +43,38 @@ DECLARE_Q8GEMM_UKERNEL_FUNCTION(q8gemm_ukernel_8x8__aarch64_neon)
 DECLARE_Q8GEMM_UKERNEL_FUNCTION(q8gemm_ukernel_2x4c8__sse2)
 DECLARE_Q8GEMM_UKERNEL_FUNCTION(q8gemm_ukernel_4x4c2__sse2)
 
+#define DECLARE_Q8GEMM_I32_UKERNEL_FUNCTION(fn_name)                   \
+  QNNP_INTERNAL void fn_name(                                          \
+      size_t mr,                                                       \
+      size_t nr,                                                       \
+      size_t k,                                                        \
+      const uint8_t* a,                                                \
+      size_t a_stride,                                                 \
+      const void* w,                                                   \
+      int32_t* c,                                                      \
+      size_t c_stride,                                                 \
+      const union qnnp_kernel_zero_point_params* quantization_params);
+
+DECLARE_Q8GEMM_I32_UKERNEL_FUNCTION(q8gemm_i32_ukernel_4x8__neon)
+
+DECLARE_Q8GEMM_I32_UKERNEL_FUNCTION(q8gemm_i32_ukernel_4x4c2__sse2)
+
+#define DECLARE_Q8GEMM_F32_UKERNEL_FUNCTION(fn_name)                   \
+  QNNP_INTERNAL void fn_name(                                          \
+      size_t mr,                                                       \
+      size_t nr,                                                       \
+      size_t k,                                                        \
+      const uint8_t* a,                                                \
+      size_t a_stride,                                                 \
+      const void* w,                                                   \
+      float* c,                                                        \
+      size_t c_stride,                                                 \
+      const union qnnp_conv_dequantization_params* dequantization_params);
+
+DECLARE_Q8GEMM_F32_UKERNEL_FUNCTION(q8gemm_f32_ukernel_4x8__neon)
+
+DECLARE_Q8GEMM_F32_UKERNEL_FUNCTION(q8gemm_f32_ukernel_4x4c2__sse2)
+
 #define DECLARE_Q8GEMM_XZP_UKERNEL_FUNCTION(fn_name) \
   QNNP_INTERNAL void fn_name(                        \
       size_t mr,                                     \
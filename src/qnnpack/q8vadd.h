@@ -30,6 +30,10 @@ extern "C" {
 DECLARE_Q8VADD_UKERNEL_FUNCTION(q8vadd_ukernel__neon)
 DECLARE_Q8VADD_UKERNEL_FUNCTION(q8vadd_ukernel__sse2)
 
+/* Variants which add the same B element to every A element */
+DECLARE_Q8VADD_UKERNEL_FUNCTION(q8vaddc_ukernel__neon)
+DECLARE_Q8VADD_UKERNEL_FUNCTION(q8vaddc_ukernel__sse2)
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack/params.h>
+#include <qnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DECLARE_Q8VMUL_UKERNEL_FUNCTION(fn_name)                      \
+  QNNP_INTERNAL void fn_name(                                         \
+      size_t n,                                                       \
+      const uint8_t* a,                                               \
+      const uint8_t* b,                                               \
+      uint8_t* y,                                                     \
+      const union qnnp_mul_quantization_params* quantization_params);
+
+
+DECLARE_Q8VMUL_UKERNEL_FUNCTION(q8vmul_ukernel__neon)
+DECLARE_Q8VMUL_UKERNEL_FUNCTION(q8vmul_ukernel__sse2)
+DECLARE_Q8VMUL_UKERNEL_FUNCTION(q8vmul_ukernel__avx2)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -324,6 +324,174 @@ static inline union qnnp_u8_clamping_params qnnp_compute_u8_clamping_params(
   return params;
 }
 
+static inline union qnnp_kernel_zero_point_params qnnp_compute_kernel_zero_point_params(
+  uint8_t kernel_zero_point)
+{
+  union qnnp_kernel_zero_point_params params;
+  #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.kernel_zero_point[i] = (int16_t) (uint16_t) kernel_zero_point;
+    }
+  #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    params.neon.kernel_zero_point = kernel_zero_point;
+  #else
+    params.scalar.kernel_zero_point = (int32_t) (uint32_t) kernel_zero_point;
+  #endif
+  return params;
+}
+
+static inline union qnnp_conv_dequantization_params qnnp_compute_conv_dequantization_params(
+  uint8_t kernel_zero_point,
+  float scale)
+{
+  union qnnp_conv_dequantization_params params;
+  #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.kernel_zero_point[i] = (int16_t) (uint16_t) kernel_zero_point;
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.scale[i] = scale;
+    }
+  #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    params.neon.kernel_zero_point = kernel_zero_point;
+    params.neon.scale = scale;
+  #else
+    params.scalar.kernel_zero_point = (int32_t) (uint32_t) kernel_zero_point;
+    params.scalar.scale = scale;
+  #endif
+  return params;
+}
+
+static inline union qnnp_f32_quantization_params qnnp_compute_f32_quantization_params(
+  uint8_t output_zero_point,
+  float output_scale,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  assert(output_scale > 0.0f);
+  assert(output_min < output_max);
+
+  /*
+   * Values are scaled, clamped to [output_min - zero point, output_max - zero point], and rounded to nearest even by
+   * adding 1.5 * 2**23 as in FP32 requantization. The subtrahend of the integer representation adds the zero point.
+   */
+  const float scale = 1.0f / output_scale;
+  const float min_less_zero_point = (float) ((int32_t) (uint32_t) output_min - (int32_t) (uint32_t) output_zero_point);
+  const float max_less_zero_point = (float) ((int32_t) (uint32_t) output_max - (int32_t) (uint32_t) output_zero_point);
+  const int32_t magic_less_zero_point = INT32_C(0x4B400000) - (int32_t) (uint32_t) output_zero_point;
+
+  union qnnp_f32_quantization_params params;
+  #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.scale[i] = scale;
+      params.sse2.min_less_zero_point[i] = min_less_zero_point;
+      params.sse2.max_less_zero_point[i] = max_less_zero_point;
+      params.sse2.magic[i] = 12582912.0f;
+      params.sse2.magic_less_zero_point[i] = magic_less_zero_point;
+    }
+  #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    params.neon.scale = scale;
+    params.neon.min_less_zero_point = min_less_zero_point;
+    params.neon.max_less_zero_point = max_less_zero_point;
+    params.neon.magic = 12582912.0f;
+    params.neon.magic_less_zero_point = magic_less_zero_point;
+  #else
+    params.scalar.scale = scale;
+    params.scalar.min_less_zero_point = min_less_zero_point;
+    params.scalar.max_less_zero_point = max_less_zero_point;
+    params.scalar.magic = 12582912.0f;
+    params.scalar.magic_less_zero_point = magic_less_zero_point;
+  #endif
+  return params;
+}
+
+static inline union qnnp_f32_quantization_params qnnp_compute_scalar_f32_quantization_params(
+  uint8_t output_zero_point,
+  float output_scale,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  assert(output_scale > 0.0f);
+  assert(output_min < output_max);
+
+  union qnnp_f32_quantization_params params;
+  params.scalar.scale = 1.0f / output_scale;
+  params.scalar.min_less_zero_point =
+    (float) ((int32_t) (uint32_t) output_min - (int32_t) (uint32_t) output_zero_point);
+  params.scalar.max_less_zero_point =
+    (float) ((int32_t) (uint32_t) output_max - (int32_t) (uint32_t) output_zero_point);
+  params.scalar.magic = 12582912.0f;
+  params.scalar.magic_less_zero_point = INT32_C(0x4B400000) - (int32_t) (uint32_t) output_zero_point;
+  return params;
+}
+
+static inline union qnnp_f32_dequantization_params qnnp_compute_f32_dequantization_params(
+  uint8_t input_zero_point,
+  float input_scale)
+{
+  union qnnp_f32_dequantization_params params;
+  #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.zero_point[i] = (int16_t) (uint16_t) input_zero_point;
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.scale[i] = input_scale;
+    }
+  #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    params.neon.zero_point = input_zero_point;
+    params.neon.scale = input_scale;
+  #else
+    params.scalar.zero_point = (int32_t) (uint32_t) input_zero_point;
+    params.scalar.scale = input_scale;
+  #endif
+  return params;
+}
+
+static inline union qnnp_f32_dequantization_params qnnp_compute_scalar_f32_dequantization_params(
+  uint8_t input_zero_point,
+  float input_scale)
+{
+  union qnnp_f32_dequantization_params params;
+  params.scalar.zero_point = (int32_t) (uint32_t) input_zero_point;
+  params.scalar.scale = input_scale;
+  return params;
+}
+
+static inline union qnnp_softargmax_params qnnp_compute_softargmax_params(
+  uint8_t output_zero_point,
+  float output_scale)
+{
+  assert(output_scale > 0.0f);
+
+  /* Kernels compute round((t << 8) / round(sum * divisor_scale)), which is 1/256 output scale for divisor_scale = 1 */
+  union qnnp_softargmax_params params;
+  #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    params.sse2.divisor_scale = output_scale * 256.0f;
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.output_zero_point[i] = (int16_t) (uint16_t) output_zero_point;
+    }
+  #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    params.neon.divisor_scale = output_scale * 256.0f;
+    params.neon.output_zero_point = (uint16_t) output_zero_point;
+  #else
+    params.scalar.divisor_scale = output_scale * 256.0f;
+    params.scalar.output_zero_point = (int32_t) (uint32_t) output_zero_point;
+  #endif
+  return params;
+}
+
+static inline union qnnp_softargmax_params qnnp_compute_scalar_softargmax_params(
+  uint8_t output_zero_point,
+  float output_scale)
+{
+  assert(output_scale > 0.0f);
+
+  union qnnp_softargmax_params params;
+  params.scalar.divisor_scale = output_scale * 256.0f;
+  params.scalar.output_zero_point = (int32_t) (uint32_t) output_zero_point;
+  return params;
+}
+
 static inline union qnnp_add_quantization_params qnnp_compute_add_quantization_params(
   uint8_t a_zero_point,
   uint8_t b_zero_point,
@@ -461,6 +629,134 @@ static inline union qnnp_add_quantization_params qnnp_compute_scalar_add_quantiz
   return params;
 }
 
+static inline union qnnp_mul_quantization_params qnnp_compute_mul_quantization_params(
+  uint8_t a_zero_point,
+  uint8_t b_zero_point,
+  uint8_t output_zero_point,
+  float output_scale,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  /* Compute requantization parameters */
+  assert(output_scale < 1.0f);
+  assert(output_scale >= 0x1.0p-32f);
+  const uint32_t scale_bits = fp32_to_bits(output_scale);
+
+  /* Multiplier is in [0x40000000, 0x7FFFFF80] range */
+  const int32_t multiplier = (int32_t)(((scale_bits & UINT32_C(0x007FFFFF)) | UINT32_C(0x00800000)) << 7);
+  assert(multiplier >= INT32_C(0x40000000));
+  assert(multiplier <= INT32_C(0x7FFFFF80));
+
+  /* Shift is in [0, 31] range */
+  const int32_t scale_shift = 127 + 31 - 32 - (scale_bits >> 23);
+  assert(scale_shift >= 0);
+  assert(scale_shift < 32);
+
+  /*
+   * Products of zero-point-adjusted inputs fit into 17 bits: shifting them left by up to 14 bits before the Q31
+   * multiplication makes the rounding of the Q31 product negligible compared to the final rounding.
+   */
+  const int32_t left_shift = 31 - scale_shift < 14 ? 31 - scale_shift : 14;
+  const int32_t shift = scale_shift + left_shift;
+  assert(shift < 32);
+
+  union qnnp_mul_quantization_params params;
+  #if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+    const uint32_t remainder_mask = (UINT32_C(1) << shift) - UINT32_C(1);
+    const uint32_t remainder_threshold = remainder_mask >> 1;
+    for (uint32_t i = 0; i < 8; i++) {
+      params.sse2.a_zero_point[i] = (int16_t) (uint16_t) a_zero_point;
+      params.sse2.b_zero_point[i] = (int16_t) (uint16_t) b_zero_point;
+      params.sse2.y_zero_point[i] = (int16_t) (uint16_t) output_zero_point;
+    }
+    for (uint32_t i = 0; i < 4; i++) {
+      params.sse2.multiplier[i] = (uint32_t) multiplier;
+      params.sse2.remainder_mask[i] = (int32_t) remainder_mask;
+      params.sse2.remainder_threshold[i] = (int32_t) remainder_threshold;
+    }
+    params.sse2.rounding[0] = UINT64_C(0x40000000);
+    params.sse2.rounding[1] = UINT64_C(0x40000000);
+    params.sse2.left_shift[0] = (uint64_t) (uint32_t) left_shift;
+    params.sse2.left_shift[1] = (uint64_t) (uint32_t) left_shift;
+    params.sse2.shift[0] = (uint64_t) (uint32_t) shift;
+    params.sse2.shift[1] = (uint64_t) (uint32_t) shift;
+    for (uint32_t i = 0; i < 16; i++) {
+      params.sse2.y_max[i] = output_max;
+      params.sse2.y_min[i] = output_min;
+    }
+  #elif CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+    params.neon.a_zero_point = a_zero_point;
+    params.neon.b_zero_point = b_zero_point;
+    params.neon.y_zero_point = (int16_t) (uint16_t) output_zero_point;
+    params.neon.left_shift = left_shift;
+    params.neon.multiplier = multiplier;
+    params.neon.right_shift = -shift;
+    params.neon.y_max = output_max;
+    params.neon.y_min = output_min;
+  #else
+    const uint32_t remainder_mask = (UINT32_C(1) << shift) - UINT32_C(1);
+    const uint32_t remainder_threshold = remainder_mask >> 1;
+    params.scalar.a_zero_point = (int32_t) (uint32_t) a_zero_point;
+    params.scalar.b_zero_point = (int32_t) (uint32_t) b_zero_point;
+    params.scalar.left_shift = (uint32_t) left_shift;
+    params.scalar.multiplier = multiplier;
+    params.scalar.remainder_mask = (int32_t) remainder_mask;
+    params.scalar.remainder_threshold = (int32_t) remainder_threshold;
+    params.scalar.shift = (uint32_t) shift;
+    params.scalar.y_zero_point = (int32_t) (uint32_t) output_zero_point;
+    params.scalar.y_max = (int32_t) (uint32_t) output_max;
+    params.scalar.y_min = (int32_t) (uint32_t) output_min;
+  #endif
+  return params;
+}
+
+static inline union qnnp_mul_quantization_params qnnp_compute_scalar_mul_quantization_params(
+  uint8_t a_zero_point,
+  uint8_t b_zero_point,
+  uint8_t output_zero_point,
+  float output_scale,
+  uint8_t output_min,
+  uint8_t output_max)
+{
+  /* Compute requantization parameters */
+  assert(output_scale < 1.0f);
+  assert(output_scale >= 0x1.0p-32f);
+  const uint32_t scale_bits = fp32_to_bits(output_scale);
+
+  /* Multiplier is in [0x40000000, 0x7FFFFF80] range */
+  const int32_t multiplier = (int32_t)(((scale_bits & UINT32_C(0x007FFFFF)) | UINT32_C(0x00800000)) << 7);
+  assert(multiplier >= INT32_C(0x40000000));
+  assert(multiplier <= INT32_C(0x7FFFFF80));
+
+  /* Shift is in [0, 31] range */
+  const int32_t scale_shift = 127 + 31 - 32 - (scale_bits >> 23);
+  assert(scale_shift >= 0);
+  assert(scale_shift < 32);
+
+  /*
+   * Products of zero-point-adjusted inputs fit into 17 bits: shifting them left by up to 14 bits before the Q31
+   * multiplication makes the rounding of the Q31 product negligible compared to the final rounding.
+   */
+  const int32_t left_shift = 31 - scale_shift < 14 ? 31 - scale_shift : 14;
+  const int32_t shift = scale_shift + left_shift;
+  assert(shift < 32);
+
+  union qnnp_mul_quantization_params params;
+  const uint32_t remainder_mask = (UINT32_C(1) << shift) - UINT32_C(1);
+  const uint32_t remainder_threshold = remainder_mask >> 1;
+  params.scalar.a_zero_point = (int32_t) (uint32_t) a_zero_point;
+  params.scalar.b_zero_point = (int32_t) (uint32_t) b_zero_point;
+  params.scalar.left_shift = (uint32_t) left_shift;
+  params.scalar.multiplier = multiplier;
+  params.scalar.remainder_mask = (int32_t) remainder_mask;
+  params.scalar.remainder_threshold = (int32_t) remainder_threshold;
+  params.scalar.shift = (uint32_t) shift;
+  params.scalar.y_zero_point = (int32_t) (uint32_t) output_zero_point;
+  params.scalar.y_max = (int32_t) (uint32_t) output_max;
+  params.scalar.y_min = (int32_t) (uint32_t) output_min;
+  return params;
+}
+
 static inline uint8_t qnnp_q31_requantize(
   int32_t n,
   union qnnp_q31_requantization_params params)
@@ -479,6 +775,23 @@ static inline uint8_t qnnp_q31_requantize(
   return (uint8_t) (n + params.scalar.zero_point);
 }
 
+static inline uint8_t qnnp_f32_quantize(
+  float x,
+  union qnnp_f32_quantization_params params)
+{
+  float scaled = x * params.scalar.scale;
+  scaled = scaled > params.scalar.min_less_zero_point ? scaled : params.scalar.min_less_zero_point;
+  scaled = scaled < params.scalar.max_less_zero_point ? scaled : params.scalar.max_less_zero_point;
+  return (uint8_t) (fp32_to_bits(scaled + params.scalar.magic) - (uint32_t) params.scalar.magic_less_zero_point);
+}
+
+static inline float qnnp_f32_dequantize(
+  uint8_t x,
+  union qnnp_f32_dequantization_params params)
+{
+  return (float) ((int32_t) (uint32_t) x - params.scalar.zero_point) * params.scalar.scale;
+}
+
 static inline uint8_t qnnp_avgpool_quantize(
   int32_t n,
   union qnnp_avgpool_quantization_params params)
@@ -520,3 +833,28 @@ static inline uint8_t qnnp_add_quantize(
   }
   return (uint8_t) y;
 }
+
+static inline uint8_t qnnp_mul_quantize(
+  uint8_t a, uint8_t b,
+  union qnnp_mul_quantization_params params)
+{
+  /* Subtract zero points and multiply */
+  const int32_t n = (int32_t) ((uint32_t) (((int32_t) (uint32_t) a - params.scalar.a_zero_point) *
+    ((int32_t) (uint32_t) b - params.scalar.b_zero_point)) << params.scalar.left_shift);
+
+  /* Multiply by Q31 multiplier, shift right and round */
+  const int64_t product = (int64_t) n * (int64_t) params.scalar.multiplier;
+  const int32_t q31product = (int32_t) (uint32_t) ((uint64_t) (product + INT64_C(0x40000000)) >> 31);
+  const int32_t remainder = (q31product & params.scalar.remainder_mask) - (int32_t) (q31product < 0);
+  const int32_t acc = asr_s32(q31product, params.scalar.shift) + (int32_t) (remainder > params.scalar.remainder_threshold);
+
+  /* Clamp and add output zero point */
+  int32_t y = acc + params.scalar.y_zero_point;
+  if (y >= params.scalar.y_max) {
+    y = params.scalar.y_max;
+  }
+  if (y <= params.scalar.y_min) {
+    y = params.scalar.y_min;
+  }
+  return (uint8_t) y;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack/params.h>
+#include <qnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DECLARE_U8IBILINEAR_UKERNEL_FUNCTION(fn_name) \
+  QNNP_INTERNAL void fn_name(                         \
+      size_t n,                                       \
+      size_t c,                                       \
+      const uint8_t** x,                              \
+      const int16_t* w,                               \
+      uint8_t* y,                                     \
+      size_t y_increment);
+
+DECLARE_U8IBILINEAR_UKERNEL_FUNCTION(u8ibilinear_ukernel_c8__neon)
+DECLARE_U8IBILINEAR_UKERNEL_FUNCTION(u8ibilinear_ukernel_c8__sse2)
+DECLARE_U8IBILINEAR_UKERNEL_FUNCTION(u8ibilinear_ukernel_c16__avx2)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
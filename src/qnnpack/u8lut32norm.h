@@ -26,6 +26,7 @@ extern "C" {
       uint8_t* y);
 
 DECLARE_X8LUT32NORM_UKERNEL_FUNCTION(u8lut32norm_ukernel__scalar)
+DECLARE_X8LUT32NORM_UKERNEL_FUNCTION(u8lut32norm_ukernel__avx2)
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -33,6 +33,8 @@ DECLARE_U8MAXPOOL_UKERNEL_FUNCTION(u8maxpool_ukernel_16x9p8q__neon)
 DECLARE_U8MAXPOOL_UKERNEL_FUNCTION(u8maxpool_ukernel_16x9p8q__sse2)
 DECLARE_U8MAXPOOL_UKERNEL_FUNCTION(u8maxpool_ukernel_sub16__neon)
 DECLARE_U8MAXPOOL_UKERNEL_FUNCTION(u8maxpool_ukernel_sub16__sse2)
+DECLARE_U8MAXPOOL_UKERNEL_FUNCTION(u8maxpool_ukernel_32x9p8q__avx2)
+DECLARE_U8MAXPOOL_UKERNEL_FUNCTION(u8maxpool_ukernel_sub32__avx2)
 
 #ifdef __cplusplus
 } /* extern "C" */
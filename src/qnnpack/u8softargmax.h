@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack/params.h>
+#include <qnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Divisor for the normalization of a row of exponents which sum to sum, in [1, 2**31] range */
+static inline uint32_t u8softargmax_divisor(uint32_t sum, float divisor_scale)
+{
+  const double divisor = (double) sum * (double) divisor_scale + 0.5;
+  if (divisor < 1.0) {
+    return 1;
+  }
+  if (divisor >= 2147483648.0) {
+    return UINT32_C(0x80000000);
+  }
+  return (uint32_t) divisor;
+}
+
+#define DECLARE_U8SOFTARGMAX_UKERNEL_FUNCTION(fn_name) \
+  QNNP_INTERNAL void fn_name(                          \
+      size_t n,                                        \
+      const uint8_t* x,                                \
+      const uint32_t* t,                               \
+      uint8_t* y,                                      \
+      const union qnnp_softargmax_params* params);
+
+DECLARE_U8SOFTARGMAX_UKERNEL_FUNCTION(u8softargmax_ukernel__neon)
+DECLARE_U8SOFTARGMAX_UKERNEL_FUNCTION(u8softargmax_ukernel__sse2)
+DECLARE_U8SOFTARGMAX_UKERNEL_FUNCTION(u8softargmax_ukernel__avx2)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <qnnpack/common.h>
+#include <qnnpack/params.h>
+
+
+struct qnnp_q8conv_ukernel {
+  const char* name;
+  const char* isa;
+  struct q8conv_parameters parameters;
+};
+
+struct qnnp_q8dwconv_ukernel {
+  const char* name;
+  const char* isa;
+  /* Checks whether the processor supports the ISA extension of the micro-kernel; NULL if always supported */
+  bool (*is_supported)(void);
+  struct q8dwconv_up_parameters q8dw9;
+  struct q8dwconv_mp_parameters q8dw25;
+};
+
+/* Pooling micro-kernels with the same channel tile; operators read them from qnnp_params when they are created, set up, and run */
+struct qnnp_q8avgpool_ukernel {
+  const char* name;
+  const char* isa;
+  bool (*is_supported)(void);
+  struct q8avgpool_parameters parameters;
+};
+
+struct qnnp_q8gavgpool_ukernel {
+  const char* name;
+  const char* isa;
+  bool (*is_supported)(void);
+  struct q8gavgpool_parameters parameters;
+};
+
+struct qnnp_u8maxpool_ukernel {
+  const char* name;
+  const char* isa;
+  bool (*is_supported)(void);
+  struct u8maxpool_parameters parameters;
+};
+
+/* GEMM and CONV micro-kernels which share the layout of packed weights, available on the target architecture */
+QNNP_INTERNAL extern const struct qnnp_q8conv_ukernel qnnp_q8conv_ukernels[];
+QNNP_INTERNAL extern const size_t qnnp_q8conv_ukernels_count;
+
+/* Unipass 9-tap and multipass 25-tap depthwise convolution micro-kernels with the same channel tile */
+QNNP_INTERNAL extern const struct qnnp_q8dwconv_ukernel qnnp_q8dwconv_ukernels[];
+QNNP_INTERNAL extern const size_t qnnp_q8dwconv_ukernels_count;
+
+/* Average pooling, global average pooling, and max pooling micro-kernels, available on the target architecture */
+QNNP_INTERNAL extern const struct qnnp_q8avgpool_ukernel qnnp_q8avgpool_ukernels[];
+QNNP_INTERNAL extern const size_t qnnp_q8avgpool_ukernels_count;
+
+QNNP_INTERNAL extern const struct qnnp_q8gavgpool_ukernel qnnp_q8gavgpool_ukernels[];
+QNNP_INTERNAL extern const size_t qnnp_q8gavgpool_ukernels_count;
+
+QNNP_INTERNAL extern const struct qnnp_u8maxpool_ukernel qnnp_u8maxpool_ukernels[];
+QNNP_INTERNAL extern const size_t qnnp_u8maxpool_ukernels_count;
@@ -26,6 +26,9 @@ extern "C" {
       uint8_t* y);
 
 DECLARE_X8LUT_UKERNEL_FUNCTION(x8lut_ukernel__scalar)
+DECLARE_X8LUT_UKERNEL_FUNCTION(x8lut_ukernel__neon)
+DECLARE_X8LUT_UKERNEL_FUNCTION(x8lut_ukernel__ssse3)
+DECLARE_X8LUT_UKERNEL_FUNCTION(x8lut_ukernel__avx2)
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <qnnpack/params.h>
+#include <qnnpack/common.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DECLARE_XTRANSPOSE_UKERNEL_FUNCTION(fn_name) \
+  QNNP_INTERNAL void fn_name(                        \
+      size_t m,                                      \
+      size_t n,                                      \
+      const void* x,                                 \
+      size_t x_stride,                               \
+      void* y,                                       \
+      size_t y_stride);
+
+DECLARE_XTRANSPOSE_UKERNEL_FUNCTION(x8transpose_ukernel__neon)
+DECLARE_XTRANSPOSE_UKERNEL_FUNCTION(x8transpose_ukernel__sse2)
+DECLARE_XTRANSPOSE_UKERNEL_FUNCTION(x32transpose_ukernel__neon)
+DECLARE_XTRANSPOSE_UKERNEL_FUNCTION(x32transpose_ukernel__sse2)
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/compute.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+/* Kernels which handle a channel remainder step back by up to NR - 1 bytes from every row pointer, including zero */
+#define REDUCE_ZERO_OFFSET 16
+
+static enum qnnp_status create_reduce(
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    enum qnnp_ukernel_type ukernel_type,
+    const char* name,
+    qnnp_operator_t* reduce_out)
+{
+  qnnp_operator_t reduce_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("%s failed because QNNPACK is not properly initialized", name);
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (input_scale <= 0.0f || !isnormal(input_scale)) {
+    qnnp_log_error(
+      "failed to create reduce operator with %.7g input scale: scale must be finite and positive", input_scale);
+    goto error;
+  }
+
+  if (output_scale <= 0.0f || !isnormal(output_scale)) {
+    qnnp_log_error(
+      "failed to create reduce operator with %.7g output scale: scale must be finite and positive", output_scale);
+    goto error;
+  }
+
+  if (output_min >= output_max) {
+    qnnp_log_error(
+      "failed to create reduce operator with [%" PRIu8 ", %" PRIu8 "] output range: range min must be below range max",
+      output_min, output_max);
+    goto error;
+  }
+
+  status = qnnp_status_unsupported_parameter;
+
+  const float input_output_scale = input_scale / output_scale;
+  if (input_output_scale < 0x1.0p-8f || input_output_scale >= 0x1.0p+8f) {
+    qnnp_log_error(
+      "failed to create reduce operator with %.7g input-to-output scale ratio: "
+      "scale ratio must be in [2**-8, 2**8) range",
+      input_output_scale);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  reduce_op = qnnp_allocate_operator();
+  if (reduce_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  const size_t zero_size = REDUCE_ZERO_OFFSET + QNNP_REDUCE_CHANNEL_TILE;
+  void* zero_buffer = qnnp_operator_allocate_zero(reduce_op, zero_size * sizeof(uint8_t));
+  if (zero_buffer == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for zero padding", zero_size * sizeof(uint8_t));
+    goto error;
+  }
+  reduce_op->zero_buffer = zero_buffer;
+  reduce_op->zero_buffer_size = zero_size * sizeof(uint8_t);
+  reduce_op->zero_pointer = (void*) ((uintptr_t) zero_buffer + REDUCE_ZERO_OFFSET);
+
+  reduce_op->input_zero_point = input_zero_point;
+  reduce_op->output_zero_point = output_zero_point;
+  reduce_op->input_scale = input_scale;
+  reduce_op->output_scale = output_scale;
+  reduce_op->output_min = output_min;
+  reduce_op->output_max = output_max;
+  reduce_op->flags = flags;
+
+  reduce_op->ukernel_type = ukernel_type;
+  reduce_op->format = qnnp_format_quint8;
+
+  *reduce_out = reduce_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(reduce_op);
+  return status;
+}
+
+static enum qnnp_status setup_reduce(
+    qnnp_operator_t reduce_op,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const uint8_t* input,
+    uint8_t* output,
+    const char* name)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("%s failed because QNNPACK is not properly initialized", name);
+    return qnnp_status_uninitialized;
+  }
+
+  if (num_input_dims == 0 || num_input_dims > QNNP_MAX_TENSOR_DIMS) {
+    qnnp_log_error(
+      "failed to setup reduce operator with %zu input dimensions: number of dimensions must be in [1, %d] range",
+      num_input_dims, QNNP_MAX_TENSOR_DIMS);
+    return qnnp_status_invalid_parameter;
+  }
+
+  for (size_t i = 0; i < num_input_dims; i++) {
+    if (input_shape[i] == 0) {
+      qnnp_log_error("failed to setup reduce operator: input dimension #%zu is zero", i);
+      return qnnp_status_invalid_parameter;
+    }
+  }
+
+  if (num_reduction_axes == 0 || num_reduction_axes > num_input_dims) {
+    qnnp_log_error(
+      "failed to setup reduce operator with %zu reduction axes: number of reduction axes must be in [1, %zu] range",
+      num_reduction_axes, num_input_dims);
+    return qnnp_status_invalid_parameter;
+  }
+
+  bool reduced[QNNP_MAX_TENSOR_DIMS] = { false };
+  for (size_t i = 0; i < num_reduction_axes; i++) {
+    const size_t axis = reduction_axes[i];
+    if (axis >= num_input_dims) {
+      qnnp_log_error(
+        "failed to setup reduce operator with reduction axis %zu: axis must be below the number of dimensions (%zu)",
+        axis, num_input_dims);
+      return qnnp_status_invalid_parameter;
+    }
+    if (reduced[axis]) {
+      qnnp_log_error("failed to setup reduce operator: reduction axis %zu is specified more than once", axis);
+      return qnnp_status_invalid_parameter;
+    }
+    reduced[axis] = true;
+  }
+
+  /*
+   * Collapse the input into [outer, reduction, inner] shape. Kept dimensions of size 1 between reduced ones do not
+   * break contiguity of the reduced elements; any other kept dimension there does.
+   */
+  size_t first_reduced = num_input_dims;
+  size_t last_reduced = 0;
+  for (size_t i = 0; i < num_input_dims; i++) {
+    if (reduced[i]) {
+      first_reduced = first_reduced < i ? first_reduced : i;
+      last_reduced = i;
+    }
+  }
+  size_t outer_size = 1;
+  for (size_t i = 0; i < first_reduced; i++) {
+    outer_size *= input_shape[i];
+  }
+  size_t reduction_size = 1;
+  for (size_t i = first_reduced; i <= last_reduced; i++) {
+    if (!reduced[i] && input_shape[i] != 1) {
+      qnnp_log_error(
+        "failed to setup reduce operator: kept dimension #%zu of size %zu between reduced dimensions is unsupported",
+        i, input_shape[i]);
+      return qnnp_status_unsupported_parameter;
+    }
+    reduction_size *= input_shape[i];
+  }
+  size_t inner_size = 1;
+  for (size_t i = last_reduced + 1; i < num_input_dims; i++) {
+    inner_size *= input_shape[i];
+  }
+
+  /* Sums of up to 2**23 bytes fit into the 32-bit accumulators of the kernels */
+  if (reduction_size >= (size_t) (UINT32_C(1) << 23)) {
+    qnnp_log_error(
+      "failed to setup reduce operator with %zu reduced elements: number of reduced elements must be below 2**23",
+      reduction_size);
+    return qnnp_status_unsupported_parameter;
+  }
+
+  reduce_op->batch_size = outer_size;
+  reduce_op->input_width = reduction_size;
+  reduce_op->channels = inner_size;
+  reduce_op->input = input;
+  reduce_op->output = output;
+
+  const int32_t bias = -(int32_t) reduction_size * (int32_t) (uint32_t) reduce_op->input_zero_point;
+  float scale = reduce_op->input_scale / reduce_op->output_scale;
+  if (reduce_op->ukernel_type == qnnp_ukernel_type_reduce_mean) {
+    scale /= (float) reduction_size;
+  }
+  if (inner_size == 1) {
+    reduce_op->avgpool_quantization_params = qnnp_compute_scalar_avgpool_quantization_params(
+      bias, scale, reduce_op->output_zero_point, reduce_op->output_min, reduce_op->output_max);
+  } else {
+    reduce_op->avgpool_quantization_params = qnnp_compute_avgpool_quantization_params(
+      bias, scale, reduce_op->output_zero_point, reduce_op->output_min, reduce_op->output_max);
+  }
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_create_reduce_mean_nd_q8(
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* reduce_mean_out)
+{
+  return create_reduce(
+    input_zero_point, input_scale,
+    output_zero_point, output_scale,
+    output_min, output_max,
+    flags,
+    qnnp_ukernel_type_reduce_mean,
+    "qnnp_create_reduce_mean_nd_q8",
+    reduce_mean_out);
+}
+
+enum qnnp_status qnnp_setup_reduce_mean_nd_q8(
+    qnnp_operator_t reduce_mean,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_reduce(
+    reduce_mean,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    "qnnp_setup_reduce_mean_nd_q8");
+}
+
+enum qnnp_status qnnp_create_reduce_sum_nd_q8(
+    uint8_t input_zero_point,
+    float input_scale,
+    uint8_t output_zero_point,
+    float output_scale,
+    uint8_t output_min,
+    uint8_t output_max,
+    uint32_t flags,
+    qnnp_operator_t* reduce_sum_out)
+{
+  return create_reduce(
+    input_zero_point, input_scale,
+    output_zero_point, output_scale,
+    output_min, output_max,
+    flags,
+    qnnp_ukernel_type_reduce_sum,
+    "qnnp_create_reduce_sum_nd_q8",
+    reduce_sum_out);
+}
+
+enum qnnp_status qnnp_setup_reduce_sum_nd_q8(
+    qnnp_operator_t reduce_sum,
+    size_t num_reduction_axes,
+    const size_t* reduction_axes,
+    size_t num_input_dims,
+    const size_t* input_shape,
+    const uint8_t* input,
+    uint8_t* output,
+    pthreadpool_t threadpool)
+{
+  return setup_reduce(
+    reduce_sum,
+    num_reduction_axes, reduction_axes,
+    num_input_dims, input_shape,
+    input, output,
+    "qnnp_setup_reduce_sum_nd_q8");
+}
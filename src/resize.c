@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/common.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+#include <qnnpack/indirection.h>
+
+
+static enum qnnp_status create_resize(
+    size_t channels,
+    uint32_t flags,
+    enum qnnp_ukernel_type ukernel_type,
+    const char* operator_name,
+    qnnp_operator_t* resize_out)
+{
+  qnnp_operator_t resize = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_create_%s failed because QNNPACK is not properly initialized", operator_name);
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create resize operator with %zu channels: number of channels must be non-zero",
+      channels);
+    goto error;
+  }
+
+  if ((flags & ~(QNNP_FLAG_ALIGN_CORNERS | QNNP_FLAG_TENSORFLOW_LEGACY_MODE)) != 0) {
+    qnnp_log_error(
+      "failed to create resize operator with 0x%08" PRIx32 " flags: unsupported flags are set",
+      flags);
+    goto error;
+  }
+
+  if ((flags & QNNP_FLAG_ALIGN_CORNERS) && (flags & QNNP_FLAG_TENSORFLOW_LEGACY_MODE)) {
+    qnnp_log_error(
+      "failed to create resize operator with 0x%08" PRIx32 " flags: "
+      "QNNP_FLAG_ALIGN_CORNERS and QNNP_FLAG_TENSORFLOW_LEGACY_MODE are mutually exclusive",
+      flags);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  resize = qnnp_allocate_operator();
+  if (resize == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  resize->channels = channels;
+  resize->flags = flags;
+
+  resize->ukernel_type = ukernel_type;
+  resize->format = qnnp_format_quint8;
+
+  *resize_out = resize;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(resize);
+  return status;
+}
+
+static enum qnnp_status setup_resize(
+    qnnp_operator_t resize,
+    enum qnnp_ukernel_type ukernel_type,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("failed to setup resize operator: QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (resize->ukernel_type != ukernel_type) {
+    qnnp_log_error("failed to setup resize operator: operator type mismatch");
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup resize operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_width == 0 || input_height == 0) {
+    qnnp_log_error(
+      "failed to setup resize operator with %zux%zu input: input dimensions must be non-zero",
+      input_width, input_height);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_width == 0 || output_height == 0) {
+    qnnp_log_error(
+      "failed to setup resize operator with %zux%zu output: output dimensions must be non-zero",
+      output_width, output_height);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_pixel_stride < resize->channels || output_pixel_stride < resize->channels) {
+    qnnp_log_error(
+      "failed to setup resize operator with input stride %zu and output stride %zu: "
+      "strides must not be smaller than the number of channels (%zu)",
+      input_pixel_stride, output_pixel_stride, resize->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  /* The indirection buffer is valid only if it was built for the same input pointer, pixel stride, and dimensions */
+  size_t valid_batch_size = 0;
+  if (input == resize->last_input &&
+      input_pixel_stride == resize->input_pixel_stride &&
+      input_height == resize->last_input_height &&
+      input_width == resize->last_input_width &&
+      output_height == resize->last_output_height &&
+      output_width == resize->last_output_width)
+  {
+    valid_batch_size = resize->valid_batch_size;
+  }
+
+  resize->batch_size = batch_size;
+  resize->input_height = input_height;
+  resize->input_width = input_width;
+  resize->input = input;
+  resize->input_pixel_stride = input_pixel_stride;
+  resize->output_height = output_height;
+  resize->output_width = output_width;
+  resize->output = output;
+  resize->output_pixel_stride = output_pixel_stride;
+
+  if (batch_size <= valid_batch_size) {
+    return qnnp_status_success;
+  }
+
+  const size_t output_pixels = output_height * output_width;
+  const size_t pointers_per_pixel = ukernel_type == qnnp_ukernel_type_resize_bilinear ? 4 : 1;
+  const size_t indirection_buffer_size = sizeof(void*) * batch_size * output_pixels * pointers_per_pixel;
+
+  const void** indirection_buffer = (const void**) qnnp_operator_reallocate(resize, resize->indirection_buffer, indirection_buffer_size);
+  if (indirection_buffer == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for indirection buffer", indirection_buffer_size);
+    return qnnp_status_out_of_memory;
+  }
+  resize->indirection_buffer = indirection_buffer;
+  resize->indirection_buffer_size = indirection_buffer_size;
+
+  if (ukernel_type == qnnp_ukernel_type_resize_bilinear) {
+    if (valid_batch_size == 0) {
+      const size_t weights_size = sizeof(int16_t) * 2 * output_pixels;
+      void* weights = qnnp_operator_reallocate(resize, resize->packed_weights, weights_size);
+      if (weights == NULL) {
+        qnnp_log_error("failed to allocate %zu bytes for interpolation weights", weights_size);
+        return qnnp_status_out_of_memory;
+      }
+      resize->packed_weights = weights;
+      resize->packed_weights_size = weights_size;
+    }
+    qnnp_indirection_init_resize_bilinear2d(resize, valid_batch_size);
+  } else {
+    qnnp_indirection_init_resize_nearest2d(resize, valid_batch_size);
+  }
+
+  resize->last_input = input;
+  resize->last_input_height = input_height;
+  resize->last_input_width = input_width;
+  resize->last_output_height = output_height;
+  resize->last_output_width = output_width;
+  resize->valid_batch_size = max(valid_batch_size, batch_size);
+
+  return qnnp_status_success;
+}
+
+enum qnnp_status qnnp_create_resize_bilinear2d_nhwc_q8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* resize_out)
+{
+  return create_resize(
+    channels, flags, qnnp_ukernel_type_resize_bilinear, "resize_bilinear2d_nhwc_q8", resize_out);
+}
+
+enum qnnp_status qnnp_setup_resize_bilinear2d_nhwc_q8(
+    qnnp_operator_t resize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  return setup_resize(
+    resize, qnnp_ukernel_type_resize_bilinear,
+    batch_size, input_height, input_width, output_height, output_width,
+    input, input_pixel_stride, output, output_pixel_stride);
+}
+
+enum qnnp_status qnnp_create_resize_nearest2d_nhwc_x8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* resize_out)
+{
+  return create_resize(
+    channels, flags, qnnp_ukernel_type_resize_nearest, "resize_nearest2d_nhwc_x8", resize_out);
+}
+
+enum qnnp_status qnnp_setup_resize_nearest2d_nhwc_x8(
+    qnnp_operator_t resize,
+    size_t batch_size,
+    size_t input_height,
+    size_t input_width,
+    size_t output_height,
+    size_t output_width,
+    const uint8_t* input,
+    size_t input_pixel_stride,
+    uint8_t* output,
+    size_t output_pixel_stride,
+    pthreadpool_t threadpool)
+{
+  return setup_resize(
+    resize, qnnp_ukernel_type_resize_nearest,
+    batch_size, input_height, input_width, output_height, output_width,
+    input, input_pixel_stride, output, output_pixel_stride);
+}
@@ -13,6 +13,7 @@
 #include <stdlib.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/log.h>
 
@@ -81,17 +82,18 @@ enum qnnp_status qnnp_create_sigmoid_nc_q8(
 
   status = qnnp_status_out_of_memory;
 
-  sigmoid_op = calloc(1, sizeof(struct qnnp_operator));
+  sigmoid_op = qnnp_allocate_operator();
   if (sigmoid_op == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
   }
 
-  sigmoid_op->lookup_table = malloc(256 * sizeof(uint8_t));
+  sigmoid_op->lookup_table = qnnp_operator_allocate(sigmoid_op, 256 * sizeof(uint8_t));
   if (sigmoid_op->lookup_table == NULL) {
     qnnp_log_error("failed to allocate 256 bytes for Sigmoid lookup table");
     goto error;
   }
+  sigmoid_op->lookup_table_size = 256 * sizeof(uint8_t);
 
   uint8_t* lookup_table = sigmoid_op->lookup_table;
   const float scaled_min = (float) (int32_t) output_min;
@@ -13,6 +13,7 @@
 #include <stdlib.h>
 
 #include <qnnpack.h>
+#include <qnnpack/allocator.h>
 #include <qnnpack/operator.h>
 #include <qnnpack/log.h>
 
@@ -53,44 +54,35 @@ enum qnnp_status qnnp_create_softargmax_nc_q8(
     goto error;
   }
 
-  status = qnnp_status_unsupported_parameter;
-
-  if (output_scale != 0x1.0p-8f) {
-    qnnp_log_error(
-      "failed to create Soft ArgMax operator with %.7g output scale: only output scale of 1/256 is supported",
-      output_scale);
-    goto error;
-  }
-
-  if (output_zero_point != 0) {
-    qnnp_log_error(
-      "failed to create Soft ArgMax operator with %" PRIu8 " output zero point: only output zero point of 0 is supported",
-      output_zero_point);
-    goto error;
-  }
-
   status = qnnp_status_out_of_memory;
 
-  softargmax_op = calloc(1, sizeof(struct qnnp_operator));
+  softargmax_op = qnnp_allocate_operator();
   if (softargmax_op == NULL) {
     qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
     goto error;
   }
 
-  softargmax_op->lookup_table = malloc(256 * sizeof(uint32_t));
+  softargmax_op->lookup_table = qnnp_operator_allocate(softargmax_op, 256 * sizeof(uint32_t));
   if (softargmax_op->lookup_table == NULL) {
     qnnp_log_error("failed to allocate 256 bytes for Soft ArgMax lookup table");
     goto error;
   }
+  softargmax_op->lookup_table_size = 256 * sizeof(uint32_t);
 
+  /*
+   * Kernels divide (t << 8) by (sum * output_scale * 256) in 32-bit arithmetic: entries below 2**22 and a divisor
+   * of at most 2**31 keep the rounded numerator below 2**31.
+   */
   uint32_t* lookup_table = softargmax_op->lookup_table;
-  const double qscale = fmin(((double) UINT32_MAX) / (double) channels, 8388607.0);
+  const double divisor_scale = fmax((double) output_scale * 256.0, 1.0);
+  const double qscale = fmax(fmin(floor(2147483648.0 / ((double) channels * divisor_scale)), 4194303.0), 1.0);
   for (int32_t i = 0; i < 256; i++) {
     const double scaled_exp_xi = qscale * exp((double) (i - 255) * (double) input_scale);
     lookup_table[(uint32_t) i] = (uint32_t) lrint(scaled_exp_xi);
   }
 
   softargmax_op->channels = channels;
+  softargmax_op->softargmax_params = qnnp_compute_softargmax_params(output_zero_point, output_scale);
 
   softargmax_op->ukernel_type = qnnp_ukernel_type_softargmax;
   softargmax_op->format = qnnp_format_quint8;
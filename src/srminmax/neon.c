@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/srminmax.h>
+
+
+void srminmax_ukernel__neon(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+
+  float32x2_t vmin = vld1_dup_f32(x);
+  float32x2_t vmax = vmin;
+  if QNNP_LIKELY(n >= 8) {
+    float32x4_t vmin0123 = vcombine_f32(vmin, vmin);
+    float32x4_t vmax0123 = vmin0123;
+    float32x4_t vmin4567 = vmin0123;
+    float32x4_t vmax4567 = vmin0123;
+    do {
+      const float32x4_t vx0123 = vld1q_f32(x);
+      const float32x4_t vx4567 = vld1q_f32(x + 4);
+      x += 8;
+
+      vmin0123 = vminq_f32(vmin0123, vx0123);
+      vmax0123 = vmaxq_f32(vmax0123, vx0123);
+      vmin4567 = vminq_f32(vmin4567, vx4567);
+      vmax4567 = vmaxq_f32(vmax4567, vx4567);
+      n -= 8;
+    } while (n >= 8);
+    vmin0123 = vminq_f32(vmin0123, vmin4567);
+    vmax0123 = vmaxq_f32(vmax0123, vmax4567);
+    vmin = vpmin_f32(vget_low_f32(vmin0123), vget_high_f32(vmin0123));
+    vmax = vpmax_f32(vget_low_f32(vmax0123), vget_high_f32(vmax0123));
+    vmin = vpmin_f32(vmin, vmin);
+    vmax = vpmax_f32(vmax, vmax);
+  }
+  for (; n != 0; n--) {
+    const float32x2_t vx = vld1_dup_f32(x++);
+    vmin = vmin_f32(vmin, vx);
+    vmax = vmax_f32(vmax, vx);
+  }
+  vst1_lane_f32(y, vmin, 0);
+  vst1_lane_f32(y + 1, vmax, 0);
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/srminmax.h>
+
+
+void srminmax_ukernel__sse2(
+    size_t n,
+    const float* x,
+    float* y)
+{
+  assert(n != 0);
+
+  __m128 vmin = _mm_load_ss(x);
+  vmin = _mm_shuffle_ps(vmin, vmin, _MM_SHUFFLE(0, 0, 0, 0));
+  __m128 vmax = vmin;
+  if QNNP_LIKELY(n >= 8) {
+    __m128 vmin4567 = vmin;
+    __m128 vmax4567 = vmax;
+    do {
+      const __m128 vx0123 = _mm_loadu_ps(x);
+      const __m128 vx4567 = _mm_loadu_ps(x + 4);
+      x += 8;
+
+      vmin = _mm_min_ps(vmin, vx0123);
+      vmax = _mm_max_ps(vmax, vx0123);
+      vmin4567 = _mm_min_ps(vmin4567, vx4567);
+      vmax4567 = _mm_max_ps(vmax4567, vx4567);
+      n -= 8;
+    } while (n >= 8);
+    vmin = _mm_min_ps(vmin, vmin4567);
+    vmax = _mm_max_ps(vmax, vmax4567);
+    vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+    vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+    vmin = _mm_min_ss(vmin, _mm_shuffle_ps(vmin, vmin, _MM_SHUFFLE(1, 1, 1, 1)));
+    vmax = _mm_max_ss(vmax, _mm_shuffle_ps(vmax, vmax, _MM_SHUFFLE(1, 1, 1, 1)));
+  }
+  for (; n != 0; n--) {
+    const __m128 vx = _mm_load_ss(x++);
+    vmin = _mm_min_ss(vmin, vx);
+    vmax = _mm_max_ss(vmax, vx);
+  }
+  _mm_store_ss(y, vmin);
+  _mm_store_ss(y + 1, vmax);
+}
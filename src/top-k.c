@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/params.h>
+
+
+static enum qnnp_status create_top_k(
+    size_t channels,
+    size_t k,
+    uint32_t flags,
+    const char* name,
+    qnnp_operator_t* top_k_out)
+{
+  qnnp_operator_t top_k_op = NULL;
+  enum qnnp_status status = qnnp_status_uninitialized;
+
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("%s failed because QNNPACK is not properly initialized", name);
+    goto error;
+  }
+
+  status = qnnp_status_invalid_parameter;
+
+  if (channels == 0) {
+    qnnp_log_error(
+      "failed to create Top-K operator with %zu channels: number of channels must be non-zero", channels);
+    goto error;
+  }
+
+  if (k == 0 || k > channels) {
+    qnnp_log_error(
+      "failed to create Top-K operator with K = %zu: K must be in [1, %zu] range", k, channels);
+    goto error;
+  }
+
+  if (channels > UINT32_MAX) {
+    qnnp_log_error(
+      "failed to create Top-K operator with %zu channels: channel indices must fit into 32 bits", channels);
+    goto error;
+  }
+
+  status = qnnp_status_out_of_memory;
+
+  top_k_op = qnnp_allocate_operator();
+  if (top_k_op == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for qnnp_operator structure", sizeof(struct qnnp_operator));
+    goto error;
+  }
+
+  top_k_op->channels = channels;
+  top_k_op->top_k = k;
+  top_k_op->flags = flags;
+
+  top_k_op->ukernel_type = qnnp_ukernel_type_top_k;
+  top_k_op->format = qnnp_format_quint8;
+
+  *top_k_out = top_k_op;
+  return qnnp_status_success;
+
+error:
+  qnnp_delete_operator(top_k_op);
+  return status;
+}
+
+enum qnnp_status qnnp_create_argmax_nc_u8(
+    size_t channels,
+    uint32_t flags,
+    qnnp_operator_t* argmax_out)
+{
+  return create_top_k(channels, 1, flags, "qnnp_create_argmax_nc_u8", argmax_out);
+}
+
+enum qnnp_status qnnp_setup_argmax_nc_u8(
+    qnnp_operator_t argmax,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint32_t* output)
+{
+  return qnnp_setup_top_k_nc_u8(argmax, batch_size, input, input_stride, NULL, 0, output, 1);
+}
+
+enum qnnp_status qnnp_create_top_k_nc_u8(
+    size_t channels,
+    size_t k,
+    uint32_t flags,
+    qnnp_operator_t* top_k_out)
+{
+  return create_top_k(channels, k, flags, "qnnp_create_top_k_nc_u8", top_k_out);
+}
+
+enum qnnp_status qnnp_setup_top_k_nc_u8(
+    qnnp_operator_t top_k,
+    size_t batch_size,
+    const uint8_t* input,
+    size_t input_stride,
+    uint8_t* output_values,
+    size_t output_values_stride,
+    uint32_t* output_indices,
+    size_t output_indices_stride)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_setup_top_k_nc_u8 failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (batch_size == 0) {
+    qnnp_log_error("failed to setup Top-K operator with batch size %zu: batch size must be non-zero", batch_size);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (input_stride < top_k->channels) {
+    qnnp_log_error(
+      "failed to setup Top-K operator with input stride %zu: input stride must be at least the number of channels (%zu)",
+      input_stride, top_k->channels);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_indices == NULL) {
+    qnnp_log_error("failed to setup Top-K operator: output indices must be non-NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_indices_stride < top_k->top_k) {
+    qnnp_log_error(
+      "failed to setup Top-K operator with output indices stride %zu: output indices stride must be at least K (%zu)",
+      output_indices_stride, top_k->top_k);
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (output_values != NULL && output_values_stride < top_k->top_k) {
+    qnnp_log_error(
+      "failed to setup Top-K operator with output values stride %zu: output values stride must be at least K (%zu)",
+      output_values_stride, top_k->top_k);
+    return qnnp_status_invalid_parameter;
+  }
+
+  top_k->batch_size = batch_size;
+  top_k->input = input;
+  top_k->input_pixel_stride = input_stride;
+  top_k->output = output_values;
+  top_k->output_pixel_stride = output_values_stride;
+  top_k->output2 = output_indices;
+  top_k->output2_pixel_stride = output_indices_stride;
+
+  return qnnp_status_success;
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/u8ibilinear.h>
+
+
+void u8ibilinear_ukernel_c16__avx2(
+    size_t n,
+    size_t c,
+    const uint8_t** x,
+    const int16_t* w,
+    uint8_t* y,
+    size_t y_increment)
+{
+  assert(n != 0);
+  assert(c != 0);
+
+  const __m256i vrounding_h = _mm256_set1_epi32(8);
+  const __m256i vrounding_v = _mm256_set1_epi32(0x20000);
+  do {
+    const uint8_t* i0 = x[0];
+    const uint8_t* i1 = x[1];
+    const uint8_t* i2 = x[2];
+    const uint8_t* i3 = x[3];
+    x += 4;
+    const int32_t valphah = (int32_t) w[0];
+    const int32_t valphav = (int32_t) w[1];
+    w += 2;
+
+    /* Weights are interleaved with 2048 (1.0 in Q11), so that one PMADDWD computes x0 * 2048 + (x1 - x0) * alpha */
+    const __m256i vweights_h = _mm256_set1_epi32((int32_t) (((uint32_t) (uint16_t) valphah << 16) | UINT32_C(2048)));
+    const __m256i vweights_v = _mm256_set1_epi32((int32_t) (((uint32_t) (uint16_t) valphav << 16) | UINT32_C(2048)));
+
+    size_t k = c;
+    for (; k >= 16; k -= 16) {
+      const __m256i vtl = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i0)); i0 += 16;
+      const __m256i vtr = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i1)); i1 += 16;
+      const __m256i vbl = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i2)); i2 += 16;
+      const __m256i vbr = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*) i3)); i3 += 16;
+
+      const __m256i vtd = _mm256_sub_epi16(vtr, vtl);
+      const __m256i vbd = _mm256_sub_epi16(vbr, vbl);
+
+      /* Unpacks and packs operate within 128-bit lanes, so their combination keeps the channel order */
+      const __m256i vt_lo = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(vtl, vtd), vweights_h), vrounding_h), 4);
+      const __m256i vt_hi = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(vtl, vtd), vweights_h), vrounding_h), 4);
+      const __m256i vb_lo = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(vbl, vbd), vweights_h), vrounding_h), 4);
+      const __m256i vb_hi = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(vbl, vbd), vweights_h), vrounding_h), 4);
+      const __m256i vt = _mm256_packs_epi32(vt_lo, vt_hi);
+      const __m256i vb = _mm256_packs_epi32(vb_lo, vb_hi);
+      const __m256i vd = _mm256_sub_epi16(vb, vt);
+
+      const __m256i vacc_lo = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(_mm256_unpacklo_epi16(vt, vd), vweights_v), vrounding_v), 18);
+      const __m256i vacc_hi = _mm256_srai_epi32(_mm256_add_epi32(_mm256_madd_epi16(_mm256_unpackhi_epi16(vt, vd), vweights_v), vrounding_v), 18);
+      const __m256i vacc = _mm256_packs_epi32(vacc_lo, vacc_hi);
+      _mm_storeu_si128((__m128i*) y, _mm_packus_epi16(_mm256_castsi256_si128(vacc), _mm256_extracti128_si256(vacc, 1))); y += 16;
+    }
+    if (k >= 8) {
+      const __m128i vweights_h128 = _mm256_castsi256_si128(vweights_h);
+      const __m128i vweights_v128 = _mm256_castsi256_si128(vweights_v);
+      const __m128i vrounding_h128 = _mm256_castsi256_si128(vrounding_h);
+      const __m128i vrounding_v128 = _mm256_castsi256_si128(vrounding_v);
+
+      const __m128i vtl = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i0)); i0 += 8;
+      const __m128i vtr = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i1)); i1 += 8;
+      const __m128i vbl = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i2)); i2 += 8;
+      const __m128i vbr = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*) i3)); i3 += 8;
+
+      const __m128i vtd = _mm_sub_epi16(vtr, vtl);
+      const __m128i vbd = _mm_sub_epi16(vbr, vbl);
+
+      const __m128i vt_lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(vtl, vtd), vweights_h128), vrounding_h128), 4);
+      const __m128i vt_hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(vtl, vtd), vweights_h128), vrounding_h128), 4);
+      const __m128i vb_lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(vbl, vbd), vweights_h128), vrounding_h128), 4);
+      const __m128i vb_hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(vbl, vbd), vweights_h128), vrounding_h128), 4);
+      const __m128i vt = _mm_packs_epi32(vt_lo, vt_hi);
+      const __m128i vb = _mm_packs_epi32(vb_lo, vb_hi);
+      const __m128i vd = _mm_sub_epi16(vb, vt);
+
+      const __m128i vacc_lo = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(vt, vd), vweights_v128), vrounding_v128), 18);
+      const __m128i vacc_hi = _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(vt, vd), vweights_v128), vrounding_v128), 18);
+      const __m128i vacc = _mm_packs_epi32(vacc_lo, vacc_hi);
+      _mm_storel_epi64((__m128i*) y, _mm_packus_epi16(vacc, vacc)); y += 8;
+      k -= 8;
+    }
+    for (; k != 0; k--) {
+      const int32_t vtl = (int32_t) *i0++;
+      const int32_t vtr = (int32_t) *i1++;
+      const int32_t vbl = (int32_t) *i2++;
+      const int32_t vbr = (int32_t) *i3++;
+      const int32_t vt = ((vtl << 11) + (vtr - vtl) * valphah + 8) >> 4;
+      const int32_t vb = ((vbl << 11) + (vbr - vbl) * valphah + 8) >> 4;
+      const int32_t vacc = (vt << 11) + (vb - vt) * valphav;
+      *y++ = (uint8_t) ((vacc + INT32_C(0x20000)) >> 18);
+    }
+    y += y_increment;
+  } while (--n != 0);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/u8ibilinear.h>
+
+
+void u8ibilinear_ukernel_c8__neon(
+    size_t n,
+    size_t c,
+    const uint8_t** x,
+    const int16_t* w,
+    uint8_t* y,
+    size_t y_increment)
+{
+  assert(n != 0);
+  assert(c != 0);
+
+  do {
+    const uint8_t* i0 = x[0];
+    const uint8_t* i1 = x[1];
+    const uint8_t* i2 = x[2];
+    const uint8_t* i3 = x[3];
+    x += 4;
+    const int32_t valphah = (int32_t) w[0];
+    const int32_t valphav = (int32_t) w[1];
+    w += 2;
+
+    const int16x4_t valphah_x4 = vdup_n_s16((int16_t) valphah);
+    const int16x4_t valphav_x4 = vdup_n_s16((int16_t) valphav);
+
+    size_t k = c;
+    for (; k >= 8; k -= 8) {
+      const int16x8_t vtl = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(i0))); i0 += 8;
+      const int16x8_t vtr = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(i1))); i1 += 8;
+      const int16x8_t vbl = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(i2))); i2 += 8;
+      const int16x8_t vbr = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(i3))); i3 += 8;
+
+      const int16x8_t vtd = vsubq_s16(vtr, vtl);
+      const int16x8_t vbd = vsubq_s16(vbr, vbl);
+
+      /* Horizontal interpolation in Q11, rounded to Q7 to fit into 16 bits */
+      const int32x4_t vt_lo = vmlal_s16(vshll_n_s16(vget_low_s16(vtl), 11), vget_low_s16(vtd), valphah_x4);
+      const int32x4_t vt_hi = vmlal_s16(vshll_n_s16(vget_high_s16(vtl), 11), vget_high_s16(vtd), valphah_x4);
+      const int32x4_t vb_lo = vmlal_s16(vshll_n_s16(vget_low_s16(vbl), 11), vget_low_s16(vbd), valphah_x4);
+      const int32x4_t vb_hi = vmlal_s16(vshll_n_s16(vget_high_s16(vbl), 11), vget_high_s16(vbd), valphah_x4);
+      const int16x8_t vt = vcombine_s16(vrshrn_n_s32(vt_lo, 4), vrshrn_n_s32(vt_hi, 4));
+      const int16x8_t vb = vcombine_s16(vrshrn_n_s32(vb_lo, 4), vrshrn_n_s32(vb_hi, 4));
+      const int16x8_t vd = vsubq_s16(vb, vt);
+
+      /* Vertical interpolation in Q18 */
+      const int32x4_t vacc_lo = vrshrq_n_s32(vmlal_s16(vshll_n_s16(vget_low_s16(vt), 11), vget_low_s16(vd), valphav_x4), 18);
+      const int32x4_t vacc_hi = vrshrq_n_s32(vmlal_s16(vshll_n_s16(vget_high_s16(vt), 11), vget_high_s16(vd), valphav_x4), 18);
+      const int16x8_t vacc = vcombine_s16(vmovn_s32(vacc_lo), vmovn_s32(vacc_hi));
+      vst1_u8(y, vqmovun_s16(vacc)); y += 8;
+    }
+    for (; k != 0; k--) {
+      const int32_t vtl = (int32_t) *i0++;
+      const int32_t vtr = (int32_t) *i1++;
+      const int32_t vbl = (int32_t) *i2++;
+      const int32_t vbr = (int32_t) *i3++;
+      const int32_t vt = ((vtl << 11) + (vtr - vtl) * valphah + 8) >> 4;
+      const int32_t vb = ((vbl << 11) + (vbr - vbl) * valphah + 8) >> 4;
+      const int32_t vacc = (vt << 11) + (vb - vt) * valphav;
+      *y++ = (uint8_t) ((vacc + INT32_C(0x20000)) >> 18);
+    }
+    y += y_increment;
+  } while (--n != 0);
+}
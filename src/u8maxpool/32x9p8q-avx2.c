@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/u8maxpool.h>
+
+
+void u8maxpool_ukernel_32x9p8q__avx2(
+    size_t n,
+    size_t ks,
+    size_t kc,
+    const uint8_t** input,
+    uint8_t* output,
+    size_t input_increment,
+    size_t output_increment,
+    const union qnnp_u8_clamping_params params[restrict static 1])
+{
+  assert(n != 0);
+  assert(ks != 0);
+  assert(kc >= 32);
+
+  const __m256i voutput_max = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.output_max));
+  const __m256i voutput_min = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*) params->sse2.output_min));
+
+  do {
+    uint8_t* o = output;
+    {
+      const uint8_t* i0 = *input++;
+      const uint8_t* i1 = *input++;
+      const uint8_t* i2 = *input++;
+      const uint8_t* i3 = *input++;
+      const uint8_t* i4 = *input++;
+      const uint8_t* i5 = *input++;
+      const uint8_t* i6 = *input++;
+      const uint8_t* i7 = *input++;
+      const uint8_t* i8 = *input++;
+      if (ks < 2) {
+        i1 = i0;
+      }
+      if (ks <= 2) {
+        i2 = i0;
+      }
+      if (ks < 4) {
+        i3 = i0;
+      }
+      if (ks <= 4) {
+        i4 = i0;
+      }
+      if (ks < 6) {
+        i5 = i0;
+      }
+      if (ks <= 6) {
+        i6 = i0;
+      }
+      if (ks < 8) {
+        i7 = i0;
+      }
+      if (ks <= 8) {
+        i8 = i0;
+      }
+
+      size_t k = kc;
+      while (k >= 32) {
+        const __m256i vi0 = _mm256_loadu_si256((const __m256i*) i0); i0 += 32;
+        const __m256i vi1 = _mm256_loadu_si256((const __m256i*) i1); i1 += 32;
+        const __m256i vi2 = _mm256_loadu_si256((const __m256i*) i2); i2 += 32;
+        const __m256i vi3 = _mm256_loadu_si256((const __m256i*) i3); i3 += 32;
+        const __m256i vi4 = _mm256_loadu_si256((const __m256i*) i4); i4 += 32;
+        const __m256i vi5 = _mm256_loadu_si256((const __m256i*) i5); i5 += 32;
+        const __m256i vi6 = _mm256_loadu_si256((const __m256i*) i6); i6 += 32;
+        const __m256i vi7 = _mm256_loadu_si256((const __m256i*) i7); i7 += 32;
+        const __m256i vi8 = _mm256_loadu_si256((const __m256i*) i8); i8 += 32;
+
+        const __m256i vmax018 = _mm256_max_epu8(_mm256_max_epu8(vi0, vi1), vi8);
+        const __m256i vmax23 = _mm256_max_epu8(vi2, vi3);
+        const __m256i vmax45 = _mm256_max_epu8(vi4, vi5);
+        const __m256i vmax67 = _mm256_max_epu8(vi6, vi7);
+
+        const __m256i vmax2345 = _mm256_max_epu8(vmax23, vmax45);
+        const __m256i vmax01678 = _mm256_max_epu8(vmax018, vmax67);
+        const __m256i vmax = _mm256_max_epu8(vmax2345, vmax01678);
+        const __m256i vout = _mm256_max_epu8(_mm256_min_epu8(vmax, voutput_max), voutput_min);
+
+        _mm256_storeu_si256((__m256i*) o, vout); o += 32;
+
+        k -= 32;
+      }
+      if (k != 0) {
+        const size_t address_increment = k - 32;
+        i0 = (const uint8_t*) ((uintptr_t) i0 + address_increment);
+        i1 = (const uint8_t*) ((uintptr_t) i1 + address_increment);
+        i2 = (const uint8_t*) ((uintptr_t) i2 + address_increment);
+        i3 = (const uint8_t*) ((uintptr_t) i3 + address_increment);
+        i4 = (const uint8_t*) ((uintptr_t) i4 + address_increment);
+        i5 = (const uint8_t*) ((uintptr_t) i5 + address_increment);
+        i6 = (const uint8_t*) ((uintptr_t) i6 + address_increment);
+        i7 = (const uint8_t*) ((uintptr_t) i7 + address_increment);
+        i8 = (const uint8_t*) ((uintptr_t) i8 + address_increment);
+        o = (uint8_t*) ((uintptr_t) o + address_increment);
+
+        const __m256i vi0 = _mm256_loadu_si256((const __m256i*) i0);
+        const __m256i vi1 = _mm256_loadu_si256((const __m256i*) i1);
+        const __m256i vi2 = _mm256_loadu_si256((const __m256i*) i2);
+        const __m256i vi3 = _mm256_loadu_si256((const __m256i*) i3);
+        const __m256i vi4 = _mm256_loadu_si256((const __m256i*) i4);
+        const __m256i vi5 = _mm256_loadu_si256((const __m256i*) i5);
+        const __m256i vi6 = _mm256_loadu_si256((const __m256i*) i6);
+        const __m256i vi7 = _mm256_loadu_si256((const __m256i*) i7);
+        const __m256i vi8 = _mm256_loadu_si256((const __m256i*) i8);
+
+        const __m256i vmax018 = _mm256_max_epu8(_mm256_max_epu8(vi0, vi1), vi8);
+        const __m256i vmax23 = _mm256_max_epu8(vi2, vi3);
+        const __m256i vmax45 = _mm256_max_epu8(vi4, vi5);
+        const __m256i vmax67 = _mm256_max_epu8(vi6, vi7);
+
+        const __m256i vmax2345 = _mm256_max_epu8(vmax23, vmax45);
+        const __m256i vmax01678 = _mm256_max_epu8(vmax018, vmax67);
+        const __m256i vmax = _mm256_max_epu8(vmax2345, vmax01678);
+        const __m256i vout = _mm256_max_epu8(_mm256_min_epu8(vmax, voutput_max), voutput_min);
+
+        _mm256_storeu_si256((__m256i*) o, vout);
+        o += 32;
+      }
+    }
+
+    for (ptrdiff_t m = (ptrdiff_t) ks - 9; m > 0; m -= 8) {
+      const uint8_t* i0 = *input++;
+      const uint8_t* i1 = *input++;
+      const uint8_t* i2 = *input++;
+      const uint8_t* i3 = *input++;
+      const uint8_t* i4 = *input++;
+      const uint8_t* i5 = *input++;
+      const uint8_t* i6 = *input++;
+      const uint8_t* i7 = *input++;
+      if (m < 2) {
+        i1 = i0;
+      }
+      if (m <= 2) {
+        i2 = i0;
+      }
+      if (m < 4) {
+        i3 = i0;
+      }
+      if (m <= 4) {
+        i4 = i0;
+      }
+      if (m < 6) {
+        i5 = i0;
+      }
+      if (m <= 6) {
+        i6 = i0;
+      }
+      if (m < 8) {
+        i7 = i0;
+      }
+
+      o = output;
+      size_t k = kc;
+      while (k >= 32) {
+        const __m256i vi0 = _mm256_loadu_si256((const __m256i*) i0); i0 += 32;
+        const __m256i vi1 = _mm256_loadu_si256((const __m256i*) i1); i1 += 32;
+        const __m256i vi2 = _mm256_loadu_si256((const __m256i*) i2); i2 += 32;
+        const __m256i vi3 = _mm256_loadu_si256((const __m256i*) i3); i3 += 32;
+        const __m256i vi4 = _mm256_loadu_si256((const __m256i*) i4); i4 += 32;
+        const __m256i vi5 = _mm256_loadu_si256((const __m256i*) i5); i5 += 32;
+        const __m256i vi6 = _mm256_loadu_si256((const __m256i*) i6); i6 += 32;
+        const __m256i vi7 = _mm256_loadu_si256((const __m256i*) i7); i7 += 32;
+        const __m256i vo = _mm256_loadu_si256((const __m256i*) o);
+
+        const __m256i vmax01 = _mm256_max_epu8(_mm256_max_epu8(vi0, vi1), vo);
+        const __m256i vmax23 = _mm256_max_epu8(vi2, vi3);
+        const __m256i vmax45 = _mm256_max_epu8(vi4, vi5);
+        const __m256i vmax67 = _mm256_max_epu8(vi6, vi7);
+
+        const __m256i vmax2345 = _mm256_max_epu8(vmax23, vmax45);
+        const __m256i vmax0167 = _mm256_max_epu8(vmax01, vmax67);
+        const __m256i vmax = _mm256_max_epu8(vmax2345, vmax0167);
+        const __m256i vout = _mm256_max_epu8(_mm256_min_epu8(vmax, voutput_max), voutput_min);
+
+        _mm256_storeu_si256((__m256i*) o, vout);
+        o += 32;
+
+        k -= 32;
+      }
+      if (k != 0) {
+        const size_t address_increment = k - 32;
+        i0 = (const uint8_t*) ((uintptr_t) i0 + address_increment);
+        i1 = (const uint8_t*) ((uintptr_t) i1 + address_increment);
+        i2 = (const uint8_t*) ((uintptr_t) i2 + address_increment);
+        i3 = (const uint8_t*) ((uintptr_t) i3 + address_increment);
+        i4 = (const uint8_t*) ((uintptr_t) i4 + address_increment);
+        i5 = (const uint8_t*) ((uintptr_t) i5 + address_increment);
+        i6 = (const uint8_t*) ((uintptr_t) i6 + address_increment);
+        i7 = (const uint8_t*) ((uintptr_t) i7 + address_increment);
+        o = (uint8_t*) ((uintptr_t) o + address_increment);
+
+        const __m256i vi0 = _mm256_loadu_si256((const __m256i*) i0);
+        const __m256i vi1 = _mm256_loadu_si256((const __m256i*) i1);
+        const __m256i vi2 = _mm256_loadu_si256((const __m256i*) i2);
+        const __m256i vi3 = _mm256_loadu_si256((const __m256i*) i3);
+        const __m256i vi4 = _mm256_loadu_si256((const __m256i*) i4);
+        const __m256i vi5 = _mm256_loadu_si256((const __m256i*) i5);
+        const __m256i vi6 = _mm256_loadu_si256((const __m256i*) i6);
+        const __m256i vi7 = _mm256_loadu_si256((const __m256i*) i7);
+        const __m256i vo = _mm256_loadu_si256((const __m256i*) o);
+
+        const __m256i vmax01 = _mm256_max_epu8(_mm256_max_epu8(vi0, vi1), vo);
+        const __m256i vmax23 = _mm256_max_epu8(vi2, vi3);
+        const __m256i vmax45 = _mm256_max_epu8(vi4, vi5);
+        const __m256i vmax67 = _mm256_max_epu8(vi6, vi7);
+
+        const __m256i vmax2345 = _mm256_max_epu8(vmax23, vmax45);
+        const __m256i vmax0167 = _mm256_max_epu8(vmax01, vmax67);
+        const __m256i vmax = _mm256_max_epu8(vmax2345, vmax0167);
+        const __m256i vout = _mm256_max_epu8(_mm256_min_epu8(vmax, voutput_max), voutput_min);
+
+        _mm256_storeu_si256((__m256i*) o, vout);
+        o += 32;
+      }
+    }
+    input = (const uint8_t**) ((uintptr_t) input + input_increment);
+    output = (uint8_t*) ((uintptr_t) o + output_increment);
+  } while (--n != 0);
+}
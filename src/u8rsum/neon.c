@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/u8rsum.h>
+
+
+uint32_t u8rsum_ukernel__neon(
+    size_t n,
+    const uint8_t* x)
+{
+  assert(n != 0);
+
+  uint32_t vsum = 0;
+  if QNNP_LIKELY(n >= 16) {
+    uint32x4_t vacc = vmovq_n_u32(0);
+    do {
+      const uint8x16_t vx = vld1q_u8(x); x += 16;
+      vacc = vpadalq_u16(vacc, vpaddlq_u8(vx));
+      n -= 16;
+    } while (n >= 16);
+    const uint64x2_t vacc2 = vpaddlq_u32(vacc);
+    vsum = (uint32_t) (vgetq_lane_u64(vacc2, 0) + vgetq_lane_u64(vacc2, 1));
+  }
+  while (n != 0) {
+    vsum += (uint32_t) *x++;
+    n--;
+  }
+  return vsum;
+}
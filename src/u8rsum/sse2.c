@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/u8rsum.h>
+
+
+uint32_t u8rsum_ukernel__sse2(
+    size_t n,
+    const uint8_t* x)
+{
+  assert(n != 0);
+
+  uint32_t vsum = 0;
+  if QNNP_LIKELY(n >= 16) {
+    /* PSADBW against zero sums each half of the vector into a 64-bit lane */
+    const __m128i vzero = _mm_setzero_si128();
+    __m128i vacc = _mm_setzero_si128();
+    do {
+      const __m128i vx = _mm_loadu_si128((const __m128i*) x);
+      x += 16;
+      vacc = _mm_add_epi32(vacc, _mm_sad_epu8(vx, vzero));
+      n -= 16;
+    } while (n >= 16);
+    vacc = _mm_add_epi32(vacc, _mm_unpackhi_epi64(vacc, vacc));
+    vsum = (uint32_t) _mm_cvtsi128_si32(vacc);
+  }
+  while (n != 0) {
+    vsum += (uint32_t) *x++;
+    n--;
+  }
+  return vsum;
+}
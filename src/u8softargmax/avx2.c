@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/common.h>
+#include <qnnpack/u8softargmax.h>
+
+
+static inline uint8_t compute_max(
+    size_t n,
+    const uint8_t* x)
+{
+  if QNNP_LIKELY(n >= 32) {
+    __m256i vmax = _mm256_setzero_si256();
+    do {
+      const __m256i vx = _mm256_loadu_si256((const __m256i*) x);
+      x += 32;
+      vmax = _mm256_max_epu8(vmax, vx);
+      n -= 32;
+    } while (n >= 32);
+    if (n != 0) {
+      const size_t x_increment = n - 32;
+      x = (const uint8_t*) ((uintptr_t) x + x_increment);
+      const __m256i vx = _mm256_loadu_si256((const __m256i*) x);
+      vmax = _mm256_max_epu8(vmax, vx);
+    }
+    __m128i vmax128 = _mm_max_epu8(_mm256_castsi256_si128(vmax), _mm256_extracti128_si256(vmax, 1));
+    vmax128 = _mm_max_epu8(vmax128, _mm_unpackhi_epi64(vmax128, vmax128));
+    vmax128 = _mm_max_epu8(vmax128, _mm_srli_epi64(vmax128, 32));
+    vmax128 = _mm_max_epu8(vmax128, _mm_srli_epi32(vmax128, 16));
+    vmax128 = _mm_max_epu8(vmax128, _mm_srli_epi16(vmax128, 8));
+    return (uint8_t) _mm_cvtsi128_si32(vmax128);
+  } else {
+    uint8_t vmax = 0;
+    do {
+      const uint8_t vx = *x++;
+      vmax = vx > vmax ? vx : vmax;
+    } while (--n != 0);
+    return vmax;
+  }
+}
+
+static inline uint32_t compute_sum(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t)
+{
+  __m256i vacc = _mm256_setzero_si256();
+  for (; n >= 8; n -= 8) {
+    const __m256i vx = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) x)); x += 8;
+    vacc = _mm256_add_epi32(vacc, _mm256_i32gather_epi32((const int*) t, vx, 4));
+  }
+  __m128i vacc128 = _mm_add_epi32(_mm256_castsi256_si128(vacc), _mm256_extracti128_si256(vacc, 1));
+  vacc128 = _mm_add_epi32(vacc128, _mm_shuffle_epi32(vacc128, _MM_SHUFFLE(1, 0, 3, 2)));
+  vacc128 = _mm_add_epi32(vacc128, _mm_shuffle_epi32(vacc128, _MM_SHUFFLE(2, 3, 0, 1)));
+
+  uint32_t vsum = (uint32_t) _mm_cvtsi128_si32(vacc128);
+  while (n != 0) {
+    vsum += t[*x++];
+    n--;
+  }
+  return vsum;
+}
+
+void u8softargmax_ukernel__avx2(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t,
+    uint8_t* y,
+    const union qnnp_softargmax_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  /* Exponents in the table are relative to 255, shift the table so that they are relative to the maximum */
+  const uint8_t vx_max = compute_max(n, x);
+  t += vx_max ^ 255;
+
+  const uint32_t vsum = compute_sum(n, x, t);
+  assert(vsum != 0);
+  const uint32_t vdivisor = u8softargmax_divisor(vsum, params->sse2.divisor_scale);
+
+  /* Division by the divisor uses the same multiply-and-shift sequence as FXdiv */
+  const uint32_t l = vdivisor == 1 ? 0 : 32 - (uint32_t) __builtin_clz(vdivisor - 1);
+  const uint32_t m = (uint32_t) (((UINT64_C(1) << 32) * ((UINT64_C(1) << l) - vdivisor)) / vdivisor + 1);
+  const uint32_t s1 = l < 1 ? l : 1;
+  const uint32_t s2 = l - s1;
+  const uint32_t vrounding = vdivisor >> 1;
+
+  const __m256i vmultiplier = _mm256_set1_epi32((int) m);
+  const __m256i vrounding_x8 = _mm256_set1_epi32((int) vrounding);
+  const __m128i vshift1 = _mm_cvtsi32_si128((int) s1);
+  const __m128i vshift2 = _mm_cvtsi32_si128((int) s2);
+  const __m128i vzero_point = _mm_load_si128((const __m128i*) params->sse2.output_zero_point);
+  for (; n >= 8; n -= 8) {
+    const __m256i vx = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) x)); x += 8;
+    const __m256i vt = _mm256_i32gather_epi32((const int*) t, vx, 4);
+    const __m256i vn = _mm256_add_epi32(_mm256_slli_epi32(vt, 8), vrounding_x8);
+
+    const __m256i vprod_even = _mm256_mul_epu32(vn, vmultiplier);
+    const __m256i vprod_odd = _mm256_mul_epu32(_mm256_srli_epi64(vn, 32), vmultiplier);
+    const __m256i vmulhi = _mm256_blend_epi32(_mm256_srli_epi64(vprod_even, 32), vprod_odd, 0xAA);
+    const __m256i vq = _mm256_srl_epi32(
+      _mm256_add_epi32(vmulhi, _mm256_srl_epi32(_mm256_sub_epi32(vn, vmulhi), vshift1)), vshift2);
+
+    /* Quotients are below 2**31, so signed saturation clamps them without wrap-around */
+    const __m128i vq16 = _mm_packs_epi32(_mm256_castsi256_si128(vq), _mm256_extracti128_si256(vq, 1));
+    const __m128i vy16 = _mm_adds_epi16(vq16, vzero_point);
+    _mm_storel_epi64((__m128i*) y, _mm_packus_epi16(vy16, vy16)); y += 8;
+  }
+  const uint32_t vzero_point_scalar = (uint32_t) (uint16_t) params->sse2.output_zero_point[0];
+  while (n != 0) {
+    const uint64_t vn = (uint64_t) ((t[*x++] << 8) + vrounding);
+    const uint32_t vmulhi = (uint32_t) ((vn * (uint64_t) m) >> 32);
+    const uint32_t vq = ((vmulhi + (((uint32_t) vn - vmulhi) >> s1)) >> s2) + vzero_point_scalar;
+    *y++ = vq > 255 ? UINT8_C(255) : (uint8_t) vq;
+
+    n--;
+  }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/common.h>
+#include <qnnpack/u8softargmax.h>
+
+
+static inline uint8_t compute_max(
+    size_t n,
+    const uint8_t* x)
+{
+  if QNNP_LIKELY(n >= 16) {
+    uint8x16_t vmax = vmovq_n_u8(0);
+    do {
+      const uint8x16_t vx = vld1q_u8(x); x += 16;
+      vmax = vmaxq_u8(vmax, vx);
+      n -= 16;
+    } while (n >= 16);
+    if (n != 0) {
+      const size_t x_increment = n - 16;
+      x = (const uint8_t*) ((uintptr_t) x + x_increment);
+      const uint8x16_t vx = vld1q_u8(x);
+      vmax = vmaxq_u8(vmax, vx);
+    }
+    uint8x8_t vmax8 = vmax_u8(vget_low_u8(vmax), vget_high_u8(vmax));
+    const uint8x8_t vmax4 = vpmax_u8(vmax8, vmax8);
+    const uint8x8_t vmax2 = vpmax_u8(vmax4, vmax4);
+    const uint8x8_t vmax1 = vpmax_u8(vmax2, vmax2);
+    return vget_lane_u8(vmax1, 0);
+  } else {
+    uint8_t vmax = 0;
+    do {
+      const uint8_t vx = *x++;
+      vmax = vx > vmax ? vx : vmax;
+    } while (--n != 0);
+    return vmax;
+  }
+}
+
+static inline uint32_t compute_sum(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t)
+{
+  uint32_t vsum0 = 0;
+  uint32_t vsum1 = 0;
+  for (; n >= 4; n -= 4) {
+    vsum0 += t[x[0]];
+    vsum1 += t[x[1]];
+    vsum0 += t[x[2]];
+    vsum1 += t[x[3]];
+    x += 4;
+  }
+  while (n != 0) {
+    vsum0 += t[*x++];
+    n--;
+  }
+  return vsum0 + vsum1;
+}
+
+void u8softargmax_ukernel__neon(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t,
+    uint8_t* y,
+    const union qnnp_softargmax_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  /* Exponents in the table are relative to 255, shift the table so that they are relative to the maximum */
+  const uint8_t vx_max = compute_max(n, x);
+  t += vx_max ^ 255;
+
+  const uint32_t vsum = compute_sum(n, x, t);
+  assert(vsum != 0);
+  const uint32_t vdivisor = u8softargmax_divisor(vsum, params->neon.divisor_scale);
+
+  /* Division by the divisor uses the same multiply-and-shift sequence as FXdiv */
+  const uint32_t l = vdivisor == 1 ? 0 : 32 - (uint32_t) __builtin_clz(vdivisor - 1);
+  const uint32_t m = (uint32_t) (((UINT64_C(1) << 32) * ((UINT64_C(1) << l) - vdivisor)) / vdivisor + 1);
+  const uint32_t s1 = l < 1 ? l : 1;
+  const uint32_t s2 = l - s1;
+  const uint32_t vrounding = vdivisor >> 1;
+
+  const uint32x2_t vmultiplier = vdup_n_u32(m);
+  const uint32x4_t vrounding_x4 = vdupq_n_u32(vrounding);
+  const int32x4_t vshift1 = vdupq_n_s32(-(int32_t) s1);
+  const int32x4_t vshift2 = vdupq_n_s32(-(int32_t) s2);
+  const uint16x8_t vzero_point = vdupq_n_u16(params->neon.output_zero_point);
+  for (; n >= 8; n -= 8) {
+    uint32x4_t vt0123 = vdupq_n_u32(t[x[0]]);
+    vt0123 = vsetq_lane_u32(t[x[1]], vt0123, 1);
+    vt0123 = vsetq_lane_u32(t[x[2]], vt0123, 2);
+    vt0123 = vsetq_lane_u32(t[x[3]], vt0123, 3);
+    uint32x4_t vt4567 = vdupq_n_u32(t[x[4]]);
+    vt4567 = vsetq_lane_u32(t[x[5]], vt4567, 1);
+    vt4567 = vsetq_lane_u32(t[x[6]], vt4567, 2);
+    vt4567 = vsetq_lane_u32(t[x[7]], vt4567, 3);
+    x += 8;
+
+    const uint32x4_t vn0123 = vaddq_u32(vshlq_n_u32(vt0123, 8), vrounding_x4);
+    const uint32x4_t vn4567 = vaddq_u32(vshlq_n_u32(vt4567, 8), vrounding_x4);
+
+    const uint32x4_t vmulhi0123 = vcombine_u32(
+      vshrn_n_u64(vmull_u32(vget_low_u32(vn0123), vmultiplier), 32),
+      vshrn_n_u64(vmull_u32(vget_high_u32(vn0123), vmultiplier), 32));
+    const uint32x4_t vmulhi4567 = vcombine_u32(
+      vshrn_n_u64(vmull_u32(vget_low_u32(vn4567), vmultiplier), 32),
+      vshrn_n_u64(vmull_u32(vget_high_u32(vn4567), vmultiplier), 32));
+    const uint32x4_t vq0123 = vshlq_u32(
+      vaddq_u32(vmulhi0123, vshlq_u32(vsubq_u32(vn0123, vmulhi0123), vshift1)), vshift2);
+    const uint32x4_t vq4567 = vshlq_u32(
+      vaddq_u32(vmulhi4567, vshlq_u32(vsubq_u32(vn4567, vmulhi4567), vshift1)), vshift2);
+
+    const uint16x8_t vy16 = vqaddq_u16(vcombine_u16(vqmovn_u32(vq0123), vqmovn_u32(vq4567)), vzero_point);
+    vst1_u8(y, vqmovn_u16(vy16)); y += 8;
+  }
+  const uint32_t vzero_point_scalar = (uint32_t) params->neon.output_zero_point;
+  while (n != 0) {
+    const uint64_t vn = (uint64_t) ((t[*x++] << 8) + vrounding);
+    const uint32_t vmulhi = (uint32_t) ((vn * (uint64_t) m) >> 32);
+    const uint32_t vq = ((vmulhi + (((uint32_t) vn - vmulhi) >> s1)) >> s2) + vzero_point_scalar;
+    *y++ = vq > 255 ? UINT8_C(255) : (uint8_t) vq;
+
+    n--;
+  }
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/common.h>
+#include <qnnpack/u8softargmax.h>
+
+
+static inline uint8_t compute_max(
+    size_t n,
+    const uint8_t* x)
+{
+  if QNNP_LIKELY(n >= 16) {
+    __m128i vmax = _mm_setzero_si128();
+    do {
+      const __m128i vx = _mm_loadu_si128((const __m128i*) x);
+      x += 16;
+      vmax = _mm_max_epu8(vmax, vx);
+      n -= 16;
+    } while (n >= 16);
+    if (n != 0) {
+      const size_t x_increment = n - 16;
+      x = (const uint8_t*) ((uintptr_t) x + x_increment);
+      const __m128i vx = _mm_loadu_si128((const __m128i*) x);
+      vmax = _mm_max_epu8(vmax, vx);
+    }
+    vmax = _mm_max_epu8(vmax, _mm_unpackhi_epi64(vmax, vmax));
+    vmax = _mm_max_epu8(vmax, _mm_srli_epi64(vmax, 32));
+    vmax = _mm_max_epu8(vmax, _mm_srli_epi32(vmax, 16));
+    vmax = _mm_max_epu8(vmax, _mm_srli_epi16(vmax, 8));
+    return (uint8_t) _mm_cvtsi128_si32(vmax);
+  } else {
+    uint8_t vmax = 0;
+    do {
+      const uint8_t vx = *x++;
+      vmax = vx > vmax ? vx : vmax;
+    } while (--n != 0);
+    return vmax;
+  }
+}
+
+static inline uint32_t compute_sum(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t)
+{
+  uint32_t vsum0 = 0;
+  uint32_t vsum1 = 0;
+  for (; n >= 4; n -= 4) {
+    vsum0 += t[x[0]];
+    vsum1 += t[x[1]];
+    vsum0 += t[x[2]];
+    vsum1 += t[x[3]];
+    x += 4;
+  }
+  while (n != 0) {
+    vsum0 += t[*x++];
+    n--;
+  }
+  return vsum0 + vsum1;
+}
+
+void u8softargmax_ukernel__sse2(
+    size_t n,
+    const uint8_t* x,
+    const uint32_t* t,
+    uint8_t* y,
+    const union qnnp_softargmax_params params[restrict static 1])
+{
+  assert(n != 0);
+
+  /* Exponents in the table are relative to 255, shift the table so that they are relative to the maximum */
+  const uint8_t vx_max = compute_max(n, x);
+  t += vx_max ^ 255;
+
+  const uint32_t vsum = compute_sum(n, x, t);
+  assert(vsum != 0);
+  const uint32_t vdivisor = u8softargmax_divisor(vsum, params->sse2.divisor_scale);
+
+  /* Division by the divisor uses the same multiply-and-shift sequence as FXdiv */
+  const uint32_t l = vdivisor == 1 ? 0 : 32 - (uint32_t) __builtin_clz(vdivisor - 1);
+  const uint32_t m = (uint32_t) (((UINT64_C(1) << 32) * ((UINT64_C(1) << l) - vdivisor)) / vdivisor + 1);
+  const uint32_t s1 = l < 1 ? l : 1;
+  const uint32_t s2 = l - s1;
+  const uint32_t vrounding = vdivisor >> 1;
+
+  const __m128i vmultiplier = _mm_set1_epi32((int) m);
+  const __m128i vrounding_x4 = _mm_set1_epi32((int) vrounding);
+  const __m128i vshift1 = _mm_cvtsi32_si128((int) s1);
+  const __m128i vshift2 = _mm_cvtsi32_si128((int) s2);
+  const __m128i vzero_point = _mm_load_si128((const __m128i*) params->sse2.output_zero_point);
+  for (; n >= 8; n -= 8) {
+    const __m128i vt0123 = _mm_setr_epi32((int) t[x[0]], (int) t[x[1]], (int) t[x[2]], (int) t[x[3]]);
+    const __m128i vt4567 = _mm_setr_epi32((int) t[x[4]], (int) t[x[5]], (int) t[x[6]], (int) t[x[7]]);
+    x += 8;
+
+    const __m128i vn0123 = _mm_add_epi32(_mm_slli_epi32(vt0123, 8), vrounding_x4);
+    const __m128i vn4567 = _mm_add_epi32(_mm_slli_epi32(vt4567, 8), vrounding_x4);
+
+    const __m128i vprod02 = _mm_mul_epu32(vn0123, vmultiplier);
+    const __m128i vprod13 = _mm_mul_epu32(_mm_srli_epi64(vn0123, 32), vmultiplier);
+    const __m128i vprod46 = _mm_mul_epu32(vn4567, vmultiplier);
+    const __m128i vprod57 = _mm_mul_epu32(_mm_srli_epi64(vn4567, 32), vmultiplier);
+    const __m128i vmulhi0123 = _mm_unpacklo_epi32(
+      _mm_shuffle_epi32(vprod02, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_epi32(vprod13, _MM_SHUFFLE(3, 1, 3, 1)));
+    const __m128i vmulhi4567 = _mm_unpacklo_epi32(
+      _mm_shuffle_epi32(vprod46, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_epi32(vprod57, _MM_SHUFFLE(3, 1, 3, 1)));
+    const __m128i vq0123 = _mm_srl_epi32(
+      _mm_add_epi32(vmulhi0123, _mm_srl_epi32(_mm_sub_epi32(vn0123, vmulhi0123), vshift1)), vshift2);
+    const __m128i vq4567 = _mm_srl_epi32(
+      _mm_add_epi32(vmulhi4567, _mm_srl_epi32(_mm_sub_epi32(vn4567, vmulhi4567), vshift1)), vshift2);
+
+    /* Quotients are below 2**31, so signed saturation clamps them without wrap-around */
+    const __m128i vy16 = _mm_adds_epi16(_mm_packs_epi32(vq0123, vq4567), vzero_point);
+    _mm_storel_epi64((__m128i*) y, _mm_packus_epi16(vy16, vy16)); y += 8;
+  }
+  const uint32_t vzero_point_scalar = (uint32_t) (uint16_t) params->sse2.output_zero_point[0];
+  while (n != 0) {
+    const uint64_t vn = (uint64_t) ((t[*x++] << 8) + vrounding);
+    const uint32_t vmulhi = (uint32_t) ((vn * (uint64_t) m) >> 32);
+    const uint32_t vq = ((vmulhi + (((uint32_t) vn - vmulhi) >> s1)) >> s2) + vzero_point_scalar;
+    *y++ = vq > 255 ? UINT8_C(255) : (uint8_t) vq;
+
+    n--;
+  }
+}
@@ -0,0 +1,747 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <cpuinfo.h>
+
+#include <qnnpack.h>
+#include <qnnpack/allocator.h>
+#include <qnnpack/operator.h>
+#include <qnnpack/log.h>
+#include <qnnpack/math.h>
+#include <qnnpack/params.h>
+#include <qnnpack/q8avgpool.h>
+#include <qnnpack/q8conv.h>
+#include <qnnpack/q8dwconv.h>
+#include <qnnpack/q8gavgpool.h>
+#include <qnnpack/q8gemm.h>
+#include <qnnpack/u8maxpool.h>
+#include <qnnpack/ukernel-registry.h>
+
+
+const struct qnnp_q8conv_ukernel qnnp_q8conv_ukernels[] = {
+#if CPUINFO_ARCH_ARM
+  {
+    .name = "4x8__aarch32_neon",
+    .isa = "NEON",
+    .parameters = {
+      .gemm = q8gemm_ukernel_4x8__aarch32_neon,
+      .conv = q8conv_ukernel_4x8__aarch32_neon,
+      .mr = 4,
+      .nr = 8,
+      .kr = 1,
+    },
+  },
+  {
+    .name = "4x8__neon",
+    .isa = "NEON",
+    .parameters = {
+      .gemm = q8gemm_ukernel_4x8__neon,
+      .conv = q8conv_ukernel_4x8__neon,
+      .mr = 4,
+      .nr = 8,
+      .kr = 1,
+    },
+  },
+  {
+    .name = "8x8__neon",
+    .isa = "NEON",
+    .parameters = {
+      .gemm = q8gemm_ukernel_8x8__neon,
+      .conv = q8conv_ukernel_8x8__neon,
+      .mr = 8,
+      .nr = 8,
+      .kr = 1,
+    },
+  },
+#elif CPUINFO_ARCH_ARM64
+  {
+    .name = "8x8__aarch64_neon",
+    .isa = "NEON",
+    .parameters = {
+      .gemm = q8gemm_ukernel_8x8__aarch64_neon,
+      .conv = q8conv_ukernel_8x8__aarch64_neon,
+      .mr = 8,
+      .nr = 8,
+      .kr = 1,
+    },
+  },
+  {
+    .name = "8x8__neon",
+    .isa = "NEON",
+    .parameters = {
+      .gemm = q8gemm_ukernel_8x8__neon,
+      .conv = q8conv_ukernel_8x8__neon,
+      .mr = 8,
+      .nr = 8,
+      .kr = 1,
+    },
+  },
+  {
+    .name = "4x8__neon",
+    .isa = "NEON",
+    .parameters = {
+      .gemm = q8gemm_ukernel_4x8__neon,
+      .conv = q8conv_ukernel_4x8__neon,
+      .mr = 4,
+      .nr = 8,
+      .kr = 1,
+    },
+  },
+#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  {
+    .name = "4x4c2__sse2",
+    .isa = "SSE2",
+    .parameters = {
+      .gemm = q8gemm_ukernel_4x4c2__sse2,
+      .conv = q8conv_ukernel_4x4c2__sse2,
+      .mr = 4,
+      .nr = 4,
+      .kr = 2,
+    },
+  },
+#endif
+};
+
+const size_t qnnp_q8conv_ukernels_count = QNNP_COUNT_OF(qnnp_q8conv_ukernels);
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+static bool has_x86_avx2(void) {
+  return cpuinfo_has_x86_avx2();
+}
+#endif
+
+const struct qnnp_q8dwconv_ukernel qnnp_q8dwconv_ukernels[] = {
+#if CPUINFO_ARCH_ARM
+  {
+    .name = "up8x9__aarch32_neon",
+    .isa = "NEON",
+    .q8dw9 = {
+      .updw = q8dwconv_ukernel_up8x9__aarch32_neon,
+      .cr = 8,
+    },
+    .q8dw25 = {
+      .mpdw = q8dwconv_ukernel_mp8x25__neon,
+      .cr = 8,
+    },
+  },
+#endif
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  {
+    .name = "up8x9__neon",
+    .isa = "NEON",
+    .q8dw9 = {
+      .updw = q8dwconv_ukernel_up8x9__neon,
+      .cr = 8,
+    },
+    .q8dw25 = {
+      .mpdw = q8dwconv_ukernel_mp8x25__neon,
+      .cr = 8,
+    },
+  },
+#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  {
+    .name = "up32x9__avx2",
+    .isa = "AVX2",
+    .is_supported = has_x86_avx2,
+    .q8dw9 = {
+      .updw = q8dwconv_ukernel_up32x9__avx2,
+      .cr = 32,
+    },
+    .q8dw25 = {
+      .mpdw = q8dwconv_ukernel_mp32x25__avx2,
+      .cr = 32,
+    },
+  },
+  {
+    .name = "up8x9__sse2",
+    .isa = "SSE2",
+    .q8dw9 = {
+      .updw = q8dwconv_ukernel_up8x9__sse2,
+      .cr = 8,
+    },
+    .q8dw25 = {
+      .mpdw = q8dwconv_ukernel_mp8x25__sse2,
+      .cr = 8,
+    },
+  },
+#endif
+};
+
+const size_t qnnp_q8dwconv_ukernels_count = QNNP_COUNT_OF(qnnp_q8dwconv_ukernels);
+
+const struct qnnp_q8avgpool_ukernel qnnp_q8avgpool_ukernels[] = {
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  {
+    .name = "up8x9__neon",
+    .isa = "NEON",
+    .parameters = {
+      .ltkr = q8avgpool_ukernel_up8xm__neon,
+      .gekr_lemr = q8avgpool_ukernel_up8x9__neon,
+      .gekr_gtmr = q8avgpool_ukernel_mp8x9p8q__neon,
+      .mr = 9,
+      .qr = 8,
+      .kr = 8,
+    },
+  },
+#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  {
+    .name = "up16x9__avx2",
+    .isa = "AVX2",
+    .is_supported = has_x86_avx2,
+    .parameters = {
+      .ltkr = q8avgpool_ukernel_up16xm__avx2,
+      .gekr_lemr = q8avgpool_ukernel_up16x9__avx2,
+      .gekr_gtmr = q8avgpool_ukernel_mp16x9p8q__avx2,
+      .mr = 9,
+      .qr = 8,
+      .kr = 16,
+    },
+  },
+  {
+    .name = "up8x9__sse2",
+    .isa = "SSE2",
+    .parameters = {
+      .ltkr = q8avgpool_ukernel_up8xm__sse2,
+      .gekr_lemr = q8avgpool_ukernel_up8x9__sse2,
+      .gekr_gtmr = q8avgpool_ukernel_mp8x9p8q__sse2,
+      .mr = 9,
+      .qr = 8,
+      .kr = 8,
+    },
+  },
+#endif
+};
+
+const size_t qnnp_q8avgpool_ukernels_count = QNNP_COUNT_OF(qnnp_q8avgpool_ukernels);
+
+const struct qnnp_q8gavgpool_ukernel qnnp_q8gavgpool_ukernels[] = {
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  {
+    .name = "up8x7__neon",
+    .isa = "NEON",
+    .parameters = {
+      .ltnr = q8gavgpool_ukernel_up8xm__neon,
+      .genr_lemr = q8gavgpool_ukernel_up8x7__neon,
+      .genr_gtmr = q8gavgpool_ukernel_mp8x7p7q__neon,
+      .mr = 7,
+      .nr = 8,
+    },
+  },
+#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  {
+    .name = "up16x7__avx2",
+    .isa = "AVX2",
+    .is_supported = has_x86_avx2,
+    .parameters = {
+      .ltnr = q8gavgpool_ukernel_up16xm__avx2,
+      .genr_lemr = q8gavgpool_ukernel_up16x7__avx2,
+      .genr_gtmr = q8gavgpool_ukernel_mp16x7p7q__avx2,
+      .mr = 7,
+      .nr = 16,
+    },
+  },
+  {
+    .name = "up8x7__sse2",
+    .isa = "SSE2",
+    .parameters = {
+      .ltnr = q8gavgpool_ukernel_up8xm__sse2,
+      .genr_lemr = q8gavgpool_ukernel_up8x7__sse2,
+      .genr_gtmr = q8gavgpool_ukernel_mp8x7p7q__sse2,
+      .mr = 7,
+      .nr = 8,
+    },
+  },
+#endif
+};
+
+const size_t qnnp_q8gavgpool_ukernels_count = QNNP_COUNT_OF(qnnp_q8gavgpool_ukernels);
+
+const struct qnnp_u8maxpool_ukernel qnnp_u8maxpool_ukernels[] = {
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  {
+    .name = "16x9p8q__neon",
+    .isa = "NEON",
+    .parameters = {
+      .ltkr = u8maxpool_ukernel_sub16__neon,
+      .gekr = u8maxpool_ukernel_16x9p8q__neon,
+      .mr = 9,
+      .qr = 8,
+      .kr = 16,
+    },
+  },
+#elif CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  {
+    .name = "32x9p8q__avx2",
+    .isa = "AVX2",
+    .is_supported = has_x86_avx2,
+    .parameters = {
+      .ltkr = u8maxpool_ukernel_sub32__avx2,
+      .gekr = u8maxpool_ukernel_32x9p8q__avx2,
+      .mr = 9,
+      .qr = 8,
+      .kr = 32,
+    },
+  },
+  {
+    .name = "16x9p8q__sse2",
+    .isa = "SSE2",
+    .parameters = {
+      .ltkr = u8maxpool_ukernel_sub16__sse2,
+      .gekr = u8maxpool_ukernel_16x9p8q__sse2,
+      .mr = 9,
+      .qr = 8,
+      .kr = 16,
+    },
+  },
+#endif
+};
+
+const size_t qnnp_u8maxpool_ukernels_count = QNNP_COUNT_OF(qnnp_u8maxpool_ukernels);
+
+static const struct qnnp_q8conv_ukernel* find_q8conv_ukernel(const char* name) {
+  for (size_t i = 0; i < qnnp_q8conv_ukernels_count; i++) {
+    if (strcmp(qnnp_q8conv_ukernels[i].name, name) == 0) {
+      return &qnnp_q8conv_ukernels[i];
+    }
+  }
+  return NULL;
+}
+
+static bool is_q8dwconv_ukernel_supported(const struct qnnp_q8dwconv_ukernel* ukernel) {
+  return ukernel->is_supported == NULL || ukernel->is_supported();
+}
+
+static size_t get_q8dwconv_ukernels_count(void) {
+  size_t count = 0;
+  for (size_t i = 0; i < qnnp_q8dwconv_ukernels_count; i++) {
+    count += (size_t) is_q8dwconv_ukernel_supported(&qnnp_q8dwconv_ukernels[i]);
+  }
+  return count;
+}
+
+/* Returns the index-th micro-kernel among those supported on the current processor */
+static const struct qnnp_q8dwconv_ukernel* get_q8dwconv_ukernel(size_t index) {
+  for (size_t i = 0; i < qnnp_q8dwconv_ukernels_count; i++) {
+    if (is_q8dwconv_ukernel_supported(&qnnp_q8dwconv_ukernels[i])) {
+      if (index-- == 0) {
+        return &qnnp_q8dwconv_ukernels[i];
+      }
+    }
+  }
+  return NULL;
+}
+
+static const struct qnnp_q8dwconv_ukernel* find_q8dwconv_ukernel(const char* name) {
+  for (size_t i = 0; i < qnnp_q8dwconv_ukernels_count; i++) {
+    if (strcmp(qnnp_q8dwconv_ukernels[i].name, name) == 0 &&
+        is_q8dwconv_ukernel_supported(&qnnp_q8dwconv_ukernels[i]))
+    {
+      return &qnnp_q8dwconv_ukernels[i];
+    }
+  }
+  return NULL;
+}
+
+/*
+ * Copies weights packed for GEMM/CONV micro-kernels with one (nr, kr) into the layout for another (nr, kr).
+ * Both layouts consist of nr-wide blocks of output channels: nr biases, followed by ks x ceil(kc / kr) groups of
+ * nr x kr weights. The accumulated biases do not depend on the layout and are copied as is.
+ */
+static void repack_q8conv_w(
+  size_t groups,
+  size_t n,
+  size_t ks,
+  size_t kc,
+  uint32_t old_nr,
+  uint32_t old_kr,
+  const void* old_packed_w,
+  uint32_t nr,
+  uint32_t kr,
+  void* packed_w)
+{
+  const size_t old_k_stride = round_up(kc, old_kr);
+  const size_t old_block_size = old_nr * (sizeof(int32_t) + ks * old_k_stride * sizeof(uint8_t));
+  const size_t old_group_size = divide_round_up(n, old_nr) * old_block_size;
+  const size_t k_stride = round_up(kc, kr);
+  const size_t block_size = nr * (sizeof(int32_t) + ks * k_stride * sizeof(uint8_t));
+  const size_t group_size = divide_round_up(n, nr) * block_size;
+  for (size_t group = 0; group < groups; group++) {
+    const uint8_t* old_w = (const uint8_t*) old_packed_w + group * old_group_size;
+    uint8_t* w = (uint8_t*) packed_w + group * group_size;
+    for (size_t ni = 0; ni < n; ni++) {
+      const uint8_t* old_block = old_w + (ni / old_nr) * old_block_size;
+      uint8_t* block = w + (ni / nr) * block_size;
+      memcpy(block + (ni % nr) * sizeof(int32_t), old_block + (ni % old_nr) * sizeof(int32_t), sizeof(int32_t));
+      for (size_t ki = 0; ki < ks; ki++) {
+        for (size_t k = 0; k < kc; k++) {
+          const size_t old_offset =
+            ((ki * (old_k_stride / old_kr) + k / old_kr) * old_nr + ni % old_nr) * old_kr + k % old_kr;
+          const size_t offset =
+            ((ki * (k_stride / kr) + k / kr) * nr + ni % nr) * kr + k % kr;
+          block[nr * sizeof(int32_t) + offset] = old_block[old_nr * sizeof(int32_t) + old_offset];
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Copies depthwise convolution weights packed for one channel tile into the layout for another channel tile.
+ * 9-tap weights form a single section; 25-tap weights are split into sections of 10, 10, and 5 taps, and only the
+ * first section starts with biases. Within a section, every cr-wide block of channels stores cr biases (if any),
+ * followed by taps x cr weights.
+ */
+static void repack_q8dw_w(
+  size_t c,
+  size_t ks,
+  size_t old_cr,
+  const void* old_packed_w,
+  size_t cr,
+  void* packed_w)
+{
+  static const size_t sections_9[] = { 9 };
+  static const size_t sections_25[] = { 10, 10, 5 };
+  const size_t* sections = ks == 9 ? sections_9 : sections_25;
+  const size_t sections_count = ks == 9 ? QNNP_COUNT_OF(sections_9) : QNNP_COUNT_OF(sections_25);
+
+  const size_t old_c_stride = round_up(c, old_cr);
+  const size_t c_stride = round_up(c, cr);
+  size_t old_section_offset = 0;
+  size_t section_offset = 0;
+  for (size_t section = 0; section < sections_count; section++) {
+    const size_t taps = sections[section];
+    const size_t bias_size = section == 0 ? sizeof(int32_t) : 0;
+    const size_t old_block_size = old_cr * (bias_size + taps);
+    const size_t block_size = cr * (bias_size + taps);
+    for (size_t ci = 0; ci < c; ci++) {
+      const uint8_t* old_block = (const uint8_t*) old_packed_w + old_section_offset + (ci / old_cr) * old_block_size;
+      uint8_t* block = (uint8_t*) packed_w + section_offset + (ci / cr) * block_size;
+      if (bias_size != 0) {
+        memcpy(block + (ci % cr) * sizeof(int32_t), old_block + (ci % old_cr) * sizeof(int32_t), sizeof(int32_t));
+      }
+      for (size_t tap = 0; tap < taps; tap++) {
+        block[cr * bias_size + tap * cr + ci % cr] = old_block[old_cr * bias_size + tap * old_cr + ci % old_cr];
+      }
+    }
+    old_section_offset += old_c_stride * (bias_size + taps);
+    section_offset += c_stride * (bias_size + taps);
+  }
+}
+
+/* Replaces the zero padding buffer of an operator with one of zero_size bytes, zero_offset of them before the row */
+static enum qnnp_status reallocate_zero_buffer(
+  qnnp_operator_t op,
+  size_t zero_size,
+  size_t zero_offset)
+{
+  if (op->zero_buffer == NULL) {
+    return qnnp_status_success;
+  }
+
+  void* zero_buffer = qnnp_operator_allocate(op, zero_size);
+  if (zero_buffer == NULL) {
+    qnnp_log_error("failed to allocate %zu bytes for zero padding", zero_size);
+    return qnnp_status_out_of_memory;
+  }
+  memset(zero_buffer, op->input_zero_point, zero_size);
+  qnnp_operator_deallocate(op, op->zero_buffer);
+  op->zero_buffer = zero_buffer;
+  op->zero_buffer_size = zero_size;
+  op->zero_pointer = (void*) ((uintptr_t) zero_buffer + zero_offset);
+  return qnnp_status_success;
+}
+
+static enum qnnp_status set_q8conv_ukernel(
+  qnnp_operator_t op,
+  const struct qnnp_q8conv_ukernel* ukernel)
+{
+  const struct q8conv_parameters* old_parameters = &op->ukernel.q8conv;
+  const struct q8conv_parameters* parameters = &ukernel->parameters;
+  if (parameters->nr != old_parameters->nr || parameters->kr != old_parameters->kr) {
+    const size_t groups = op->groups;
+    const size_t group_input_channels = op->group_input_channels;
+    const size_t group_output_channels = op->group_output_channels;
+    const size_t kernel_size = op->ukernel_type == qnnp_ukernel_type_gemm ? 1 : op->kernel_height * op->kernel_width;
+    const uint32_t nr = parameters->nr;
+    const uint32_t kr = parameters->kr;
+    const size_t n_stride = round_up(group_output_channels, nr);
+    const size_t k_stride = round_up(group_input_channels, kr);
+
+    const size_t packed_weights_size =
+      groups * (sizeof(uint8_t) * kernel_size * k_stride + sizeof(int32_t)) * n_stride;
+    void* packed_weights = qnnp_operator_allocate_weights(op, packed_weights_size);
+    if (packed_weights == NULL) {
+      qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
+      return qnnp_status_out_of_memory;
+    }
+    memset(packed_weights, op->kernel_zero_point, packed_weights_size);
+    repack_q8conv_w(
+      groups, group_output_channels, kernel_size, group_input_channels,
+      old_parameters->nr, old_parameters->kr, op->packed_weights,
+      nr, kr, packed_weights);
+
+    const enum qnnp_status status = group_input_channels >= 8 ?
+      reallocate_zero_buffer(op, sizeof(uint8_t) * k_stride, 0) :
+      reallocate_zero_buffer(op, sizeof(uint8_t) * k_stride + 8, 8);
+    if (status != qnnp_status_success) {
+      qnnp_operator_deallocate(op, packed_weights);
+      return status;
+    }
+    qnnp_operator_deallocate(op, op->packed_weights);
+    op->packed_weights = packed_weights;
+    op->packed_weights_size = packed_weights_size;
+  }
+  op->ukernel.q8conv = *parameters;
+  return qnnp_status_success;
+}
+
+static enum qnnp_status set_q8dwconv_ukernel(
+  qnnp_operator_t op,
+  const struct qnnp_q8dwconv_ukernel* ukernel)
+{
+  const uint32_t old_cr = op->ukernel.q8dwconv.q8dw9.cr;
+  const uint32_t cr = ukernel->q8dw9.cr;
+  if (cr != old_cr) {
+    const size_t groups = op->groups;
+    const size_t kernel_size = op->kernel_height * op->kernel_width;
+    const size_t c_stride = round_up(groups, cr);
+
+    const size_t packed_weights_size = (sizeof(uint8_t) * kernel_size + sizeof(int32_t)) * c_stride;
+    void* packed_weights = qnnp_operator_allocate_weights(op, packed_weights_size);
+    if (packed_weights == NULL) {
+      qnnp_log_error("failed to allocate %zu bytes for packed weights", packed_weights_size);
+      return qnnp_status_out_of_memory;
+    }
+    memset(packed_weights, 0, packed_weights_size);
+    repack_q8dw_w(groups, kernel_size, old_cr, op->packed_weights, cr, packed_weights);
+
+    const enum qnnp_status status = groups >= 8 ?
+      reallocate_zero_buffer(op, sizeof(uint8_t) * c_stride, 0) :
+      reallocate_zero_buffer(op, sizeof(uint8_t) * c_stride + 8, 8);
+    if (status != qnnp_status_success) {
+      qnnp_operator_deallocate(op, packed_weights);
+      return status;
+    }
+    qnnp_operator_deallocate(op, op->packed_weights);
+    op->packed_weights = packed_weights;
+    op->packed_weights_size = packed_weights_size;
+    op->group_stride = c_stride;
+  }
+  op->ukernel.q8dwconv.q8dw9 = ukernel->q8dw9;
+  op->ukernel.q8dwconv.q8dw25 = ukernel->q8dw25;
+  return qnnp_status_success;
+}
+
+/*
+ * Drops the state of the last setup: its indirection buffer points into the replaced zero buffer and is tiled for the
+ * old micro-kernel. A zero batch size marks the operator as not set up, which fails runs until the next setup.
+ */
+static void invalidate_setup(qnnp_operator_t op)
+{
+  qnnp_operator_deallocate(op, op->indirection_buffer);
+  op->indirection_buffer = NULL;
+  op->indirection_buffer_size = 0;
+  op->last_input = NULL;
+  op->valid_batch_size = 0;
+  op->batch_size = 0;
+}
+
+enum qnnp_status qnnp_get_ukernels_count(
+    enum qnnp_ukernel_class ukernel_class,
+    size_t* count)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_get_ukernels_count failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (count == NULL) {
+    qnnp_log_error("failed to get micro-kernels count: count pointer is NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  switch (ukernel_class) {
+    case qnnp_ukernel_class_q8conv:
+      *count = qnnp_q8conv_ukernels_count;
+      return qnnp_status_success;
+    case qnnp_ukernel_class_q8dwconv:
+      *count = get_q8dwconv_ukernels_count();
+      return qnnp_status_success;
+    default:
+      qnnp_log_error("failed to get micro-kernels count: invalid micro-kernel class %d", (int) ukernel_class);
+      return qnnp_status_invalid_parameter;
+  }
+}
+
+enum qnnp_status qnnp_get_ukernel_info(
+    enum qnnp_ukernel_class ukernel_class,
+    size_t index,
+    struct qnnp_ukernel_info* info)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_get_ukernel_info failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (info == NULL) {
+    qnnp_log_error("failed to get micro-kernel info: info pointer is NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  switch (ukernel_class) {
+    case qnnp_ukernel_class_q8conv:
+    {
+      if (index >= qnnp_q8conv_ukernels_count) {
+        break;
+      }
+      const struct qnnp_q8conv_ukernel* ukernel = &qnnp_q8conv_ukernels[index];
+      *info = (struct qnnp_ukernel_info) {
+        .name = ukernel->name,
+        .isa = ukernel->isa,
+        .mr = ukernel->parameters.mr,
+        .nr = ukernel->parameters.nr,
+        .kr = ukernel->parameters.kr,
+        .selected = ukernel->parameters.gemm == qnnp_params.q8conv.gemm &&
+          ukernel->parameters.conv == qnnp_params.q8conv.conv,
+      };
+      return qnnp_status_success;
+    }
+    case qnnp_ukernel_class_q8dwconv:
+    {
+      const struct qnnp_q8dwconv_ukernel* ukernel = get_q8dwconv_ukernel(index);
+      if (ukernel == NULL) {
+        break;
+      }
+      *info = (struct qnnp_ukernel_info) {
+        .name = ukernel->name,
+        .isa = ukernel->isa,
+        .mr = 1,
+        .nr = ukernel->q8dw9.cr,
+        .kr = 1,
+        .selected = ukernel->q8dw9.updw == qnnp_params.q8dw9.updw &&
+          ukernel->q8dw25.mpdw == qnnp_params.q8dw25.mpdw,
+      };
+      return qnnp_status_success;
+    }
+    default:
+      qnnp_log_error("failed to get micro-kernel info: invalid micro-kernel class %d", (int) ukernel_class);
+      return qnnp_status_invalid_parameter;
+  }
+
+  qnnp_log_error("failed to get micro-kernel info: index %zu is out of range", index);
+  return qnnp_status_invalid_parameter;
+}
+
+enum qnnp_status qnnp_select_ukernel(
+    enum qnnp_ukernel_class ukernel_class,
+    const char* name)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_select_ukernel failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (name == NULL) {
+    qnnp_log_error("failed to select micro-kernel: name is NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  switch (ukernel_class) {
+    case qnnp_ukernel_class_q8conv:
+    {
+      const struct qnnp_q8conv_ukernel* ukernel = find_q8conv_ukernel(name);
+      if (ukernel == NULL) {
+        break;
+      }
+      qnnp_params.q8conv = ukernel->parameters;
+      return qnnp_status_success;
+    }
+    case qnnp_ukernel_class_q8dwconv:
+    {
+      const struct qnnp_q8dwconv_ukernel* ukernel = find_q8dwconv_ukernel(name);
+      if (ukernel == NULL) {
+        break;
+      }
+      qnnp_params.q8dw9 = ukernel->q8dw9;
+      qnnp_params.q8dw25 = ukernel->q8dw25;
+      return qnnp_status_success;
+    }
+    default:
+      qnnp_log_error("failed to select micro-kernel %s: invalid micro-kernel class %d", name, (int) ukernel_class);
+      return qnnp_status_invalid_parameter;
+  }
+
+  qnnp_log_error("failed to select micro-kernel %s: no such micro-kernel", name);
+  return qnnp_status_invalid_parameter;
+}
+
+enum qnnp_status qnnp_set_operator_ukernel(
+    qnnp_operator_t op,
+    const char* name)
+{
+  if (!qnnp_params.initialized) {
+    qnnp_log_error("qnnp_set_operator_ukernel failed because QNNPACK is not properly initialized");
+    return qnnp_status_uninitialized;
+  }
+
+  if (op == NULL) {
+    qnnp_log_error("failed to set operator micro-kernel: operator is NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  if (name == NULL) {
+    qnnp_log_error("failed to set operator micro-kernel: name is NULL");
+    return qnnp_status_invalid_parameter;
+  }
+
+  switch (op->ukernel_type) {
+    case qnnp_ukernel_type_gemm:
+    case qnnp_ukernel_type_conv:
+    {
+      if (op->conv_output_type != qnnp_conv_output_type_quint8) {
+        qnnp_log_error(
+          "failed to set operator micro-kernel %s: operators with 32-bit output do not use selectable micro-kernels",
+          name);
+        return qnnp_status_unsupported_parameter;
+      }
+      const struct qnnp_q8conv_ukernel* ukernel = find_q8conv_ukernel(name);
+      if (ukernel == NULL) {
+        break;
+      }
+      const enum qnnp_status status = set_q8conv_ukernel(op, ukernel);
+      if (status == qnnp_status_success) {
+        invalidate_setup(op);
+      }
+      return status;
+    }
+    case qnnp_ukernel_type_dwconv:
+    {
+      const struct qnnp_q8dwconv_ukernel* ukernel = find_q8dwconv_ukernel(name);
+      if (ukernel == NULL) {
+        break;
+      }
+      const enum qnnp_status status = set_q8dwconv_ukernel(op, ukernel);
+      if (status == qnnp_status_success) {
+        invalidate_setup(op);
+      }
+      return status;
+    }
+    default:
+      qnnp_log_error("failed to set operator micro-kernel %s: operator does not use selectable micro-kernels", name);
+      return qnnp_status_unsupported_parameter;
+  }
+
+  qnnp_log_error("failed to set operator micro-kernel %s: no such micro-kernel for this operator", name);
+  return qnnp_status_invalid_parameter;
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/xtranspose.h>
+
+
+void x32transpose_ukernel__neon(
+    size_t m,
+    size_t n,
+    const void* x,
+    size_t x_stride,
+    void* y,
+    size_t y_stride)
+{
+  assert(m != 0);
+  assert(n != 0);
+
+  const uint32_t* i0 = x;
+  uint32_t* o = y;
+  for (; m >= 4; m -= 4) {
+    const uint32_t* i1 = (const uint32_t*) ((uintptr_t) i0 + x_stride);
+    const uint32_t* i2 = (const uint32_t*) ((uintptr_t) i1 + x_stride);
+    const uint32_t* i3 = (const uint32_t*) ((uintptr_t) i2 + x_stride);
+    uint32_t* o0 = o;
+
+    size_t k = n;
+    for (; k >= 4; k -= 4) {
+      const uint32x4_t vx0 = vld1q_u32(i0); i0 += 4;
+      const uint32x4_t vx1 = vld1q_u32(i1); i1 += 4;
+      const uint32x4_t vx2 = vld1q_u32(i2); i2 += 4;
+      const uint32x4_t vx3 = vld1q_u32(i3); i3 += 4;
+
+      const uint32x4x2_t vx01 = vtrnq_u32(vx0, vx1);
+      const uint32x4x2_t vx23 = vtrnq_u32(vx2, vx3);
+
+      vst1q_u32(o0, vcombine_u32(vget_low_u32(vx01.val[0]), vget_low_u32(vx23.val[0])));
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+      vst1q_u32(o0, vcombine_u32(vget_low_u32(vx01.val[1]), vget_low_u32(vx23.val[1])));
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+      vst1q_u32(o0, vcombine_u32(vget_high_u32(vx01.val[0]), vget_high_u32(vx23.val[0])));
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+      vst1q_u32(o0, vcombine_u32(vget_high_u32(vx01.val[1]), vget_high_u32(vx23.val[1])));
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+    }
+    for (; k != 0; k--) {
+      o0[0] = *i0++;
+      o0[1] = *i1++;
+      o0[2] = *i2++;
+      o0[3] = *i3++;
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+    }
+    i0 = (const uint32_t*) ((uintptr_t) (i3 - n) + x_stride);
+    o += 4;
+  }
+  for (; m != 0; m--) {
+    uint32_t* o0 = o;
+    for (size_t k = 0; k < n; k++) {
+      *o0 = i0[k];
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+    }
+    i0 = (const uint32_t*) ((uintptr_t) i0 + x_stride);
+    o += 1;
+  }
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/xtranspose.h>
+
+
+void x32transpose_ukernel__sse2(
+    size_t m,
+    size_t n,
+    const void* x,
+    size_t x_stride,
+    void* y,
+    size_t y_stride)
+{
+  assert(m != 0);
+  assert(n != 0);
+
+  const uint32_t* i0 = x;
+  uint32_t* o = y;
+  for (; m >= 4; m -= 4) {
+    const uint32_t* i1 = (const uint32_t*) ((uintptr_t) i0 + x_stride);
+    const uint32_t* i2 = (const uint32_t*) ((uintptr_t) i1 + x_stride);
+    const uint32_t* i3 = (const uint32_t*) ((uintptr_t) i2 + x_stride);
+    uint32_t* o0 = o;
+
+    size_t k = n;
+    for (; k >= 4; k -= 4) {
+      const __m128i vx0 = _mm_loadu_si128((const __m128i*) i0); i0 += 4;
+      const __m128i vx1 = _mm_loadu_si128((const __m128i*) i1); i1 += 4;
+      const __m128i vx2 = _mm_loadu_si128((const __m128i*) i2); i2 += 4;
+      const __m128i vx3 = _mm_loadu_si128((const __m128i*) i3); i3 += 4;
+
+      const __m128i vx01_lo = _mm_unpacklo_epi32(vx0, vx1);
+      const __m128i vx01_hi = _mm_unpackhi_epi32(vx0, vx1);
+      const __m128i vx23_lo = _mm_unpacklo_epi32(vx2, vx3);
+      const __m128i vx23_hi = _mm_unpackhi_epi32(vx2, vx3);
+
+      _mm_storeu_si128((__m128i*) o0, _mm_unpacklo_epi64(vx01_lo, vx23_lo));
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storeu_si128((__m128i*) o0, _mm_unpackhi_epi64(vx01_lo, vx23_lo));
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storeu_si128((__m128i*) o0, _mm_unpacklo_epi64(vx01_hi, vx23_hi));
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storeu_si128((__m128i*) o0, _mm_unpackhi_epi64(vx01_hi, vx23_hi));
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+    }
+    for (; k != 0; k--) {
+      o0[0] = *i0++;
+      o0[1] = *i1++;
+      o0[2] = *i2++;
+      o0[3] = *i3++;
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+    }
+    i0 = (const uint32_t*) ((uintptr_t) (i3 - n) + x_stride);
+    o += 4;
+  }
+  for (; m != 0; m--) {
+    uint32_t* o0 = o;
+    for (size_t k = 0; k < n; k++) {
+      *o0 = i0[k];
+      o0 = (uint32_t*) ((uintptr_t) o0 + y_stride);
+    }
+    i0 = (const uint32_t*) ((uintptr_t) i0 + x_stride);
+    o += 1;
+  }
+}
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <immintrin.h>
+
+#include <qnnpack/x8lut.h>
+
+
+/*
+ * VPSHUFB looks up 16-entry tables within each 128-bit lane, so every 16-entry sub-table of the 256-entry table is
+ * broadcast to both lanes and the results are blended by the high nibble of the input.
+ */
+static QNNP_INLINE __m256i lookup_x32(
+    __m256i vx,
+    const uint8_t t[restrict static 256])
+{
+  const __m256i vlo = _mm256_and_si256(vx, _mm256_set1_epi8(0x0F));
+  const __m256i vhi = _mm256_and_si256(vx, _mm256_set1_epi8((char) 0xF0));
+
+  __m256i vy = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) t)), vlo);
+  for (size_t j = 1; j < 16; j++) {
+    const __m256i vt = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*) &t[j * 16]));
+    const __m256i vmask = _mm256_cmpeq_epi8(vhi, _mm256_set1_epi8((char) (j << 4)));
+    vy = _mm256_blendv_epi8(vy, _mm256_shuffle_epi8(vt, vlo), vmask);
+  }
+  return vy;
+}
+
+void x8lut_ukernel__avx2(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict static 256],
+    uint8_t* y)
+{
+  assert(n != 0);
+
+  for (; n >= 32; n -= 32) {
+    const __m256i vx = _mm256_loadu_si256((const __m256i*) x); x += 32;
+    _mm256_storeu_si256((__m256i*) y, lookup_x32(vx, t)); y += 32;
+  }
+  if (n != 0) {
+    uint8_t vbuffer[32] QNNP_ALIGN(32);
+    memcpy(vbuffer, x, n);
+    _mm256_store_si256((__m256i*) vbuffer, lookup_x32(_mm256_load_si256((const __m256i*) vbuffer), t));
+    memcpy(y, vbuffer, n);
+  }
+}
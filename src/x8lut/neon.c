@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/x8lut.h>
+
+
+void x8lut_ukernel__neon(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict static 256],
+    uint8_t* y)
+{
+  assert(n != 0);
+
+#ifdef __aarch64__
+  /* TBL/TBX look up 64-entry tables; out-of-range indices leave the destination unchanged in TBX */
+  const uint8x16x4_t vt0 = { { vld1q_u8(t), vld1q_u8(t + 16), vld1q_u8(t + 32), vld1q_u8(t + 48) } };
+  const uint8x16x4_t vt1 = { { vld1q_u8(t + 64), vld1q_u8(t + 80), vld1q_u8(t + 96), vld1q_u8(t + 112) } };
+  const uint8x16x4_t vt2 = { { vld1q_u8(t + 128), vld1q_u8(t + 144), vld1q_u8(t + 160), vld1q_u8(t + 176) } };
+  const uint8x16x4_t vt3 = { { vld1q_u8(t + 192), vld1q_u8(t + 208), vld1q_u8(t + 224), vld1q_u8(t + 240) } };
+  const uint8x16_t voffset = vmovq_n_u8(64);
+  for (; n >= 16; n -= 16) {
+    uint8x16_t vx = vld1q_u8(x); x += 16;
+    uint8x16_t vy = vqtbl4q_u8(vt0, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vt1, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vt2, vx);
+    vx = vsubq_u8(vx, voffset);
+    vy = vqtbx4q_u8(vy, vt3, vx);
+    vst1q_u8(y, vy); y += 16;
+  }
+#else
+  /* VTBL/VTBX look up 32-entry tables; out-of-range indices leave the destination unchanged in VTBX */
+  const uint8x8_t voffset = vmov_n_u8(32);
+  for (; n >= 8; n -= 8) {
+    uint8x8_t vx = vld1_u8(x); x += 8;
+    const uint8x8x4_t vt0 = { { vld1_u8(t), vld1_u8(t + 8), vld1_u8(t + 16), vld1_u8(t + 24) } };
+    uint8x8_t vy = vtbl4_u8(vt0, vx);
+    for (size_t j = 1; j < 8; j++) {
+      const uint8_t* tj = t + j * 32;
+      const uint8x8x4_t vtj = { { vld1_u8(tj), vld1_u8(tj + 8), vld1_u8(tj + 16), vld1_u8(tj + 24) } };
+      vx = vsub_u8(vx, voffset);
+      vy = vtbx4_u8(vy, vtj, vx);
+    }
+    vst1_u8(y, vy); y += 8;
+  }
+#endif
+  while (n != 0) {
+    const size_t vx = *x++;
+    *y++ = t[vx];
+
+    n--;
+  }
+}
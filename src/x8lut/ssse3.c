@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <tmmintrin.h>
+
+#include <qnnpack/x8lut.h>
+
+
+/*
+ * PSHUFB indexes a 16-entry table, so the 256-entry table is processed as 16 sub-tables. The low nibble of each
+ * element selects an entry in every sub-table, and the high nibble selects which sub-table contributes the result.
+ */
+static QNNP_INLINE __m128i lookup_x16(
+    __m128i vx,
+    const uint8_t t[restrict static 256])
+{
+  const __m128i vlo = _mm_and_si128(vx, _mm_set1_epi8(0x0F));
+  const __m128i vhi = _mm_and_si128(vx, _mm_set1_epi8((char) 0xF0));
+
+  __m128i vy = _mm_setzero_si128();
+  for (size_t j = 0; j < 16; j++) {
+    const __m128i vt = _mm_loadu_si128((const __m128i*) &t[j * 16]);
+    const __m128i vmask = _mm_cmpeq_epi8(vhi, _mm_set1_epi8((char) (j << 4)));
+    vy = _mm_or_si128(vy, _mm_and_si128(vmask, _mm_shuffle_epi8(vt, vlo)));
+  }
+  return vy;
+}
+
+void x8lut_ukernel__ssse3(
+    size_t n,
+    const uint8_t* x,
+    const uint8_t t[restrict static 256],
+    uint8_t* y)
+{
+  assert(n != 0);
+
+  for (; n >= 16; n -= 16) {
+    const __m128i vx = _mm_loadu_si128((const __m128i*) x); x += 16;
+    _mm_storeu_si128((__m128i*) y, lookup_x16(vx, t)); y += 16;
+  }
+  if (n != 0) {
+    uint8_t vbuffer[16] QNNP_ALIGN(16);
+    memcpy(vbuffer, x, n);
+    _mm_store_si128((__m128i*) vbuffer, lookup_x16(_mm_load_si128((const __m128i*) vbuffer), t));
+    memcpy(y, vbuffer, n);
+  }
+}
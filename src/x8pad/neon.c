@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/x8pad.h>
+
+
+static inline uint8_t* fill(uint8_t* y, size_t n, uint8x16_t vc)
+{
+  for (; n >= 16; n -= 16) {
+    vst1q_u8(y, vc); y += 16;
+  }
+  if (n & 8) {
+    vst1_u8(y, vget_low_u8(vc)); y += 8;
+  }
+  if (n & 4) {
+    vst1q_lane_u32(__builtin_assume_aligned(y, 1), vreinterpretq_u32_u8(vc), 0); y += 4;
+  }
+  if (n & 2) {
+    vst1q_lane_u16(__builtin_assume_aligned(y, 1), vreinterpretq_u16_u8(vc), 0); y += 2;
+  }
+  if (n & 1) {
+    vst1q_lane_u8(y, vc, 0); y += 1;
+  }
+  return y;
+}
+
+void x8pad_ukernel__neon(
+    size_t m,
+    size_t n,
+    size_t l,
+    size_t r,
+    uint8_t c,
+    const void* x,
+    size_t x_stride,
+    void* y,
+    size_t y_stride)
+{
+  assert(m != 0);
+
+  const uint8x16_t vc = vdupq_n_u8(c);
+  do {
+    /* Left padding, then a copy of the input row, then right padding */
+    uint8_t* output = fill((uint8_t*) y, l, vc);
+    if (n != 0) {
+      memcpy(output, x, n);
+      output += n;
+      x = (const void*) ((uintptr_t) x + x_stride);
+    }
+    fill(output, r, vc);
+    y = (void*) ((uintptr_t) y + y_stride);
+  } while (--m != 0);
+}
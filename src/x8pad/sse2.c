@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/x8pad.h>
+
+
+static inline uint8_t* fill(uint8_t* y, size_t n, __m128i vc)
+{
+  for (; n >= 16; n -= 16) {
+    _mm_storeu_si128((__m128i*) y, vc); y += 16;
+  }
+  if (n & 8) {
+    _mm_storel_epi64((__m128i*) y, vc); y += 8;
+  }
+  if (n & 4) {
+    *((uint32_t*) y) = (uint32_t) _mm_cvtsi128_si32(vc); y += 4;
+  }
+  if (n & 2) {
+    *((uint16_t*) y) = (uint16_t) _mm_cvtsi128_si32(vc); y += 2;
+  }
+  if (n & 1) {
+    *y++ = (uint8_t) _mm_cvtsi128_si32(vc);
+  }
+  return y;
+}
+
+void x8pad_ukernel__sse2(
+    size_t m,
+    size_t n,
+    size_t l,
+    size_t r,
+    uint8_t c,
+    const void* x,
+    size_t x_stride,
+    void* y,
+    size_t y_stride)
+{
+  assert(m != 0);
+
+  const __m128i vc = _mm_set1_epi8((char) c);
+  do {
+    /* Left padding, then a copy of the input row, then right padding */
+    uint8_t* output = fill((uint8_t*) y, l, vc);
+    if (n != 0) {
+      memcpy(output, x, n);
+      output += n;
+      x = (const void*) ((uintptr_t) x + x_stride);
+    }
+    fill(output, r, vc);
+    y = (void*) ((uintptr_t) y + y_stride);
+  } while (--m != 0);
+}
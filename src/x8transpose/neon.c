@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <arm_neon.h>
+
+#include <qnnpack/xtranspose.h>
+
+
+void x8transpose_ukernel__neon(
+    size_t m,
+    size_t n,
+    const void* x,
+    size_t x_stride,
+    void* y,
+    size_t y_stride)
+{
+  assert(m != 0);
+  assert(n != 0);
+
+  const uint8_t* i0 = x;
+  uint8_t* o = y;
+  for (; m >= 8; m -= 8) {
+    const uint8_t* i1 = (const uint8_t*) ((uintptr_t) i0 + x_stride);
+    const uint8_t* i2 = (const uint8_t*) ((uintptr_t) i1 + x_stride);
+    const uint8_t* i3 = (const uint8_t*) ((uintptr_t) i2 + x_stride);
+    const uint8_t* i4 = (const uint8_t*) ((uintptr_t) i3 + x_stride);
+    const uint8_t* i5 = (const uint8_t*) ((uintptr_t) i4 + x_stride);
+    const uint8_t* i6 = (const uint8_t*) ((uintptr_t) i5 + x_stride);
+    const uint8_t* i7 = (const uint8_t*) ((uintptr_t) i6 + x_stride);
+    uint8_t* o0 = o;
+
+    size_t k = n;
+    for (; k >= 8; k -= 8) {
+      const uint8x8_t vx0 = vld1_u8(i0); i0 += 8;
+      const uint8x8_t vx1 = vld1_u8(i1); i1 += 8;
+      const uint8x8_t vx2 = vld1_u8(i2); i2 += 8;
+      const uint8x8_t vx3 = vld1_u8(i3); i3 += 8;
+      const uint8x8_t vx4 = vld1_u8(i4); i4 += 8;
+      const uint8x8_t vx5 = vld1_u8(i5); i5 += 8;
+      const uint8x8_t vx6 = vld1_u8(i6); i6 += 8;
+      const uint8x8_t vx7 = vld1_u8(i7); i7 += 8;
+
+      const uint8x8x2_t vx01 = vtrn_u8(vx0, vx1);
+      const uint8x8x2_t vx23 = vtrn_u8(vx2, vx3);
+      const uint8x8x2_t vx45 = vtrn_u8(vx4, vx5);
+      const uint8x8x2_t vx67 = vtrn_u8(vx6, vx7);
+
+      const uint16x4x2_t vx0123_even = vtrn_u16(vreinterpret_u16_u8(vx01.val[0]), vreinterpret_u16_u8(vx23.val[0]));
+      const uint16x4x2_t vx0123_odd = vtrn_u16(vreinterpret_u16_u8(vx01.val[1]), vreinterpret_u16_u8(vx23.val[1]));
+      const uint16x4x2_t vx4567_even = vtrn_u16(vreinterpret_u16_u8(vx45.val[0]), vreinterpret_u16_u8(vx67.val[0]));
+      const uint16x4x2_t vx4567_odd = vtrn_u16(vreinterpret_u16_u8(vx45.val[1]), vreinterpret_u16_u8(vx67.val[1]));
+
+      /* Each pair holds columns j and j + 4 of the input block, i.e. rows j and j + 4 of the output block */
+      const uint32x2x2_t vy04 = vtrn_u32(
+        vreinterpret_u32_u16(vx0123_even.val[0]), vreinterpret_u32_u16(vx4567_even.val[0]));
+      const uint32x2x2_t vy15 = vtrn_u32(
+        vreinterpret_u32_u16(vx0123_odd.val[0]), vreinterpret_u32_u16(vx4567_odd.val[0]));
+      const uint32x2x2_t vy26 = vtrn_u32(
+        vreinterpret_u32_u16(vx0123_even.val[1]), vreinterpret_u32_u16(vx4567_even.val[1]));
+      const uint32x2x2_t vy37 = vtrn_u32(
+        vreinterpret_u32_u16(vx0123_odd.val[1]), vreinterpret_u32_u16(vx4567_odd.val[1]));
+
+      vst1_u8(o0, vreinterpret_u8_u32(vy04.val[0]));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      vst1_u8(o0, vreinterpret_u8_u32(vy15.val[0]));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      vst1_u8(o0, vreinterpret_u8_u32(vy26.val[0]));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      vst1_u8(o0, vreinterpret_u8_u32(vy37.val[0]));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      vst1_u8(o0, vreinterpret_u8_u32(vy04.val[1]));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      vst1_u8(o0, vreinterpret_u8_u32(vy15.val[1]));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      vst1_u8(o0, vreinterpret_u8_u32(vy26.val[1]));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      vst1_u8(o0, vreinterpret_u8_u32(vy37.val[1]));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+    }
+    for (; k != 0; k--) {
+      o0[0] = *i0++;
+      o0[1] = *i1++;
+      o0[2] = *i2++;
+      o0[3] = *i3++;
+      o0[4] = *i4++;
+      o0[5] = *i5++;
+      o0[6] = *i6++;
+      o0[7] = *i7++;
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+    }
+    i0 = (const uint8_t*) ((uintptr_t) i7 - n + x_stride);
+    o += 8;
+  }
+  for (; m != 0; m--) {
+    uint8_t* o0 = o;
+    for (size_t k = 0; k < n; k++) {
+      *o0 = i0[k];
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+    }
+    i0 = (const uint8_t*) ((uintptr_t) i0 + x_stride);
+    o += 1;
+  }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <assert.h>
+
+#include <emmintrin.h>
+
+#include <qnnpack/xtranspose.h>
+
+
+void x8transpose_ukernel__sse2(
+    size_t m,
+    size_t n,
+    const void* x,
+    size_t x_stride,
+    void* y,
+    size_t y_stride)
+{
+  assert(m != 0);
+  assert(n != 0);
+
+  const uint8_t* i0 = x;
+  uint8_t* o = y;
+  for (; m >= 8; m -= 8) {
+    const uint8_t* i1 = (const uint8_t*) ((uintptr_t) i0 + x_stride);
+    const uint8_t* i2 = (const uint8_t*) ((uintptr_t) i1 + x_stride);
+    const uint8_t* i3 = (const uint8_t*) ((uintptr_t) i2 + x_stride);
+    const uint8_t* i4 = (const uint8_t*) ((uintptr_t) i3 + x_stride);
+    const uint8_t* i5 = (const uint8_t*) ((uintptr_t) i4 + x_stride);
+    const uint8_t* i6 = (const uint8_t*) ((uintptr_t) i5 + x_stride);
+    const uint8_t* i7 = (const uint8_t*) ((uintptr_t) i6 + x_stride);
+    uint8_t* o0 = o;
+
+    size_t k = n;
+    for (; k >= 8; k -= 8) {
+      const __m128i vx0 = _mm_loadl_epi64((const __m128i*) i0); i0 += 8;
+      const __m128i vx1 = _mm_loadl_epi64((const __m128i*) i1); i1 += 8;
+      const __m128i vx2 = _mm_loadl_epi64((const __m128i*) i2); i2 += 8;
+      const __m128i vx3 = _mm_loadl_epi64((const __m128i*) i3); i3 += 8;
+      const __m128i vx4 = _mm_loadl_epi64((const __m128i*) i4); i4 += 8;
+      const __m128i vx5 = _mm_loadl_epi64((const __m128i*) i5); i5 += 8;
+      const __m128i vx6 = _mm_loadl_epi64((const __m128i*) i6); i6 += 8;
+      const __m128i vx7 = _mm_loadl_epi64((const __m128i*) i7); i7 += 8;
+
+      const __m128i vx01 = _mm_unpacklo_epi8(vx0, vx1);
+      const __m128i vx23 = _mm_unpacklo_epi8(vx2, vx3);
+      const __m128i vx45 = _mm_unpacklo_epi8(vx4, vx5);
+      const __m128i vx67 = _mm_unpacklo_epi8(vx6, vx7);
+
+      const __m128i vx0123_lo = _mm_unpacklo_epi16(vx01, vx23);
+      const __m128i vx0123_hi = _mm_unpackhi_epi16(vx01, vx23);
+      const __m128i vx4567_lo = _mm_unpacklo_epi16(vx45, vx67);
+      const __m128i vx4567_hi = _mm_unpackhi_epi16(vx45, vx67);
+
+      /* Each register holds two columns of the input block, i.e. two rows of the output block */
+      const __m128i vy01 = _mm_unpacklo_epi32(vx0123_lo, vx4567_lo);
+      const __m128i vy23 = _mm_unpackhi_epi32(vx0123_lo, vx4567_lo);
+      const __m128i vy45 = _mm_unpacklo_epi32(vx0123_hi, vx4567_hi);
+      const __m128i vy67 = _mm_unpackhi_epi32(vx0123_hi, vx4567_hi);
+
+      _mm_storel_epi64((__m128i*) o0, vy01);
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storel_epi64((__m128i*) o0, _mm_unpackhi_epi64(vy01, vy01));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storel_epi64((__m128i*) o0, vy23);
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storel_epi64((__m128i*) o0, _mm_unpackhi_epi64(vy23, vy23));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storel_epi64((__m128i*) o0, vy45);
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storel_epi64((__m128i*) o0, _mm_unpackhi_epi64(vy45, vy45));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storel_epi64((__m128i*) o0, vy67);
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+      _mm_storel_epi64((__m128i*) o0, _mm_unpackhi_epi64(vy67, vy67));
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+    }
+    for (; k != 0; k--) {
+      o0[0] = *i0++;
+      o0[1] = *i1++;
+      o0[2] = *i2++;
+      o0[3] = *i3++;
+      o0[4] = *i4++;
+      o0[5] = *i5++;
+      o0[6] = *i6++;
+      o0[7] = *i7++;
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+    }
+    i0 = (const uint8_t*) ((uintptr_t) i7 - n + x_stride);
+    o += 8;
+  }
+  for (; m != 0; m--) {
+    uint8_t* o0 = o;
+    for (size_t k = 0; k < n; k++) {
+      *o0 = i0[k];
+      o0 = (uint8_t*) ((uintptr_t) o0 + y_stride);
+    }
+    i0 = (const uint8_t*) ((uintptr_t) i0 + x_stride);
+    o += 1;
+  }
+}
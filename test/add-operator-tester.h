@@ -54,13 +54,39 @@ class AddOperatorTester {
 
   inline size_t bStride() const {
     if (this->bStride_ == 0) {
-      return this->channels_;
+      return bChannels();
     } else {
-      assert(this->bStride_ >= this->channels_);
+      assert(this->bStride_ >= bChannels());
       return this->bStride_;
     }
   }
 
+  inline AddOperatorTester& broadcastBBatch(bool broadcastBBatch) {
+    this->broadcastBBatch_ = broadcastBBatch;
+    return *this;
+  }
+
+  inline bool broadcastBBatch() const {
+    return this->broadcastBBatch_;
+  }
+
+  inline size_t bBatchSize() const {
+    return broadcastBBatch() ? 1 : batchSize();
+  }
+
+  inline AddOperatorTester& broadcastBChannels(bool broadcastBChannels) {
+    this->broadcastBChannels_ = broadcastBChannels;
+    return *this;
+  }
+
+  inline bool broadcastBChannels() const {
+    return this->broadcastBChannels_;
+  }
+
+  inline size_t bChannels() const {
+    return broadcastBChannels() ? 1 : channels();
+  }
+
   inline AddOperatorTester& yStride(size_t yStride) {
     assert(yStride != 0);
     this->yStride_ = yStride;
@@ -179,7 +205,7 @@ class AddOperatorTester {
     auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
 
     std::vector<uint8_t> a((batchSize() - 1) * aStride() + channels());
-    std::vector<uint8_t> b((batchSize() - 1) * bStride() + channels());
+    std::vector<uint8_t> b((bBatchSize() - 1) * bStride() + bChannels());
     std::vector<uint8_t> y((batchSize() - 1) * yStride() + channels());
     std::vector<float> yRef(batchSize() * channels());
     for (size_t iteration = 0; iteration < iterations(); iteration++) {
@@ -189,6 +215,8 @@ class AddOperatorTester {
 
       if (batchSize() * channels() > 3) {
         ASSERT_NE(*std::max_element(a.cbegin(), a.cend()), *std::min_element(a.cbegin(), a.cend()));
+      }
+      if (bBatchSize() * bChannels() > 3) {
         ASSERT_NE(*std::max_element(b.cbegin(), b.cend()), *std::min_element(b.cbegin(), b.cend()));
       }
 
@@ -197,7 +225,7 @@ class AddOperatorTester {
         for (size_t c = 0; c < channels(); c++) {
           yRef[i * channels() + c] = float(yZeroPoint()) +
             float(int32_t(a[i * aStride() + c]) - int32_t(aZeroPoint())) * (aScale() / yScale()) +
-            float(int32_t(b[i * bStride() + c]) - int32_t(bZeroPoint())) * (bScale() / yScale());
+            float(int32_t(b[(i % bBatchSize()) * bStride() + c % bChannels()]) - int32_t(bZeroPoint())) * (bScale() / yScale());
           yRef[i * channels() + c] = std::min<float>(yRef[i * channels() + c], float(qmax()));
           yRef[i * channels() + c] = std::max<float>(yRef[i * channels() + c], float(qmin()));
         }
@@ -217,13 +245,23 @@ class AddOperatorTester {
           0, &add_op));
       ASSERT_NE(nullptr, add_op);
 
-      ASSERT_EQ(qnnp_status_success,
-        qnnp_setup_add_nc_q8(
-          add_op,
-          batchSize(),
-          a.data(), aStride(),
-          b.data(), bStride(),
-          y.data(), yStride()));
+      if (broadcastBBatch() || broadcastBChannels()) {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_setup_add_nc_q8_broadcast(
+            add_op,
+            batchSize(),
+            a.data(), aStride(),
+            b.data(), bBatchSize(), bChannels(), bStride(),
+            y.data(), yStride()));
+      } else {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_setup_add_nc_q8(
+            add_op,
+            batchSize(),
+            a.data(), aStride(),
+            b.data(), bStride(),
+            y.data(), yStride()));
+      }
 
       ASSERT_EQ(qnnp_status_success,
         qnnp_run_operator(add_op, nullptr /* thread pool */));
@@ -248,6 +286,8 @@ class AddOperatorTester {
   size_t channels_{1};
   size_t aStride_{0};
   size_t bStride_{0};
+  bool broadcastBBatch_{false};
+  bool broadcastBChannels_{false};
   size_t yStride_{0};
   float aScale_{0.75f};
   float bScale_{1.25f};
@@ -400,3 +400,102 @@ TEST(ADD_OP, strided_batch_with_y_zero_point) {
     }
   }
 }
+
+TEST(ADD_OP, small_batch_with_scalar_b) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .broadcastBBatch(true)
+      .broadcastBChannels(true)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(ADD_OP, strided_batch_with_scalar_b) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .aStride(129)
+      .bStride(123)
+      .yStride(117)
+      .broadcastBBatch(true)
+      .broadcastBChannels(true)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(ADD_OP, small_batch_with_per_channel_b) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .broadcastBBatch(true)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(ADD_OP, strided_batch_with_per_channel_b) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .aStride(129)
+      .bStride(123)
+      .yStride(117)
+      .broadcastBBatch(true)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(ADD_OP, small_batch_with_per_row_b) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .broadcastBChannels(true)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(ADD_OP, strided_batch_with_per_row_b) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .aStride(129)
+      .bStride(123)
+      .yStride(117)
+      .broadcastBChannels(true)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(ADD_OP, unit_batch_with_scalar_b) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    AddOperatorTester()
+      .batchSize(1)
+      .channels(channels)
+      .broadcastBBatch(true)
+      .broadcastBChannels(true)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(ADD_OP, large_batch_with_scalar_b) {
+  AddOperatorTester()
+    .batchSize(97)
+    .channels(71)
+    .broadcastBBatch(true)
+    .broadcastBChannels(true)
+    .iterations(3)
+    .testQ8();
+}
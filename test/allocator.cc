@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <qnnpack.h>
+
+#include "convolution-operator-tester.h"
+#include "fully-connected-operator-tester.h"
+#include "max-pooling-operator-tester.h"
+
+
+/* Bump allocator over a fixed buffer; every block is preceded by its size so that reallocate can copy it */
+class Arena {
+ public:
+  explicit Arena(size_t capacity) : memory_(capacity + 64) {
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(memory_.data());
+    offset_ = ((begin + 63) & -uintptr_t(64)) - begin;
+  }
+
+  qnnp_allocator allocator() {
+    qnnp_allocator allocator;
+    allocator.context = this;
+    allocator.allocate = allocate;
+    allocator.reallocate = reallocate;
+    allocator.deallocate = deallocate;
+    return allocator;
+  }
+
+  bool contains(const void* pointer) const {
+    const uint8_t* bytes = static_cast<const uint8_t*>(pointer);
+    return bytes >= memory_.data() && bytes < memory_.data() + memory_.size();
+  }
+
+  size_t allocations() const {
+    return allocations_;
+  }
+
+  size_t deallocations() const {
+    return deallocations_;
+  }
+
+  size_t misaligned() const {
+    return misaligned_;
+  }
+
+  size_t foreignDeallocations() const {
+    return foreignDeallocations_;
+  }
+
+  size_t maxAlignment() const {
+    return maxAlignment_;
+  }
+
+ private:
+  static void* allocate(void* context, size_t alignment, size_t size) {
+    Arena* arena = static_cast<Arena*>(context);
+    /* Operators request cache-line alignment for all create-time buffers */
+    if (alignment < 64 || (alignment & (alignment - 1)) != 0) {
+      arena->misaligned_++;
+    }
+    arena->maxAlignment_ = std::max(arena->maxAlignment_, alignment);
+    return arena->bump(alignment, size);
+  }
+
+  static void* reallocate(void* context, void* pointer, size_t size) {
+    Arena* arena = static_cast<Arena*>(context);
+    void* block = arena->bump(sizeof(void*), size);
+    if (block != nullptr && pointer != nullptr) {
+      const size_t oldSize = reinterpret_cast<const size_t*>(pointer)[-1];
+      std::memcpy(block, pointer, std::min(oldSize, size));
+      arena->deallocations_++;
+    }
+    return block;
+  }
+
+  static void deallocate(void* context, void* pointer) {
+    Arena* arena = static_cast<Arena*>(context);
+    if (!arena->contains(pointer)) {
+      arena->foreignDeallocations_++;
+    }
+    arena->deallocations_++;
+  }
+
+  void* bump(size_t alignment, size_t size) {
+    const uintptr_t begin = reinterpret_cast<uintptr_t>(memory_.data());
+    const size_t blockOffset = ((begin + offset_ + sizeof(size_t) + alignment - 1) & -uintptr_t(alignment)) - begin;
+    if (blockOffset + size > memory_.size()) {
+      return nullptr;
+    }
+    offset_ = blockOffset + size;
+    allocations_++;
+    uint8_t* block = memory_.data() + blockOffset;
+    reinterpret_cast<size_t*>(block)[-1] = size;
+    return block;
+  }
+
+  std::vector<uint8_t> memory_;
+  size_t offset_{0};
+  size_t allocations_{0};
+  size_t deallocations_{0};
+  size_t misaligned_{0};
+  size_t foreignDeallocations_{0};
+  size_t maxAlignment_{0};
+};
+
+TEST(ALLOCATOR, convolution_in_arena) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  Arena arena(1 << 20);
+  const qnnp_allocator allocator = arena.allocator();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(&allocator));
+  ConvolutionOperatorTester()
+    .inputSize(13, 14)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testQ8();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(nullptr));
+
+  ASSERT_NE(0, arena.allocations());
+  ASSERT_EQ(arena.allocations(), arena.deallocations());
+  ASSERT_EQ(0, arena.misaligned());
+  ASSERT_EQ(0, arena.foreignDeallocations());
+}
+
+TEST(ALLOCATOR, depthwise_convolution_in_arena) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  Arena arena(1 << 20);
+  const qnnp_allocator allocator = arena.allocator();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(&allocator));
+  ConvolutionOperatorTester()
+    .inputSize(15, 14)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(24)
+    .iterations(3)
+    .testQ8();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(nullptr));
+
+  ASSERT_NE(0, arena.allocations());
+  ASSERT_EQ(arena.allocations(), arena.deallocations());
+  ASSERT_EQ(0, arena.misaligned());
+  ASSERT_EQ(0, arena.foreignDeallocations());
+}
+
+TEST(ALLOCATOR, setup_reallocation_in_arena) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  Arena arena(1 << 20);
+  const qnnp_allocator allocator = arena.allocator();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(&allocator));
+  MaxPoolingOperatorTester()
+    .batchSize(3)
+    .inputSize(11, 13)
+    .poolingSize(3, 3)
+    .channels(19)
+    .nextInputSize(17, 19)
+    .testSetupU8();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(nullptr));
+
+  ASSERT_NE(0, arena.allocations());
+  ASSERT_EQ(arena.allocations(), arena.deallocations());
+  ASSERT_EQ(0, arena.foreignDeallocations());
+}
+
+TEST(ALLOCATOR, operator_keeps_allocator) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  Arena arena(1 << 16);
+  const qnnp_allocator allocator = arena.allocator();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(&allocator));
+  qnnp_operator_t softargmaxOp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_softargmax_nc_q8(100, 0.1f, 0, 1.0f / 256.0f, 0, &softargmaxOp));
+  ASSERT_TRUE(arena.contains(softargmaxOp));
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(nullptr));
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(softargmaxOp));
+  ASSERT_EQ(arena.allocations(), arena.deallocations());
+  ASSERT_EQ(0, arena.foreignDeallocations());
+}
+
+TEST(ALLOCATOR, arena_exhausted) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  Arena arena(64);
+  const qnnp_allocator allocator = arena.allocator();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(&allocator));
+  qnnp_operator_t softargmaxOp = nullptr;
+  ASSERT_EQ(qnnp_status_out_of_memory,
+    qnnp_create_softargmax_nc_q8(100, 0.1f, 0, 1.0f / 256.0f, 0, &softargmaxOp));
+  ASSERT_EQ(nullptr, softargmaxOp);
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(nullptr));
+}
+
+TEST(ALLOCATOR, invalid_allocator) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_allocator allocator = { };
+  ASSERT_EQ(qnnp_status_invalid_parameter, qnnp_set_allocator(&allocator));
+}
+
+TEST(ALLOCATOR, huge_page_weights) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_weights_memory_policy policy = { };
+  policy.huge_pages = true;
+  const qnnp_status status = qnnp_set_weights_memory_policy(&policy);
+  if (status == qnnp_status_unsupported_parameter) {
+    return;
+  }
+  ASSERT_EQ(qnnp_status_success, status);
+
+  Arena arena(16 << 20);
+  const qnnp_allocator allocator = arena.allocator();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(&allocator));
+  FullyConnectedOperatorTester()
+    .batchSize(3)
+    .inputChannels(1024)
+    .outputChannels(2048)
+    .iterations(1)
+    .testQ8();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(nullptr));
+  ASSERT_EQ(qnnp_status_success, qnnp_set_weights_memory_policy(nullptr));
+
+  ASSERT_EQ(2 << 20, arena.maxAlignment());
+  ASSERT_EQ(arena.allocations(), arena.deallocations());
+}
+
+TEST(ALLOCATOR, small_weights_without_huge_pages) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_weights_memory_policy policy = { };
+  policy.huge_pages = true;
+  const qnnp_status status = qnnp_set_weights_memory_policy(&policy);
+  if (status == qnnp_status_unsupported_parameter) {
+    return;
+  }
+  ASSERT_EQ(qnnp_status_success, status);
+
+  Arena arena(1 << 20);
+  const qnnp_allocator allocator = arena.allocator();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(&allocator));
+  ConvolutionOperatorTester()
+    .inputSize(13, 14)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(1)
+    .testQ8();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_allocator(nullptr));
+  ASSERT_EQ(qnnp_status_success, qnnp_set_weights_memory_policy(nullptr));
+
+  ASSERT_EQ(64, arena.maxAlignment());
+}
+
+TEST(ALLOCATOR, numa_bound_weights) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_weights_memory_policy policy = { };
+  policy.numa_placement = qnnp_numa_placement_bind;
+  policy.node_mask = 1;
+  const qnnp_status status = qnnp_set_weights_memory_policy(&policy);
+  if (status == qnnp_status_unsupported_parameter) {
+    return;
+  }
+  ASSERT_EQ(qnnp_status_success, status);
+
+  ConvolutionOperatorTester()
+    .inputSize(13, 14)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testQ8();
+  ConvolutionOperatorTester()
+    .inputSize(15, 14)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(24)
+    .iterations(3)
+    .testQ8();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_weights_memory_policy(nullptr));
+}
+
+TEST(ALLOCATOR, interleaved_weights) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_weights_memory_policy policy = { };
+  policy.numa_placement = qnnp_numa_placement_interleave;
+  policy.node_mask = UINT64_MAX;
+  const qnnp_status status = qnnp_set_weights_memory_policy(&policy);
+  if (status == qnnp_status_unsupported_parameter) {
+    return;
+  }
+  ASSERT_EQ(qnnp_status_success, status);
+
+  FullyConnectedOperatorTester()
+    .batchSize(3)
+    .inputChannels(37)
+    .outputChannels(19)
+    .iterations(3)
+    .testQ8();
+  ASSERT_EQ(qnnp_status_success, qnnp_set_weights_memory_policy(nullptr));
+}
+
+TEST(ALLOCATOR, invalid_weights_memory_policy) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_weights_memory_policy policy = { };
+  policy.numa_placement = qnnp_numa_placement_bind;
+  ASSERT_EQ(qnnp_status_invalid_parameter, qnnp_set_weights_memory_policy(&policy));
+  policy.numa_placement = static_cast<qnnp_numa_placement>(-1);
+  policy.node_mask = 1;
+  ASSERT_EQ(qnnp_status_invalid_parameter, qnnp_set_weights_memory_policy(&policy));
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <qnnpack.h>
+#include <qnnpack/params.h>
+
+#include "average-pooling-operator-tester.h"
+#include "convolution-operator-tester.h"
+#include "global-average-pooling-operator-tester.h"
+#include "max-pooling-operator-tester.h"
+
+
+static const char* const kCachePath = "qnnpack-autotune-test.cache";
+
+static std::string readFile(const char* path) {
+  std::ifstream file(path);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+TEST(AUTOTUNE, without_cache) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  ASSERT_EQ(qnnp_status_success, qnnp_autotune(nullptr));
+  ASSERT_NE(nullptr, qnnp_params.q8conv.gemm);
+  ASSERT_NE(nullptr, qnnp_params.q8conv.conv);
+}
+
+TEST(AUTOTUNE, writes_and_reloads_cache) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  std::remove(kCachePath);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_autotune(kCachePath));
+  const struct q8conv_parameters tunedParameters = qnnp_params.q8conv;
+  const size_t tunedThreshold = qnnp_params.q8conv_xzp.kthreshold;
+  const struct q8dwconv_up_parameters tunedDw9 = qnnp_params.q8dw9;
+  const struct q8dwconv_mp_parameters tunedDw25 = qnnp_params.q8dw25;
+  const struct q8avgpool_parameters tunedAvgpool = qnnp_params.q8avgpool;
+  const struct q8gavgpool_parameters tunedGavgpool = qnnp_params.q8gavgpool;
+  const struct u8maxpool_parameters tunedMaxpool = qnnp_params.u8maxpool;
+  const std::string cache = readFile(kCachePath);
+  ASSERT_EQ(0, cache.find("QNNPACK autotune cache v2\n"));
+  ASSERT_NE(std::string::npos, cache.find("\nq8conv "));
+  ASSERT_NE(std::string::npos, cache.find("\nq8conv_xzp.kthreshold "));
+  ASSERT_NE(std::string::npos, cache.find("\nq8dwconv "));
+  ASSERT_NE(std::string::npos, cache.find("\nq8avgpool "));
+  ASSERT_NE(std::string::npos, cache.find("\nq8gavgpool "));
+  ASSERT_NE(std::string::npos, cache.find("\nu8maxpool "));
+
+  ASSERT_EQ(qnnp_status_success, qnnp_autotune(kCachePath));
+  ASSERT_EQ(tunedParameters.gemm, qnnp_params.q8conv.gemm);
+  ASSERT_EQ(tunedParameters.conv, qnnp_params.q8conv.conv);
+  ASSERT_EQ(tunedParameters.mr, qnnp_params.q8conv.mr);
+  ASSERT_EQ(tunedParameters.nr, qnnp_params.q8conv.nr);
+  ASSERT_EQ(tunedParameters.kr, qnnp_params.q8conv.kr);
+  ASSERT_EQ(tunedThreshold, qnnp_params.q8conv_xzp.kthreshold);
+  ASSERT_EQ(tunedDw9.updw, qnnp_params.q8dw9.updw);
+  ASSERT_EQ(tunedDw9.cr, qnnp_params.q8dw9.cr);
+  ASSERT_EQ(tunedDw25.mpdw, qnnp_params.q8dw25.mpdw);
+  ASSERT_EQ(tunedDw25.cr, qnnp_params.q8dw25.cr);
+  ASSERT_EQ(tunedAvgpool.gekr_lemr, qnnp_params.q8avgpool.gekr_lemr);
+  ASSERT_EQ(tunedAvgpool.kr, qnnp_params.q8avgpool.kr);
+  ASSERT_EQ(tunedGavgpool.genr_lemr, qnnp_params.q8gavgpool.genr_lemr);
+  ASSERT_EQ(tunedGavgpool.nr, qnnp_params.q8gavgpool.nr);
+  ASSERT_EQ(tunedMaxpool.gekr, qnnp_params.u8maxpool.gekr);
+  ASSERT_EQ(tunedMaxpool.kr, qnnp_params.u8maxpool.kr);
+  ASSERT_EQ(cache, readFile(kCachePath));
+  std::remove(kCachePath);
+}
+
+TEST(AUTOTUNE, retunes_on_invalid_cache) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  {
+    std::ofstream file(kCachePath);
+    file << "QNNPACK autotune cache v2\nsome other CPU\nq8conv unknown\n";
+  }
+
+  ASSERT_EQ(qnnp_status_success, qnnp_autotune(kCachePath));
+  const std::string cache = readFile(kCachePath);
+  ASSERT_EQ(std::string::npos, cache.find("some other CPU"));
+  ASSERT_EQ(std::string::npos, cache.find("unknown"));
+  std::remove(kCachePath);
+}
+
+TEST(AUTOTUNE, retunes_on_empty_cache) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  {
+    std::ofstream file(kCachePath);
+  }
+
+  ASSERT_EQ(qnnp_status_success, qnnp_autotune(kCachePath));
+  ASSERT_EQ(0, readFile(kCachePath).find("QNNPACK autotune cache v2\n"));
+  std::remove(kCachePath);
+}
+
+TEST(AUTOTUNE, retunes_on_empty_lines_in_cache) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  {
+    std::ofstream file(kCachePath);
+    file << "\n\n";
+  }
+
+  ASSERT_EQ(qnnp_status_success, qnnp_autotune(kCachePath));
+  ASSERT_EQ(0, readFile(kCachePath).find("QNNPACK autotune cache v2\n"));
+  std::remove(kCachePath);
+}
+
+TEST(AUTOTUNE, retunes_on_truncated_cache) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  {
+    std::ofstream file(kCachePath);
+    file << "QNNPACK autotune cache v2\n\n";
+  }
+
+  ASSERT_EQ(qnnp_status_success, qnnp_autotune(kCachePath));
+  const std::string cache = readFile(kCachePath);
+  ASSERT_EQ(0, cache.find("QNNPACK autotune cache v2\n"));
+  ASSERT_NE(std::string::npos, cache.find("\nq8conv "));
+  std::remove(kCachePath);
+}
+
+TEST(AUTOTUNE, convolution_after_autotune) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  ASSERT_EQ(qnnp_status_success, qnnp_autotune(nullptr));
+  ConvolutionOperatorTester()
+    .inputSize(13, 14)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testQ8();
+  ConvolutionOperatorTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .groupInputChannels(300)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(AUTOTUNE, depthwise_convolution_and_pooling_after_autotune) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  ASSERT_EQ(qnnp_status_success, qnnp_autotune(nullptr));
+  for (uint32_t kernelSize = 3; kernelSize <= 5; kernelSize += 2) {
+    ConvolutionOperatorTester()
+      .inputSize(15, 14)
+      .kernelSize(kernelSize, kernelSize)
+      .groups(27)
+      .iterations(3)
+      .testQ8();
+  }
+  for (uint32_t poolingSize = 2; poolingSize <= 5; poolingSize++) {
+    AveragePoolingOperatorTester()
+      .inputSize(poolingSize + 4, poolingSize + 3)
+      .poolingSize(poolingSize)
+      .channels(67)
+      .iterations(3)
+      .testQ8();
+    MaxPoolingOperatorTester()
+      .inputSize(poolingSize + 4, poolingSize + 3)
+      .poolingSize(poolingSize)
+      .channels(67)
+      .iterations(3)
+      .testU8();
+  }
+  for (size_t width = 1; width <= 9; width += 4) {
+    GlobalAveragePoolingOperatorTester()
+      .batchSize(2)
+      .width(width * width)
+      .channels(67)
+      .iterations(3)
+      .testQ8();
+  }
+}
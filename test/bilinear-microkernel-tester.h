@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+
+
+class BilinearMicrokernelTester {
+ public:
+  inline BilinearMicrokernelTester& pixels(size_t pixels) {
+    assert(pixels != 0);
+    this->pixels_ = pixels;
+    return *this;
+  }
+
+  inline size_t pixels() const {
+    return this->pixels_;
+  }
+
+  inline BilinearMicrokernelTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline BilinearMicrokernelTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->outputStride_ >= channels());
+      return this->outputStride_;
+    }
+  }
+
+  inline BilinearMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test(u8ibilinear_ukernel_function u8ibilinear) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto wrng = std::bind(std::uniform_int_distribution<int16_t>(0, 2048), rng);
+
+    std::vector<uint8_t> input(4 * pixels() * channels());
+    std::vector<const uint8_t*> indirectInput(4 * pixels());
+    std::vector<int16_t> weights(2 * pixels());
+    std::vector<uint8_t> output((pixels() - 1) * outputStride() + channels());
+    std::vector<uint8_t> outputRef(pixels() * channels());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(weights.begin(), weights.end(), std::ref(wrng));
+      std::fill(output.begin(), output.end(), 0xA5);
+      /* Corners are stored in random order to catch kernels which ignore the indirection buffer */
+      for (size_t i = 0; i < indirectInput.size(); i++) {
+        indirectInput[i] = input.data() + i * channels();
+      }
+      std::shuffle(indirectInput.begin(), indirectInput.end(), rng);
+
+      /* Compute reference results, in the same fixed-point arithmetic as micro-kernels */
+      for (size_t i = 0; i < pixels(); i++) {
+        const int32_t alphaH = int32_t(weights[i * 2]);
+        const int32_t alphaV = int32_t(weights[i * 2 + 1]);
+        for (size_t c = 0; c < channels(); c++) {
+          const int32_t topLeft = int32_t(indirectInput[i * 4 + 0][c]);
+          const int32_t topRight = int32_t(indirectInput[i * 4 + 1][c]);
+          const int32_t bottomLeft = int32_t(indirectInput[i * 4 + 2][c]);
+          const int32_t bottomRight = int32_t(indirectInput[i * 4 + 3][c]);
+          const int32_t top = ((topLeft << 11) + (topRight - topLeft) * alphaH + 8) >> 4;
+          const int32_t bottom = ((bottomLeft << 11) + (bottomRight - bottomLeft) * alphaH + 8) >> 4;
+          const int32_t acc = (top << 11) + (bottom - top) * alphaV;
+          outputRef[i * channels() + c] = uint8_t((acc + 0x20000) >> 18);
+
+          /* Fixed-point result must also be within 1 of the exact bilinear interpolation */
+          const double fAlphaH = double(alphaH) / 2048.0;
+          const double fAlphaV = double(alphaV) / 2048.0;
+          const double fTop = double(topLeft) + double(topRight - topLeft) * fAlphaH;
+          const double fBottom = double(bottomLeft) + double(bottomRight - bottomLeft) * fAlphaH;
+          ASSERT_NEAR(double(outputRef[i * channels() + c]), fTop + (fBottom - fTop) * fAlphaV, 1.0);
+        }
+      }
+
+      /* Call optimized micro-kernel */
+      u8ibilinear(
+        pixels(), channels(),
+        indirectInput.data(), weights.data(),
+        output.data(), (outputStride() - channels()) * sizeof(uint8_t));
+
+      /* Verify results */
+      for (size_t i = 0; i < pixels(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_EQ(uint32_t(outputRef[i * channels() + c]), uint32_t(output[i * outputStride() + c]))
+            << "at pixel " << i << ", channel " << c << ", channels = " << channels();
+        }
+      }
+    }
+  }
+
+ private:
+  size_t pixels_{1};
+  size_t channels_{1};
+  size_t outputStride_{0};
+  size_t iterations_{3};
+};
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+#include <pthreadpool.h>
+
+
+class ConcatTester {
+ public:
+  enum class Producer {
+    Convolution1x1,
+    Convolution3x3,
+    DepthwiseConvolution,
+    Deconvolution,
+    FullyConnected,
+    MaxPooling,
+    AveragePooling,
+    GlobalAveragePooling,
+    ChannelShuffle,
+    Add,
+    Multiply,
+    Clamp,
+    LUT,
+    Sigmoid,
+    LeakyReLU,
+    SoftArgMax,
+  };
+
+  inline ConcatTester& inputChannels(std::vector<size_t> inputChannels) {
+    assert(!inputChannels.empty());
+    this->inputChannels_ = std::move(inputChannels);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& inputChannels() const {
+    return this->inputChannels_;
+  }
+
+  inline size_t outputChannels() const {
+    return std::accumulate(this->inputChannels_.cbegin(), this->inputChannels_.cend(), size_t(0));
+  }
+
+  inline ConcatTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return outputChannels();
+    } else {
+      assert(this->outputStride_ >= outputChannels());
+      return this->outputStride_;
+    }
+  }
+
+  inline ConcatTester& batchSize(size_t batchSize) {
+    assert(batchSize != 0);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline ConcatTester& inputSize(size_t inputHeight, size_t inputWidth) {
+    assert(inputHeight >= 1);
+    assert(inputWidth >= 1);
+    this->inputHeight_ = inputHeight;
+    this->inputWidth_ = inputWidth;
+    return *this;
+  }
+
+  inline size_t inputHeight() const {
+    return this->inputHeight_;
+  }
+
+  inline size_t inputWidth() const {
+    return this->inputWidth_;
+  }
+
+  inline ConcatTester& threads(size_t threads) {
+    this->threads_ = threads;
+    return *this;
+  }
+
+  inline size_t threads() const {
+    return this->threads_;
+  }
+
+  inline ConcatTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  /*
+   * Sets up one producer per input to write its channel slice of a concatenated output, runs all producers
+   * concurrently as a graph, and compares with the outputs of the producers run alone into contiguous buffers.
+   * Output bytes between pixels which belong to no slice must be left untouched.
+   */
+  void testProducer(Producer producer) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+
+    const size_t producers = inputChannels().size();
+    const size_t pixels = producer == Producer::GlobalAveragePooling ?
+      batchSize() : batchSize() * inputHeight() * inputWidth();
+
+    std::vector<std::vector<uint8_t>> inputs(producers);
+    std::vector<std::vector<uint8_t>> secondInputs(producers);
+    std::vector<std::vector<uint8_t>> kernels(producers);
+    std::vector<std::vector<int32_t>> biases(producers);
+    std::vector<std::vector<uint8_t>> outputsRef(producers);
+    std::vector<uint8_t> lookupTable(256);
+    std::vector<uint8_t> output((pixels - 1) * outputStride() + outputChannels());
+    std::vector<uint8_t*> slices(producers);
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_NE(nullptr, threadpool);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(lookupTable.begin(), lookupTable.end(), std::ref(u8rng));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      std::vector<qnnp_operator_t> ops(producers, nullptr);
+      for (size_t i = 0; i < producers; i++) {
+        const size_t channels = inputChannels()[i];
+        const size_t producerInputChannels = producerChannels(producer, channels);
+        inputs[i].resize(batchSize() * inputHeight() * inputWidth() * producerInputChannels);
+        secondInputs[i].resize(pixels * channels);
+        kernels[i].resize(channels * 9 * producerInputChannels);
+        biases[i].resize(channels);
+        outputsRef[i].resize(pixels * channels);
+        std::generate(inputs[i].begin(), inputs[i].end(), std::ref(u8rng));
+        std::generate(secondInputs[i].begin(), secondInputs[i].end(), std::ref(u8rng));
+        std::generate(kernels[i].begin(), kernels[i].end(), std::ref(u8rng));
+        std::generate(biases[i].begin(), biases[i].end(), std::ref(s32rng));
+
+        ASSERT_EQ(qnnp_status_success,
+          createProducer(producer, channels, kernels[i].data(), biases[i].data(), lookupTable.data(), &ops[i]));
+        ASSERT_NE(nullptr, ops[i]);
+      }
+
+      /* Compute reference results by running every producer alone into a contiguous output */
+      for (size_t i = 0; i < producers; i++) {
+        std::fill(outputsRef[i].begin(), outputsRef[i].end(), 0xA5);
+        ASSERT_EQ(qnnp_status_success,
+          setupProducer(
+            producer, ops[i], inputChannels()[i],
+            inputs[i].data(), secondInputs[i].data(),
+            outputsRef[i].data(), inputChannels()[i],
+            threadpool));
+        ASSERT_EQ(qnnp_status_success, qnnp_run_operator(ops[i], nullptr /* thread pool */));
+      }
+
+      std::fill(output.begin(), output.end(), 0xA5);
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_plan_concat_nc_x8(
+          producers, inputChannels().data(),
+          output.data(), outputStride(),
+          slices.data()));
+      for (size_t i = 0; i < producers; i++) {
+        ASSERT_EQ(qnnp_status_success,
+          setupProducer(
+            producer, ops[i], inputChannels()[i],
+            inputs[i].data(), secondInputs[i].data(),
+            slices[i], outputStride(),
+            threadpool));
+      }
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator_graph(producers, ops.data(), 0, nullptr, threadpool));
+
+      for (size_t i = 0; i < producers; i++) {
+        ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(ops[i]));
+        ops[i] = nullptr;
+      }
+
+      /* Verify results */
+      for (size_t p = 0; p < pixels; p++) {
+        size_t channelOffset = 0;
+        for (size_t i = 0; i < producers; i++) {
+          for (size_t c = 0; c < inputChannels()[i]; c++) {
+            ASSERT_EQ(uint32_t(outputsRef[i][p * inputChannels()[i] + c]),
+                uint32_t(output[p * outputStride() + channelOffset + c]))
+              << "at pixel " << p << ", input " << i << ", channel " << c
+              << ", output stride = " << outputStride();
+          }
+          channelOffset += inputChannels()[i];
+        }
+        if (p + 1 != pixels) {
+          for (size_t c = outputChannels(); c < outputStride(); c++) {
+            ASSERT_EQ(0xA5, uint32_t(output[p * outputStride() + c]))
+              << "at pixel " << p << ", padding channel " << c
+              << ", output stride = " << outputStride();
+          }
+        }
+      }
+    }
+    pthreadpool_destroy(threadpool);
+  }
+
+ private:
+  static size_t producerChannels(Producer producer, size_t channels) {
+    switch (producer) {
+      case Producer::Convolution1x1:
+      case Producer::Convolution3x3:
+      case Producer::Deconvolution:
+      case Producer::FullyConnected:
+        return 7;
+      default:
+        return channels;
+    }
+  }
+
+  static qnnp_status createProducer(
+      Producer producer,
+      size_t channels,
+      const uint8_t* kernel,
+      const int32_t* bias,
+      const uint8_t* lookupTable,
+      qnnp_operator_t* op)
+  {
+    const size_t inputChannels = producerChannels(producer, channels);
+    switch (producer) {
+      case Producer::Convolution1x1:
+        return qnnp_create_convolution2d_nhwc_q8(
+          0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+          inputChannels, channels,
+          127, 1.0f, 127, 1.0f,
+          kernel, bias,
+          127, 1024.0f, 0, 255,
+          0, op);
+      case Producer::Convolution3x3:
+        return qnnp_create_convolution2d_nhwc_q8(
+          1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1,
+          inputChannels, channels,
+          127, 1.0f, 127, 1.0f,
+          kernel, bias,
+          127, 4096.0f, 0, 255,
+          0, op);
+      case Producer::DepthwiseConvolution:
+        return qnnp_create_convolution2d_nhwc_q8(
+          1, 1, 1, 1, 3, 3, 1, 1, 1, 1, channels,
+          1, 1,
+          127, 1.0f, 127, 1.0f,
+          kernel, bias,
+          127, 512.0f, 0, 255,
+          0, op);
+      case Producer::Deconvolution:
+        return qnnp_create_deconvolution2d_nhwc_q8(
+          1, 1, 1, 1, 0, 0, 3, 3, 1, 1, 1, 1, 1,
+          inputChannels, channels,
+          127, 1.0f, 127, 1.0f,
+          kernel, bias,
+          127, 4096.0f, 0, 255,
+          0, op);
+      case Producer::FullyConnected:
+        return qnnp_create_fully_connected_nc_q8(
+          inputChannels, channels,
+          127, 1.0f, 127, 1.0f,
+          kernel, bias,
+          127, 1024.0f, 0, 255,
+          0, op);
+      case Producer::MaxPooling:
+        return qnnp_create_max_pooling2d_nhwc_u8(
+          1, 1, 1, 1, 3, 3, 1, 1, 1, 1,
+          channels, 0, 255,
+          0, op);
+      case Producer::AveragePooling:
+        return qnnp_create_average_pooling2d_nhwc_q8(
+          1, 1, 1, 1, 3, 3, 1, 1,
+          channels,
+          127, 1.0f, 127, 1.0f, 0, 255,
+          0, op);
+      case Producer::GlobalAveragePooling:
+        return qnnp_create_global_average_pooling_nwc_q8(
+          channels,
+          127, 1.0f, 127, 1.0f, 0, 255,
+          0, op);
+      case Producer::ChannelShuffle:
+        return channels % 2 == 0 ?
+          qnnp_create_channel_shuffle_nc_x8(2, channels / 2, 0, op) :
+          qnnp_create_channel_shuffle_nc_x8(channels, 1, 0, op);
+      case Producer::Add:
+        return qnnp_create_add_nc_q8(
+          channels,
+          127, 1.0f, 127, 0.5f, 127, 1.5f, 0, 255,
+          0, op);
+      case Producer::Multiply:
+        return qnnp_create_multiply_nc_q8(
+          channels,
+          127, 1.0f, 127, 1.0f, 127, 64.0f, 0, 255,
+          0, op);
+      case Producer::Clamp:
+        return qnnp_create_clamp_nc_u8(channels, 32, 224, 0, op);
+      case Producer::LUT:
+        return qnnp_create_lut_nc_x8(channels, lookupTable, 0, op);
+      case Producer::Sigmoid:
+        return qnnp_create_sigmoid_nc_q8(
+          channels,
+          127, 0.125f, 0, 1.0f / 256.0f, 0, 255,
+          0, op);
+      case Producer::LeakyReLU:
+        return qnnp_create_leaky_relu_nc_q8(
+          channels, 0.25f,
+          127, 1.0f, 127, 1.0f, 0, 255,
+          0, op);
+      case Producer::SoftArgMax:
+        return qnnp_create_softargmax_nc_q8(
+          channels, 0.125f, 0, 1.0f / 256.0f,
+          0, op);
+    }
+    return qnnp_status_invalid_parameter;
+  }
+
+  qnnp_status setupProducer(
+      Producer producer,
+      qnnp_operator_t op,
+      size_t channels,
+      const uint8_t* input,
+      const uint8_t* secondInput,
+      uint8_t* output,
+      size_t outputStride,
+      pthreadpool_t threadpool) const
+  {
+    const size_t inputChannels = producerChannels(producer, channels);
+    const size_t pixels = batchSize() * inputHeight() * inputWidth();
+    switch (producer) {
+      case Producer::Convolution1x1:
+      case Producer::Convolution3x3:
+      case Producer::DepthwiseConvolution:
+        return qnnp_setup_convolution2d_nhwc_q8(
+          op, batchSize(), inputHeight(), inputWidth(),
+          input, inputChannels,
+          output, outputStride,
+          threadpool);
+      case Producer::Deconvolution:
+        return qnnp_setup_deconvolution2d_nhwc_q8(
+          op, batchSize(), inputHeight(), inputWidth(),
+          input, inputChannels,
+          output, outputStride,
+          threadpool);
+      case Producer::FullyConnected:
+        return qnnp_setup_fully_connected_nc_q8(
+          op, pixels,
+          input, inputChannels,
+          output, outputStride);
+      case Producer::MaxPooling:
+        return qnnp_setup_max_pooling2d_nhwc_u8(
+          op, batchSize(), inputHeight(), inputWidth(),
+          input, inputChannels,
+          output, outputStride,
+          threadpool);
+      case Producer::AveragePooling:
+        return qnnp_setup_average_pooling2d_nhwc_q8(
+          op, batchSize(), inputHeight(), inputWidth(),
+          input, inputChannels,
+          output, outputStride,
+          threadpool);
+      case Producer::GlobalAveragePooling:
+        return qnnp_setup_global_average_pooling_nwc_q8(
+          op, batchSize(), inputHeight() * inputWidth(),
+          input, inputChannels,
+          output, outputStride);
+      case Producer::ChannelShuffle:
+        return qnnp_setup_channel_shuffle_nc_x8(
+          op, pixels,
+          input, inputChannels,
+          output, outputStride);
+      case Producer::Add:
+        return qnnp_setup_add_nc_q8(
+          op, pixels,
+          input, inputChannels,
+          secondInput, channels,
+          output, outputStride);
+      case Producer::Multiply:
+        return qnnp_setup_multiply_nc_q8(
+          op, pixels,
+          input, inputChannels,
+          secondInput, pixels, channels,
+          output, outputStride);
+      case Producer::Clamp:
+        return qnnp_setup_clamp_nc_u8(
+          op, pixels,
+          input, inputChannels,
+          output, outputStride);
+      case Producer::LUT:
+        return qnnp_setup_lut_nc_x8(
+          op, pixels,
+          input, inputChannels,
+          output, outputStride);
+      case Producer::Sigmoid:
+        return qnnp_setup_sigmoid_nc_q8(
+          op, pixels,
+          input, inputChannels,
+          output, outputStride);
+      case Producer::LeakyReLU:
+        return qnnp_setup_leaky_relu_nc_q8(
+          op, pixels,
+          input, inputChannels,
+          output, outputStride);
+      case Producer::SoftArgMax:
+        return qnnp_setup_softargmax_nc_q8(
+          op, pixels,
+          input, inputChannels,
+          output, outputStride);
+    }
+    return qnnp_status_invalid_parameter;
+  }
+
+  std::vector<size_t> inputChannels_{3, 17, 8};
+  size_t outputStride_{0};
+  size_t batchSize_{2};
+  size_t inputHeight_{5};
+  size_t inputWidth_{6};
+  size_t threads_{4};
+  size_t iterations_{3};
+};
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "concat-tester.h"
+
+
+TEST(CONCAT, invalid_parameters) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  uint8_t output[64];
+  uint8_t* slices[3] = { nullptr, nullptr, nullptr };
+  const size_t channels[3] = { 8, 0, 16 };
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_plan_concat_nc_x8(0, channels, output, 64, slices));
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_plan_concat_nc_x8(3, channels, output, 64, slices));
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_plan_concat_nc_x8(1, channels + 2, output, 15, slices));
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_plan_concat_nc_x8(1, nullptr, output, 16, slices));
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_plan_concat_nc_x8(1, channels + 2, nullptr, 16, slices));
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_plan_concat_nc_x8(1, channels + 2, output, 16, nullptr));
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_plan_concat_nc_x8(1, channels + 2, output, 16, slices));
+  ASSERT_EQ(output, slices[0]);
+}
+
+TEST(CONCAT, slice_offsets) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  uint8_t output[64];
+  uint8_t* slices[3] = { nullptr, nullptr, nullptr };
+  const size_t channels[3] = { 3, 17, 8 };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_plan_concat_nc_x8(3, channels, output, 32, slices));
+  ASSERT_EQ(output, slices[0]);
+  ASSERT_EQ(output + 3, slices[1]);
+  ASSERT_EQ(output + 20, slices[2]);
+}
+
+TEST(CONCAT, convolution_1x1) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::Convolution1x1);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::Convolution1x1);
+}
+
+TEST(CONCAT, convolution_1x1_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::Convolution1x1);
+  }
+}
+
+TEST(CONCAT, convolution_3x3) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::Convolution3x3);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::Convolution3x3);
+}
+
+TEST(CONCAT, convolution_3x3_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::Convolution3x3);
+  }
+}
+
+TEST(CONCAT, depthwise_convolution) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::DepthwiseConvolution);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::DepthwiseConvolution);
+}
+
+TEST(CONCAT, depthwise_convolution_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::DepthwiseConvolution);
+  }
+}
+
+TEST(CONCAT, deconvolution) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::Deconvolution);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::Deconvolution);
+}
+
+TEST(CONCAT, deconvolution_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::Deconvolution);
+  }
+}
+
+TEST(CONCAT, fully_connected) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::FullyConnected);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::FullyConnected);
+}
+
+TEST(CONCAT, fully_connected_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::FullyConnected);
+  }
+}
+
+TEST(CONCAT, max_pooling) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::MaxPooling);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::MaxPooling);
+}
+
+TEST(CONCAT, max_pooling_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::MaxPooling);
+  }
+}
+
+TEST(CONCAT, average_pooling) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::AveragePooling);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::AveragePooling);
+}
+
+TEST(CONCAT, average_pooling_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::AveragePooling);
+  }
+}
+
+TEST(CONCAT, global_average_pooling) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::GlobalAveragePooling);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::GlobalAveragePooling);
+}
+
+TEST(CONCAT, global_average_pooling_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::GlobalAveragePooling);
+  }
+}
+
+TEST(CONCAT, channel_shuffle) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::ChannelShuffle);
+  ConcatTester()
+    .inputChannels({ 2, 17, 8 })
+    .testProducer(ConcatTester::Producer::ChannelShuffle);
+}
+
+TEST(CONCAT, channel_shuffle_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 2, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::ChannelShuffle);
+  }
+}
+
+TEST(CONCAT, add) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::Add);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::Add);
+}
+
+TEST(CONCAT, add_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::Add);
+  }
+}
+
+TEST(CONCAT, multiply) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::Multiply);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::Multiply);
+}
+
+TEST(CONCAT, multiply_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::Multiply);
+  }
+}
+
+TEST(CONCAT, clamp) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::Clamp);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::Clamp);
+}
+
+TEST(CONCAT, clamp_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::Clamp);
+  }
+}
+
+TEST(CONCAT, lut) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::LUT);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::LUT);
+}
+
+TEST(CONCAT, lut_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::LUT);
+  }
+}
+
+TEST(CONCAT, sigmoid) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::Sigmoid);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::Sigmoid);
+}
+
+TEST(CONCAT, sigmoid_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::Sigmoid);
+  }
+}
+
+TEST(CONCAT, leaky_relu) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::LeakyReLU);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::LeakyReLU);
+}
+
+TEST(CONCAT, leaky_relu_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::LeakyReLU);
+  }
+}
+
+TEST(CONCAT, softargmax) {
+  ConcatTester()
+    .inputChannels({ 8, 8 })
+    .testProducer(ConcatTester::Producer::SoftArgMax);
+  ConcatTester()
+    .inputChannels({ 1, 17, 8 })
+    .testProducer(ConcatTester::Producer::SoftArgMax);
+}
+
+TEST(CONCAT, softargmax_with_output_stride) {
+  for (size_t outputStride = 28; outputStride <= 43; outputStride += 5) {
+    ConcatTester()
+      .inputChannels({ 1, 17, 8 })
+      .outputStride(outputStride)
+      .testProducer(ConcatTester::Producer::SoftArgMax);
+  }
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+#include <pthreadpool.h>
+
+#include <qnnpack.h>
+
+
+class ConstantPadOperatorTester {
+ public:
+  inline ConstantPadOperatorTester& inputShape(std::initializer_list<size_t> inputShape) {
+    assert(inputShape.size() <= QNNP_MAX_TENSOR_DIMS);
+    this->inputShape_ = std::vector<size_t>(inputShape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& inputShape() const {
+    return this->inputShape_;
+  }
+
+  inline size_t numDims() const {
+    return this->inputShape_.size();
+  }
+
+  inline ConstantPadOperatorTester& prePaddings(std::initializer_list<size_t> prePaddings) {
+    assert(prePaddings.size() <= QNNP_MAX_TENSOR_DIMS);
+    this->prePaddings_ = std::vector<size_t>(prePaddings);
+    return *this;
+  }
+
+  inline size_t prePadding(size_t dim) const {
+    return dim < this->prePaddings_.size() ? this->prePaddings_[dim] : 0;
+  }
+
+  inline ConstantPadOperatorTester& postPaddings(std::initializer_list<size_t> postPaddings) {
+    assert(postPaddings.size() <= QNNP_MAX_TENSOR_DIMS);
+    this->postPaddings_ = std::vector<size_t>(postPaddings);
+    return *this;
+  }
+
+  inline size_t postPadding(size_t dim) const {
+    return dim < this->postPaddings_.size() ? this->postPaddings_[dim] : 0;
+  }
+
+  inline ConstantPadOperatorTester& paddingValue(uint8_t paddingValue) {
+    this->paddingValue_ = paddingValue;
+    return *this;
+  }
+
+  inline uint8_t paddingValue() const {
+    return this->paddingValue_;
+  }
+
+  inline ConstantPadOperatorTester& threads(size_t threads) {
+    this->threads_ = threads;
+    return *this;
+  }
+
+  inline size_t threads() const {
+    return this->threads_;
+  }
+
+  inline ConstantPadOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testX8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<size_t> prePaddings(numDims());
+    std::vector<size_t> postPaddings(numDims());
+    std::vector<size_t> outputShape(numDims());
+    size_t inputElements = 1;
+    size_t outputElements = 1;
+    for (size_t dim = 0; dim < numDims(); dim++) {
+      prePaddings[dim] = prePadding(dim);
+      postPaddings[dim] = postPadding(dim);
+      outputShape[dim] = prePaddings[dim] + inputShape()[dim] + postPaddings[dim];
+      inputElements *= inputShape()[dim];
+      outputElements *= outputShape[dim];
+    }
+
+    std::vector<uint8_t> input(inputElements);
+    std::vector<uint8_t> output(outputElements);
+    std::vector<uint8_t> outputRef(outputElements);
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_TRUE(threadpool != nullptr);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), uint8_t(paddingValue() ^ 0xFF));
+
+      /* Compute reference results */
+      for (size_t outputIndex = 0; outputIndex < outputElements; outputIndex++) {
+        size_t remainder = outputIndex;
+        size_t inputIndex = 0;
+        size_t inputStride = 1;
+        bool padding = false;
+        for (size_t dim = numDims(); dim != 0; dim--) {
+          const size_t position = remainder % outputShape[dim - 1];
+          remainder /= outputShape[dim - 1];
+          if (position < prePaddings[dim - 1] || position >= prePaddings[dim - 1] + inputShape()[dim - 1]) {
+            padding = true;
+          } else {
+            inputIndex += (position - prePaddings[dim - 1]) * inputStride;
+          }
+          inputStride *= inputShape()[dim - 1];
+        }
+        outputRef[outputIndex] = padding ? paddingValue() : input[inputIndex];
+      }
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t constantPad = nullptr;
+
+      ASSERT_EQ(qnnp_status_success, qnnp_create_constant_pad_nd_x8(paddingValue(), 0, &constantPad));
+      ASSERT_NE(nullptr, constantPad);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_constant_pad_nd_x8(
+          constantPad,
+          numDims(), inputShape().data(), prePaddings.data(), postPaddings.data(),
+          input.data(), output.data(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_run_operator(constantPad, threadpool));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(constantPad));
+      constantPad = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < outputElements; i++) {
+        ASSERT_EQ(uint32_t(outputRef[i]), uint32_t(output[i])) << "at output element " << i;
+      }
+    }
+
+    pthreadpool_destroy(threadpool);
+  }
+
+ private:
+  std::vector<size_t> inputShape_;
+  std::vector<size_t> prePaddings_;
+  std::vector<size_t> postPaddings_;
+  uint8_t paddingValue_{0};
+  size_t threads_{1};
+  size_t iterations_{1};
+};
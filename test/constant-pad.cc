@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "constant-pad-operator-tester.h"
+
+
+TEST(CONSTANT_PAD_OP, 1d) {
+  ConstantPadOperatorTester()
+    .inputShape({29})
+    .prePaddings({3})
+    .postPaddings({5})
+    .paddingValue(7)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, 1d_no_padding) {
+  ConstantPadOperatorTester()
+    .inputShape({29})
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, 2d) {
+  ConstantPadOperatorTester()
+    .inputShape({11, 29})
+    .prePaddings({2, 3})
+    .postPaddings({1, 5})
+    .paddingValue(7)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, 2d_pad_rows_only) {
+  ConstantPadOperatorTester()
+    .inputShape({11, 29})
+    .prePaddings({2, 0})
+    .postPaddings({3, 0})
+    .paddingValue(7)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, 2d_pad_columns_only) {
+  ConstantPadOperatorTester()
+    .inputShape({11, 29})
+    .prePaddings({0, 17})
+    .postPaddings({0, 19})
+    .paddingValue(7)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, nhwc_spatial) {
+  ConstantPadOperatorTester()
+    .inputShape({2, 7, 9, 19})
+    .prePaddings({0, 1, 2, 0})
+    .postPaddings({0, 2, 1, 0})
+    .paddingValue(128)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, nhwc_channels) {
+  ConstantPadOperatorTester()
+    .inputShape({2, 7, 9, 19})
+    .prePaddings({0, 0, 0, 3})
+    .postPaddings({0, 0, 0, 10})
+    .paddingValue(128)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, nhwc_all_dims) {
+  ConstantPadOperatorTester()
+    .inputShape({2, 7, 9, 19})
+    .prePaddings({1, 1, 2, 3})
+    .postPaddings({2, 2, 1, 4})
+    .paddingValue(128)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, 5d) {
+  ConstantPadOperatorTester()
+    .inputShape({2, 3, 4, 5, 6})
+    .prePaddings({1, 0, 2, 1, 3})
+    .postPaddings({0, 2, 1, 1, 2})
+    .paddingValue(33)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, 6d) {
+  ConstantPadOperatorTester()
+    .inputShape({2, 3, 2, 3, 4, 5})
+    .prePaddings({1, 2, 0, 1, 2, 3})
+    .postPaddings({2, 1, 1, 0, 1, 2})
+    .paddingValue(33)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, multithreaded) {
+  ConstantPadOperatorTester()
+    .inputShape({2, 7, 9, 19})
+    .prePaddings({1, 1, 2, 3})
+    .postPaddings({2, 2, 1, 4})
+    .paddingValue(128)
+    .threads(3)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, multithreaded_single_image_wide_rows) {
+  ConstantPadOperatorTester()
+    .inputShape({1, 20, 23, 97})
+    .prePaddings({0, 3, 1, 0})
+    .postPaddings({0, 2, 2, 0})
+    .paddingValue(128)
+    .threads(3)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, multithreaded_padded_batch_wide_rows) {
+  ConstantPadOperatorTester()
+    .inputShape({2, 5, 11, 211})
+    .prePaddings({1, 1, 0, 3})
+    .postPaddings({1, 2, 0, 2})
+    .paddingValue(128)
+    .threads(3)
+    .iterations(3)
+    .testX8();
+}
+
+TEST(CONSTANT_PAD_OP, fold_spatial_padding_into_convolution) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const size_t prePaddings[4] = { 0, 1, 2, 0 };
+  const size_t postPaddings[4] = { 0, 3, 4, 0 };
+  uint32_t top = 1, right = 1, bottom = 1, left = 1;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_fold_constant_pad_into_convolution2d_nhwc_q8(
+      prePaddings, postPaddings, 127, 127, &top, &right, &bottom, &left));
+  ASSERT_EQ(2, top);
+  ASSERT_EQ(5, right);
+  ASSERT_EQ(4, bottom);
+  ASSERT_EQ(3, left);
+}
+
+TEST(CONSTANT_PAD_OP, no_fold_with_channel_padding) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const size_t prePaddings[4] = { 0, 1, 1, 0 };
+  const size_t postPaddings[4] = { 0, 1, 1, 2 };
+  uint32_t top = 0, right = 0, bottom = 0, left = 0;
+  ASSERT_EQ(qnnp_status_unsupported_parameter,
+    qnnp_fold_constant_pad_into_convolution2d_nhwc_q8(
+      prePaddings, postPaddings, 127, 127, &top, &right, &bottom, &left));
+  ASSERT_EQ(0, top);
+  ASSERT_EQ(0, right);
+  ASSERT_EQ(0, bottom);
+  ASSERT_EQ(0, left);
+}
+
+TEST(CONSTANT_PAD_OP, no_fold_with_value_other_than_zero_point) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const size_t prePaddings[4] = { 0, 1, 1, 0 };
+  const size_t postPaddings[4] = { 0, 1, 1, 0 };
+  uint32_t top = 0, right = 0, bottom = 0, left = 0;
+  ASSERT_EQ(qnnp_status_unsupported_parameter,
+    qnnp_fold_constant_pad_into_convolution2d_nhwc_q8(
+      prePaddings, postPaddings, 0, 127, &top, &right, &bottom, &left));
+  ASSERT_EQ(0, top);
+}
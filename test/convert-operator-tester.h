@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <pthreadpool.h>
+
+#include <qnnpack.h>
+
+
+class ConvertOperatorTester {
+ public:
+  inline ConvertOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline ConvertOperatorTester& inputSize(size_t inputHeight, size_t inputWidth) {
+    assert(inputHeight >= 1);
+    assert(inputWidth >= 1);
+    this->inputHeight_ = inputHeight;
+    this->inputWidth_ = inputWidth;
+    return *this;
+  }
+
+  inline size_t inputHeight() const {
+    return this->inputHeight_;
+  }
+
+  inline size_t inputWidth() const {
+    return this->inputWidth_;
+  }
+
+  inline ConvertOperatorTester& pixelStride(size_t pixelStride) {
+    assert(pixelStride != 0);
+    this->pixelStride_ = pixelStride;
+    return *this;
+  }
+
+  inline size_t pixelStride() const {
+    if (this->pixelStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->pixelStride_ >= channels());
+      return this->pixelStride_;
+    }
+  }
+
+  inline ConvertOperatorTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline ConvertOperatorTester& threads(size_t threads) {
+    this->threads_ = threads;
+    return *this;
+  }
+
+  inline size_t threads() const {
+    return this->threads_;
+  }
+
+  inline ConvertOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testNCHWtoNHWCX8() const {
+    testNCHWtoNHWC<uint8_t>(qnnp_create_convert_nchw_nhwc_x8,
+      [](qnnp_operator_t op, size_t n, size_t h, size_t w, const uint8_t* x, uint8_t* y, size_t yStride) {
+        return qnnp_setup_convert_nchw_nhwc_x8(op, n, h, w, x, y, yStride);
+      });
+  }
+
+  void testNCHWtoNHWCX32() const {
+    testNCHWtoNHWC<uint32_t>(qnnp_create_convert_nchw_nhwc_x32,
+      [](qnnp_operator_t op, size_t n, size_t h, size_t w, const uint32_t* x, uint32_t* y, size_t yStride) {
+        return qnnp_setup_convert_nchw_nhwc_x32(op, n, h, w, x, y, yStride);
+      });
+  }
+
+  void testNHWCtoNCHWX8() const {
+    testNHWCtoNCHW<uint8_t>(qnnp_create_convert_nhwc_nchw_x8,
+      [](qnnp_operator_t op, size_t n, size_t h, size_t w, const uint8_t* x, size_t xStride, uint8_t* y) {
+        return qnnp_setup_convert_nhwc_nchw_x8(op, n, h, w, x, xStride, y);
+      });
+  }
+
+  void testNHWCtoNCHWX32() const {
+    testNHWCtoNCHW<uint32_t>(qnnp_create_convert_nhwc_nchw_x32,
+      [](qnnp_operator_t op, size_t n, size_t h, size_t w, const uint32_t* x, size_t xStride, uint32_t* y) {
+        return qnnp_setup_convert_nhwc_nchw_x32(op, n, h, w, x, xStride, y);
+      });
+  }
+
+ private:
+  template<typename T, typename Setup>
+  void testNCHWtoNHWC(qnnp_status (*create)(size_t, uint32_t, qnnp_operator_t*), Setup setup) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto xrng = std::bind(std::uniform_int_distribution<T>(), rng);
+
+    const size_t pixels = inputHeight() * inputWidth();
+    std::vector<T> input(batchSize() * channels() * pixels);
+    std::vector<T> output((batchSize() * pixels - 1) * pixelStride() + channels());
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_TRUE(threadpool != nullptr);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(xrng));
+      std::fill(output.begin(), output.end(), T(0xA5A5A5A5));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t convert = nullptr;
+
+      ASSERT_EQ(qnnp_status_success, create(channels(), 0, &convert));
+      ASSERT_NE(nullptr, convert);
+
+      ASSERT_EQ(qnnp_status_success,
+        setup(convert, batchSize(), inputHeight(), inputWidth(), input.data(), output.data(), pixelStride()));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_run_operator(convert, threadpool));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(convert));
+      convert = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t p = 0; p < pixels; p++) {
+          for (size_t c = 0; c < channels(); c++) {
+            ASSERT_EQ(uint32_t(input[(i * channels() + c) * pixels + p]), uint32_t(output[(i * pixels + p) * pixelStride() + c]))
+              << "batch index = " << i << ", pixel = " << p << ", channel = " << c;
+          }
+        }
+      }
+    }
+
+    pthreadpool_destroy(threadpool);
+  }
+
+  template<typename T, typename Setup>
+  void testNHWCtoNCHW(qnnp_status (*create)(size_t, uint32_t, qnnp_operator_t*), Setup setup) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto xrng = std::bind(std::uniform_int_distribution<T>(), rng);
+
+    const size_t pixels = inputHeight() * inputWidth();
+    std::vector<T> input((batchSize() * pixels - 1) * pixelStride() + channels());
+    std::vector<T> output(batchSize() * channels() * pixels);
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_TRUE(threadpool != nullptr);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(xrng));
+      std::fill(output.begin(), output.end(), T(0xA5A5A5A5));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t convert = nullptr;
+
+      ASSERT_EQ(qnnp_status_success, create(channels(), 0, &convert));
+      ASSERT_NE(nullptr, convert);
+
+      ASSERT_EQ(qnnp_status_success,
+        setup(convert, batchSize(), inputHeight(), inputWidth(), input.data(), pixelStride(), output.data()));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_run_operator(convert, threadpool));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(convert));
+      convert = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t p = 0; p < pixels; p++) {
+          for (size_t c = 0; c < channels(); c++) {
+            ASSERT_EQ(uint32_t(input[(i * pixels + p) * pixelStride() + c]), uint32_t(output[(i * channels() + c) * pixels + p]))
+              << "batch index = " << i << ", pixel = " << p << ", channel = " << c;
+          }
+        }
+      }
+    }
+
+    pthreadpool_destroy(threadpool);
+  }
+
+  size_t channels_{1};
+  size_t inputHeight_{1};
+  size_t inputWidth_{1};
+  size_t pixelStride_{0};
+  size_t batchSize_{1};
+  size_t threads_{1};
+  size_t iterations_{1};
+};
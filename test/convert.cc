@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "convert-operator-tester.h"
+
+
+TEST(CONVERT_NCHW_NHWC_X8, unit_batch) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(3)
+    .iterations(3)
+    .testNCHWtoNHWCX8();
+}
+
+TEST(CONVERT_NCHW_NHWC_X8, unit_batch_many_channels) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(67)
+    .iterations(3)
+    .testNCHWtoNHWCX8();
+}
+
+TEST(CONVERT_NCHW_NHWC_X8, unit_batch_with_pixel_stride) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(19)
+    .pixelStride(23)
+    .iterations(3)
+    .testNCHWtoNHWCX8();
+}
+
+TEST(CONVERT_NCHW_NHWC_X8, unit_pixel) {
+  ConvertOperatorTester()
+    .inputSize(1, 1)
+    .channels(67)
+    .iterations(3)
+    .testNCHWtoNHWCX8();
+}
+
+TEST(CONVERT_NCHW_NHWC_X8, small_batch) {
+  ConvertOperatorTester()
+    .batchSize(3)
+    .inputSize(13, 14)
+    .channels(19)
+    .iterations(3)
+    .testNCHWtoNHWCX8();
+}
+
+TEST(CONVERT_NCHW_NHWC_X8, small_batch_with_pixel_stride) {
+  ConvertOperatorTester()
+    .batchSize(3)
+    .inputSize(13, 14)
+    .channels(19)
+    .pixelStride(23)
+    .iterations(3)
+    .testNCHWtoNHWCX8();
+}
+
+TEST(CONVERT_NCHW_NHWC_X8, large_image_multithreaded) {
+  ConvertOperatorTester()
+    .batchSize(2)
+    .inputSize(67, 71)
+    .channels(35)
+    .threads(4)
+    .iterations(3)
+    .testNCHWtoNHWCX8();
+}
+
+TEST(CONVERT_NHWC_NCHW_X8, unit_batch) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(3)
+    .iterations(3)
+    .testNHWCtoNCHWX8();
+}
+
+TEST(CONVERT_NHWC_NCHW_X8, unit_batch_many_channels) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(67)
+    .iterations(3)
+    .testNHWCtoNCHWX8();
+}
+
+TEST(CONVERT_NHWC_NCHW_X8, unit_batch_with_pixel_stride) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(19)
+    .pixelStride(23)
+    .iterations(3)
+    .testNHWCtoNCHWX8();
+}
+
+TEST(CONVERT_NHWC_NCHW_X8, unit_pixel) {
+  ConvertOperatorTester()
+    .inputSize(1, 1)
+    .channels(67)
+    .iterations(3)
+    .testNHWCtoNCHWX8();
+}
+
+TEST(CONVERT_NHWC_NCHW_X8, small_batch) {
+  ConvertOperatorTester()
+    .batchSize(3)
+    .inputSize(13, 14)
+    .channels(19)
+    .iterations(3)
+    .testNHWCtoNCHWX8();
+}
+
+TEST(CONVERT_NHWC_NCHW_X8, small_batch_with_pixel_stride) {
+  ConvertOperatorTester()
+    .batchSize(3)
+    .inputSize(13, 14)
+    .channels(19)
+    .pixelStride(23)
+    .iterations(3)
+    .testNHWCtoNCHWX8();
+}
+
+TEST(CONVERT_NHWC_NCHW_X8, large_image_multithreaded) {
+  ConvertOperatorTester()
+    .batchSize(2)
+    .inputSize(67, 71)
+    .channels(35)
+    .threads(4)
+    .iterations(3)
+    .testNHWCtoNCHWX8();
+}
+
+TEST(CONVERT_NCHW_NHWC_X32, unit_batch) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(3)
+    .iterations(3)
+    .testNCHWtoNHWCX32();
+}
+
+TEST(CONVERT_NCHW_NHWC_X32, unit_batch_many_channels) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(67)
+    .iterations(3)
+    .testNCHWtoNHWCX32();
+}
+
+TEST(CONVERT_NCHW_NHWC_X32, unit_batch_with_pixel_stride) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(19)
+    .pixelStride(23)
+    .iterations(3)
+    .testNCHWtoNHWCX32();
+}
+
+TEST(CONVERT_NCHW_NHWC_X32, unit_pixel) {
+  ConvertOperatorTester()
+    .inputSize(1, 1)
+    .channels(67)
+    .iterations(3)
+    .testNCHWtoNHWCX32();
+}
+
+TEST(CONVERT_NCHW_NHWC_X32, small_batch) {
+  ConvertOperatorTester()
+    .batchSize(3)
+    .inputSize(13, 14)
+    .channels(19)
+    .iterations(3)
+    .testNCHWtoNHWCX32();
+}
+
+TEST(CONVERT_NCHW_NHWC_X32, small_batch_with_pixel_stride) {
+  ConvertOperatorTester()
+    .batchSize(3)
+    .inputSize(13, 14)
+    .channels(19)
+    .pixelStride(23)
+    .iterations(3)
+    .testNCHWtoNHWCX32();
+}
+
+TEST(CONVERT_NCHW_NHWC_X32, large_image_multithreaded) {
+  ConvertOperatorTester()
+    .batchSize(2)
+    .inputSize(67, 71)
+    .channels(35)
+    .threads(4)
+    .iterations(3)
+    .testNCHWtoNHWCX32();
+}
+
+TEST(CONVERT_NHWC_NCHW_X32, unit_batch) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(3)
+    .iterations(3)
+    .testNHWCtoNCHWX32();
+}
+
+TEST(CONVERT_NHWC_NCHW_X32, unit_batch_many_channels) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(67)
+    .iterations(3)
+    .testNHWCtoNCHWX32();
+}
+
+TEST(CONVERT_NHWC_NCHW_X32, unit_batch_with_pixel_stride) {
+  ConvertOperatorTester()
+    .inputSize(13, 14)
+    .channels(19)
+    .pixelStride(23)
+    .iterations(3)
+    .testNHWCtoNCHWX32();
+}
+
+TEST(CONVERT_NHWC_NCHW_X32, unit_pixel) {
+  ConvertOperatorTester()
+    .inputSize(1, 1)
+    .channels(67)
+    .iterations(3)
+    .testNHWCtoNCHWX32();
+}
+
+TEST(CONVERT_NHWC_NCHW_X32, small_batch) {
+  ConvertOperatorTester()
+    .batchSize(3)
+    .inputSize(13, 14)
+    .channels(19)
+    .iterations(3)
+    .testNHWCtoNCHWX32();
+}
+
+TEST(CONVERT_NHWC_NCHW_X32, small_batch_with_pixel_stride) {
+  ConvertOperatorTester()
+    .batchSize(3)
+    .inputSize(13, 14)
+    .channels(19)
+    .pixelStride(23)
+    .iterations(3)
+    .testNHWCtoNCHWX32();
+}
+
+TEST(CONVERT_NHWC_NCHW_X32, large_image_multithreaded) {
+  ConvertOperatorTester()
+    .batchSize(2)
+    .inputSize(67, 71)
+    .channels(35)
+    .threads(4)
+    .iterations(3)
+    .testNHWCtoNCHWX32();
+}
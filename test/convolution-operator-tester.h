@@ -333,6 +333,24 @@ class ConvolutionOperatorTester {
     return this->qmax_;
   }
 
+  inline ConvolutionOperatorTester& ukernel(const char* ukernel) {
+    this->ukernel_ = ukernel;
+    return *this;
+  }
+
+  inline const char* ukernel() const {
+    return this->ukernel_;
+  }
+
+  inline ConvolutionOperatorTester& outputLUT(bool outputLUT) {
+    this->outputLUT_ = outputLUT;
+    return *this;
+  }
+
+  inline bool outputLUT() const {
+    return this->outputLUT_;
+  }
+
   inline ConvolutionOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -427,6 +445,11 @@ class ConvolutionOperatorTester {
           outputZeroPoint, outputScale, qmin(), qmax(),
           0, &convolution));
 
+      if (ukernel() != nullptr) {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_set_operator_ukernel(convolution, ukernel()));
+      }
+
       ASSERT_EQ(qnnp_status_success,
         qnnp_setup_convolution2d_nhwc_q8(
           convolution,
@@ -442,6 +465,42 @@ class ConvolutionOperatorTester {
       ASSERT_EQ(qnnp_status_success,
         qnnp_run_operator(convolution, nullptr /* thread pool */));
 
+      if (outputLUT()) {
+        std::vector<uint8_t> lookupTable(256);
+        std::generate(lookupTable.begin(), lookupTable.end(), std::ref(u8rng));
+        std::vector<uint8_t> lutOutput(output.size(), 0xA5);
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_set_operator_output_lut(convolution, lookupTable.data()));
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_setup_convolution2d_nhwc_q8(
+            convolution,
+            batchSize(),
+            inputHeight(),
+            inputWidth(),
+            inputPtr,
+            inputPixelStride(),
+            lutOutput.data(),
+            outputPixelStride(),
+            nullptr /* thread pool */));
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_run_operator(convolution, nullptr /* thread pool */));
+
+        for (size_t i = 0; i < batchSize(); i++) {
+          for (size_t y = 0; y < outputHeight(); y++) {
+            for (size_t x = 0; x < outputWidth(); x++) {
+              for (size_t g = 0; g < groups(); g++) {
+                for (size_t c = 0; c < groupOutputChannels(); c++) {
+                  ASSERT_EQ(uint32_t(lookupTable[output[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + g * groupOutputChannels() + c]]), uint32_t(lutOutput[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + g * groupOutputChannels() + c]));
+                }
+              }
+            }
+          }
+        }
+      }
+
       ASSERT_EQ(qnnp_status_success,
         qnnp_delete_operator(convolution));
       convolution = nullptr;
@@ -468,6 +527,237 @@ class ConvolutionOperatorTester {
     }
   }
 
+  void testS32() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input(batchSize() * ((inputHeight() * inputWidth() - 1) * inputPixelStride() + groups() * groupInputChannels()) + 8);
+    std::vector<uint8_t> kernel(groups() * groupOutputChannels() * kernelHeight() * kernelWidth() * groupInputChannels());
+    std::vector<int32_t> bias(groups() * groupOutputChannels());
+    std::vector<int32_t> output(batchSize() * ((outputHeight() * outputWidth() - 1) * outputPixelStride() + groups() * groupOutputChannels()));
+    std::vector<int32_t> accumulators(batchSize() * outputHeight() * outputWidth() * groups() * groupOutputChannels());
+
+    const uint8_t* inputPtr = input.data() + 8;
+    const uint8_t inputZeroPoint = 127;
+    const uint8_t kernelZeroPoint = 127;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(output.begin(), output.end(), INT32_C(0xA5A5A5A5));
+      std::fill(accumulators.begin(), accumulators.end(), 0);
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oy = 0; oy < outputHeight(); oy++) {
+          for (size_t ox = 0; ox < outputWidth(); ox++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t oc = 0; oc < groupOutputChannels(); oc++) {
+                accumulators[(((i * outputHeight() + oy) * outputWidth() + ox) * groups() + g) * groupOutputChannels() + oc] =
+                  bias[g * groupOutputChannels() + oc];
+              }
+            }
+          }
+        }
+      }
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oy = 0; oy < outputHeight(); oy++) {
+          for (size_t ox = 0; ox < outputWidth(); ox++) {
+            for (size_t ky = 0; ky < kernelHeight(); ky++) {
+              const size_t iy = oy * subsamplingHeight() + ky * dilationHeight() - paddingTop();
+              if (iy < inputHeight()) {
+                for (size_t kx = 0; kx < kernelWidth(); kx++) {
+                  const size_t ix = ox * subsamplingWidth() + kx * dilationWidth() - paddingLeft();
+                  if (ix < inputWidth()) {
+                    for (size_t g = 0; g < groups(); g++) {
+                      for (size_t oc = 0; oc < groupOutputChannels(); oc++) {
+                        for (size_t ic = 0; ic < groupInputChannels(); ic++) {
+                          accumulators[(((i * outputHeight() + oy) * outputWidth() + ox) * groups() + g) * groupOutputChannels() + oc] +=
+                            (int32_t(inputPtr[((i * inputHeight() + iy) * inputWidth() + ix) * inputPixelStride() + g * groupInputChannels() + ic]) - int32_t(inputZeroPoint)) *
+                            (int32_t(kernel[(((g * groupOutputChannels() + oc) * kernelHeight() + ky) * kernelWidth() + kx) * groupInputChannels() + ic]) - int32_t(kernelZeroPoint));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t convolution = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_convolution2d_nhwc_q8_s32(
+          paddingTop(), paddingRight(), paddingBottom(), paddingLeft(),
+          kernelHeight(), kernelWidth(),
+          subsamplingHeight(), subsamplingWidth(),
+          dilationHeight(), dilationWidth(),
+          groups(), groupInputChannels(), groupOutputChannels(),
+          inputZeroPoint, kernelZeroPoint,
+          kernel.data(), bias.data(),
+          0, &convolution));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_convolution2d_nhwc_q8_s32(
+          convolution,
+          batchSize(),
+          inputHeight(),
+          inputWidth(),
+          inputPtr,
+          inputPixelStride(),
+          output.data(),
+          outputPixelStride(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(convolution, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(convolution));
+      convolution = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t y = 0; y < outputHeight(); y++) {
+          for (size_t x = 0; x < outputWidth(); x++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t c = 0; c < groupOutputChannels(); c++) {
+                const int32_t accumulator =
+                  accumulators[(((i * outputHeight() + y) * outputWidth() + x) * groups() + g) * groupOutputChannels() + c];
+                ASSERT_EQ(
+                  accumulator,
+                  output[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + g * groupOutputChannels() + c])
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  void testF32() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input(batchSize() * ((inputHeight() * inputWidth() - 1) * inputPixelStride() + groups() * groupInputChannels()) + 8);
+    std::vector<uint8_t> kernel(groups() * groupOutputChannels() * kernelHeight() * kernelWidth() * groupInputChannels());
+    std::vector<int32_t> bias(groups() * groupOutputChannels());
+    std::vector<float> output(batchSize() * ((outputHeight() * outputWidth() - 1) * outputPixelStride() + groups() * groupOutputChannels()));
+    std::vector<int32_t> accumulators(batchSize() * outputHeight() * outputWidth() * groups() * groupOutputChannels());
+
+    const uint8_t* inputPtr = input.data() + 8;
+    const uint8_t inputZeroPoint = 127;
+    const uint8_t kernelZeroPoint = 127;
+    const float inputScale = 0.25f;
+    const float kernelScale = 0.02f;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+      std::fill(accumulators.begin(), accumulators.end(), 0);
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oy = 0; oy < outputHeight(); oy++) {
+          for (size_t ox = 0; ox < outputWidth(); ox++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t oc = 0; oc < groupOutputChannels(); oc++) {
+                accumulators[(((i * outputHeight() + oy) * outputWidth() + ox) * groups() + g) * groupOutputChannels() + oc] =
+                  bias[g * groupOutputChannels() + oc];
+              }
+            }
+          }
+        }
+      }
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oy = 0; oy < outputHeight(); oy++) {
+          for (size_t ox = 0; ox < outputWidth(); ox++) {
+            for (size_t ky = 0; ky < kernelHeight(); ky++) {
+              const size_t iy = oy * subsamplingHeight() + ky * dilationHeight() - paddingTop();
+              if (iy < inputHeight()) {
+                for (size_t kx = 0; kx < kernelWidth(); kx++) {
+                  const size_t ix = ox * subsamplingWidth() + kx * dilationWidth() - paddingLeft();
+                  if (ix < inputWidth()) {
+                    for (size_t g = 0; g < groups(); g++) {
+                      for (size_t oc = 0; oc < groupOutputChannels(); oc++) {
+                        for (size_t ic = 0; ic < groupInputChannels(); ic++) {
+                          accumulators[(((i * outputHeight() + oy) * outputWidth() + ox) * groups() + g) * groupOutputChannels() + oc] +=
+                            (int32_t(inputPtr[((i * inputHeight() + iy) * inputWidth() + ix) * inputPixelStride() + g * groupInputChannels() + ic]) - int32_t(inputZeroPoint)) *
+                            (int32_t(kernel[(((g * groupOutputChannels() + oc) * kernelHeight() + ky) * kernelWidth() + kx) * groupInputChannels() + ic]) - int32_t(kernelZeroPoint));
+                        }
+                      }
+                    }
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t convolution = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_convolution2d_nhwc_q8_f32(
+          paddingTop(), paddingRight(), paddingBottom(), paddingLeft(),
+          kernelHeight(), kernelWidth(),
+          subsamplingHeight(), subsamplingWidth(),
+          dilationHeight(), dilationWidth(),
+          groups(), groupInputChannels(), groupOutputChannels(),
+          inputZeroPoint, inputScale,
+          kernelZeroPoint, kernelScale,
+          kernel.data(), bias.data(),
+          0, &convolution));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_convolution2d_nhwc_q8_f32(
+          convolution,
+          batchSize(),
+          inputHeight(),
+          inputWidth(),
+          inputPtr,
+          inputPixelStride(),
+          output.data(),
+          outputPixelStride(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(convolution, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(convolution));
+      convolution = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t y = 0; y < outputHeight(); y++) {
+          for (size_t x = 0; x < outputWidth(); x++) {
+            for (size_t g = 0; g < groups(); g++) {
+              for (size_t c = 0; c < groupOutputChannels(); c++) {
+                const int32_t accumulator =
+                  accumulators[(((i * outputHeight() + y) * outputWidth() + x) * groups() + g) * groupOutputChannels() + c];
+                const double outputRef = double(accumulator) * double(inputScale) * double(kernelScale);
+                ASSERT_NEAR(
+                  outputRef,
+                  double(output[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + g * groupOutputChannels() + c]),
+                  1.0e-6 * std::max(std::abs(outputRef), 1.0))
+                  << "(x, y) = (" << x << ", " << y << "), group = " << g << ", channel = " << c;
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
  private:
   uint32_t paddingTop_{0};
   uint32_t paddingRight_{0};
@@ -489,5 +779,7 @@ class ConvolutionOperatorTester {
   uint32_t subsamplingWidth_{1};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
+  const char* ukernel_{nullptr};
+  bool outputLUT_{false};
   size_t iterations_{1};
 };
@@ -568,3 +568,383 @@ TEST(CONVOLUTION_OP, depthwise_5x5d2x1) {
     .iterations(3)
     .testQ8();
 }
+
+TEST(CONVOLUTION_OP, 1x1_with_output_lut) {
+  ConvolutionOperatorTester()
+    .inputSize(27, 29)
+    .kernelSize(1, 1)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .outputLUT(true)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(CONVOLUTION_OP, xzp_1x1_with_output_lut) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8conv_xzp.kthreshold != SIZE_MAX) {
+    ConvolutionOperatorTester()
+      .inputSize(27, 29)
+      .kernelSize(1, 1)
+      .groupInputChannels(qnnp_params.q8conv_xzp.kthreshold + 1)
+      .groupOutputChannels(19)
+      .outputLUT(true)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(CONVOLUTION_OP, 3x3s2_with_output_lut) {
+  ConvolutionOperatorTester()
+    .inputSize(19, 21)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .outputLUT(true)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(CONVOLUTION_OP, grouped_1x1_with_output_lut) {
+  ConvolutionOperatorTester()
+    .inputSize(24, 25)
+    .kernelSize(1, 1)
+    .groups(2)
+    .groupInputChannels(17)
+    .groupOutputChannels(19)
+    .outputLUT(true)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(CONVOLUTION_OP, grouped_3x3_with_output_lut_and_output_stride) {
+  ConvolutionOperatorTester()
+    .inputSize(10, 9)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(2)
+    .groupInputChannels(14)
+    .groupOutputChannels(13)
+    .outputPixelStride(29)
+    .outputLUT(true)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(CONVOLUTION_OP, depthwise_3x3_with_output_lut) {
+  ConvolutionOperatorTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(27)
+    .outputLUT(true)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(CONVOLUTION_OP, depthwise_5x5_with_output_lut) {
+  ConvolutionOperatorTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .groups(27)
+    .outputLUT(true)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(CONVOLUTION_OP_S32, 1x1) {
+  ConvolutionOperatorTester()
+    .inputSize(27, 29)
+    .kernelSize(1, 1)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, 1x1_with_output_stride) {
+  ConvolutionOperatorTester()
+    .inputSize(27, 29)
+    .kernelSize(1, 1)
+    .outputPixelStride(29)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, 1x1_with_batch) {
+  ConvolutionOperatorTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .batchSize(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, grouped_1x1) {
+  ConvolutionOperatorTester()
+    .inputSize(24, 25)
+    .kernelSize(1, 1)
+    .groups(2)
+    .groupInputChannels(17)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, xzp_1x1) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8conv_xzp.kthreshold != SIZE_MAX) {
+    ConvolutionOperatorTester()
+      .inputSize(27, 29)
+      .kernelSize(1, 1)
+      .groupInputChannels(qnnp_params.q8conv_xzp.kthreshold + 1)
+      .groupOutputChannels(19)
+      .iterations(3)
+      .testS32();
+  }
+}
+
+TEST(CONVOLUTION_OP_S32, 3x3) {
+  ConvolutionOperatorTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, 3x3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .outputPixelStride(23)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, 3x3_with_batch) {
+  ConvolutionOperatorTester()
+    .inputSize(10, 9)
+    .padding(1)
+    .kernelSize(3, 3)
+    .batchSize(3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, grouped_3x3) {
+  ConvolutionOperatorTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(2)
+    .groupInputChannels(14)
+    .groupOutputChannels(13)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, 3x3s2) {
+  ConvolutionOperatorTester()
+    .inputSize(19, 21)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, 3x3d2) {
+  ConvolutionOperatorTester()
+    .inputSize(13, 14)
+    .padding(2)
+    .kernelSize(3, 3)
+    .dilation(2)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, depthwise_3x3) {
+  ConvolutionOperatorTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(27)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_S32, depthwise_5x5) {
+  ConvolutionOperatorTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .groups(27)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(CONVOLUTION_OP_F32, 1x1) {
+  ConvolutionOperatorTester()
+    .inputSize(27, 29)
+    .kernelSize(1, 1)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 1x1_with_output_stride) {
+  ConvolutionOperatorTester()
+    .inputSize(27, 29)
+    .kernelSize(1, 1)
+    .outputPixelStride(29)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 1x1_with_batch) {
+  ConvolutionOperatorTester()
+    .inputSize(13, 14)
+    .kernelSize(1, 1)
+    .batchSize(3)
+    .groupInputChannels(23)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_1x1) {
+  ConvolutionOperatorTester()
+    .inputSize(24, 25)
+    .kernelSize(1, 1)
+    .groups(2)
+    .groupInputChannels(17)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, xzp_1x1) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  if (qnnp_params.q8conv_xzp.kthreshold != SIZE_MAX) {
+    ConvolutionOperatorTester()
+      .inputSize(27, 29)
+      .kernelSize(1, 1)
+      .groupInputChannels(qnnp_params.q8conv_xzp.kthreshold + 1)
+      .groupOutputChannels(19)
+      .iterations(3)
+      .testF32();
+  }
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3) {
+  ConvolutionOperatorTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_with_output_stride) {
+  ConvolutionOperatorTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .outputPixelStride(23)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3_with_batch) {
+  ConvolutionOperatorTester()
+    .inputSize(10, 9)
+    .padding(1)
+    .kernelSize(3, 3)
+    .batchSize(3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, grouped_3x3) {
+  ConvolutionOperatorTester()
+    .inputSize(10, 11)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groups(2)
+    .groupInputChannels(14)
+    .groupOutputChannels(13)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3s2) {
+  ConvolutionOperatorTester()
+    .inputSize(19, 21)
+    .padding(1)
+    .kernelSize(3, 3)
+    .subsampling(2)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, 3x3d2) {
+  ConvolutionOperatorTester()
+    .inputSize(13, 14)
+    .padding(2)
+    .kernelSize(3, 3)
+    .dilation(2)
+    .groupInputChannels(27)
+    .groupOutputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_3x3) {
+  ConvolutionOperatorTester()
+    .inputSize(15, 14)
+    .padding(1, 1)
+    .kernelSize(3, 3)
+    .groups(27)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(CONVOLUTION_OP_F32, depthwise_5x5) {
+  ConvolutionOperatorTester()
+    .inputSize(15, 14)
+    .padding(2, 2)
+    .kernelSize(5, 5)
+    .groups(27)
+    .iterations(3)
+    .testF32();
+}
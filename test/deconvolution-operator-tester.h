@@ -349,6 +349,15 @@ class DeconvolutionOperatorTester {
     return this->qmax_;
   }
 
+  inline DeconvolutionOperatorTester& outputLUT(bool outputLUT) {
+    this->outputLUT_ = outputLUT;
+    return *this;
+  }
+
+  inline bool outputLUT() const {
+    return this->outputLUT_;
+  }
+
   inline DeconvolutionOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -461,6 +470,42 @@ class DeconvolutionOperatorTester {
       ASSERT_EQ(qnnp_status_success,
         qnnp_run_operator(deconvolution, nullptr /* thread pool */));
 
+      if (outputLUT()) {
+        std::vector<uint8_t> lookupTable(256);
+        std::generate(lookupTable.begin(), lookupTable.end(), std::ref(u8rng));
+        std::vector<uint8_t> lutOutput(output.size(), 0xA5);
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_set_operator_output_lut(deconvolution, lookupTable.data()));
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_setup_deconvolution2d_nhwc_q8(
+            deconvolution,
+            batchSize(),
+            inputHeight(),
+            inputWidth(),
+            inputPtr,
+            inputPixelStride(),
+            lutOutput.data(),
+            outputPixelStride(),
+            nullptr /* thread pool */));
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_run_operator(deconvolution, nullptr /* thread pool */));
+
+        for (size_t i = 0; i < batchSize(); i++) {
+          for (size_t y = 0; y < outputHeight(); y++) {
+            for (size_t x = 0; x < outputWidth(); x++) {
+              for (size_t g = 0; g < groups(); g++) {
+                for (size_t c = 0; c < groupOutputChannels(); c++) {
+                  ASSERT_EQ(uint32_t(lookupTable[output[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + g * groupOutputChannels() + c]]), uint32_t(lutOutput[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + g * groupOutputChannels() + c]));
+                }
+              }
+            }
+          }
+        }
+      }
+
       ASSERT_EQ(qnnp_status_success,
         qnnp_delete_operator(deconvolution));
       deconvolution = nullptr;
@@ -518,5 +563,6 @@ class DeconvolutionOperatorTester {
   uint32_t strideWidth_{1};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
+  bool outputLUT_{false};
   size_t iterations_{1};
 };
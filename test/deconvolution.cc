@@ -263,3 +263,15 @@ TEST(DECONVOLUTION_OP, 3x3d2x1) {
     .iterations(3)
     .testQ8();
 }
+
+TEST(DECONVOLUTION_OP, 3x3_with_output_lut) {
+  DeconvolutionOperatorTester()
+    .inputSize(13, 12)
+    .padding(1)
+    .kernelSize(3, 3)
+    .groupInputChannels(15)
+    .groupOutputChannels(17)
+    .outputLUT(true)
+    .iterations(3)
+    .testQ8();
+}
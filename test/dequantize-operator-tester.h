@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class DequantizeOperatorTester {
+ public:
+  inline DequantizeOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline DequantizeOperatorTester& inputStride(size_t inputStride) {
+    assert(inputStride != 0);
+    this->inputStride_ = inputStride;
+    return *this;
+  }
+
+  inline size_t inputStride() const {
+    if (this->inputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->inputStride_ >= this->channels_);
+      return this->inputStride_;
+    }
+  }
+
+  inline DequantizeOperatorTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->outputStride_ >= this->channels_);
+      return this->outputStride_;
+    }
+  }
+
+  inline DequantizeOperatorTester& batchSize(size_t batchSize) {
+    assert(batchSize != 0);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline DequantizeOperatorTester& inputScale(float inputScale) {
+    assert(inputScale > 0.0f);
+    assert(std::isnormal(inputScale));
+    this->inputScale_ = inputScale;
+    return *this;
+  }
+
+  inline float inputScale() const {
+    return this->inputScale_;
+  }
+
+  inline DequantizeOperatorTester& inputZeroPoint(uint8_t inputZeroPoint) {
+    this->inputZeroPoint_ = inputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t inputZeroPoint() const {
+    return this->inputZeroPoint_;
+  }
+
+  inline DequantizeOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQ8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<float> output((batchSize() - 1) * outputStride() + channels());
+    std::vector<float> outputRef(batchSize() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      /* Compute reference results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const int32_t x = int32_t(input[i * inputStride() + c]);
+          outputRef[i * channels() + c] = float(x - int32_t(inputZeroPoint())) * inputScale();
+        }
+      }
+
+      /* Create, setup, run, and destroy Dequantize operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t dequantizeOp = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_dequantize_nc_q8_f32(
+          channels(),
+          inputZeroPoint(), inputScale(),
+          0, &dequantizeOp));
+      ASSERT_NE(nullptr, dequantizeOp);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_dequantize_nc_q8_f32(
+          dequantizeOp,
+          batchSize(),
+          input.data(), inputStride(),
+          output.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(dequantizeOp, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(dequantizeOp));
+      dequantizeOp = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_EQ(outputRef[i * channels() + c], output[i * outputStride() + c])
+            << "at " << i << ", " << c << ": batch size = " << batchSize() << ", channels = " << channels()
+            << ", scale = " << inputScale() << ", zero point = " << uint32_t(inputZeroPoint());
+        }
+      }
+      for (size_t i = 0; i + 1 < batchSize(); i++) {
+        for (size_t c = channels(); c < outputStride(); c++) {
+          ASSERT_TRUE(std::isnan(output[i * outputStride() + c]))
+            << "at " << i << ", " << c << ": output padding was overwritten";
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batchSize_{1};
+  size_t channels_{1};
+  size_t inputStride_{0};
+  size_t outputStride_{0};
+  float inputScale_{0.75f};
+  uint8_t inputZeroPoint_{121};
+  size_t iterations_{15};
+};
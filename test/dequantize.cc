@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "dequantize-operator-tester.h"
+
+
+TEST(DEQUANTIZE_OP, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    DequantizeOperatorTester()
+      .batchSize(1)
+      .channels(channels)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(DEQUANTIZE_OP, unit_batch_with_input_scale) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (float scale = 1.0e-2f; scale < 1.0e+2f; scale *= 3.14159265f) {
+      DequantizeOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .inputScale(scale)
+        .iterations(1)
+        .testQ8();
+    }
+  }
+}
+
+TEST(DEQUANTIZE_OP, unit_batch_with_input_zero_point) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (int32_t zeroPoint = 0; zeroPoint <= 255; zeroPoint += 51) {
+      DequantizeOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .inputZeroPoint(uint8_t(zeroPoint))
+        .iterations(3)
+        .testQ8();
+    }
+  }
+}
+
+TEST(DEQUANTIZE_OP, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    DequantizeOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(DEQUANTIZE_OP, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    DequantizeOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputStride(129)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(DEQUANTIZE_OP, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    DequantizeOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .outputStride(117)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(DEQUANTIZE_OP, large_batch) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    DequantizeOperatorTester()
+      .batchSize(101)
+      .channels(channels)
+      .iterations(1)
+      .testQ8();
+  }
+}
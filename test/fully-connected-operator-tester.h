@@ -99,6 +99,15 @@ class FullyConnectedOperatorTester {
     return this->qmax_;
   }
 
+  inline FullyConnectedOperatorTester& outputLUT(bool outputLUT) {
+    this->outputLUT_ = outputLUT;
+    return *this;
+  }
+
+  inline bool outputLUT() const {
+    return this->outputLUT_;
+  }
+
   inline FullyConnectedOperatorTester& iterations(size_t iterations) {
     this->iterations_ = iterations;
     return *this;
@@ -178,6 +187,33 @@ class FullyConnectedOperatorTester {
       ASSERT_EQ(qnnp_status_success,
         qnnp_run_operator(convolution, nullptr /* thread pool */));
 
+      if (outputLUT()) {
+        std::vector<uint8_t> lookupTable(256);
+        std::generate(lookupTable.begin(), lookupTable.end(), std::ref(u8rng));
+        std::vector<uint8_t> lutOutput(output.size(), 0xA5);
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_set_operator_output_lut(convolution, lookupTable.data()));
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_setup_fully_connected_nc_q8(
+            convolution,
+            batchSize(),
+            inputPtr,
+            inputStride(),
+            lutOutput.data(),
+            outputStride()));
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_run_operator(convolution, nullptr /* thread pool */));
+
+        for (size_t i = 0; i < batchSize(); i++) {
+          for (size_t c = 0; c < outputChannels(); c++) {
+            ASSERT_EQ(uint32_t(lookupTable[output[i * outputStride() + c]]), uint32_t(lutOutput[i * outputStride() + c]));
+          }
+        }
+      }
+
       ASSERT_EQ(qnnp_status_success,
         qnnp_delete_operator(convolution));
       convolution = nullptr;
@@ -197,6 +233,230 @@ class FullyConnectedOperatorTester {
     }
   }
 
+  void testS32() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + inputChannels() + 8);
+    std::vector<uint8_t> kernel(outputChannels() * inputChannels());
+    std::vector<int32_t> bias(outputChannels());
+    std::vector<int32_t> output((batchSize() - 1) * outputStride() + outputChannels());
+    std::vector<int32_t> accumulators(batchSize() * outputChannels());
+
+    const uint8_t* inputPtr = input.data() + 8;
+    const uint8_t inputZeroPoint = 127;
+    const uint8_t kernelZeroPoint = 127;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(output.begin(), output.end(), INT32_C(0xA5A5A5A5));
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oc = 0; oc < outputChannels(); oc++) {
+          accumulators[i * outputChannels() + oc] = bias[oc];
+          for (size_t ic = 0; ic < inputChannels(); ic++) {
+            accumulators[i * outputChannels() + oc] +=
+              (int32_t(inputPtr[i * inputStride() + ic]) - int32_t(inputZeroPoint)) *
+              (int32_t(kernel[oc * inputChannels() + ic]) - int32_t(kernelZeroPoint));
+          }
+        }
+      }
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t fullyConnected = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_fully_connected_nc_q8_s32(
+          inputChannels(), outputChannels(),
+          inputZeroPoint, kernelZeroPoint,
+          kernel.data(), bias.data(),
+          0, &fullyConnected));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_fully_connected_nc_q8_s32(
+          fullyConnected,
+          batchSize(),
+          inputPtr,
+          inputStride(),
+          output.data(),
+          outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(fullyConnected, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(fullyConnected));
+      fullyConnected = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < outputChannels(); c++) {
+          ASSERT_EQ(accumulators[i * outputChannels() + c], output[i * outputStride() + c])
+            << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void testF32() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + inputChannels() + 8);
+    std::vector<uint8_t> kernel(outputChannels() * inputChannels());
+    std::vector<int32_t> bias(outputChannels());
+    std::vector<float> output((batchSize() - 1) * outputStride() + outputChannels());
+    std::vector<int32_t> accumulators(batchSize() * outputChannels());
+
+    const uint8_t* inputPtr = input.data() + 8;
+    const uint8_t inputZeroPoint = 127;
+    const float inputScale = 0.25f;
+    const uint8_t kernelZeroPoint = 127;
+    const float kernelScale = 0.02f;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oc = 0; oc < outputChannels(); oc++) {
+          accumulators[i * outputChannels() + oc] = bias[oc];
+          for (size_t ic = 0; ic < inputChannels(); ic++) {
+            accumulators[i * outputChannels() + oc] +=
+              (int32_t(inputPtr[i * inputStride() + ic]) - int32_t(inputZeroPoint)) *
+              (int32_t(kernel[oc * inputChannels() + ic]) - int32_t(kernelZeroPoint));
+          }
+        }
+      }
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t fullyConnected = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_fully_connected_nc_q8_f32(
+          inputChannels(), outputChannels(),
+          inputZeroPoint, inputScale,
+          kernelZeroPoint, kernelScale,
+          kernel.data(), bias.data(),
+          0, &fullyConnected));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_fully_connected_nc_q8_f32(
+          fullyConnected,
+          batchSize(),
+          inputPtr,
+          inputStride(),
+          output.data(),
+          outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(fullyConnected, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(fullyConnected));
+      fullyConnected = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < outputChannels(); c++) {
+          const double outputRef =
+            double(accumulators[i * outputChannels() + c]) * double(inputScale) * double(kernelScale);
+          ASSERT_NEAR(outputRef, double(output[i * outputStride() + c]), 1.0e-6 * std::max(std::abs(outputRef), 1.0))
+            << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
+  void testF32Dynamic() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(-1.0f, 1.0f), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<float> input((batchSize() - 1) * inputStride() + inputChannels());
+    std::vector<uint8_t> kernel(outputChannels() * inputChannels());
+    std::vector<float> bias(outputChannels());
+    std::vector<float> output((batchSize() - 1) * outputStride() + outputChannels());
+    std::vector<double> outputRef(batchSize() * outputChannels());
+    std::vector<double> outputTolerance(batchSize() * outputChannels());
+
+    const uint8_t kernelZeroPoint = 127;
+    const float kernelScale = 0.02f;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::generate(kernel.begin(), kernel.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), std::nanf(""));
+
+      /*
+       * Each input row is quantized with its own scale over [min(x, 0), max(x, 0)], so every input element is off by at
+       * most half of the quantization step of its row.
+       */
+      for (size_t i = 0; i < batchSize(); i++) {
+        const float* inputRow = input.data() + i * inputStride();
+        const float inputMin = std::min(*std::min_element(inputRow, inputRow + inputChannels()), 0.0f);
+        const float inputMax = std::max(*std::max_element(inputRow, inputRow + inputChannels()), 0.0f);
+        const double inputStep = double(inputMax - inputMin) / 255.0;
+        for (size_t oc = 0; oc < outputChannels(); oc++) {
+          double acc = double(bias[oc]);
+          double absKernelSum = 0.0;
+          for (size_t ic = 0; ic < inputChannels(); ic++) {
+            const double w =
+              double(int32_t(kernel[oc * inputChannels() + ic]) - int32_t(kernelZeroPoint)) * double(kernelScale);
+            acc += double(inputRow[ic]) * w;
+            absKernelSum += std::abs(w);
+          }
+          outputRef[i * outputChannels() + oc] = acc;
+          outputTolerance[i * outputChannels() + oc] =
+            0.51 * inputStep * absKernelSum + 1.0e-5 * std::max(std::abs(acc), 1.0);
+        }
+      }
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t fullyConnected = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_dynamic_fully_connected_nc_f32(
+          inputChannels(), outputChannels(),
+          kernelZeroPoint, kernelScale,
+          kernel.data(), bias.data(),
+          0, &fullyConnected));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_dynamic_fully_connected_nc_f32(
+          fullyConnected,
+          batchSize(),
+          input.data(),
+          inputStride(),
+          output.data(),
+          outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(fullyConnected, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(fullyConnected));
+      fullyConnected = nullptr;
+
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < outputChannels(); c++) {
+          ASSERT_NEAR(
+            outputRef[i * outputChannels() + c],
+            double(output[i * outputStride() + c]),
+            outputTolerance[i * outputChannels() + c]) << "batch index = " << i << ", channel = " << c;
+        }
+      }
+    }
+  }
+
  private:
   size_t inputChannels_{1};
   size_t inputStride_{0};
@@ -205,5 +465,6 @@ class FullyConnectedOperatorTester {
   size_t batchSize_{1};
   uint8_t qmin_{0};
   uint8_t qmax_{255};
+  bool outputLUT_{false};
   size_t iterations_{1};
 };
@@ -6,8 +6,16 @@
  * LICENSE file in the root directory of this source tree.
  */
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
 #include <gtest/gtest.h>
 
+#include <pthreadpool.h>
+#include <qnnpack.h>
+#include <qnnpack/compute.h>
+
 #include "fully-connected-operator-tester.h"
 
 
@@ -108,3 +116,282 @@ TEST(FULLY_CONNECTED_OP, small_batch_with_output_stride) {
     .iterations(3)
     .testQ8();
 }
+
+TEST(FULLY_CONNECTED_OP, small_batch_with_output_lut) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .outputChannels(19)
+    .outputLUT(true)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(FULLY_CONNECTED_OP, unit_batch_with_output_lut_multithreaded) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const size_t inputChannels = 64;
+  const size_t outputChannels = 256;
+  std::vector<uint8_t> input(inputChannels);
+  std::vector<uint8_t> kernel(outputChannels * inputChannels);
+  std::vector<int32_t> bias(outputChannels);
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = uint8_t(i * 7);
+  }
+  for (size_t i = 0; i < kernel.size(); i++) {
+    kernel[i] = uint8_t(i * 13);
+  }
+  std::vector<uint8_t> lookupTable(256);
+  for (size_t i = 0; i < lookupTable.size(); i++) {
+    lookupTable[i] = uint8_t(i ^ 0x5A);
+  }
+
+  qnnp_operator_t fullyConnectedOp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_fully_connected_nc_q8(
+      inputChannels, outputChannels,
+      127, 0.5f, 127, 0.5f,
+      kernel.data(), bias.data(),
+      127, 256.0f, 0, 255,
+      0, &fullyConnectedOp));
+  std::vector<uint8_t> output(outputChannels, 0xA5);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_fully_connected_nc_q8(fullyConnectedOp, 1, input.data(), inputChannels, output.data(), outputChannels));
+  qnnp_compute_plan plan;
+  ASSERT_EQ(qnnp_status_success, qnnp_prepare_compute_plan(fullyConnectedOp, &plan));
+  const size_t tilesCount = qnnp_compute_get_tiles_count(&plan.stages[0]);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_set_operator_output_lut(fullyConnectedOp, lookupTable.data()));
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_fully_connected_nc_q8(fullyConnectedOp, 1, input.data(), inputChannels, output.data(), outputChannels));
+
+  /* A fused lookup table must not coarsen the tiles: a single row still splits over output channels */
+  ASSERT_EQ(qnnp_status_success, qnnp_prepare_compute_plan(fullyConnectedOp, &plan));
+  ASSERT_GT(tilesCount, 1);
+  ASSERT_EQ(tilesCount, qnnp_compute_get_tiles_count(&plan.stages[0]));
+
+  ASSERT_EQ(qnnp_status_success, qnnp_run_operator(fullyConnectedOp, nullptr /* thread pool */));
+  const std::vector<uint8_t> referenceOutput(output);
+  std::fill(output.begin(), output.end(), 0xA5);
+
+  pthreadpool_t threadpool = pthreadpool_create(4);
+  ASSERT_TRUE(threadpool);
+  ASSERT_EQ(qnnp_status_success, qnnp_run_operator(fullyConnectedOp, threadpool));
+  pthreadpool_destroy(threadpool);
+  ASSERT_EQ(referenceOutput, output);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(fullyConnectedOp));
+}
+
+TEST(FULLY_CONNECTED_OP_S32, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batchSize(1)
+    .inputChannels(23)
+    .outputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(FULLY_CONNECTED_OP_S32, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(1)
+    .inputChannels(23)
+    .inputStride(28)
+    .outputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(FULLY_CONNECTED_OP_S32, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(1)
+    .inputChannels(23)
+    .outputChannels(19)
+    .outputStride(29)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(FULLY_CONNECTED_OP_S32, small_batch) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .outputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(FULLY_CONNECTED_OP_S32, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .inputStride(28)
+    .outputChannels(19)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(FULLY_CONNECTED_OP_S32, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .outputChannels(19)
+    .outputStride(29)
+    .iterations(3)
+    .testS32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batchSize(1)
+    .inputChannels(23)
+    .outputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(1)
+    .inputChannels(23)
+    .inputStride(28)
+    .outputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(1)
+    .inputChannels(23)
+    .outputChannels(19)
+    .outputStride(29)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .outputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .inputStride(28)
+    .outputChannels(19)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(FULLY_CONNECTED_OP_F32, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .outputChannels(19)
+    .outputStride(29)
+    .iterations(3)
+    .testF32();
+}
+
+TEST(DYNAMIC_FULLY_CONNECTED_OP, unit_batch) {
+  FullyConnectedOperatorTester()
+    .batchSize(1)
+    .inputChannels(23)
+    .outputChannels(19)
+    .iterations(3)
+    .testF32Dynamic();
+}
+
+TEST(DYNAMIC_FULLY_CONNECTED_OP, unit_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(1)
+    .inputChannels(23)
+    .inputStride(28)
+    .outputChannels(19)
+    .iterations(3)
+    .testF32Dynamic();
+}
+
+TEST(DYNAMIC_FULLY_CONNECTED_OP, unit_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(1)
+    .inputChannels(23)
+    .outputChannels(19)
+    .outputStride(29)
+    .iterations(3)
+    .testF32Dynamic();
+}
+
+TEST(DYNAMIC_FULLY_CONNECTED_OP, small_batch) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .outputChannels(19)
+    .iterations(3)
+    .testF32Dynamic();
+}
+
+TEST(DYNAMIC_FULLY_CONNECTED_OP, small_batch_with_input_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .inputStride(28)
+    .outputChannels(19)
+    .iterations(3)
+    .testF32Dynamic();
+}
+
+TEST(DYNAMIC_FULLY_CONNECTED_OP, small_batch_with_output_stride) {
+  FullyConnectedOperatorTester()
+    .batchSize(12)
+    .inputChannels(23)
+    .outputChannels(19)
+    .outputStride(29)
+    .iterations(3)
+    .testF32Dynamic();
+}
+
+TEST(DYNAMIC_FULLY_CONNECTED_OP, large_channels) {
+  FullyConnectedOperatorTester()
+    .batchSize(5)
+    .inputChannels(517)
+    .outputChannels(131)
+    .iterations(3)
+    .testF32Dynamic();
+}
+
+TEST(DYNAMIC_FULLY_CONNECTED_OP, wide_input) {
+  FullyConnectedOperatorTester()
+    .batchSize(7)
+    .inputChannels(25088)
+    .outputChannels(13)
+    .iterations(1)
+    .testF32Dynamic();
+}
+
+TEST(FULLY_CONNECTED_OP, output_lut_with_wide_output) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  std::vector<uint8_t> kernel(19 * 23, 1);
+  std::vector<int32_t> bias(19);
+  std::vector<uint8_t> lookupTable(256);
+
+  qnnp_operator_t fullyConnectedOp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_fully_connected_nc_q8_s32(23, 19, 127, 127, kernel.data(), bias.data(), 0, &fullyConnectedOp));
+  ASSERT_EQ(qnnp_status_unsupported_parameter,
+    qnnp_set_operator_output_lut(fullyConnectedOp, lookupTable.data()));
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(fullyConnectedOp));
+
+  fullyConnectedOp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_fully_connected_nc_q8_f32(
+      23, 19, 127, 0.5f, 127, 0.5f, kernel.data(), bias.data(), 0, &fullyConnectedOp));
+  ASSERT_EQ(qnnp_status_unsupported_parameter,
+    qnnp_set_operator_output_lut(fullyConnectedOp, lookupTable.data()));
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(fullyConnectedOp));
+}
@@ -275,6 +275,141 @@ class GemmMicrokernelTester {
     }
   }
 
+  void test(q8gemm_i32_ukernel_function qgemm) const {
+    ASSERT_LE(m(), mr());
+    ASSERT_LE(n(), nr());
+    ASSERT_GE(k(), kr());
+
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> a((m() - 1) * aStride() + k() + 8);
+    std::vector<uint8_t> b(n() * k());
+    std::vector<int32_t> bias(n());
+    std::vector<uint8_t, AlignedAllocator<uint8_t, 32>> packedW(packedN() * packedK() + biasN() * sizeof(uint32_t) / sizeof(uint8_t));
+    std::vector<int32_t> c((m() - 1) * cStride() + n());
+    std::vector<int32_t> acc(m() * n());
+
+    const uint8_t* aPtr = a.data() + 8;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(u8rng));
+      std::generate(b.begin(), b.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(c.begin(), c.end(), INT32_C(0xA5A5A5A5));
+
+      std::fill(packedW.begin(), packedW.end(), bZeroPoint());
+      pack_q8gemm_w(n(), k(),
+        nr(), np(), kr(),
+        aZeroPoint(), bZeroPoint(),
+        b.data(), bias.data(), packedW.data());
+
+      ASSERT_NE(*std::max_element(a.cbegin(), a.cend()), *std::min_element(a.cbegin(), a.cend()));
+      ASSERT_NE(*std::max_element(b.cbegin(), b.cend()), *std::min_element(b.cbegin(), b.cend()));
+
+      std::fill(acc.begin(), acc.end(), 0);
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          for (size_t kIndex = 0; kIndex < k(); kIndex++) {
+            acc[mIndex * n() + nIndex] +=
+                (int32_t(aPtr[mIndex * aStride() + kIndex]) - int32_t(aZeroPoint())) *
+                (int32_t(b[nIndex * k() + kIndex]) - int32_t(bZeroPoint()));
+          }
+          acc[mIndex * n() + nIndex] += bias[nIndex];
+        }
+      }
+
+      const union qnnp_kernel_zero_point_params kernelZeroPointParams =
+        qnnp_compute_kernel_zero_point_params(bZeroPoint());
+
+      qgemm(
+        m(), n(), k(),
+        aPtr, aStride() * sizeof(uint8_t),
+        packedW.data(),
+        c.data(), cStride() * sizeof(int32_t),
+        &kernelZeroPointParams);
+
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          ASSERT_EQ(c[mIndex * cStride() + nIndex], acc[mIndex * n() + nIndex])
+              << "at " << mIndex << ", " << nIndex << ": Mr x Nr x Kr = " << mr() << " x "
+              << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        }
+      }
+    }
+  }
+
+  void test(q8gemm_f32_ukernel_function qgemm) const {
+    ASSERT_LE(m(), mr());
+    ASSERT_LE(n(), nr());
+    ASSERT_GE(k(), kr());
+
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto scaleRng = std::bind(std::uniform_real_distribution<float>(1.0e-5f, 1.0f), rng);
+
+    std::vector<uint8_t> a((m() - 1) * aStride() + k() + 8);
+    std::vector<uint8_t> b(n() * k());
+    std::vector<int32_t> bias(n());
+    std::vector<uint8_t, AlignedAllocator<uint8_t, 32>> packedW(packedN() * packedK() + biasN() * sizeof(uint32_t) / sizeof(uint8_t));
+    std::vector<float> c((m() - 1) * cStride() + n());
+    std::vector<int32_t> acc(m() * n());
+
+    const uint8_t* aPtr = a.data() + 8;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(u8rng));
+      std::generate(b.begin(), b.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(c.begin(), c.end(), std::nanf(""));
+
+      std::fill(packedW.begin(), packedW.end(), bZeroPoint());
+      pack_q8gemm_w(n(), k(),
+        nr(), np(), kr(),
+        aZeroPoint(), bZeroPoint(),
+        b.data(), bias.data(), packedW.data());
+
+      ASSERT_NE(*std::max_element(a.cbegin(), a.cend()), *std::min_element(a.cbegin(), a.cend()));
+      ASSERT_NE(*std::max_element(b.cbegin(), b.cend()), *std::min_element(b.cbegin(), b.cend()));
+
+      std::fill(acc.begin(), acc.end(), 0);
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          for (size_t kIndex = 0; kIndex < k(); kIndex++) {
+            acc[mIndex * n() + nIndex] +=
+                (int32_t(aPtr[mIndex * aStride() + kIndex]) - int32_t(aZeroPoint())) *
+                (int32_t(b[nIndex * k() + kIndex]) - int32_t(bZeroPoint()));
+          }
+          acc[mIndex * n() + nIndex] += bias[nIndex];
+        }
+      }
+
+      const float scale = scaleRng();
+      const union qnnp_conv_dequantization_params dequantizationParams =
+        qnnp_compute_conv_dequantization_params(bZeroPoint(), scale);
+
+      qgemm(
+        m(), n(), k(),
+        aPtr, aStride() * sizeof(uint8_t),
+        packedW.data(),
+        c.data(), cStride() * sizeof(float),
+        &dequantizationParams);
+
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          ASSERT_EQ(c[mIndex * cStride() + nIndex], float(acc[mIndex * n() + nIndex]) * scale)
+              << "at " << mIndex << ", " << nIndex << ": accumulator = " << acc[mIndex * n() + nIndex]
+              << ", scale = " << scale << ", Mr x Nr x Kr = " << mr() << " x "
+              << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        }
+      }
+    }
+  }
+
   void test(q8conv_ukernel_function qconv) const {
     ASSERT_LE(m(), mr());
     ASSERT_LE(n(), nr());
@@ -412,6 +547,179 @@ class GemmMicrokernelTester {
     }
   }
 
+  void test(q8conv_i32_ukernel_function qconv) const {
+    ASSERT_LE(m(), mr());
+    ASSERT_LE(n(), nr());
+    ASSERT_GE(k(), kr());
+
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> a((mr() - 1) * aStride() + k() + 8);
+    std::vector<uint8_t> b(n() * ks() * k());
+    std::vector<uint8_t, AlignedAllocator<uint8_t, 32>> packedW(ks() * packedN() * packedK() + biasN() * sizeof(uint32_t) / sizeof(uint8_t));
+    std::vector<int32_t> bias(n());
+    std::vector<int32_t> c((m() - 1) * cStride() + n());
+    std::vector<int32_t> acc(m() * n());
+    std::vector<const uint8_t*> im2col(mr() * ks());
+
+    const uint8_t* aPtr = a.data() + 8;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(u8rng));
+      std::generate(b.begin(), b.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(c.begin(), c.end(), INT32_C(0xA5A5A5A5));
+
+      std::fill(packedW.begin(), packedW.end(), bZeroPoint());
+      pack_q8conv_w(n(), ks(), k(), np(), kr(),
+        aZeroPoint(), bZeroPoint(),
+        b.data(), bias.data(), packedW.data());
+
+      ASSERT_NE(*std::max_element(a.cbegin(), a.cend()), *std::min_element(a.cbegin(), a.cend()));
+      ASSERT_NE(*std::max_element(b.cbegin(), b.cend()), *std::min_element(b.cbegin(), b.cend()));
+
+      for (size_t ksIndex = 0; ksIndex < ks(); ksIndex++) {
+        for (size_t mIndex = 0; mIndex < mr(); mIndex++) {
+          im2col[ksIndex * mr() + mIndex] = aPtr + aStride() * mIndex;
+        }
+      }
+      std::shuffle(im2col.begin(), im2col.end(), rng);
+      for (size_t ksIndex = 0; ksIndex < ks(); ksIndex++) {
+        for (size_t mIndex = m(); mIndex < mr(); mIndex++) {
+          im2col[ksIndex * mr() + mIndex] = im2col[ksIndex * mr() + m() - 1];
+        }
+      }
+
+      std::fill(acc.begin(), acc.end(), 0);
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          for (size_t ksIndex = 0; ksIndex < ks(); ksIndex++) {
+            for (size_t kBlockStart = 0; kBlockStart < k(); kBlockStart += kr()) {
+              for (size_t kBlockOffset = 0; kBlockOffset < std::min(k() - kBlockStart, kr()); kBlockOffset++) {
+                ASSERT_LT(ksIndex * mr() + mIndex, im2col.size());
+                ASSERT_LT(kBlockStart + kBlockOffset, k());
+                ASSERT_LT(kBlockStart + kBlockOffset, aStride());
+
+                acc[mIndex * n() + nIndex] +=
+                  (int32_t(im2col[ksIndex * mr() + mIndex][kBlockStart + kBlockOffset]) - int32_t(aZeroPoint())) *
+                  (int32_t(b[(nIndex * ks() + ksIndex) * k() + kBlockStart + kBlockOffset]) - int32_t(bZeroPoint()));
+              }
+            }
+          }
+          acc[mIndex * n() + nIndex] += bias[nIndex];
+        }
+      }
+
+      const union qnnp_kernel_zero_point_params kernelZeroPointParams =
+        qnnp_compute_kernel_zero_point_params(bZeroPoint());
+
+      qconv(
+        m(), n(), k(), ks(),
+        im2col.data(), packedW.data(),
+        c.data(), cStride() * sizeof(int32_t),
+        &kernelZeroPointParams);
+
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          ASSERT_EQ(c[mIndex * cStride() + nIndex], acc[mIndex * n() + nIndex])
+              << "at " << mIndex << ", " << nIndex << ": Mr x Nr x Kr = " << mr() << " x "
+              << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        }
+      }
+    }
+  }
+
+  void test(q8conv_f32_ukernel_function qconv) const {
+    ASSERT_LE(m(), mr());
+    ASSERT_LE(n(), nr());
+    ASSERT_GE(k(), kr());
+
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto scaleRng = std::bind(std::uniform_real_distribution<float>(1.0e-5f, 1.0f), rng);
+
+    std::vector<uint8_t> a((mr() - 1) * aStride() + k() + 8);
+    std::vector<uint8_t> b(n() * ks() * k());
+    std::vector<uint8_t, AlignedAllocator<uint8_t, 32>> packedW(ks() * packedN() * packedK() + biasN() * sizeof(uint32_t) / sizeof(uint8_t));
+    std::vector<int32_t> bias(n());
+    std::vector<float> c((m() - 1) * cStride() + n());
+    std::vector<int32_t> acc(m() * n());
+    std::vector<const uint8_t*> im2col(mr() * ks());
+
+    const uint8_t* aPtr = a.data() + 8;
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(a.begin(), a.end(), std::ref(u8rng));
+      std::generate(b.begin(), b.end(), std::ref(u8rng));
+      std::generate(bias.begin(), bias.end(), std::ref(s32rng));
+      std::fill(c.begin(), c.end(), std::nanf(""));
+
+      std::fill(packedW.begin(), packedW.end(), bZeroPoint());
+      pack_q8conv_w(n(), ks(), k(), np(), kr(),
+        aZeroPoint(), bZeroPoint(),
+        b.data(), bias.data(), packedW.data());
+
+      ASSERT_NE(*std::max_element(a.cbegin(), a.cend()), *std::min_element(a.cbegin(), a.cend()));
+      ASSERT_NE(*std::max_element(b.cbegin(), b.cend()), *std::min_element(b.cbegin(), b.cend()));
+
+      for (size_t ksIndex = 0; ksIndex < ks(); ksIndex++) {
+        for (size_t mIndex = 0; mIndex < mr(); mIndex++) {
+          im2col[ksIndex * mr() + mIndex] = aPtr + aStride() * mIndex;
+        }
+      }
+      std::shuffle(im2col.begin(), im2col.end(), rng);
+      for (size_t ksIndex = 0; ksIndex < ks(); ksIndex++) {
+        for (size_t mIndex = m(); mIndex < mr(); mIndex++) {
+          im2col[ksIndex * mr() + mIndex] = im2col[ksIndex * mr() + m() - 1];
+        }
+      }
+
+      std::fill(acc.begin(), acc.end(), 0);
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          for (size_t ksIndex = 0; ksIndex < ks(); ksIndex++) {
+            for (size_t kBlockStart = 0; kBlockStart < k(); kBlockStart += kr()) {
+              for (size_t kBlockOffset = 0; kBlockOffset < std::min(k() - kBlockStart, kr()); kBlockOffset++) {
+                ASSERT_LT(ksIndex * mr() + mIndex, im2col.size());
+                ASSERT_LT(kBlockStart + kBlockOffset, k());
+                ASSERT_LT(kBlockStart + kBlockOffset, aStride());
+
+                acc[mIndex * n() + nIndex] +=
+                  (int32_t(im2col[ksIndex * mr() + mIndex][kBlockStart + kBlockOffset]) - int32_t(aZeroPoint())) *
+                  (int32_t(b[(nIndex * ks() + ksIndex) * k() + kBlockStart + kBlockOffset]) - int32_t(bZeroPoint()));
+              }
+            }
+          }
+          acc[mIndex * n() + nIndex] += bias[nIndex];
+        }
+      }
+
+      const float scale = scaleRng();
+      const union qnnp_conv_dequantization_params dequantizationParams =
+        qnnp_compute_conv_dequantization_params(bZeroPoint(), scale);
+
+      qconv(
+        m(), n(), k(), ks(),
+        im2col.data(), packedW.data(),
+        c.data(), cStride() * sizeof(float),
+        &dequantizationParams);
+
+      for (size_t mIndex = 0; mIndex < m(); mIndex++) {
+        for (size_t nIndex = 0; nIndex < n(); nIndex++) {
+          ASSERT_EQ(c[mIndex * cStride() + nIndex], float(acc[mIndex * n() + nIndex]) * scale)
+              << "at " << mIndex << ", " << nIndex << ": accumulator = " << acc[mIndex * n() + nIndex]
+              << ", scale = " << scale << ", Mr x Nr x Kr = " << mr() << " x "
+              << nr() << " x " << kr() << ", M x N x K = " << m() << " x " << n() << " x " << k();
+        }
+      }
+    }
+  }
+
   void test(q8gemm_xzp_ukernel_function qgemm) const
   {
     ASSERT_LE(m(), mr());
@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <qnnpack.h>
+
+
+static void ExpectEqual(const qnnp_operator_memory_info& expected, const qnnp_operator_memory_info& actual) {
+  EXPECT_EQ(expected.operator_size, actual.operator_size);
+  EXPECT_EQ(expected.packed_weights_size, actual.packed_weights_size);
+  EXPECT_EQ(expected.indirection_buffer_size, actual.indirection_buffer_size);
+  EXPECT_EQ(expected.a_sum_size, actual.a_sum_size);
+  EXPECT_EQ(expected.zero_buffer_size, actual.zero_buffer_size);
+  EXPECT_EQ(expected.lookup_table_size, actual.lookup_table_size);
+  EXPECT_EQ(expected.total_size, actual.total_size);
+}
+
+static qnnp_operator_t CreateConvolution(
+    uint32_t padding, uint32_t kernelSize, uint32_t stride, uint32_t dilation,
+    uint32_t groups, size_t groupInputChannels, size_t groupOutputChannels)
+{
+  std::vector<uint8_t> kernel(groups * groupOutputChannels * kernelSize * kernelSize * groupInputChannels, 1);
+  std::vector<int32_t> bias(groups * groupOutputChannels);
+  qnnp_operator_t convolutionOp = nullptr;
+  EXPECT_EQ(qnnp_status_success,
+    qnnp_create_convolution2d_nhwc_q8(
+      padding, padding, padding, padding,
+      kernelSize, kernelSize,
+      stride, stride,
+      dilation, dilation,
+      groups, groupInputChannels, groupOutputChannels,
+      127, 0.5f,
+      127, 0.5f,
+      kernel.data(), bias.data(),
+      127, 1.0f, 0, 255,
+      0, &convolutionOp));
+  return convolutionOp;
+}
+
+TEST(MEMORY_INFO, convolution) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t convolutionOp = CreateConvolution(1, 3, 1, 1, 1, 15, 17);
+  ASSERT_NE(nullptr, convolutionOp);
+
+  qnnp_operator_memory_info created = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(convolutionOp, &created));
+  EXPECT_NE(0, created.operator_size);
+  EXPECT_LE(17 * (3 * 3 * 15 + sizeof(int32_t)), created.packed_weights_size);
+  EXPECT_LE(15, created.zero_buffer_size);
+  EXPECT_EQ(0, created.indirection_buffer_size);
+  EXPECT_EQ(0, created.a_sum_size);
+  EXPECT_EQ(0, created.lookup_table_size);
+  EXPECT_EQ(created.operator_size + created.packed_weights_size + created.zero_buffer_size, created.total_size);
+
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(convolutionOp, 3, 13, 14, 0, 0, &predicted));
+  EXPECT_EQ(created.packed_weights_size, predicted.packed_weights_size);
+  EXPECT_LE(sizeof(void*) * 3 * 13 * 14 * 3 * 3, predicted.indirection_buffer_size);
+
+  /* Prediction does not allocate */
+  qnnp_operator_memory_info unchanged = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(convolutionOp, &unchanged));
+  ExpectEqual(created, unchanged);
+
+  std::vector<uint8_t> input(3 * 13 * 14 * 15);
+  std::vector<uint8_t> output(3 * 13 * 14 * 17);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_convolution2d_nhwc_q8(
+      convolutionOp, 3, 13, 14, input.data(), 15, output.data(), 17, nullptr));
+  qnnp_operator_memory_info actual = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(convolutionOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(convolutionOp));
+}
+
+TEST(MEMORY_INFO, strided_dilated_convolution) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t convolutionOp = CreateConvolution(2, 3, 2, 2, 2, 7, 9);
+  ASSERT_NE(nullptr, convolutionOp);
+
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(convolutionOp, 2, 17, 11, 0, 0, &predicted));
+
+  std::vector<uint8_t> input(2 * 17 * 11 * 14);
+  std::vector<uint8_t> output(2 * 17 * 11 * 18);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_convolution2d_nhwc_q8(
+      convolutionOp, 2, 17, 11, input.data(), 14, output.data(), 18, nullptr));
+  qnnp_operator_memory_info actual = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(convolutionOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(convolutionOp));
+}
+
+TEST(MEMORY_INFO, depthwise_convolution) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t convolutionOp = CreateConvolution(1, 3, 2, 1, 24, 1, 1);
+  ASSERT_NE(nullptr, convolutionOp);
+
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(convolutionOp, 2, 15, 14, 0, 0, &predicted));
+
+  std::vector<uint8_t> input(2 * 15 * 14 * 24);
+  std::vector<uint8_t> output(2 * 15 * 14 * 24);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_convolution2d_nhwc_q8(
+      convolutionOp, 2, 15, 14, input.data(), 24, output.data(), 24, nullptr));
+  qnnp_operator_memory_info actual = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(convolutionOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(convolutionOp));
+}
+
+TEST(MEMORY_INFO, pointwise_convolution) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t convolutionOp = CreateConvolution(0, 1, 1, 1, 1, 23, 19);
+  ASSERT_NE(nullptr, convolutionOp);
+
+  qnnp_operator_memory_info created = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(convolutionOp, &created));
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(convolutionOp, 2, 15, 14, 0, 0, &predicted));
+  ExpectEqual(created, predicted);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(convolutionOp));
+}
+
+TEST(MEMORY_INFO, deconvolution) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  std::vector<uint8_t> kernel(11 * 3 * 3 * 13, 1);
+  std::vector<int32_t> bias(11);
+  qnnp_operator_t deconvolutionOp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_deconvolution2d_nhwc_q8(
+      1, 1, 1, 1,
+      1, 0,
+      3, 3,
+      2, 2,
+      1, 1,
+      1, 13, 11,
+      127, 0.5f,
+      127, 0.5f,
+      kernel.data(), bias.data(),
+      127, 1.0f, 0, 255,
+      0, &deconvolutionOp));
+
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(deconvolutionOp, 2, 9, 7, 0, 0, &predicted));
+
+  std::vector<uint8_t> input(2 * 9 * 7 * 13);
+  std::vector<uint8_t> output(2 * 18 * 14 * 11);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_deconvolution2d_nhwc_q8(
+      deconvolutionOp, 2, 9, 7, input.data(), 13, output.data(), 11, nullptr));
+  qnnp_operator_memory_info actual = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(deconvolutionOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(deconvolutionOp));
+}
+
+TEST(MEMORY_INFO, max_pooling) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t maxPoolingOp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_max_pooling2d_nhwc_u8(
+      1, 1, 1, 1,
+      3, 3,
+      2, 2,
+      2, 2,
+      19, 0, 255,
+      0, &maxPoolingOp));
+
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(maxPoolingOp, 3, 11, 13, 0, 0, &predicted));
+
+  std::vector<uint8_t> input(3 * 11 * 13 * 19);
+  std::vector<uint8_t> output(3 * 11 * 13 * 19);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_max_pooling2d_nhwc_u8(
+      maxPoolingOp, 3, 11, 13, input.data(), 19, output.data(), 19, nullptr));
+  qnnp_operator_memory_info actual = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(maxPoolingOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  /* Setup for a smaller batch of the same input keeps the indirection buffer */
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(maxPoolingOp, 1, 11, 13, 0, 0, &predicted));
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_max_pooling2d_nhwc_u8(
+      maxPoolingOp, 1, 11, 13, input.data(), 19, output.data(), 19, nullptr));
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(maxPoolingOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(maxPoolingOp));
+}
+
+TEST(MEMORY_INFO, average_pooling) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t averagePoolingOp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_average_pooling2d_nhwc_q8(
+      1, 1, 1, 1,
+      3, 3,
+      1, 1,
+      19,
+      127, 0.5f,
+      127, 0.5f,
+      0, 255,
+      0, &averagePoolingOp));
+
+  qnnp_operator_memory_info created = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(averagePoolingOp, &created));
+  EXPECT_EQ(19, created.zero_buffer_size);
+
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(averagePoolingOp, 2, 11, 13, 0, 0, &predicted));
+
+  std::vector<uint8_t> input(2 * 11 * 13 * 19);
+  std::vector<uint8_t> output(2 * 11 * 13 * 19);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_average_pooling2d_nhwc_q8(
+      averagePoolingOp, 2, 11, 13, input.data(), 19, output.data(), 19, nullptr));
+  qnnp_operator_memory_info actual = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(averagePoolingOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(averagePoolingOp));
+}
+
+TEST(MEMORY_INFO, resize_bilinear) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t resizeOp = nullptr;
+  ASSERT_EQ(qnnp_status_success, qnnp_create_resize_bilinear2d_nhwc_q8(5, 0, &resizeOp));
+
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(resizeOp, 2, 7, 9, 13, 17, &predicted));
+  EXPECT_EQ(sizeof(int16_t) * 2 * 13 * 17, predicted.packed_weights_size);
+
+  std::vector<uint8_t> input(2 * 7 * 9 * 5);
+  std::vector<uint8_t> output(2 * 13 * 17 * 5);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_resize_bilinear2d_nhwc_q8(
+      resizeOp, 2, 7, 9, 13, 17, input.data(), 5, output.data(), 5, nullptr));
+  qnnp_operator_memory_info actual = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(resizeOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  /* Setup for a smaller batch of the same input and output keeps the indirection buffer */
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(resizeOp, 1, 7, 9, 13, 17, &predicted));
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_resize_bilinear2d_nhwc_q8(
+      resizeOp, 1, 7, 9, 13, 17, input.data(), 5, output.data(), 5, nullptr));
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(resizeOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(resizeOp));
+}
+
+TEST(MEMORY_INFO, resize_nearest) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t resizeOp = nullptr;
+  ASSERT_EQ(qnnp_status_success, qnnp_create_resize_nearest2d_nhwc_x8(5, 0, &resizeOp));
+
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(resizeOp, 2, 7, 9, 13, 17, &predicted));
+
+  std::vector<uint8_t> input(2 * 7 * 9 * 5);
+  std::vector<uint8_t> output(2 * 13 * 17 * 5);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_resize_nearest2d_nhwc_x8(
+      resizeOp, 2, 7, 9, 13, 17, input.data(), 5, output.data(), 5, nullptr));
+  qnnp_operator_memory_info actual = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(resizeOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(resizeOp));
+}
+
+TEST(MEMORY_INFO, dynamic_fully_connected) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  std::vector<uint8_t> kernel(19 * 1023, 1);
+  std::vector<float> bias(19);
+  qnnp_operator_t fullyConnectedOp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_dynamic_fully_connected_nc_f32(
+      1023, 19, 127, 0.5f, kernel.data(), bias.data(), 0, &fullyConnectedOp));
+
+  qnnp_operator_memory_info predicted = { };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_predict_operator_memory_info(fullyConnectedOp, 5, 0, 0, 0, 0, &predicted));
+  EXPECT_LE(5 * 1023, predicted.a_sum_size);
+
+  std::vector<float> input(5 * 1023);
+  std::vector<float> output(5 * 19);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_dynamic_fully_connected_nc_f32(fullyConnectedOp, 5, input.data(), 1023, output.data(), 19));
+  qnnp_operator_memory_info actual = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(fullyConnectedOp, &actual));
+  ExpectEqual(predicted, actual);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(fullyConnectedOp));
+}
+
+TEST(MEMORY_INFO, lookup_table) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t sigmoidOp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_sigmoid_nc_q8(7, 127, 0.5f, 0, 1.0f / 256.0f, 0, 255, 0, &sigmoidOp));
+
+  qnnp_operator_memory_info memoryInfo = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(sigmoidOp, &memoryInfo));
+  EXPECT_EQ(256, memoryInfo.lookup_table_size);
+  EXPECT_EQ(memoryInfo.operator_size + 256, memoryInfo.total_size);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(sigmoidOp));
+}
+
+TEST(MEMORY_INFO, fused_output_lut) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t convolutionOp = CreateConvolution(1, 3, 1, 1, 1, 15, 17);
+  ASSERT_NE(nullptr, convolutionOp);
+
+  std::vector<uint8_t> lookupTable(256);
+  ASSERT_EQ(qnnp_status_success, qnnp_set_operator_output_lut(convolutionOp, lookupTable.data()));
+  qnnp_operator_memory_info memoryInfo = { };
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(convolutionOp, &memoryInfo));
+  EXPECT_EQ(256, memoryInfo.lookup_table_size);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_set_operator_output_lut(convolutionOp, nullptr));
+  ASSERT_EQ(qnnp_status_success, qnnp_get_operator_memory_info(convolutionOp, &memoryInfo));
+  EXPECT_EQ(0, memoryInfo.lookup_table_size);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(convolutionOp));
+}
+
+TEST(MEMORY_INFO, invalid_parameters) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_memory_info memoryInfo = { };
+  ASSERT_EQ(qnnp_status_invalid_parameter, qnnp_get_operator_memory_info(nullptr, &memoryInfo));
+
+  qnnp_operator_t convolutionOp = CreateConvolution(0, 5, 1, 1, 1, 3, 3);
+  ASSERT_NE(nullptr, convolutionOp);
+  ASSERT_EQ(qnnp_status_invalid_parameter, qnnp_get_operator_memory_info(convolutionOp, nullptr));
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_predict_operator_memory_info(convolutionOp, 0, 7, 7, 0, 0, &memoryInfo));
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_predict_operator_memory_info(convolutionOp, 1, 4, 7, 0, 0, &memoryInfo));
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(convolutionOp));
+}
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+
+
+class PadMicrokernelTester {
+ public:
+  inline PadMicrokernelTester& m(size_t m) {
+    assert(m != 0);
+    this->m_ = m;
+    return *this;
+  }
+
+  inline size_t m() const {
+    return this->m_;
+  }
+
+  inline PadMicrokernelTester& n(size_t n) {
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline PadMicrokernelTester& l(size_t l) {
+    this->l_ = l;
+    return *this;
+  }
+
+  inline size_t l() const {
+    return this->l_;
+  }
+
+  inline PadMicrokernelTester& r(size_t r) {
+    this->r_ = r;
+    return *this;
+  }
+
+  inline size_t r() const {
+    return this->r_;
+  }
+
+  inline PadMicrokernelTester& xStride(size_t xStride) {
+    assert(xStride != 0);
+    this->xStride_ = xStride;
+    return *this;
+  }
+
+  inline size_t xStride() const {
+    if (this->xStride_ == 0) {
+      return n();
+    } else {
+      assert(this->xStride_ >= n());
+      return this->xStride_;
+    }
+  }
+
+  inline PadMicrokernelTester& yStride(size_t yStride) {
+    assert(yStride != 0);
+    this->yStride_ = yStride;
+    return *this;
+  }
+
+  inline size_t yStride() const {
+    if (this->yStride_ == 0) {
+      return l() + n() + r();
+    } else {
+      assert(this->yStride_ >= l() + n() + r());
+      return this->yStride_;
+    }
+  }
+
+  inline PadMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test(x8pad_ukernel_function x8pad) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> x(std::max<size_t>((m() - 1) * xStride() + n(), 1));
+    std::vector<uint8_t> y((m() - 1) * yStride() + l() + n() + r() + 1);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(u8rng));
+      const uint8_t c = u8rng();
+      const uint8_t guard = c ^ 0xFF;
+      std::fill(y.begin(), y.end(), guard);
+
+      /* Call optimized micro-kernel */
+      x8pad(m(), n(), l(), r(), c, n() == 0 ? nullptr : x.data(), xStride(), y.data(), yStride());
+
+      /* Verify results */
+      for (size_t i = 0; i < m(); i++) {
+        for (size_t j = 0; j < l(); j++) {
+          ASSERT_EQ(uint32_t(c), uint32_t(y[i * yStride() + j]))
+            << "at row " << i << ", left padding column " << j;
+        }
+        for (size_t j = 0; j < n(); j++) {
+          ASSERT_EQ(uint32_t(x[i * xStride() + j]), uint32_t(y[i * yStride() + l() + j]))
+            << "at row " << i << ", column " << j;
+        }
+        for (size_t j = 0; j < r(); j++) {
+          ASSERT_EQ(uint32_t(c), uint32_t(y[i * yStride() + l() + n() + j]))
+            << "at row " << i << ", right padding column " << j;
+        }
+        for (size_t j = l() + n() + r(); j < yStride() && i * yStride() + j < y.size(); j++) {
+          ASSERT_EQ(uint32_t(guard), uint32_t(y[i * yStride() + j]))
+            << "at row " << i << ", column " << j << " past the end of the row";
+        }
+      }
+    }
+  }
+
+ private:
+  size_t m_{1};
+  size_t n_{1};
+  size_t l_{0};
+  size_t r_{0};
+  size_t xStride_{0};
+  size_t yStride_{0};
+  size_t iterations_{3};
+};
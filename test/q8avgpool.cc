@@ -2403,4 +2403,1197 @@
       }
     }
   }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, kc_lt_16_small_ks) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t kc = 1; kc < 16; kc++) {
+      for (size_t ks = 1; ks < 8; ks++) {
+        for (size_t kh = 1; kh <= ks; kh++) {
+          for (size_t kw = 1; kw <= ks; kw++) {
+            if (kh * kw == ks) {
+              AvgPoolMicrokernelTester()
+                .kr(16)
+                .kh(kh)
+                .kw(kw)
+                .kc(kc)
+                .test(q8avgpool_ukernel_up16xm__avx2);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, kc_lt_16_large_ks) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t kc = 1; kc < 16; kc++) {
+      for (size_t ks = 8; ks < 16; ks++) {
+        AvgPoolMicrokernelTester()
+          .kr(16)
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .test(q8avgpool_ukernel_up16xm__avx2);
+        AvgPoolMicrokernelTester()
+          .kr(16)
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .test(q8avgpool_ukernel_up16xm__avx2);
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, kc_lt_16_with_x_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 3; n += 2) {
+      for (size_t kc = 1; kc < 16; kc++) {
+        for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+          for (float xScale = 0.01f; xScale < 100.0f; xScale *= 3.14159265f) {
+            AvgPoolMicrokernelTester()
+              .kr(16)
+              .n(n)
+              .kh(ks)
+              .kw(ks)
+              .kc(kc)
+              .xScale(xScale)
+              .iterations(1)
+              .test(q8avgpool_ukernel_up16xm__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, kc_lt_16_with_x_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 3; n += 2) {
+      for (size_t kc = 1; kc < 16; kc++) {
+        for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+          for (int32_t xZeroPoint = 0; xZeroPoint <= 255; xZeroPoint += 51) {
+            AvgPoolMicrokernelTester()
+              .kr(16)
+              .n(n)
+              .kh(ks)
+              .kw(ks)
+              .kc(kc)
+              .xZeroPoint(uint8_t(xZeroPoint))
+              .iterations(1)
+              .test(q8avgpool_ukernel_up16xm__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, kc_lt_16_with_y_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 3; n += 2) {
+      for (size_t kc = 1; kc < 16; kc++) {
+        for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+          for (float yScale = 0.01f; yScale < 100.0f; yScale *= 3.14159265f) {
+            AvgPoolMicrokernelTester()
+              .kr(16)
+              .n(n)
+              .kh(ks)
+              .kw(ks)
+              .kc(kc)
+              .yScale(yScale)
+              .iterations(1)
+              .test(q8avgpool_ukernel_up16xm__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, kc_lt_16_with_y_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 3; n += 2) {
+      for (size_t kc = 1; kc < 16; kc++) {
+        for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+          for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+            AvgPoolMicrokernelTester()
+              .kr(16)
+              .n(n)
+              .kh(ks)
+              .kw(ks)
+              .kc(kc)
+              .yZeroPoint(uint8_t(yZeroPoint))
+              .iterations(1)
+              .test(q8avgpool_ukernel_up16xm__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, kc_lt_16_with_y_max) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 3; n += 2) {
+      for (size_t kc = 1; kc < 16; kc++) {
+        for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .xZeroPoint(128)
+            .yZeroPoint(128)
+            .xScale(1.0f)
+            .yScale(1.0f)
+            .yMax(128)
+            .iterations(3)
+            .test(q8avgpool_ukernel_up16xm__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, kc_lt_16_with_y_min) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 3; n += 2) {
+      for (size_t kc = 1; kc < 16; kc++) {
+        for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .xZeroPoint(128)
+            .yZeroPoint(128)
+            .xScale(1.0f)
+            .yScale(1.0f)
+            .yMin(128)
+            .iterations(3)
+            .test(q8avgpool_ukernel_up16xm__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, small_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t kc = 1; kc < 16; kc++) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .iterations(3)
+            .test(q8avgpool_ukernel_up16xm__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, small_n_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t kc = 1; kc < 16; kc++) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .xStride(19)
+            .iterations(3)
+            .test(q8avgpool_ukernel_up16xm__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, small_n_with_y_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t kc = 1; kc < 16; kc++) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .yStride(17)
+            .iterations(3)
+            .test(q8avgpool_ukernel_up16xm__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16xM__AVX2, small_n_with_s) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t s = 2; s <= 5; s++) {
+          for (size_t kc = 1; kc < 16; kc++) {
+            AvgPoolMicrokernelTester()
+              .kr(16)
+              .n(n)
+              .kh(ks)
+              .kw(ks)
+              .kc(kc)
+              .s(s)
+              .iterations(1)
+              .test(q8avgpool_ukernel_up16xm__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_eq_16_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .kc(16);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          tester
+            .kh(kh)
+            .kw(kw)
+            .test(q8avgpool_ukernel_up16x9__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_eq_16_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .kc(16);
+    for (size_t ks = 2; ks < tester.mr(); ks++) {
+      for (size_t kh = 1; kh <= ks; kh++) {
+        for (size_t kw = 1; kw <= ks; kw++) {
+          if (kh * kw == ks) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .test(q8avgpool_ukernel_up16x9__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_div_16_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 16; kc < 256; kc += 48) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .test(q8avgpool_ukernel_up16x9__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_div_16_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .iterations(3);
+    for (size_t ks = 2; ks < tester.mr(); ks++) {
+      for (size_t kh = 1; kh <= ks; kh++) {
+        for (size_t kw = 1; kw <= ks; kw++) {
+          if (kh * kw == ks) {
+            for (size_t kc = 16; kc < 256; kc += 48) {
+              tester
+                .kh(kh)
+                .kw(kw)
+                .kc(kc)
+                .test(q8avgpool_ukernel_up16x9__avx2);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_div_16_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .iterations(3);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 16; kc < 256; kc += 48) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .xStride(263)
+              .test(q8avgpool_ukernel_up16x9__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_gt_16_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 17; kc < 32; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .test(q8avgpool_ukernel_up16x9__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_gt_16_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .iterations(3);
+    for (size_t ks = 2; ks < tester.mr(); ks++) {
+      for (size_t kh = 1; kh <= ks; kh++) {
+        for (size_t kw = 1; kw <= ks; kw++) {
+          if (kh * kw == ks) {
+            for (size_t kc = 17; kc < 32; kc++) {
+              tester
+                .kh(kh)
+                .kw(kw)
+                .kc(kc)
+                .test(q8avgpool_ukernel_up16x9__avx2);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_gt_16_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .iterations(3);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 17; kc < 32; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .xStride(37)
+              .test(q8avgpool_ukernel_up16x9__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_div_16_with_x_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        for (float xScale = 0.01f; xScale < 100.0f; xScale *= 3.14159265f) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .n(n)
+            .kh(3)
+            .kw(3)
+            .kc(kc)
+            .xScale(xScale)
+            .iterations(2)
+            .test(q8avgpool_ukernel_up16x9__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_div_16_with_x_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        for (int32_t xZeroPoint = 0; xZeroPoint <= 255; xZeroPoint += 51) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .n(n)
+            .kh(3)
+            .kw(3)
+            .kc(kc)
+            .xZeroPoint(uint8_t(xZeroPoint))
+            .iterations(3)
+            .test(q8avgpool_ukernel_up16x9__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_div_16_with_y_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        for (float yScale = 0.01f; yScale < 100.0f; yScale *= 3.14159265f) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .n(n)
+            .kh(3)
+            .kw(3)
+            .kc(kc)
+            .yScale(yScale)
+            .iterations(2)
+            .test(q8avgpool_ukernel_up16x9__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_div_16_with_y_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .n(n)
+            .kh(3)
+            .kw(3)
+            .kc(kc)
+            .yZeroPoint(uint8_t(yZeroPoint))
+            .iterations(3)
+            .test(q8avgpool_ukernel_up16x9__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_div_16_with_y_max) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        AvgPoolMicrokernelTester()
+          .kr(16)
+          .mr(9)
+          .n(n)
+          .kh(3)
+          .kw(3)
+          .kc(kc)
+          .xZeroPoint(128)
+          .yZeroPoint(128)
+          .xScale(1.0f)
+          .yScale(1.0f)
+          .yMax(128)
+          .test(q8avgpool_ukernel_up16x9__avx2);
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, kc_div_16_with_y_min) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        AvgPoolMicrokernelTester()
+          .kr(16)
+          .mr(9)
+          .n(n)
+          .kh(3)
+          .kw(3)
+          .kc(kc)
+          .xZeroPoint(128)
+          .yZeroPoint(128)
+          .xScale(1.0f)
+          .yScale(1.0f)
+          .yMin(128)
+          .test(q8avgpool_ukernel_up16x9__avx2);
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, small_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3}}) {
+        for (size_t kc = 16; kc < 51; kc += 5) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .test(q8avgpool_ukernel_up16x9__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, small_n_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3}}) {
+        for (size_t kc = 16; kc < 51; kc += 5) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .xStride(59)
+            .test(q8avgpool_ukernel_up16x9__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, small_n_with_y_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3}}) {
+        for (size_t kc = 16; kc < 51; kc += 5) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .yStride(61)
+            .test(q8avgpool_ukernel_up16x9__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_UP16x9__AVX2, small_n_with_s) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3}}) {
+        for (size_t kc = 16; kc < 51; kc += 5) {
+          for (size_t s = 2; s <= ks; s++) {
+            AvgPoolMicrokernelTester()
+              .kr(16)
+              .mr(9)
+              .n(n)
+              .kh(ks)
+              .kw(ks)
+              .kc(kc)
+              .s(s)
+              .test(q8avgpool_ukernel_up16x9__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_eq_16_twopass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .qr(8)
+      .kc(16);
+    const size_t ks = tester.mr() + tester.qr();
+    for (size_t kh = 1; kh <= ks; kh++) {
+      for (size_t kw = 1; kw <= ks; kw++) {
+        if (kh * kw == ks) {
+          tester
+            .kh(kh)
+            .kw(kw)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_eq_16_twopass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .qr(8)
+      .kc(16);
+    for (size_t ks = 10; ks < tester.mr() + tester.qr(); ks++) {
+      tester
+        .kh(ks)
+        .kw(1)
+        .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+      tester
+        .kh(1)
+        .kw(ks)
+        .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_eq_16_multipass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t ks : std::vector<size_t>{{25, 49}}) {
+      auto tester = AvgPoolMicrokernelTester()
+        .kr(16)
+        .mr(9)
+        .qr(8)
+        .kc(16);
+      for (size_t kh = 1; kh <= ks; kh++) {
+        for (size_t kw = 1; kw <= ks; kw++) {
+          if (kh * kw == ks) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_eq_16_multipass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t ksMax : std::vector<size_t>{{25, 49}}) {
+      auto tester = AvgPoolMicrokernelTester()
+        .kr(16)
+        .mr(9)
+        .qr(8)
+        .kc(16);
+      for (size_t ks = ksMax - tester.qr() + 1; ks < ksMax; ks++) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_twopass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    const size_t ks = 17;
+    for (size_t kc = 16; kc < 256; kc += 48) {
+      tester
+        .kc(kc)
+        .kh(ks)
+        .kw(1)
+        .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+      tester
+        .kc(kc)
+        .kh(1)
+        .kw(ks)
+        .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_twopass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t ks = 10; ks < tester.mr() + tester.qr(); ks++) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        tester
+          .kc(kc)
+          .kh(ks)
+          .kw(1)
+          .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        tester
+          .kc(kc)
+          .kh(1)
+          .kw(ks)
+          .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_twopass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    const size_t ks = tester.mr() + tester.qr();
+    for (size_t kh = 1; kh <= ks; kh++) {
+      for (size_t kw = 1; kw <= ks; kw++) {
+        if (kh * kw == ks) {
+          for (size_t kc = 16; kc < 256; kc += 48) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .xStride(263)
+              .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_multipass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t ks : std::vector<size_t>{{25, 49}}) {
+      auto tester = AvgPoolMicrokernelTester()
+        .kr(16)
+        .mr(9)
+        .qr(8)
+        .iterations(3);
+      for (size_t kh = 1; kh <= ks; kh++) {
+        for (size_t kw = 1; kw <= ks; kw++) {
+          if (kh * kw == ks) {
+            for (size_t kc = 16; kc < 256; kc += 48) {
+              tester
+                .kh(kh)
+                .kw(kw)
+                .kc(kc)
+                .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_multipass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t ksMax : std::vector<size_t>{{25, 49}}) {
+      auto tester = AvgPoolMicrokernelTester()
+        .kr(16)
+        .mr(9)
+        .qr(8)
+        .iterations(3);
+      for (size_t ks = ksMax - tester.qr() + 1; ks < ksMax; ks++) {
+        for (size_t kc = 16; kc < 256; kc += 48) {
+          tester
+            .kc(kc)
+            .kh(ks)
+            .kw(1)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+          tester
+            .kc(kc)
+            .kh(1)
+            .kw(ks)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t ks : std::vector<size_t>{{25, 49}}) {
+      auto tester = AvgPoolMicrokernelTester()
+        .kr(16)
+        .mr(9)
+        .qr(8)
+        .iterations(3);
+      for (size_t kh = 1; kh <= ks; kh++) {
+        for (size_t kw = 1; kw <= ks; kw++) {
+          if (kh * kw == ks) {
+            for (size_t kc = 16; kc < 256; kc += 48) {
+              tester
+                .kh(kh)
+                .kw(kw)
+                .kc(kc)
+                .xStride(263)
+                .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_gt_16_twopass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    const size_t ks = tester.mr() + tester.qr();
+    for (size_t kh = 1; kh <= ks; kh++) {
+      for (size_t kw = 1; kw <= ks; kw++) {
+        if (kh * kw == ks) {
+          for (size_t kc = 17; kc < 32; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_gt_16_twopass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t ks = 10; ks < tester.mr() + tester.qr(); ks++) {
+      for (size_t kc = 17; kc < 32; kc++) {
+        tester
+          .kc(kc)
+          .kh(ks)
+          .kw(1)
+          .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        tester
+          .kc(kc)
+          .kh(1)
+          .kw(ks)
+          .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_gt_16_twopass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = AvgPoolMicrokernelTester()
+      .kr(16)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    const size_t ks = tester.mr() + tester.qr();
+    for (size_t kh = 1; kh <= ks; kh++) {
+      for (size_t kw = 1; kw <= ks; kw++) {
+        if (kh * kw == ks) {
+          for (size_t kc = 17; kc < 32; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .xStride(37)
+              .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_gt_16_multipass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t ks : std::vector<size_t>{{25, 49}}) {
+      auto tester = AvgPoolMicrokernelTester()
+        .kr(16)
+        .mr(9)
+        .qr(8)
+        .iterations(3);
+      for (size_t kh = 1; kh <= ks; kh++) {
+        for (size_t kw = 1; kw <= ks; kw++) {
+          if (kh * kw == ks) {
+            for (size_t kc = 17; kc < 32; kc++) {
+              tester
+                .kh(kh)
+                .kw(kw)
+                .kc(kc)
+                .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_gt_16_multipass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t ksMax : std::vector<size_t>{{25, 49}}) {
+      auto tester = AvgPoolMicrokernelTester()
+        .kr(16)
+        .mr(9)
+        .qr(8)
+        .iterations(3);
+      for (size_t ks = ksMax - tester.qr() + 1; ks < ksMax; ks++) {
+        for (size_t kc = 17; kc < 32; kc++) {
+          tester
+            .kc(kc)
+            .kh(ks)
+            .kw(1)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+          tester
+            .kc(kc)
+            .kh(1)
+            .kw(ks)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_gt_16_multipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t ks : std::vector<size_t>{{25, 49}}) {
+      auto tester = AvgPoolMicrokernelTester()
+        .kr(16)
+        .mr(9)
+        .qr(8)
+        .iterations(3);
+      for (size_t kh = 1; kh <= ks; kh++) {
+        for (size_t kw = 1; kw <= ks; kw++) {
+          if (kh * kw == ks) {
+            for (size_t kc = 17; kc < 32; kc++) {
+              tester
+                .kh(kh)
+                .kw(kw)
+                .kc(kc)
+                .xStride(37)
+                .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_with_x_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        for (float xScale = 0.01f; xScale < 100.0f; xScale *= 3.14159265f) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(5)
+            .kw(5)
+            .kc(kc)
+            .xScale(xScale)
+            .iterations(1)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_with_x_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        for (int32_t xZeroPoint = 0; xZeroPoint <= 255; xZeroPoint += 51) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(5)
+            .kw(5)
+            .kc(kc)
+            .xZeroPoint(uint8_t(xZeroPoint))
+            .iterations(1)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_with_y_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        for (float yScale = 0.01f; yScale < 100.0f; yScale *= 3.14159265f) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(5)
+            .kw(5)
+            .kc(kc)
+            .yScale(yScale)
+            .iterations(1)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_with_y_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(5)
+            .kw(5)
+            .kc(kc)
+            .yZeroPoint(uint8_t(yZeroPoint))
+            .iterations(1)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_with_y_max) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        AvgPoolMicrokernelTester()
+          .kr(16)
+          .mr(9)
+          .qr(8)
+          .n(n)
+          .kh(5)
+          .kw(5)
+          .kc(kc)
+          .xZeroPoint(128)
+          .yZeroPoint(128)
+          .xScale(1.0f)
+          .yScale(1.0f)
+          .yMax(128)
+          .iterations(3)
+          .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, kc_div_16_with_y_min) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n <= 5; n += 2) {
+      for (size_t kc = 16; kc < 256; kc += 48) {
+        AvgPoolMicrokernelTester()
+          .kr(16)
+          .mr(9)
+          .qr(8)
+          .n(n)
+          .kh(5)
+          .kw(5)
+          .kc(kc)
+          .xZeroPoint(128)
+          .yZeroPoint(128)
+          .xScale(1.0f)
+          .yScale(1.0f)
+          .yMin(128)
+          .iterations(3)
+          .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, small_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{5, 7}}) {
+        for (size_t kc = 16; kc < 51; kc += 5) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, small_n_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{5, 7}}) {
+        for (size_t kc = 16; kc < 51; kc += 5) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .xStride(59)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, small_n_with_y_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{5, 7}}) {
+        for (size_t kc = 16; kc < 51; kc += 5) {
+          AvgPoolMicrokernelTester()
+            .kr(16)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .yStride(61)
+            .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8AVGPOOL_MP16x9P8Q__AVX2, small_n_with_s) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{5, 7}}) {
+        for (size_t s = 2; s <= 5; s++) {
+          for (size_t kc = 16; kc < 51; kc += 5) {
+            AvgPoolMicrokernelTester()
+              .kr(16)
+              .mr(9)
+              .qr(8)
+              .n(n)
+              .kh(ks)
+              .kw(ks)
+              .kc(kc)
+              .s(s)
+              .test(q8avgpool_ukernel_mp16x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
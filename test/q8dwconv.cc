@@ -1219,4 +1219,550 @@
         .test(q8dwconv_ukernel_mp8x25__sse2);
     }
   }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_eq_32) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(3)
+      .kernelWidth(3)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .test(q8dwconv_ukernel_up32x9__avx2);
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_eq_32_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(3)
+      .kernelWidth(3)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .qmin(128)
+      .test(q8dwconv_ukernel_up32x9__avx2);
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_eq_32_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(3)
+      .kernelWidth(3)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .qmax(128)
+      .test(q8dwconv_ukernel_up32x9__avx2);
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_eq_32_with_input_zero_point_only) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(3)
+      .kernelWidth(3)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .inputZeroPoint(255)
+      .kernelZeroPoint(0)
+      .test(q8dwconv_ukernel_up32x9__avx2);
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_eq_32_with_kernel_zero_point_only) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(3)
+      .kernelWidth(3)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .inputZeroPoint(0)
+      .kernelZeroPoint(255)
+      .test(q8dwconv_ukernel_up32x9__avx2);
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, multi_output_channels_eq_32) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(3)
+      .kernelWidth(3)
+      .cr(32)
+      .channels(32)
+      .width(5)
+      .test(q8dwconv_ukernel_up32x9__avx2);
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, multi_output_channels_eq_32_with_subsampling) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(3)
+      .kernelWidth(3)
+      .subsampling(2)
+      .cr(32)
+      .channels(32)
+      .width(5)
+      .test(q8dwconv_ukernel_up32x9__avx2);
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, multi_output_channels_eq_32_with_input_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(3)
+      .kernelWidth(3)
+      .cr(32)
+      .channels(32)
+      .width(5)
+      .inputStride(37)
+      .test(q8dwconv_ukernel_up32x9__avx2);
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, multi_output_channels_eq_32_with_output_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(3)
+      .kernelWidth(3)
+      .cr(32)
+      .channels(32)
+      .width(5)
+      .outputStride(41)
+      .test(q8dwconv_ukernel_up32x9__avx2);
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_div_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 64; channels < 512; channels += 96) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, multi_output_channels_div_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 64; channels < 512; channels += 96) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, multi_output_channels_div_32_with_output_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 64; channels < 512; channels += 96) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .outputStride(521)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_gt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_gt_32_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .qmin(128)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_gt_32_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .qmax(128)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_gt_32_with_input_zero_point_only) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(255)
+        .kernelZeroPoint(0)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_gt_32_with_kernel_zero_point_only) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(0)
+        .kernelZeroPoint(255)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, multi_output_channels_gt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, multi_output_channels_gt_32_with_output_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .outputStride(71)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, single_output_channels_lt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 2; channels < 32; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_UP32x9__AVX2, multi_output_channels_lt_32_with_output_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 1; channels < 32; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(3)
+        .kernelWidth(3)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .outputStride(37)
+        .test(q8dwconv_ukernel_up32x9__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_eq_32) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(5)
+      .kernelWidth(5)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .test(q8dwconv_ukernel_mp32x25__avx2);
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_eq_32_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(5)
+      .kernelWidth(5)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .qmin(128)
+      .test(q8dwconv_ukernel_mp32x25__avx2);
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_eq_32_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(5)
+      .kernelWidth(5)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .qmax(128)
+      .test(q8dwconv_ukernel_mp32x25__avx2);
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_eq_32_with_input_zero_point_only) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(5)
+      .kernelWidth(5)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .inputZeroPoint(255)
+      .kernelZeroPoint(0)
+      .test(q8dwconv_ukernel_mp32x25__avx2);
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_eq_32_with_kernel_zero_point_only) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(5)
+      .kernelWidth(5)
+      .cr(32)
+      .channels(32)
+      .width(1)
+      .inputZeroPoint(0)
+      .kernelZeroPoint(255)
+      .test(q8dwconv_ukernel_mp32x25__avx2);
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, multi_output_channels_eq_32) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(5)
+      .kernelWidth(5)
+      .cr(32)
+      .channels(32)
+      .width(5)
+      .test(q8dwconv_ukernel_mp32x25__avx2);
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, multi_output_channels_eq_32_with_subsampling) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(5)
+      .kernelWidth(5)
+      .subsampling(2)
+      .cr(32)
+      .channels(32)
+      .width(5)
+      .test(q8dwconv_ukernel_mp32x25__avx2);
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, multi_output_channels_eq_32_with_input_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(5)
+      .kernelWidth(5)
+      .cr(32)
+      .channels(32)
+      .width(5)
+      .inputStride(37)
+      .test(q8dwconv_ukernel_mp32x25__avx2);
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, multi_output_channels_eq_32_with_output_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    DWConvMicrokernelTester()
+      .kernelHeight(5)
+      .kernelWidth(5)
+      .cr(32)
+      .channels(32)
+      .width(5)
+      .outputStride(41)
+      .test(q8dwconv_ukernel_mp32x25__avx2);
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_div_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 64; channels < 512; channels += 96) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, multi_output_channels_div_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 64; channels < 512; channels += 96) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, multi_output_channels_div_32_with_output_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 64; channels < 512; channels += 96) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .outputStride(521)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_gt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_gt_32_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .qmin(128)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_gt_32_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .qmax(128)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_gt_32_with_input_zero_point_only) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(255)
+        .kernelZeroPoint(0)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_gt_32_with_kernel_zero_point_only) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .inputZeroPoint(0)
+        .kernelZeroPoint(255)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, multi_output_channels_gt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, multi_output_channels_gt_32_with_output_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 33; channels < 64; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .outputStride(71)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, single_output_channels_lt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 2; channels < 32; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(1)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
+
+  TEST(Q8DWCONV_MP32x25__AVX2, multi_output_channels_lt_32_with_output_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (uint32_t channels = 1; channels < 32; channels++) {
+      DWConvMicrokernelTester()
+        .kernelHeight(5)
+        .kernelWidth(5)
+        .cr(32)
+        .channels(channels)
+        .width(5)
+        .outputStride(37)
+        .test(q8dwconv_ukernel_mp32x25__avx2);
+    }
+  }
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
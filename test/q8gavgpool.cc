@@ -1363,4 +1363,677 @@
       }
     }
   }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_eq_16_all_m) {
+    TEST_REQUIRES_X86_AVX2;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(16)
+      .test(q8gavgpool_ukernel_up16x7__avx2);
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_eq_16_few_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(16)
+        .test(q8gavgpool_ukernel_up16x7__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_eq_16_all_m_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(16)
+      .xStride(19)
+      .test(q8gavgpool_ukernel_up16x7__avx2);
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_eq_16_all_m_with_x_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (float xScale = 0.01f; xScale < 100.0f; xScale *= 3.14159265f) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(16)
+        .xScale(xScale)
+        .test(q8gavgpool_ukernel_up16x7__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_eq_16_all_m_with_x_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (int32_t xZeroPoint = 0; xZeroPoint <= 255; xZeroPoint += 51) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(16)
+        .xZeroPoint(xZeroPoint)
+        .test(q8gavgpool_ukernel_up16x7__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_eq_16_all_m_with_y_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (float yScale = 0.01f; yScale < 100.0f; yScale *= 3.14159265f) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(16)
+        .yScale(yScale)
+        .test(q8gavgpool_ukernel_up16x7__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_eq_16_all_m_with_y_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(16)
+        .yZeroPoint(yZeroPoint)
+        .test(q8gavgpool_ukernel_up16x7__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_eq_16_all_m_with_y_max) {
+    TEST_REQUIRES_X86_AVX2;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(16)
+      .xZeroPoint(128)
+      .yZeroPoint(128)
+      .xScale(1.0f)
+      .yScale(1.0f)
+      .yMax(128)
+      .test(q8gavgpool_ukernel_up16x7__avx2);
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_eq_16_all_m_with_y_min) {
+    TEST_REQUIRES_X86_AVX2;
+    GAvgPoolMicrokernelTester()
+      .m(7)
+      .n(16)
+      .xZeroPoint(128)
+      .yZeroPoint(128)
+      .xScale(1.0f)
+      .yScale(1.0f)
+      .yMin(128)
+      .test(q8gavgpool_ukernel_up16x7__avx2);
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_div_16_all_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n < 256; n += 48) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .test(q8gavgpool_ukernel_up16x7__avx2);    
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_div_16_few_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n < 256; n += 48) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .test(q8gavgpool_ukernel_up16x7__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_gt_16_all_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .test(q8gavgpool_ukernel_up16x7__avx2);    
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_gt_16_few_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .test(q8gavgpool_ukernel_up16x7__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_gt_16_all_m_with_x_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      for (float xScale = 0.01f; xScale < 100.0f; xScale *= 3.14159265f) {
+        GAvgPoolMicrokernelTester()
+          .m(7)
+          .n(n)
+          .xScale(xScale)
+          .test(q8gavgpool_ukernel_up16x7__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_gt_16_all_m_with_x_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      for (int32_t xZeroPoint = 0; xZeroPoint <= 255; xZeroPoint += 51) {
+        GAvgPoolMicrokernelTester()
+          .m(7)
+          .n(n)
+          .xZeroPoint(xZeroPoint)
+          .test(q8gavgpool_ukernel_up16x7__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_gt_16_all_m_with_y_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      for (float yScale = 0.01f; yScale < 100.0f; yScale *= 3.14159265f) {
+        GAvgPoolMicrokernelTester()
+          .m(7)
+          .n(n)
+          .yScale(yScale)
+          .test(q8gavgpool_ukernel_up16x7__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_gt_16_all_m_with_y_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+        GAvgPoolMicrokernelTester()
+          .m(7)
+          .n(n)
+          .yZeroPoint(yZeroPoint)
+          .test(q8gavgpool_ukernel_up16x7__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_gt_16_all_m_with_y_max) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .xZeroPoint(128)
+        .yZeroPoint(128)
+        .xScale(1.0f)
+        .yScale(1.0f)
+        .yMax(128)
+        .test(q8gavgpool_ukernel_up16x7__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16x7__AVX2, n_gt_16_all_m_with_y_min) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(7)
+        .n(n)
+        .xZeroPoint(128)
+        .yZeroPoint(128)
+        .xScale(1.0f)
+        .yScale(1.0f)
+        .yMin(128)
+        .test(q8gavgpool_ukernel_up16x7__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_all_m) {
+    TEST_REQUIRES_X86_AVX2;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(16)
+      .nr(16)
+      .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_all_m_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(16)
+      .nr(16)
+      .xStride(19)
+      .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_all_m_with_x_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (float xScale = 0.01f; xScale < 100.0f; xScale *= 3.14159265f) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(16)
+        .nr(16)
+        .xScale(xScale)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_all_m_with_x_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (int32_t xZeroPoint = 0; xZeroPoint <= 255; xZeroPoint += 51) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(16)
+        .nr(16)
+        .xZeroPoint(xZeroPoint)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_all_m_with_y_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (float yScale = 0.01f; yScale < 100.0f; yScale *= 3.14159265f) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(16)
+        .nr(16)
+        .yScale(yScale)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_all_m_with_y_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(16)
+        .nr(16)
+        .yZeroPoint(yZeroPoint)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_all_m_with_y_max) {
+    TEST_REQUIRES_X86_AVX2;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(16)
+      .nr(16)
+      .xZeroPoint(128)
+      .yZeroPoint(128)
+      .xScale(1.0f)
+      .yScale(1.0f)
+      .yMax(128)
+      .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_all_m_with_y_min) {
+    TEST_REQUIRES_X86_AVX2;
+    GAvgPoolMicrokernelTester()
+      .m(14)
+      .n(16)
+      .nr(16)
+      .xZeroPoint(128)
+      .yZeroPoint(128)
+      .xScale(1.0f)
+      .yScale(1.0f)
+      .yMin(128)
+      .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_few_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(7 + m)
+        .n(16)
+        .nr(16)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_2pass_few_m_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t m = 1; m < 7; m++) {
+      GAvgPoolMicrokernelTester()
+        .m(7 + m)
+        .n(16)
+        .nr(16)
+        .xStride(19)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_multipass_all_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t m = 14; m <= 35; m += 7) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(16)
+        .nr(16)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    } 
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_eq_16_multipass_all_m_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t m = 14; m <= 35; m += 7) {
+      GAvgPoolMicrokernelTester()
+        .m(m)
+        .n(16)
+        .nr(16)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    } 
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_div_16_2pass_all_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n < 256; n += 48) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .nr(16)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_div_16_2pass_few_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n < 256; n += 48) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(7 + m)
+          .n(n)
+          .nr(16)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_div_16_multipass_all_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n < 256; n += 48) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .nr(16)
+          .nr(16)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      } 
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_div_16_multipass_all_m_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n < 256; n += 48) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .nr(16)
+          .nr(16)
+          .xStride(263)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      } 
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_2pass_all_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .nr(16)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_2pass_all_m_with_x_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (float xScale = 0.01f; xScale < 100.0f; xScale *= 3.14159265f) {
+      for (size_t n = 17; n < 32; n++) {
+        GAvgPoolMicrokernelTester()
+          .m(14)
+          .n(n)
+          .nr(16)
+          .xScale(xScale)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_2pass_all_m_with_x_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (int32_t xZeroPoint = 0; xZeroPoint <= 255; xZeroPoint += 51) {
+      for (size_t n = 17; n < 32; n++) {
+        GAvgPoolMicrokernelTester()
+          .m(14)
+          .n(n)
+          .nr(16)
+          .xZeroPoint(xZeroPoint)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_2pass_all_m_with_y_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (float yScale = 0.01f; yScale < 100.0f; yScale *= 3.14159265f) {
+      for (size_t n = 17; n < 32; n++) {
+        GAvgPoolMicrokernelTester()
+          .m(14)
+          .n(n)
+          .nr(16)
+          .yScale(yScale)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_2pass_all_m_with_y_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+      for (size_t n = 17; n < 32; n++) {
+        GAvgPoolMicrokernelTester()
+          .m(14)
+          .n(n)
+          .nr(16)
+          .yZeroPoint(yZeroPoint)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_2pass_all_m_with_y_max) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .nr(16)
+        .xZeroPoint(128)
+        .yZeroPoint(128)
+        .xScale(1.0f)
+        .yScale(1.0f)
+        .yMax(128)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_2pass_all_m_with_y_min) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      GAvgPoolMicrokernelTester()
+        .m(14)
+        .n(n)
+        .nr(16)
+        .xZeroPoint(128)
+        .yZeroPoint(128)
+        .xScale(1.0f)
+        .yScale(1.0f)
+        .yMin(128)
+        .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_2pass_few_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      for (size_t m = 1; m < 7; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(7 + m)
+          .n(n)
+          .nr(16)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_multipass_all_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .nr(16)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      } 
+    }
+  }
+
+  TEST(Q8GAVGPOOL_MP16x7p7q__AVX2, n_gt_16_multipass_all_m_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      for (size_t m = 14; m <= 35; m += 7) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .nr(16)
+          .xStride(37)
+          .test(q8gavgpool_ukernel_mp16x7p7q__avx2);
+      } 
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16xM__AVX2, n_lt_16_small_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 16; n++) {
+      for (size_t m = 1; m < 8; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .test(q8gavgpool_ukernel_up16xm__avx2);    
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16xM__AVX2, n_lt_16_large_m) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 16; n++) {
+      for (size_t m = 8; m < 16; m++) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .test(q8gavgpool_ukernel_up16xm__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16xM__AVX2, n_lt_16_with_x_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 16; n++) {
+      for (size_t m = 1; m < 16; m += 5) {
+        for (float xScale = 0.01f; xScale < 100.0f; xScale *= 3.14159265f) {
+          GAvgPoolMicrokernelTester()
+            .m(m)
+            .n(n)
+            .xScale(xScale)
+            .test(q8gavgpool_ukernel_up16xm__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16xM__AVX2, n_lt_16_with_x_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 16; n++) {
+      for (size_t m = 1; m < 16; m += 5) {
+        for (int32_t xZeroPoint = 0; xZeroPoint <= 255; xZeroPoint += 51) {
+          GAvgPoolMicrokernelTester()
+            .m(m)
+            .n(n)
+            .xZeroPoint(xZeroPoint)
+            .test(q8gavgpool_ukernel_up16xm__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16xM__AVX2, n_lt_16_with_y_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 16; n++) {
+      for (size_t m = 1; m < 16; m += 5) {
+        for (float yScale = 0.01f; yScale < 100.0f; yScale *= 3.14159265f) {
+          GAvgPoolMicrokernelTester()
+            .m(m)
+            .n(n)
+            .yScale(yScale)
+            .test(q8gavgpool_ukernel_up16xm__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16xM__AVX2, n_lt_16_with_y_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 16; n++) {
+      for (size_t m = 1; m < 16; m += 5) {
+        for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+          GAvgPoolMicrokernelTester()
+            .m(m)
+            .n(n)
+            .yZeroPoint(yZeroPoint)
+            .test(q8gavgpool_ukernel_up16xm__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16xM__AVX2, n_lt_16_with_y_max) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 16; n++) {
+      for (size_t m = 1; m < 16; m += 5) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .xZeroPoint(128)
+          .yZeroPoint(128)
+          .xScale(1.0f)
+          .yScale(1.0f)
+          .yMax(128)
+          .test(q8gavgpool_ukernel_up16xm__avx2);
+      }
+    }
+  }
+
+  TEST(Q8GAVGPOOL_UP16xM__AVX2, n_lt_16_with_y_min) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 16; n++) {
+      for (size_t m = 1; m < 16; m += 5) {
+        GAvgPoolMicrokernelTester()
+          .m(m)
+          .n(n)
+          .xZeroPoint(128)
+          .yZeroPoint(128)
+          .xScale(1.0f)
+          .yScale(1.0f)
+          .yMin(128)
+          .test(q8gavgpool_ukernel_up16xm__avx2);
+      }
+    }
+  }
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
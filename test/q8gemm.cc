@@ -2657,3 +2657,515 @@
     }
   }
 #endif
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(Q8GEMM_I32_4x8__NEON, k_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .np(8)
+      .kr(1)
+      .m(4)
+      .n(8)
+      .k(8)
+      .test(q8gemm_i32_ukernel_4x8__neon);
+  }
+
+  TEST(Q8GEMM_I32_4x8__NEON, k_eq_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .np(8)
+      .kr(1)
+      .m(4)
+      .n(8)
+      .k(8)
+      .aStride(37)
+      .test(q8gemm_i32_ukernel_4x8__neon);
+  }
+
+  TEST(Q8GEMM_I32_4x8__NEON, k_eq_8_strided_c) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .np(8)
+      .kr(1)
+      .m(4)
+      .n(8)
+      .k(8)
+      .cStride(17)
+      .test(q8gemm_i32_ukernel_4x8__neon);
+  }
+
+  TEST(Q8GEMM_I32_4x8__NEON, k_eq_8_nozp) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .np(8)
+      .kr(1)
+      .m(4)
+      .n(8)
+      .k(8)
+      .aZeroPoint(0)
+      .bZeroPoint(0)
+      .test(q8gemm_i32_ukernel_4x8__neon);
+  }
+
+  TEST(Q8GEMM_I32_4x8__NEON, k_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .np(8)
+        .kr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .test(q8gemm_i32_ukernel_4x8__neon);
+    }
+  }
+
+  TEST(Q8GEMM_I32_4x8__NEON, k_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 9; k < 16; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .np(8)
+            .kr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .test(q8gemm_i32_ukernel_4x8__neon);
+        }
+      }
+    }
+  }
+
+  TEST(Q8GEMM_I32_4x8__NEON, k_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .np(8)
+        .kr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .test(q8gemm_i32_ukernel_4x8__neon);
+    }
+  }
+
+  TEST(Q8GEMM_I32_4x8__NEON, k_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 16; k < 128; k += 24) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .np(8)
+            .kr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .test(q8gemm_i32_ukernel_4x8__neon);
+        }
+      }
+    }
+  }
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(Q8GEMM_I32_4x4c2__SSE2, k_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .test(q8gemm_i32_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8GEMM_I32_4x4c2__SSE2, k_eq_8_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .aStride(37)
+      .test(q8gemm_i32_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8GEMM_I32_4x4c2__SSE2, k_eq_8_strided_c) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .cStride(17)
+      .test(q8gemm_i32_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8GEMM_I32_4x4c2__SSE2, k_eq_8_nozp) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .aZeroPoint(0)
+      .bZeroPoint(0)
+      .test(q8gemm_i32_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8GEMM_I32_4x4c2__SSE2, k_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .test(q8gemm_i32_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_I32_4x4c2__SSE2, k_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 9; k < 16; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .np(4)
+            .kr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .test(q8gemm_i32_ukernel_4x4c2__sse2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8GEMM_I32_4x4c2__SSE2, k_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .test(q8gemm_i32_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_I32_4x4c2__SSE2, k_div_8_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 16; k < 128; k += 24) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .np(4)
+            .kr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .test(q8gemm_i32_ukernel_4x4c2__sse2);
+        }
+      }
+    }
+  }
+#endif
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(Q8GEMM_F32_4x8__NEON, k_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .np(8)
+      .kr(1)
+      .m(4)
+      .n(8)
+      .k(8)
+      .test(q8gemm_f32_ukernel_4x8__neon);
+  }
+
+  TEST(Q8GEMM_F32_4x8__NEON, k_eq_8_strided_a) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .np(8)
+      .kr(1)
+      .m(4)
+      .n(8)
+      .k(8)
+      .aStride(37)
+      .test(q8gemm_f32_ukernel_4x8__neon);
+  }
+
+  TEST(Q8GEMM_F32_4x8__NEON, k_eq_8_strided_c) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .np(8)
+      .kr(1)
+      .m(4)
+      .n(8)
+      .k(8)
+      .cStride(17)
+      .test(q8gemm_f32_ukernel_4x8__neon);
+  }
+
+  TEST(Q8GEMM_F32_4x8__NEON, k_eq_8_nozp) {
+    TEST_REQUIRES_ARM_NEON;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(8)
+      .np(8)
+      .kr(1)
+      .m(4)
+      .n(8)
+      .k(8)
+      .aZeroPoint(0)
+      .bZeroPoint(0)
+      .test(q8gemm_f32_ukernel_4x8__neon);
+  }
+
+  TEST(Q8GEMM_F32_4x8__NEON, k_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .np(8)
+        .kr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .test(q8gemm_f32_ukernel_4x8__neon);
+    }
+  }
+
+  TEST(Q8GEMM_F32_4x8__NEON, k_gt_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 9; k < 16; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .np(8)
+            .kr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .test(q8gemm_f32_ukernel_4x8__neon);
+        }
+      }
+    }
+  }
+
+  TEST(Q8GEMM_F32_4x8__NEON, k_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(8)
+        .np(8)
+        .kr(1)
+        .m(4)
+        .n(8)
+        .k(k)
+        .test(q8gemm_f32_ukernel_4x8__neon);
+    }
+  }
+
+  TEST(Q8GEMM_F32_4x8__NEON, k_div_8_subtile) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t k = 16; k < 128; k += 24) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 8; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(8)
+            .np(8)
+            .kr(1)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .test(q8gemm_f32_ukernel_4x8__neon);
+        }
+      }
+    }
+  }
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(Q8GEMM_F32_4x4c2__SSE2, k_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .test(q8gemm_f32_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8GEMM_F32_4x4c2__SSE2, k_eq_8_strided_a) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .aStride(37)
+      .test(q8gemm_f32_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8GEMM_F32_4x4c2__SSE2, k_eq_8_strided_c) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .cStride(17)
+      .test(q8gemm_f32_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8GEMM_F32_4x4c2__SSE2, k_eq_8_nozp) {
+    TEST_REQUIRES_X86_SSE2;
+    GemmMicrokernelTester()
+      .mr(4)
+      .nr(4)
+      .np(4)
+      .kr(2)
+      .m(4)
+      .n(4)
+      .k(8)
+      .aZeroPoint(0)
+      .bZeroPoint(0)
+      .test(q8gemm_f32_ukernel_4x4c2__sse2);
+  }
+
+  TEST(Q8GEMM_F32_4x4c2__SSE2, k_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 9; k < 16; k++) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .test(q8gemm_f32_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_F32_4x4c2__SSE2, k_gt_8_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 9; k < 16; k++) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .np(4)
+            .kr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .test(q8gemm_f32_ukernel_4x4c2__sse2);
+        }
+      }
+    }
+  }
+
+  TEST(Q8GEMM_F32_4x4c2__SSE2, k_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 16; k < 128; k += 8) {
+      GemmMicrokernelTester()
+        .mr(4)
+        .nr(4)
+        .np(4)
+        .kr(2)
+        .m(4)
+        .n(4)
+        .k(k)
+        .test(q8gemm_f32_ukernel_4x4c2__sse2);
+    }
+  }
+
+  TEST(Q8GEMM_F32_4x4c2__SSE2, k_div_8_subtile) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t k = 16; k < 128; k += 24) {
+      for (uint32_t m = 1; m <= 4; m++) {
+        for (uint32_t n = 1; n <= 4; n++) {
+          GemmMicrokernelTester()
+            .mr(4)
+            .nr(4)
+            .np(4)
+            .kr(2)
+            .m(m)
+            .n(n)
+            .k(k)
+            .iterations(3)
+            .test(q8gemm_f32_ukernel_4x4c2__sse2);
+        }
+      }
+    }
+  }
+#endif
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <cpuinfo.h>
+
+#include <qnnpack/isa-checks.h>
+#include <qnnpack/q8vdequantize.h>
+
+#include "vdequantize-microkernel-tester.h"
+
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(Q8VDEQUANTIZE__NEON, n_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    VDequantizeMicrokernelTester()
+      .n(8)
+      .test(q8vdequantize_ukernel__neon);
+  }
+
+  TEST(Q8VDEQUANTIZE__NEON, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 8; n < 128; n += 24) {
+      VDequantizeMicrokernelTester()
+        .n(n)
+        .test(q8vdequantize_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VDEQUANTIZE__NEON, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 9; n < 16; n++) {
+      VDequantizeMicrokernelTester()
+        .n(n)
+        .test(q8vdequantize_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VDEQUANTIZE__NEON, n_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 8; n++) {
+      VDequantizeMicrokernelTester()
+        .n(n)
+        .test(q8vdequantize_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VDEQUANTIZE__NEON, scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (float scale = 1.0e-3f; scale < 1.0e+3f; scale *= 3.14159265f) {
+      VDequantizeMicrokernelTester()
+        .iterations(1)
+        .n(67)
+        .scale(scale)
+        .test(q8vdequantize_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VDEQUANTIZE__NEON, zero_point) {
+    TEST_REQUIRES_ARM_NEON;
+    for (int32_t zeroPoint = 0; zeroPoint <= 255; zeroPoint += 51) {
+      VDequantizeMicrokernelTester()
+        .iterations(1)
+        .n(67)
+        .zeroPoint(uint8_t(zeroPoint))
+        .test(q8vdequantize_ukernel__neon);
+    }
+  }
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(Q8VDEQUANTIZE__SSE2, n_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    VDequantizeMicrokernelTester()
+      .n(8)
+      .test(q8vdequantize_ukernel__sse2);
+  }
+
+  TEST(Q8VDEQUANTIZE__SSE2, n_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 8; n < 128; n += 24) {
+      VDequantizeMicrokernelTester()
+        .n(n)
+        .test(q8vdequantize_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VDEQUANTIZE__SSE2, n_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 9; n < 16; n++) {
+      VDequantizeMicrokernelTester()
+        .n(n)
+        .test(q8vdequantize_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VDEQUANTIZE__SSE2, n_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 8; n++) {
+      VDequantizeMicrokernelTester()
+        .n(n)
+        .test(q8vdequantize_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VDEQUANTIZE__SSE2, scale) {
+    TEST_REQUIRES_X86_SSE2;
+    for (float scale = 1.0e-3f; scale < 1.0e+3f; scale *= 3.14159265f) {
+      VDequantizeMicrokernelTester()
+        .iterations(1)
+        .n(67)
+        .scale(scale)
+        .test(q8vdequantize_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VDEQUANTIZE__SSE2, zero_point) {
+    TEST_REQUIRES_X86_SSE2;
+    for (int32_t zeroPoint = 0; zeroPoint <= 255; zeroPoint += 51) {
+      VDequantizeMicrokernelTester()
+        .iterations(1)
+        .n(67)
+        .zeroPoint(uint8_t(zeroPoint))
+        .test(q8vdequantize_ukernel__sse2);
+    }
+  }
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
@@ -0,0 +1,524 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <cpuinfo.h>
+
+#include <qnnpack/isa-checks.h>
+#include <qnnpack/q8vmul.h>
+
+#include "vmul-microkernel-tester.h"
+
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(Q8VMUL__SSE2, n_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    VMulMicrokernelTester()
+      .n(8)
+      .test(q8vmul_ukernel__sse2);
+  }
+
+  TEST(Q8VMUL__SSE2, n_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 8; n < 128; n += 24) {
+      VMulMicrokernelTester()
+        .n(n)
+        .test(q8vmul_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, n_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 9; n < 16; n++) {
+      VMulMicrokernelTester()
+        .n(n)
+        .test(q8vmul_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, n_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 8; n++) {
+      VMulMicrokernelTester()
+        .n(n)
+        .test(q8vmul_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, inplace_a) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplaceA(true)
+        .test(q8vmul_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, inplace_b) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplaceB(true)
+        .test(q8vmul_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, inplace_a_and_b) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplaceA(true)
+        .inplaceB(true)
+        .test(q8vmul_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, a_scale) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (float aScale = 1.0e-2; aScale < 1.0e+2; aScale *= 1.7f) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .aScale(aScale)
+          .test(q8vmul_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, b_scale) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (float bScale = 1.0e-2; bScale < 1.0e+2; bScale *= 1.7f) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .bScale(bScale)
+          .test(q8vmul_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, y_scale) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (float yScale = 1.0f; yScale < 1.0e+4; yScale *= 1.7f) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .yScale(yScale)
+          .test(q8vmul_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, a_zero_point) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (int32_t aZeroPoint = 0; aZeroPoint <= 255; aZeroPoint += 51) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .aZeroPoint(uint8_t(aZeroPoint))
+          .test(q8vmul_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, b_zero_point) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (int32_t bZeroPoint = 0; bZeroPoint <= 255; bZeroPoint += 51) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .bZeroPoint(uint8_t(bZeroPoint))
+          .test(q8vmul_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, y_zero_point) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .yZeroPoint(uint8_t(yZeroPoint))
+          .test(q8vmul_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, qmin) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmin(128)
+        .test(q8vmul_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VMUL__SSE2, qmax) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmax(128)
+        .test(q8vmul_ukernel__sse2);
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, n_eq_16) {
+    TEST_REQUIRES_X86_AVX2;
+    VMulMicrokernelTester()
+      .n(16)
+      .test(q8vmul_ukernel__avx2);
+  }
+
+  TEST(Q8VMUL__AVX2, n_div_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n < 256; n += 48) {
+      VMulMicrokernelTester()
+        .n(n)
+        .test(q8vmul_ukernel__avx2);
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, n_gt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 17; n < 32; n++) {
+      VMulMicrokernelTester()
+        .n(n)
+        .test(q8vmul_ukernel__avx2);
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, n_lt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 16; n++) {
+      VMulMicrokernelTester()
+        .n(n)
+        .test(q8vmul_ukernel__avx2);
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, inplace_a) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplaceA(true)
+        .test(q8vmul_ukernel__avx2);
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, inplace_b) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplaceB(true)
+        .test(q8vmul_ukernel__avx2);
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, inplace_a_and_b) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplaceA(true)
+        .inplaceB(true)
+        .test(q8vmul_ukernel__avx2);
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, a_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      for (float aScale = 1.0e-2; aScale < 1.0e+2; aScale *= 1.7f) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .aScale(aScale)
+          .test(q8vmul_ukernel__avx2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, b_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      for (float bScale = 1.0e-2; bScale < 1.0e+2; bScale *= 1.7f) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .bScale(bScale)
+          .test(q8vmul_ukernel__avx2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, y_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      for (float yScale = 1.0f; yScale < 1.0e+4; yScale *= 1.7f) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .yScale(yScale)
+          .test(q8vmul_ukernel__avx2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, a_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      for (int32_t aZeroPoint = 0; aZeroPoint <= 255; aZeroPoint += 51) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .aZeroPoint(uint8_t(aZeroPoint))
+          .test(q8vmul_ukernel__avx2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, b_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      for (int32_t bZeroPoint = 0; bZeroPoint <= 255; bZeroPoint += 51) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .bZeroPoint(uint8_t(bZeroPoint))
+          .test(q8vmul_ukernel__avx2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, y_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .yZeroPoint(uint8_t(yZeroPoint))
+          .test(q8vmul_ukernel__avx2);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmin(128)
+        .test(q8vmul_ukernel__avx2);
+    }
+  }
+
+  TEST(Q8VMUL__AVX2, qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 256; n += 23) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmax(128)
+        .test(q8vmul_ukernel__avx2);
+    }
+  }
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(Q8VMUL__NEON, n_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    VMulMicrokernelTester()
+      .n(8)
+      .test(q8vmul_ukernel__neon);
+  }
+
+  TEST(Q8VMUL__NEON, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 8; n < 128; n += 24) {
+      VMulMicrokernelTester()
+        .n(n)
+        .test(q8vmul_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VMUL__NEON, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 9; n < 16; n++) {
+      VMulMicrokernelTester()
+        .n(n)
+        .test(q8vmul_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VMUL__NEON, n_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 8; n++) {
+      VMulMicrokernelTester()
+        .n(n)
+        .test(q8vmul_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VMUL__NEON, inplace_a) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplaceA(true)
+        .test(q8vmul_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VMUL__NEON, inplace_b) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplaceB(true)
+        .test(q8vmul_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VMUL__NEON, inplace_a_and_b) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .inplaceA(true)
+        .inplaceB(true)
+        .test(q8vmul_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VMUL__NEON, a_scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (float aScale = 1.0e-2; aScale < 1.0e+2; aScale *= 1.7f) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .aScale(aScale)
+          .test(q8vmul_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__NEON, b_scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (float bScale = 1.0e-2; bScale < 1.0e+2; bScale *= 1.7f) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .bScale(bScale)
+          .test(q8vmul_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__NEON, y_scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (float yScale = 1.0f; yScale < 1.0e+4; yScale *= 1.7f) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .yScale(yScale)
+          .test(q8vmul_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__NEON, a_zero_point) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (int32_t aZeroPoint = 0; aZeroPoint <= 255; aZeroPoint += 51) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .aZeroPoint(uint8_t(aZeroPoint))
+          .test(q8vmul_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__NEON, b_zero_point) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (int32_t bZeroPoint = 0; bZeroPoint <= 255; bZeroPoint += 51) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .bZeroPoint(uint8_t(bZeroPoint))
+          .test(q8vmul_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__NEON, y_zero_point) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      for (int32_t yZeroPoint = 0; yZeroPoint <= 255; yZeroPoint += 51) {
+        VMulMicrokernelTester()
+          .iterations(1)
+          .n(n)
+          .yZeroPoint(uint8_t(yZeroPoint))
+          .test(q8vmul_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(Q8VMUL__NEON, qmin) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmin(128)
+        .test(q8vmul_ukernel__neon);
+    }
+  }
+
+  TEST(Q8VMUL__NEON, qmax) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 128; n += 11) {
+      VMulMicrokernelTester()
+        .iterations(1)
+        .n(n)
+        .qmax(128)
+        .test(q8vmul_ukernel__neon);
+    }
+  }
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
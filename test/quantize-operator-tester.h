@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+
+
+class QuantizeOperatorTester {
+ public:
+  inline QuantizeOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline QuantizeOperatorTester& inputStride(size_t inputStride) {
+    assert(inputStride != 0);
+    this->inputStride_ = inputStride;
+    return *this;
+  }
+
+  inline size_t inputStride() const {
+    if (this->inputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->inputStride_ >= this->channels_);
+      return this->inputStride_;
+    }
+  }
+
+  inline QuantizeOperatorTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->outputStride_ >= this->channels_);
+      return this->outputStride_;
+    }
+  }
+
+  inline QuantizeOperatorTester& batchSize(size_t batchSize) {
+    assert(batchSize != 0);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline QuantizeOperatorTester& outputScale(float outputScale) {
+    assert(outputScale > 0.0f);
+    assert(std::isnormal(outputScale));
+    this->outputScale_ = outputScale;
+    return *this;
+  }
+
+  inline float outputScale() const {
+    return this->outputScale_;
+  }
+
+  inline QuantizeOperatorTester& outputZeroPoint(uint8_t outputZeroPoint) {
+    this->outputZeroPoint_ = outputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t outputZeroPoint() const {
+    return this->outputZeroPoint_;
+  }
+
+  inline QuantizeOperatorTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline QuantizeOperatorTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline QuantizeOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testF32() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    const float rangeMin = (-32.0f - float(int32_t(outputZeroPoint()))) * outputScale();
+    const float rangeMax = (287.0f - float(int32_t(outputZeroPoint()))) * outputScale();
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(rangeMin, rangeMax), rng);
+
+    std::vector<float> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<uint8_t> output((batchSize() - 1) * outputStride() + channels());
+    std::vector<float> outputRef(batchSize() * channels());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(f32rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          const float x = input[i * inputStride() + c];
+          const float scaledX = x / outputScale() + float(int32_t(outputZeroPoint()));
+          outputRef[i * channels() + c] = std::min(std::max(scaledX, float(int32_t(qmin()))), float(int32_t(qmax())));
+        }
+      }
+
+      /* Create, setup, run, and destroy Quantize operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t quantizeOp = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_quantize_nc_f32_q8(
+          channels(),
+          outputZeroPoint(), outputScale(),
+          qmin(), qmax(),
+          0, &quantizeOp));
+      ASSERT_NE(nullptr, quantizeOp);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_quantize_nc_f32_q8(
+          quantizeOp,
+          batchSize(),
+          input.data(), inputStride(),
+          output.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator(quantizeOp, nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_delete_operator(quantizeOp));
+      quantizeOp = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t c = 0; c < channels(); c++) {
+          ASSERT_LE(uint32_t(output[i * outputStride() + c]), uint32_t(qmax()))
+            << "at " << i << ", " << c << ": batch size = " << batchSize() << ", channels = " << channels();
+          ASSERT_GE(uint32_t(output[i * outputStride() + c]), uint32_t(qmin()))
+            << "at " << i << ", " << c << ": batch size = " << batchSize() << ", channels = " << channels();
+          ASSERT_NEAR(outputRef[i * channels() + c], float(int32_t(output[i * outputStride() + c])), 0.5f + 1.0e-3f)
+            << "at " << i << ", " << c << ": batch size = " << batchSize() << ", channels = " << channels()
+            << ", scale = " << outputScale() << ", zero point = " << uint32_t(outputZeroPoint());
+        }
+      }
+      for (size_t i = 0; i + 1 < batchSize(); i++) {
+        for (size_t c = channels(); c < outputStride(); c++) {
+          ASSERT_EQ(uint32_t(0xA5), uint32_t(output[i * outputStride() + c]))
+            << "at " << i << ", " << c << ": output padding was overwritten";
+        }
+      }
+    }
+  }
+
+ private:
+  size_t batchSize_{1};
+  size_t channels_{1};
+  size_t inputStride_{0};
+  size_t outputStride_{0};
+  float outputScale_{0.75f};
+  uint8_t outputZeroPoint_{121};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{15};
+};
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "quantize-operator-tester.h"
+
+
+TEST(QUANTIZE_OP, unit_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    QuantizeOperatorTester()
+      .batchSize(1)
+      .channels(channels)
+      .iterations(3)
+      .testF32();
+  }
+}
+
+TEST(QUANTIZE_OP, unit_batch_with_output_scale) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (float scale = 1.0e-2f; scale < 1.0e+2f; scale *= 3.14159265f) {
+      QuantizeOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .outputScale(scale)
+        .iterations(1)
+        .testF32();
+    }
+  }
+}
+
+TEST(QUANTIZE_OP, unit_batch_with_output_zero_point) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (int32_t zeroPoint = 0; zeroPoint <= 255; zeroPoint += 51) {
+      QuantizeOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .outputZeroPoint(uint8_t(zeroPoint))
+        .iterations(3)
+        .testF32();
+    }
+  }
+}
+
+TEST(QUANTIZE_OP, unit_batch_with_qmin) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (int32_t qmin = 1; qmin < 255; qmin += 31) {
+      QuantizeOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .qmin(uint8_t(qmin))
+        .iterations(3)
+        .testF32();
+    }
+  }
+}
+
+TEST(QUANTIZE_OP, unit_batch_with_qmax) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    for (int32_t qmax = 1; qmax < 255; qmax += 31) {
+      QuantizeOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .qmax(uint8_t(qmax))
+        .iterations(3)
+        .testF32();
+    }
+  }
+}
+
+TEST(QUANTIZE_OP, small_batch) {
+  for (size_t channels = 1; channels < 100; channels++) {
+    QuantizeOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .iterations(3)
+      .testF32();
+  }
+}
+
+TEST(QUANTIZE_OP, small_batch_with_input_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    QuantizeOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputStride(129)
+      .iterations(3)
+      .testF32();
+  }
+}
+
+TEST(QUANTIZE_OP, small_batch_with_output_stride) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    QuantizeOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .outputStride(117)
+      .iterations(3)
+      .testF32();
+  }
+}
+
+TEST(QUANTIZE_OP, large_batch) {
+  for (size_t channels = 1; channels < 100; channels += 15) {
+    QuantizeOperatorTester()
+      .batchSize(101)
+      .channels(channels)
+      .iterations(1)
+      .testF32();
+  }
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <initializer_list>
+#include <random>
+#include <vector>
+
+#include <pthreadpool.h>
+
+#include <qnnpack.h>
+
+
+class ReduceOperatorTester {
+ public:
+  enum class Mode {
+    Mean,
+    Sum,
+  };
+
+  inline ReduceOperatorTester& inputShape(std::initializer_list<size_t> inputShape) {
+    assert(inputShape.size() <= QNNP_MAX_TENSOR_DIMS);
+    this->inputShape_ = std::vector<size_t>(inputShape);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& inputShape() const {
+    return this->inputShape_;
+  }
+
+  inline size_t numInputDims() const {
+    return this->inputShape_.size();
+  }
+
+  inline ReduceOperatorTester& reductionAxes(std::initializer_list<size_t> reductionAxes) {
+    assert(reductionAxes.size() <= QNNP_MAX_TENSOR_DIMS);
+    this->reductionAxes_ = std::vector<size_t>(reductionAxes);
+    return *this;
+  }
+
+  inline const std::vector<size_t>& reductionAxes() const {
+    return this->reductionAxes_;
+  }
+
+  inline ReduceOperatorTester& inputScale(float inputScale) {
+    assert(inputScale > 0.0f);
+    assert(std::isnormal(inputScale));
+    this->inputScale_ = inputScale;
+    return *this;
+  }
+
+  inline float inputScale() const {
+    return this->inputScale_;
+  }
+
+  inline ReduceOperatorTester& inputZeroPoint(uint8_t inputZeroPoint) {
+    this->inputZeroPoint_ = inputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t inputZeroPoint() const {
+    return this->inputZeroPoint_;
+  }
+
+  inline ReduceOperatorTester& outputScale(float outputScale) {
+    assert(outputScale > 0.0f);
+    assert(std::isnormal(outputScale));
+    this->outputScale_ = outputScale;
+    return *this;
+  }
+
+  inline float outputScale() const {
+    return this->outputScale_;
+  }
+
+  inline ReduceOperatorTester& outputZeroPoint(uint8_t outputZeroPoint) {
+    this->outputZeroPoint_ = outputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t outputZeroPoint() const {
+    return this->outputZeroPoint_;
+  }
+
+  inline ReduceOperatorTester& outputMin(uint8_t outputMin) {
+    this->outputMin_ = outputMin;
+    return *this;
+  }
+
+  inline uint8_t outputMin() const {
+    return this->outputMin_;
+  }
+
+  inline ReduceOperatorTester& outputMax(uint8_t outputMax) {
+    this->outputMax_ = outputMax;
+    return *this;
+  }
+
+  inline uint8_t outputMax() const {
+    return this->outputMax_;
+  }
+
+  inline ReduceOperatorTester& mode(Mode mode) {
+    this->mode_ = mode;
+    return *this;
+  }
+
+  inline Mode mode() const {
+    return this->mode_;
+  }
+
+  inline ReduceOperatorTester& threads(size_t threads) {
+    this->threads_ = threads;
+    return *this;
+  }
+
+  inline size_t threads() const {
+    return this->threads_;
+  }
+
+  inline ReduceOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testQ8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<bool> reduced(numInputDims());
+    for (size_t axis : reductionAxes()) {
+      reduced[axis] = true;
+    }
+    size_t inputElements = 1;
+    size_t outputElements = 1;
+    size_t reductionSize = 1;
+    for (size_t dim = 0; dim < numInputDims(); dim++) {
+      inputElements *= inputShape()[dim];
+      if (reduced[dim]) {
+        reductionSize *= inputShape()[dim];
+      } else {
+        outputElements *= inputShape()[dim];
+      }
+    }
+
+    std::vector<uint8_t> input(inputElements);
+    std::vector<uint8_t> output(outputElements);
+    std::vector<double> accumulators(outputElements);
+    std::vector<float> outputRef(outputElements);
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_TRUE(threadpool != nullptr);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      std::fill(accumulators.begin(), accumulators.end(), 0.0);
+      for (size_t inputIndex = 0; inputIndex < inputElements; inputIndex++) {
+        size_t remainder = inputIndex;
+        size_t outputIndex = 0;
+        size_t outputStride = 1;
+        for (size_t dim = numInputDims(); dim != 0; dim--) {
+          const size_t position = remainder % inputShape()[dim - 1];
+          remainder /= inputShape()[dim - 1];
+          if (!reduced[dim - 1]) {
+            outputIndex += position * outputStride;
+            outputStride *= inputShape()[dim - 1];
+          }
+        }
+        accumulators[outputIndex] += double(int32_t(input[inputIndex]) - int32_t(inputZeroPoint()));
+      }
+      double scale = double(inputScale()) / double(outputScale());
+      if (mode() == Mode::Mean) {
+        scale /= double(reductionSize);
+      }
+      for (size_t i = 0; i < outputElements; i++) {
+        outputRef[i] = float(accumulators[i] * scale + double(outputZeroPoint()));
+        outputRef[i] = std::min<float>(outputRef[i], float(outputMax()));
+        outputRef[i] = std::max<float>(outputRef[i], float(outputMin()));
+      }
+
+      /* Create, setup, run, and destroy Reduce operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t reduceOp = nullptr;
+
+      switch (mode()) {
+        case Mode::Mean:
+          ASSERT_EQ(qnnp_status_success,
+            qnnp_create_reduce_mean_nd_q8(
+              inputZeroPoint(), inputScale(),
+              outputZeroPoint(), outputScale(),
+              outputMin(), outputMax(),
+              0, &reduceOp));
+          ASSERT_NE(nullptr, reduceOp);
+
+          ASSERT_EQ(qnnp_status_success,
+            qnnp_setup_reduce_mean_nd_q8(
+              reduceOp,
+              reductionAxes().size(), reductionAxes().data(),
+              numInputDims(), inputShape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+        case Mode::Sum:
+          ASSERT_EQ(qnnp_status_success,
+            qnnp_create_reduce_sum_nd_q8(
+              inputZeroPoint(), inputScale(),
+              outputZeroPoint(), outputScale(),
+              outputMin(), outputMax(),
+              0, &reduceOp));
+          ASSERT_NE(nullptr, reduceOp);
+
+          ASSERT_EQ(qnnp_status_success,
+            qnnp_setup_reduce_sum_nd_q8(
+              reduceOp,
+              reductionAxes().size(), reductionAxes().data(),
+              numInputDims(), inputShape().data(),
+              input.data(), output.data(),
+              nullptr /* thread pool */));
+          break;
+      }
+
+      ASSERT_EQ(qnnp_status_success, qnnp_run_operator(reduceOp, threadpool));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(reduceOp));
+      reduceOp = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < outputElements; i++) {
+        ASSERT_LE(uint32_t(output[i]), uint32_t(outputMax()));
+        ASSERT_GE(uint32_t(output[i]), uint32_t(outputMin()));
+        ASSERT_NEAR(float(int32_t(output[i])), outputRef[i], 0.80f) << "at output element " << i;
+      }
+    }
+
+    pthreadpool_destroy(threadpool);
+  }
+
+  void testUnsupported() const {
+    ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+    qnnp_operator_t reduceOp = nullptr;
+
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_create_reduce_mean_nd_q8(
+        inputZeroPoint(), inputScale(),
+        outputZeroPoint(), outputScale(),
+        outputMin(), outputMax(),
+        0, &reduceOp));
+    ASSERT_NE(nullptr, reduceOp);
+
+    ASSERT_EQ(qnnp_status_unsupported_parameter,
+      qnnp_setup_reduce_mean_nd_q8(
+        reduceOp,
+        reductionAxes().size(), reductionAxes().data(),
+        numInputDims(), inputShape().data(),
+        nullptr, nullptr,
+        nullptr /* thread pool */));
+
+    ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(reduceOp));
+  }
+
+ private:
+  std::vector<size_t> inputShape_;
+  std::vector<size_t> reductionAxes_;
+  float inputScale_{1.0f};
+  float outputScale_{1.0f};
+  uint8_t inputZeroPoint_{121};
+  uint8_t outputZeroPoint_{133};
+  uint8_t outputMin_{0};
+  uint8_t outputMax_{255};
+  Mode mode_{Mode::Mean};
+  size_t threads_{1};
+  size_t iterations_{1};
+};
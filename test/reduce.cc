@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "reduce-operator-tester.h"
+
+
+TEST(REDUCE_MEAN_OP, reduce_h) {
+  ReduceOperatorTester()
+    .inputShape({2, 9, 5, 19})
+    .reductionAxes({1})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_h_small_channels) {
+  ReduceOperatorTester()
+    .inputShape({3, 5, 1, 3})
+    .reductionAxes({1})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_w) {
+  ReduceOperatorTester()
+    .inputShape({2, 3, 11, 21})
+    .reductionAxes({2})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_hw) {
+  ReduceOperatorTester()
+    .inputShape({2, 7, 5, 37})
+    .reductionAxes({1, 2})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_hw_many_channels) {
+  ReduceOperatorTester()
+    .inputShape({1, 3, 4, 300})
+    .reductionAxes({2, 1})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_hw_few_rows) {
+  ReduceOperatorTester()
+    .inputShape({2, 2, 3, 29})
+    .reductionAxes({1, 2})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_c) {
+  ReduceOperatorTester()
+    .inputShape({2, 3, 5, 43})
+    .reductionAxes({3})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_c_large) {
+  ReduceOperatorTester()
+    .inputShape({2, 1, 3, 4099})
+    .reductionAxes({3})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_hwc) {
+  ReduceOperatorTester()
+    .inputShape({3, 4, 5, 7})
+    .reductionAxes({1, 2, 3})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_all) {
+  ReduceOperatorTester()
+    .inputShape({2, 4, 5, 7})
+    .reductionAxes({0, 1, 2, 3})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, reduce_across_unit_dimension) {
+  ReduceOperatorTester()
+    .inputShape({2, 6, 1, 3, 17})
+    .reductionAxes({1, 3})
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, with_input_scale) {
+  for (float inputScale = 0.01f; inputScale < 100.0f; inputScale *= 3.14159265f) {
+    ReduceOperatorTester()
+      .inputShape({2, 9, 5, 19})
+      .reductionAxes({1, 2})
+      .inputScale(inputScale)
+      .iterations(1)
+      .testQ8();
+  }
+}
+
+TEST(REDUCE_MEAN_OP, with_input_zero_point) {
+  for (int32_t inputZeroPoint = 0; inputZeroPoint <= 255; inputZeroPoint += 51) {
+    ReduceOperatorTester()
+      .inputShape({2, 9, 5, 19})
+      .reductionAxes({3})
+      .inputZeroPoint(uint8_t(inputZeroPoint))
+      .iterations(1)
+      .testQ8();
+  }
+}
+
+TEST(REDUCE_MEAN_OP, with_output_zero_point) {
+  for (int32_t outputZeroPoint = 0; outputZeroPoint <= 255; outputZeroPoint += 51) {
+    ReduceOperatorTester()
+      .inputShape({2, 9, 5, 19})
+      .reductionAxes({1})
+      .outputZeroPoint(uint8_t(outputZeroPoint))
+      .iterations(1)
+      .testQ8();
+  }
+}
+
+TEST(REDUCE_MEAN_OP, with_output_min) {
+  ReduceOperatorTester()
+    .inputShape({2, 9, 5, 19})
+    .reductionAxes({1, 2})
+    .outputMin(128)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, with_output_max) {
+  ReduceOperatorTester()
+    .inputShape({2, 9, 5, 19})
+    .reductionAxes({3})
+    .outputMax(128)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, multithreaded) {
+  ReduceOperatorTester()
+    .inputShape({3, 17, 5, 300})
+    .reductionAxes({1})
+    .threads(4)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_MEAN_OP, unsupported_non_adjacent_axes) {
+  ReduceOperatorTester()
+    .inputShape({2, 9, 5, 19})
+    .reductionAxes({1, 3})
+    .testUnsupported();
+}
+
+TEST(REDUCE_SUM_OP, reduce_h) {
+  ReduceOperatorTester()
+    .inputShape({2, 9, 5, 19})
+    .reductionAxes({1})
+    .outputScale(32.0f)
+    .mode(ReduceOperatorTester::Mode::Sum)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_SUM_OP, reduce_c) {
+  ReduceOperatorTester()
+    .inputShape({2, 3, 5, 43})
+    .reductionAxes({3})
+    .outputScale(64.0f)
+    .mode(ReduceOperatorTester::Mode::Sum)
+    .iterations(3)
+    .testQ8();
+}
+
+TEST(REDUCE_SUM_OP, saturation) {
+  ReduceOperatorTester()
+    .inputShape({2, 7, 5, 37})
+    .reductionAxes({1, 2})
+    .mode(ReduceOperatorTester::Mode::Sum)
+    .iterations(3)
+    .testQ8();
+}
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <pthreadpool.h>
+
+#include <qnnpack.h>
+
+
+class ResizeOperatorTester {
+ public:
+  inline ResizeOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline ResizeOperatorTester& inputSize(size_t inputHeight, size_t inputWidth) {
+    assert(inputHeight >= 1);
+    assert(inputWidth >= 1);
+    this->inputHeight_ = inputHeight;
+    this->inputWidth_ = inputWidth;
+    return *this;
+  }
+
+  inline size_t inputHeight() const {
+    return this->inputHeight_;
+  }
+
+  inline size_t inputWidth() const {
+    return this->inputWidth_;
+  }
+
+  inline ResizeOperatorTester& outputSize(size_t outputHeight, size_t outputWidth) {
+    assert(outputHeight >= 1);
+    assert(outputWidth >= 1);
+    this->outputHeight_ = outputHeight;
+    this->outputWidth_ = outputWidth;
+    return *this;
+  }
+
+  inline size_t outputHeight() const {
+    return this->outputHeight_;
+  }
+
+  inline size_t outputWidth() const {
+    return this->outputWidth_;
+  }
+
+  inline ResizeOperatorTester& inputPixelStride(size_t inputPixelStride) {
+    assert(inputPixelStride != 0);
+    this->inputPixelStride_ = inputPixelStride;
+    return *this;
+  }
+
+  inline size_t inputPixelStride() const {
+    if (this->inputPixelStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->inputPixelStride_ >= channels());
+      return this->inputPixelStride_;
+    }
+  }
+
+  inline ResizeOperatorTester& outputPixelStride(size_t outputPixelStride) {
+    assert(outputPixelStride != 0);
+    this->outputPixelStride_ = outputPixelStride;
+    return *this;
+  }
+
+  inline size_t outputPixelStride() const {
+    if (this->outputPixelStride_ == 0) {
+      return channels();
+    } else {
+      assert(this->outputPixelStride_ >= channels());
+      return this->outputPixelStride_;
+    }
+  }
+
+  inline ResizeOperatorTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline ResizeOperatorTester& alignCorners(bool alignCorners) {
+    this->alignCorners_ = alignCorners;
+    return *this;
+  }
+
+  inline bool alignCorners() const {
+    return this->alignCorners_;
+  }
+
+  inline ResizeOperatorTester& tensorflowLegacyMode(bool tensorflowLegacyMode) {
+    this->tensorflowLegacyMode_ = tensorflowLegacyMode;
+    return *this;
+  }
+
+  inline bool tensorflowLegacyMode() const {
+    return this->tensorflowLegacyMode_;
+  }
+
+  inline ResizeOperatorTester& threads(size_t threads) {
+    this->threads_ = threads;
+    return *this;
+  }
+
+  inline size_t threads() const {
+    return this->threads_;
+  }
+
+  inline ResizeOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testBilinearQ8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() * inputHeight() * inputWidth() - 1) * inputPixelStride() + channels());
+    std::vector<uint8_t> output((batchSize() * outputHeight() * outputWidth() - 1) * outputPixelStride() + channels());
+    std::vector<float> outputRef(batchSize() * outputHeight() * outputWidth() * channels());
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_TRUE(threadpool != nullptr);
+
+    ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+    qnnp_operator_t resize = nullptr;
+
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_create_resize_bilinear2d_nhwc_q8(channels(), flags(), &resize));
+    ASSERT_NE(nullptr, resize);
+
+    /* The operator is set up again in every iteration to check re-use of the indirection buffer */
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      /* Compute reference results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t oy = 0; oy < outputHeight(); oy++) {
+          const float y = inputCoordinate(oy, inputHeight(), outputHeight());
+          const size_t y0 = std::min(size_t(y), inputHeight() - 1);
+          const size_t y1 = std::min(y0 + 1, inputHeight() - 1);
+          const float alphaV = y - float(y0);
+          for (size_t ox = 0; ox < outputWidth(); ox++) {
+            const float x = inputCoordinate(ox, inputWidth(), outputWidth());
+            const size_t x0 = std::min(size_t(x), inputWidth() - 1);
+            const size_t x1 = std::min(x0 + 1, inputWidth() - 1);
+            const float alphaH = x - float(x0);
+            for (size_t c = 0; c < channels(); c++) {
+              const float topLeft = float(input[((i * inputHeight() + y0) * inputWidth() + x0) * inputPixelStride() + c]);
+              const float topRight = float(input[((i * inputHeight() + y0) * inputWidth() + x1) * inputPixelStride() + c]);
+              const float bottomLeft = float(input[((i * inputHeight() + y1) * inputWidth() + x0) * inputPixelStride() + c]);
+              const float bottomRight = float(input[((i * inputHeight() + y1) * inputWidth() + x1) * inputPixelStride() + c]);
+              const float top = topLeft + (topRight - topLeft) * alphaH;
+              const float bottom = bottomLeft + (bottomRight - bottomLeft) * alphaH;
+              outputRef[((i * outputHeight() + oy) * outputWidth() + ox) * channels() + c] = top + (bottom - top) * alphaV;
+            }
+          }
+        }
+      }
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_resize_bilinear2d_nhwc_q8(
+          resize,
+          batchSize(), inputHeight(), inputWidth(), outputHeight(), outputWidth(),
+          input.data(), inputPixelStride(),
+          output.data(), outputPixelStride(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_run_operator(resize, threadpool));
+
+      /* Verify results: weights are rounded to 11 bits, so results may be off by more than 0.5 */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t y = 0; y < outputHeight(); y++) {
+          for (size_t x = 0; x < outputWidth(); x++) {
+            for (size_t c = 0; c < channels(); c++) {
+              ASSERT_NEAR(
+                  float(int32_t(output[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + c])),
+                  outputRef[((i * outputHeight() + y) * outputWidth() + x) * channels() + c],
+                  0.75f) <<
+                "in batch index " << i << ", pixel (" << y << ", " << x << "), channel " << c;
+            }
+          }
+        }
+      }
+    }
+
+    ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(resize));
+    resize = nullptr;
+
+    pthreadpool_destroy(threadpool);
+  }
+
+  void testNearestX8() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> input((batchSize() * inputHeight() * inputWidth() - 1) * inputPixelStride() + channels());
+    std::vector<uint8_t> output((batchSize() * outputHeight() * outputWidth() - 1) * outputPixelStride() + channels());
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_TRUE(threadpool != nullptr);
+
+    ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+    qnnp_operator_t resize = nullptr;
+
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_create_resize_nearest2d_nhwc_x8(channels(), flags(), &resize));
+    ASSERT_NE(nullptr, resize);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), 0xA5);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_resize_nearest2d_nhwc_x8(
+          resize,
+          batchSize(), inputHeight(), inputWidth(), outputHeight(), outputWidth(),
+          input.data(), inputPixelStride(),
+          output.data(), outputPixelStride(),
+          nullptr /* thread pool */));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_run_operator(resize, threadpool));
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        for (size_t y = 0; y < outputHeight(); y++) {
+          const size_t iy = nearestIndex(y, inputHeight(), outputHeight());
+          for (size_t x = 0; x < outputWidth(); x++) {
+            const size_t ix = nearestIndex(x, inputWidth(), outputWidth());
+            for (size_t c = 0; c < channels(); c++) {
+              ASSERT_EQ(
+                  uint32_t(input[((i * inputHeight() + iy) * inputWidth() + ix) * inputPixelStride() + c]),
+                  uint32_t(output[((i * outputHeight() + y) * outputWidth() + x) * outputPixelStride() + c])) <<
+                "in batch index " << i << ", pixel (" << y << ", " << x << "), channel " << c;
+            }
+          }
+        }
+      }
+    }
+
+    ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(resize));
+    resize = nullptr;
+
+    pthreadpool_destroy(threadpool);
+  }
+
+ private:
+  inline uint32_t flags() const {
+    return (alignCorners() ? QNNP_FLAG_ALIGN_CORNERS : 0) |
+      (tensorflowLegacyMode() ? QNNP_FLAG_TENSORFLOW_LEGACY_MODE : 0);
+  }
+
+  inline float inputCoordinate(size_t outputIndex, size_t inputSize, size_t outputSize) const {
+    if (alignCorners()) {
+      return outputSize == 1 ? 0.0f :
+        float(outputIndex) * (float(inputSize - 1) / float(outputSize - 1));
+    } else if (tensorflowLegacyMode()) {
+      return float(outputIndex) * (float(inputSize) / float(outputSize));
+    } else {
+      return std::max((float(outputIndex) + 0.5f) * (float(inputSize) / float(outputSize)) - 0.5f, 0.0f);
+    }
+  }
+
+  inline size_t nearestIndex(size_t outputIndex, size_t inputSize, size_t outputSize) const {
+    size_t inputIndex;
+    if (alignCorners()) {
+      inputIndex = size_t(std::lrint(inputCoordinate(outputIndex, inputSize, outputSize)));
+    } else if (tensorflowLegacyMode()) {
+      inputIndex = size_t(inputCoordinate(outputIndex, inputSize, outputSize));
+    } else {
+      inputIndex = size_t((float(outputIndex) + 0.5f) * (float(inputSize) / float(outputSize)));
+    }
+    return std::min(inputIndex, inputSize - 1);
+  }
+
+  size_t channels_{1};
+  size_t inputHeight_{1};
+  size_t inputWidth_{1};
+  size_t outputHeight_{1};
+  size_t outputWidth_{1};
+  size_t inputPixelStride_{0};
+  size_t outputPixelStride_{0};
+  size_t batchSize_{1};
+  bool alignCorners_{false};
+  bool tensorflowLegacyMode_{false};
+  size_t threads_{1};
+  size_t iterations_{1};
+};
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+
+#include "resize-operator-tester.h"
+
+
+TEST(RESIZE_BILINEAR_OP, upsample_2x) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(14, 18)
+    .channels(19)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, downsample_2x) {
+  ResizeOperatorTester()
+    .inputSize(14, 18)
+    .outputSize(7, 9)
+    .channels(19)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, non_integer_scale) {
+  ResizeOperatorTester()
+    .inputSize(11, 13)
+    .outputSize(17, 8)
+    .channels(19)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, unit_input) {
+  ResizeOperatorTester()
+    .inputSize(1, 1)
+    .outputSize(5, 7)
+    .channels(19)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, unit_output) {
+  ResizeOperatorTester()
+    .inputSize(5, 7)
+    .outputSize(1, 1)
+    .channels(19)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, channels_lt_8) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(5)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, many_channels) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(67)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, with_input_stride) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .inputPixelStride(29)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, with_output_stride) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .outputPixelStride(29)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, small_batch) {
+  ResizeOperatorTester()
+    .batchSize(3)
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, align_corners) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .alignCorners(true)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, align_corners_unit_output) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(1, 1)
+    .channels(19)
+    .alignCorners(true)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, tensorflow_legacy_mode) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .tensorflowLegacyMode(true)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_BILINEAR_OP, multithreaded) {
+  ResizeOperatorTester()
+    .batchSize(3)
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .threads(3)
+    .iterations(3)
+    .testBilinearQ8();
+}
+
+TEST(RESIZE_NEAREST_OP, upsample_2x) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(14, 18)
+    .channels(19)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, downsample_2x) {
+  ResizeOperatorTester()
+    .inputSize(14, 18)
+    .outputSize(7, 9)
+    .channels(19)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, non_integer_scale) {
+  ResizeOperatorTester()
+    .inputSize(11, 13)
+    .outputSize(17, 8)
+    .channels(19)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, unit_input) {
+  ResizeOperatorTester()
+    .inputSize(1, 1)
+    .outputSize(5, 7)
+    .channels(19)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, unit_output) {
+  ResizeOperatorTester()
+    .inputSize(5, 7)
+    .outputSize(1, 1)
+    .channels(19)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, channels_lt_8) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(5)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, many_channels) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(67)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, with_input_stride) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .inputPixelStride(29)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, with_output_stride) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .outputPixelStride(29)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, small_batch) {
+  ResizeOperatorTester()
+    .batchSize(3)
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, align_corners) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .alignCorners(true)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, align_corners_unit_output) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(1, 1)
+    .channels(19)
+    .alignCorners(true)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, tensorflow_legacy_mode) {
+  ResizeOperatorTester()
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .tensorflowLegacyMode(true)
+    .iterations(3)
+    .testNearestX8();
+}
+
+TEST(RESIZE_NEAREST_OP, multithreaded) {
+  ResizeOperatorTester()
+    .batchSize(3)
+    .inputSize(7, 9)
+    .outputSize(12, 11)
+    .channels(19)
+    .threads(3)
+    .iterations(3)
+    .testNearestX8();
+}
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <random>
+#include <vector>
+
+#include <qnnpack.h>
+#include <pthreadpool.h>
+
+
+class RunOperatorsTester {
+ public:
+  enum class Mode {
+    Sync,
+    AsyncWait,
+    AsyncCallback,
+    AsyncWaitCallback,
+    /* Each operator of the chain is a separate task; tasks are waited for in reverse order */
+    AsyncQueue,
+  };
+
+  inline RunOperatorsTester& operators(size_t operators) {
+    assert(operators != 0);
+    this->operators_ = operators;
+    return *this;
+  }
+
+  inline size_t operators() const {
+    return this->operators_;
+  }
+
+  inline RunOperatorsTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline RunOperatorsTester& batchSize(size_t batchSize) {
+    assert(batchSize != 0);
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline RunOperatorsTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  inline RunOperatorsTester& inputSize(size_t inputHeight, size_t inputWidth) {
+    assert(inputHeight >= 1);
+    assert(inputWidth >= 1);
+    this->inputHeight_ = inputHeight;
+    this->inputWidth_ = inputWidth;
+    return *this;
+  }
+
+  inline size_t inputHeight() const {
+    return this->inputHeight_;
+  }
+
+  inline size_t inputWidth() const {
+    return this->inputWidth_;
+  }
+
+  inline RunOperatorsTester& threads(size_t threads) {
+    this->threads_ = threads;
+    return *this;
+  }
+
+  inline size_t threads() const {
+    return this->threads_;
+  }
+
+  inline RunOperatorsTester& maxThreads(size_t maxThreads) {
+    this->maxThreads_ = maxThreads;
+    return *this;
+  }
+
+  inline size_t maxThreads() const {
+    return this->maxThreads_;
+  }
+
+  /* Runs a chain of Clamp operators, each one consuming the output of the previous one */
+  void testClampChain(Mode mode) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    const size_t elements = batchSize() * channels();
+    std::vector<std::vector<uint8_t>> buffers(operators() + 1, std::vector<uint8_t>(elements));
+    std::vector<uint8_t> outputRef(elements);
+    std::vector<uint8_t> qmin(operators());
+    std::vector<uint8_t> qmax(operators());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(buffers[0].begin(), buffers[0].end(), std::ref(u8rng));
+      for (size_t i = 1; i <= operators(); i++) {
+        std::fill(buffers[i].begin(), buffers[i].end(), 0xA5);
+      }
+      for (size_t i = 0; i < operators(); i++) {
+        do {
+          qmin[i] = u8rng();
+          qmax[i] = u8rng();
+        } while (qmin[i] == qmax[i]);
+        if (qmin[i] > qmax[i]) {
+          std::swap(qmin[i], qmax[i]);
+        }
+      }
+
+      /* Compute reference results */
+      for (size_t k = 0; k < elements; k++) {
+        uint8_t y = buffers[0][k];
+        for (size_t i = 0; i < operators(); i++) {
+          y = std::min(std::max(y, qmin[i]), qmax[i]);
+        }
+        outputRef[k] = y;
+      }
+
+      /* Create, setup, run, and destroy Clamp operators */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      std::vector<qnnp_operator_t> clampOps(operators(), nullptr);
+      for (size_t i = 0; i < operators(); i++) {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_create_clamp_nc_u8(
+            channels(),
+            qmin[i], qmax[i],
+            0, &clampOps[i]));
+        ASSERT_NE(nullptr, clampOps[i]);
+
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_setup_clamp_nc_u8(
+            clampOps[i],
+            batchSize(),
+            buffers[i].data(), channels(),
+            buffers[i + 1].data(), channels()));
+      }
+
+      std::promise<qnnp_status> callbackStatus;
+      const qnnp_task_callback_t callback =
+        [](void* context, qnnp_status status) {
+          static_cast<std::promise<qnnp_status>*>(context)->set_value(status);
+        };
+      qnnp_task_t task = nullptr;
+      switch (mode) {
+        case Mode::Sync:
+          ASSERT_EQ(qnnp_status_success,
+            qnnp_run_operators(clampOps.size(), clampOps.data(), nullptr /* thread pool */));
+          break;
+        case Mode::AsyncWait:
+          ASSERT_EQ(qnnp_status_success,
+            qnnp_run_operators_async(
+              clampOps.size(), clampOps.data(), nullptr /* thread pool */,
+              nullptr, nullptr, &task));
+          ASSERT_NE(nullptr, task);
+          ASSERT_EQ(qnnp_status_success, qnnp_wait_task(task));
+          break;
+        case Mode::AsyncCallback:
+          ASSERT_EQ(qnnp_status_success,
+            qnnp_run_operators_async(
+              clampOps.size(), clampOps.data(), nullptr /* thread pool */,
+              callback, &callbackStatus, nullptr));
+          ASSERT_EQ(qnnp_status_success, callbackStatus.get_future().get());
+          break;
+        case Mode::AsyncWaitCallback:
+          ASSERT_EQ(qnnp_status_success,
+            qnnp_run_operators_async(
+              clampOps.size(), clampOps.data(), nullptr /* thread pool */,
+              callback, &callbackStatus, &task));
+          ASSERT_NE(nullptr, task);
+          ASSERT_EQ(qnnp_status_success, qnnp_wait_task(task));
+          ASSERT_EQ(qnnp_status_success, callbackStatus.get_future().get());
+          break;
+        case Mode::AsyncQueue:
+        {
+          std::vector<qnnp_task_t> tasks(operators(), nullptr);
+          for (size_t i = 0; i < operators(); i++) {
+            ASSERT_EQ(qnnp_status_success,
+              qnnp_run_operator_async(
+                clampOps[i], nullptr /* thread pool */,
+                nullptr, nullptr, &tasks[i]));
+            ASSERT_NE(nullptr, tasks[i]);
+          }
+          for (size_t i = operators(); i != 0; i--) {
+            ASSERT_EQ(qnnp_status_success, qnnp_wait_task(tasks[i - 1]));
+          }
+          break;
+        }
+      }
+
+      for (size_t i = 0; i < operators(); i++) {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_delete_operator(clampOps[i]));
+        clampOps[i] = nullptr;
+      }
+
+      /* Verify results */
+      for (size_t k = 0; k < elements; k++) {
+        ASSERT_EQ(uint32_t(outputRef[k]), uint32_t(buffers[operators()][k]))
+          << "at position " << k << ", batch size = " << batchSize() << ", channels = " << channels()
+          << ", operators = " << operators();
+      }
+    }
+  }
+
+  /*
+   * Runs a SqueezeNet-style fire module (squeeze 1x1 convolution followed by independent expand 1x1 and expand 3x3
+   * convolutions writing into halves of the same output) as a graph, and compares with sequential execution.
+   */
+  void testFireModuleGraph() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+    auto s32rng = std::bind(std::uniform_int_distribution<int32_t>(-10000, 10000), rng);
+
+    const size_t squeezeChannels = std::max<size_t>(channels() / 4, 1);
+    const size_t expandChannels = channels();
+    const size_t pixels = batchSize() * inputHeight() * inputWidth();
+
+    std::vector<uint8_t> input(pixels * channels());
+    std::vector<uint8_t> squeezeKernel(squeezeChannels * channels());
+    std::vector<int32_t> squeezeBias(squeezeChannels);
+    std::vector<uint8_t> expand1x1Kernel(expandChannels * squeezeChannels);
+    std::vector<int32_t> expand1x1Bias(expandChannels);
+    std::vector<uint8_t> expand3x3Kernel(expandChannels * 9 * squeezeChannels);
+    std::vector<int32_t> expand3x3Bias(expandChannels);
+    std::vector<uint8_t> squeezed(pixels * squeezeChannels);
+    std::vector<uint8_t> output(pixels * 2 * expandChannels);
+    std::vector<uint8_t> outputRef(pixels * 2 * expandChannels);
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_NE(nullptr, threadpool);
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::generate(squeezeKernel.begin(), squeezeKernel.end(), std::ref(u8rng));
+      std::generate(squeezeBias.begin(), squeezeBias.end(), std::ref(s32rng));
+      std::generate(expand1x1Kernel.begin(), expand1x1Kernel.end(), std::ref(u8rng));
+      std::generate(expand1x1Bias.begin(), expand1x1Bias.end(), std::ref(s32rng));
+      std::generate(expand3x3Kernel.begin(), expand3x3Kernel.end(), std::ref(u8rng));
+      std::generate(expand3x3Bias.begin(), expand3x3Bias.end(), std::ref(s32rng));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t ops[3] = { nullptr, nullptr, nullptr };
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_convolution2d_nhwc_q8(
+          0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+          channels(), squeezeChannels,
+          127, 1.0f, 127, 1.0f,
+          squeezeKernel.data(), squeezeBias.data(),
+          127, 1024.0f, 0, 255,
+          0, &ops[0]));
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_convolution2d_nhwc_q8(
+          0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+          squeezeChannels, expandChannels,
+          127, 1.0f, 127, 1.0f,
+          expand1x1Kernel.data(), expand1x1Bias.data(),
+          127, 256.0f, 0, 255,
+          0, &ops[1]));
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_convolution2d_nhwc_q8(
+          1, 1, 1, 1, 3, 3, 1, 1, 1, 1, 1,
+          squeezeChannels, expandChannels,
+          127, 1.0f, 127, 1.0f,
+          expand3x3Kernel.data(), expand3x3Bias.data(),
+          127, 2048.0f, 0, 255,
+          0, &ops[2]));
+
+      for (size_t i = 0; i < 3; i++) {
+        ASSERT_EQ(qnnp_status_success,
+          qnnp_set_operator_max_threads(ops[i], maxThreads()));
+      }
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_convolution2d_nhwc_q8(
+          ops[0], batchSize(), inputHeight(), inputWidth(),
+          input.data(), channels(),
+          squeezed.data(), squeezeChannels,
+          threadpool));
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_convolution2d_nhwc_q8(
+          ops[1], batchSize(), inputHeight(), inputWidth(),
+          squeezed.data(), squeezeChannels,
+          output.data(), 2 * expandChannels,
+          threadpool));
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_convolution2d_nhwc_q8(
+          ops[2], batchSize(), inputHeight(), inputWidth(),
+          squeezed.data(), squeezeChannels,
+          output.data() + expandChannels, 2 * expandChannels,
+          threadpool));
+
+      /* Compute reference results by running operators one by one */
+      std::fill(output.begin(), output.end(), 0xA5);
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operators(3, ops, nullptr /* thread pool */));
+      std::copy(output.cbegin(), output.cend(), outputRef.begin());
+
+      std::fill(output.begin(), output.end(), 0xA5);
+      std::fill(squeezed.begin(), squeezed.end(), 0xA5);
+      const qnnp_operator_dependency dependencies[2] = {
+        { 0, 2 },
+        { 0, 1 },
+      };
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_run_operator_graph(3, ops, 2, dependencies, threadpool));
+
+      for (size_t i = 0; i < 3; i++) {
+        ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(ops[i]));
+        ops[i] = nullptr;
+      }
+
+      /* Verify results */
+      for (size_t k = 0; k < output.size(); k++) {
+        ASSERT_EQ(uint32_t(outputRef[k]), uint32_t(output[k]))
+          << "at position " << k << ", batch size = " << batchSize()
+          << ", input size = " << inputHeight() << "x" << inputWidth()
+          << ", channels = " << channels() << ", threads = " << threads() << ", max threads = " << maxThreads();
+      }
+    }
+    pthreadpool_destroy(threadpool);
+  }
+
+ private:
+  size_t operators_{1};
+  size_t batchSize_{1};
+  size_t channels_{1};
+  size_t inputHeight_{1};
+  size_t inputWidth_{1};
+  size_t threads_{4};
+  size_t maxThreads_{0};
+  size_t iterations_{15};
+};
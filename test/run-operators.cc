@@ -0,0 +1,273 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <qnnpack/operator.h>
+
+#include "run-operators-tester.h"
+
+
+TEST(RUN_OPERATORS, single_operator) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    RunOperatorsTester()
+      .operators(1)
+      .batchSize(3)
+      .channels(channels)
+      .iterations(3)
+      .testClampChain(RunOperatorsTester::Mode::Sync);
+  }
+}
+
+TEST(RUN_OPERATORS, operator_chain) {
+  for (size_t operators = 2; operators <= 8; operators++) {
+    RunOperatorsTester()
+      .operators(operators)
+      .batchSize(5)
+      .channels(37)
+      .iterations(3)
+      .testClampChain(RunOperatorsTester::Mode::Sync);
+  }
+}
+
+TEST(RUN_OPERATORS_ASYNC, single_operator_wait) {
+  for (size_t channels = 1; channels < 100; channels += 7) {
+    RunOperatorsTester()
+      .operators(1)
+      .batchSize(3)
+      .channels(channels)
+      .iterations(3)
+      .testClampChain(RunOperatorsTester::Mode::AsyncWait);
+  }
+}
+
+TEST(RUN_OPERATORS_ASYNC, operator_chain_wait) {
+  for (size_t operators = 2; operators <= 8; operators++) {
+    RunOperatorsTester()
+      .operators(operators)
+      .batchSize(5)
+      .channels(37)
+      .iterations(3)
+      .testClampChain(RunOperatorsTester::Mode::AsyncWait);
+  }
+}
+
+TEST(RUN_OPERATORS_ASYNC, operator_chain_callback) {
+  for (size_t operators = 1; operators <= 8; operators++) {
+    RunOperatorsTester()
+      .operators(operators)
+      .batchSize(5)
+      .channels(37)
+      .iterations(3)
+      .testClampChain(RunOperatorsTester::Mode::AsyncCallback);
+  }
+}
+
+TEST(RUN_OPERATORS_ASYNC, operator_chain_wait_and_callback) {
+  for (size_t operators = 1; operators <= 8; operators++) {
+    RunOperatorsTester()
+      .operators(operators)
+      .batchSize(5)
+      .channels(37)
+      .iterations(3)
+      .testClampChain(RunOperatorsTester::Mode::AsyncWaitCallback);
+  }
+}
+
+TEST(RUN_OPERATORS_ASYNC, queued_operators_wait) {
+  for (size_t operators = 1; operators <= 8; operators++) {
+    RunOperatorsTester()
+      .operators(operators)
+      .batchSize(5)
+      .channels(37)
+      .iterations(3)
+      .testClampChain(RunOperatorsTester::Mode::AsyncQueue);
+  }
+}
+
+TEST(RUN_OPERATORS_ASYNC, threadpools_run_concurrently) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const size_t channels = 37;
+  std::vector<uint8_t> input(channels, UINT8_C(0xA5));
+  std::vector<uint8_t> outputs[2];
+  qnnp_operator_t ops[2] = { nullptr, nullptr };
+  pthreadpool_t threadpools[2] = { nullptr, nullptr };
+  for (size_t i = 0; i < 2; i++) {
+    outputs[i].assign(channels, UINT8_C(0));
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_create_clamp_nc_u8(channels, 0, 255, 0, &ops[i]));
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_setup_clamp_nc_u8(ops[i], 1, input.data(), channels, outputs[i].data(), channels));
+    threadpools[i] = pthreadpool_create(2);
+    ASSERT_TRUE(threadpools[i]);
+  }
+
+  /* The first task completes only after the second, so the two must not share a worker thread */
+  struct State {
+    std::promise<void> secondCompleted;
+    bool firstSawSecond;
+  } state;
+  state.firstSawSecond = false;
+  qnnp_task_t tasks[2] = { nullptr, nullptr };
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_run_operator_async(ops[0], threadpools[0],
+      [](void* context, qnnp_status status) {
+        State* state = static_cast<State*>(context);
+        state->firstSawSecond = state->secondCompleted.get_future().wait_for(std::chrono::seconds(10)) ==
+          std::future_status::ready;
+      },
+      &state, &tasks[0]));
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_run_operator_async(ops[1], threadpools[1],
+      [](void* context, qnnp_status status) {
+        static_cast<State*>(context)->secondCompleted.set_value();
+      },
+      &state, &tasks[1]));
+  ASSERT_EQ(qnnp_status_success, qnnp_wait_task(tasks[1]));
+  ASSERT_EQ(qnnp_status_success, qnnp_wait_task(tasks[0]));
+  ASSERT_TRUE(state.firstSawSecond);
+  ASSERT_EQ(input, outputs[0]);
+  ASSERT_EQ(input, outputs[1]);
+
+  for (size_t i = 0; i < 2; i++) {
+    pthreadpool_destroy(threadpools[i]);
+    ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(ops[i]));
+  }
+}
+
+TEST(RUN_OPERATORS_ASYNC, invalid_parameters) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_task_t task = nullptr;
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_run_operators_async(0, nullptr, nullptr, nullptr, nullptr, &task));
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_run_operator_async(nullptr, nullptr, nullptr, nullptr, &task));
+  ASSERT_EQ(nullptr, task);
+  ASSERT_EQ(qnnp_status_invalid_parameter, qnnp_wait_task(nullptr));
+}
+
+TEST(RUN_OPERATOR_GRAPH, fire_module) {
+  for (size_t channels = 4; channels <= 64; channels *= 2) {
+    RunOperatorsTester()
+      .batchSize(2)
+      .inputSize(7, 9)
+      .channels(channels)
+      .threads(4)
+      .iterations(3)
+      .testFireModuleGraph();
+  }
+}
+
+TEST(RUN_OPERATOR_GRAPH, fire_module_with_threads) {
+  for (size_t threads = 1; threads <= 8; threads++) {
+    RunOperatorsTester()
+      .batchSize(1)
+      .inputSize(13, 13)
+      .channels(32)
+      .threads(threads)
+      .iterations(1)
+      .testFireModuleGraph();
+  }
+}
+
+TEST(RUN_OPERATOR_GRAPH, invalid_dependencies) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t ops[2] = { nullptr, nullptr };
+  for (size_t i = 0; i < 2; i++) {
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_create_clamp_nc_u8(16, 0, 255, 0, &ops[i]));
+  }
+
+  const qnnp_operator_dependency cycle[2] = { { 0, 1 }, { 1, 0 } };
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_run_operator_graph(2, ops, 2, cycle, nullptr));
+
+  const qnnp_operator_dependency selfLoop[1] = { { 1, 1 } };
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_run_operator_graph(2, ops, 1, selfLoop, nullptr));
+
+  const qnnp_operator_dependency outOfRange[1] = { { 0, 2 } };
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_run_operator_graph(2, ops, 1, outOfRange, nullptr));
+
+  for (size_t i = 0; i < 2; i++) {
+    ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(ops[i]));
+  }
+}
+
+TEST(RUN_OPERATOR_GRAPH, failed_plan_skips_wave) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const size_t batchSize = 64;
+  const size_t channels = 64;
+  std::vector<uint8_t> input(batchSize * channels, UINT8_C(0xA5));
+  std::vector<uint8_t> outputs[2];
+  qnnp_operator_t ops[2] = { nullptr, nullptr };
+  for (size_t i = 0; i < 2; i++) {
+    outputs[i].assign(batchSize * channels, UINT8_C(0));
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_create_clamp_nc_u8(channels, 0, 255, 0, &ops[i]));
+    ASSERT_EQ(qnnp_status_success,
+      qnnp_setup_clamp_nc_u8(ops[i], batchSize, input.data(), channels, outputs[i].data(), channels));
+  }
+
+  /* Corrupt the second operator so that its compute plan can not be prepared */
+  const qnnp_ukernel_type ukernelType = ops[1]->ukernel_type;
+  ops[1]->ukernel_type = qnnp_ukernel_type_none;
+
+  pthreadpool_t threadpool = pthreadpool_create(4);
+  ASSERT_TRUE(threadpool);
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_run_operator_graph(2, ops, 0, nullptr, threadpool));
+  pthreadpool_destroy(threadpool);
+
+  /* Neither operator of the failed wave may have run */
+  for (size_t i = 0; i < 2; i++) {
+    ASSERT_TRUE(std::all_of(outputs[i].cbegin(), outputs[i].cend(),
+      [](uint8_t y) { return y == 0; }));
+  }
+
+  ops[1]->ukernel_type = ukernelType;
+  for (size_t i = 0; i < 2; i++) {
+    ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(ops[i]));
+  }
+}
+
+TEST(RUN_OPERATOR_GRAPH, fire_module_with_max_threads) {
+  for (size_t maxThreads = 1; maxThreads <= 6; maxThreads++) {
+    RunOperatorsTester()
+      .batchSize(1)
+      .inputSize(13, 13)
+      .channels(32)
+      .threads(4)
+      .maxThreads(maxThreads)
+      .iterations(1)
+      .testFireModuleGraph();
+  }
+}
+
+TEST(RUN_OPERATOR_GRAPH, fire_module_with_unlimited_threads) {
+  RunOperatorsTester()
+    .batchSize(2)
+    .inputSize(13, 13)
+    .channels(32)
+    .threads(4)
+    .maxThreads(SIZE_MAX)
+    .iterations(3)
+    .testFireModuleGraph();
+}
+
+TEST(RUN_OPERATORS, max_threads_invalid_operator) {
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_set_operator_max_threads(nullptr, 1));
+}
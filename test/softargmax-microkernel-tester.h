@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+#include <qnnpack/requantization.h>
+#include <qnnpack/u8softargmax.h>
+
+
+class SoftArgMaxMicrokernelTester {
+ public:
+  inline SoftArgMaxMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline SoftArgMaxMicrokernelTester& inplace(bool inplace) {
+    this->inplace_ = inplace;
+    return *this;
+  }
+
+  inline bool inplace() const {
+    return this->inplace_;
+  }
+
+  inline SoftArgMaxMicrokernelTester& outputScale(float outputScale) {
+    assert(outputScale > 0.0f);
+    assert(std::isnormal(outputScale));
+    this->outputScale_ = outputScale;
+    return *this;
+  }
+
+  inline float outputScale() const {
+    return this->outputScale_;
+  }
+
+  inline SoftArgMaxMicrokernelTester& outputZeroPoint(uint8_t outputZeroPoint) {
+    this->outputZeroPoint_ = outputZeroPoint;
+    return *this;
+  }
+
+  inline uint8_t outputZeroPoint() const {
+    return this->outputZeroPoint_;
+  }
+
+  inline SoftArgMaxMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test(u8softargmax_ukernel_function u8softargmax) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    /* Table entries are bounded the same way as in the Soft ArgMax operator */
+    const double divisorScale = std::max(double(outputScale()) * 256.0, 1.0);
+    const uint32_t tMax = uint32_t(std::max(std::min(std::floor(2147483648.0 / (double(n()) * divisorScale)), 4194303.0), 1.0));
+    auto u32rng = std::bind(std::uniform_int_distribution<uint32_t>(1, tMax), rng);
+
+    std::vector<uint8_t> x(n());
+    std::vector<uint32_t> t(256);
+    std::vector<uint8_t> y(n());
+    std::vector<uint8_t> yRef(n());
+    const union qnnp_softargmax_params params =
+      qnnp_compute_softargmax_params(outputZeroPoint(), outputScale());
+    const union qnnp_softargmax_params scalarParams =
+      qnnp_compute_scalar_softargmax_params(outputZeroPoint(), outputScale());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(u8rng));
+      std::generate(t.begin(), t.end(), std::ref(u32rng));
+      std::sort(t.begin(), t.end());
+      if (inplace()) {
+        std::generate(y.begin(), y.end(), std::ref(u8rng));
+      } else {
+        std::fill(y.begin(), y.end(), 0xA5);
+      }
+      const uint8_t* xData = inplace() ? y.data() : x.data();
+
+      /* Compute reference results */
+      const uint8_t xMax = *std::max_element(xData, xData + n());
+      const uint32_t* tData = t.data() + (xMax ^ 255);
+      uint32_t sum = 0;
+      for (size_t i = 0; i < n(); i++) {
+        sum += tData[xData[i]];
+      }
+      const uint32_t divisor = u8softargmax_divisor(sum, scalarParams.scalar.divisor_scale);
+      for (size_t i = 0; i < n(); i++) {
+        const uint32_t q = ((tData[xData[i]] << 8) + (divisor >> 1)) / divisor;
+        yRef[i] = uint8_t(std::min<uint32_t>(q + uint32_t(outputZeroPoint()), 255));
+      }
+
+      /* Call optimized micro-kernel */
+      u8softargmax(n(), xData, t.data(), y.data(), &params);
+
+      /* Verify results */
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_EQ(uint32_t(yRef[i]), uint32_t(y[i]))
+          << "at position " << i << ", n = " << n() << ", sum = " << sum << ", divisor = " << divisor;
+      }
+    }
+  }
+
+ private:
+  size_t n_{1};
+  bool inplace_{false};
+  float outputScale_{1.0f / 256.0f};
+  uint8_t outputZeroPoint_{0};
+  size_t iterations_{15};
+};
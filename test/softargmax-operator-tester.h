@@ -92,12 +92,24 @@ class SoftArgMaxOperatorTester {
     return this->inputZeroPoint_;
   }
 
+  inline SoftArgMaxOperatorTester& outputScale(float outputScale) {
+    assert(outputScale > 0.0f);
+    assert(std::isnormal(outputScale));
+    this->outputScale_ = outputScale;
+    return *this;
+  }
+
   inline float outputScale() const {
-    return 1.0f / 256.0f;
+    return this->outputScale_;
+  }
+
+  inline SoftArgMaxOperatorTester& outputZeroPoint(uint8_t outputZeroPoint) {
+    this->outputZeroPoint_ = outputZeroPoint;
+    return *this;
   }
 
   inline uint8_t outputZeroPoint() const {
-    return 0;
+    return this->outputZeroPoint_;
   }
 
   inline SoftArgMaxOperatorTester& iterations(size_t iterations) {
@@ -132,7 +144,8 @@ class SoftArgMaxOperatorTester {
         }
         for (size_t c = 0; c < channels(); c++) {
           outputRef[i * channels() + c] =
-            exp((int32_t(input[i * inputStride() + c]) - maxInput) * inputScale()) / (sumExp * outputScale());
+            exp((int32_t(input[i * inputStride() + c]) - maxInput) * inputScale()) / (sumExp * outputScale()) +
+            float(int32_t(outputZeroPoint()));
           outputRef[i * channels() + c] = std::min(outputRef[i * channels() + c], 255.0f);
         }
       }
@@ -179,5 +192,7 @@ class SoftArgMaxOperatorTester {
   size_t outputStride_{0};
   float inputScale_{0.176080093};
   uint8_t inputZeroPoint_{121};
+  float outputScale_{1.0f / 256.0f};
+  uint8_t outputZeroPoint_{0};
   size_t iterations_{15};
 };
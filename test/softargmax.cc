@@ -101,6 +101,44 @@ TEST(SOFTARGMAX_OP, many_channels_with_input_zero_point) {
   }
 }
 
+TEST(SOFTARGMAX_OP, many_channels_with_output_scale) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    for (float outputScale = 1.0e-4f; outputScale < 1.0e+0f; outputScale *= 3.14159265f) {
+      SoftArgMaxOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .outputScale(outputScale)
+        .iterations(1)
+        .testQ8();
+    }
+  }
+}
+
+TEST(SOFTARGMAX_OP, many_channels_with_output_zero_point) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    for (int32_t outputZeroPoint = 0; outputZeroPoint <= 255; outputZeroPoint += 51) {
+      SoftArgMaxOperatorTester()
+        .batchSize(1)
+        .channels(channels)
+        .outputScale(1.0f / 255.0f)
+        .outputZeroPoint(uint8_t(outputZeroPoint))
+        .iterations(1)
+        .testQ8();
+    }
+  }
+}
+
+TEST(SOFTARGMAX_OP, imagenet_classes_with_output_scale) {
+  for (float outputScale = 1.0e-4f; outputScale < 1.0e-2f; outputScale *= 3.14159265f) {
+    SoftArgMaxOperatorTester()
+      .batchSize(1)
+      .channels(1001)
+      .outputScale(outputScale)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
 TEST(SOFTARGMAX_OP, small_batch) {
   for (size_t channels = 1; channels < 100; channels += 5) {
     SoftArgMaxOperatorTester()
@@ -144,3 +182,17 @@ TEST(SOFTARGMAX_OP, strided_batch_with_input_and_output_stride) {
       .testQ8();
   }
 }
+
+TEST(SOFTARGMAX_OP, small_batch_with_output_quantization) {
+  for (size_t channels = 1; channels < 100; channels += 5) {
+    SoftArgMaxOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .outputScale(1.0f / 200.0f)
+      .outputZeroPoint(28)
+      .inputStride(129)
+      .outputStride(117)
+      .iterations(3)
+      .testQ8();
+  }
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <pthreadpool.h>
+
+#include <qnnpack.h>
+
+
+class TopKOperatorTester {
+ public:
+  inline TopKOperatorTester& channels(size_t channels) {
+    assert(channels != 0);
+    this->channels_ = channels;
+    return *this;
+  }
+
+  inline size_t channels() const {
+    return this->channels_;
+  }
+
+  inline TopKOperatorTester& k(size_t k) {
+    assert(k != 0);
+    this->k_ = k;
+    return *this;
+  }
+
+  inline size_t k() const {
+    return this->k_;
+  }
+
+  inline TopKOperatorTester& inputStride(size_t inputStride) {
+    assert(inputStride != 0);
+    this->inputStride_ = inputStride;
+    return *this;
+  }
+
+  inline size_t inputStride() const {
+    if (this->inputStride_ == 0) {
+      return this->channels_;
+    } else {
+      assert(this->inputStride_ >= this->channels_);
+      return this->inputStride_;
+    }
+  }
+
+  inline TopKOperatorTester& outputStride(size_t outputStride) {
+    assert(outputStride != 0);
+    this->outputStride_ = outputStride;
+    return *this;
+  }
+
+  inline size_t outputStride() const {
+    if (this->outputStride_ == 0) {
+      return this->k_;
+    } else {
+      assert(this->outputStride_ >= this->k_);
+      return this->outputStride_;
+    }
+  }
+
+  inline TopKOperatorTester& batchSize(size_t batchSize) {
+    this->batchSize_ = batchSize;
+    return *this;
+  }
+
+  inline size_t batchSize() const {
+    return this->batchSize_;
+  }
+
+  inline TopKOperatorTester& inputMax(uint8_t inputMax) {
+    this->inputMax_ = inputMax;
+    return *this;
+  }
+
+  inline uint8_t inputMax() const {
+    return this->inputMax_;
+  }
+
+  inline TopKOperatorTester& outputValues(bool outputValues) {
+    this->outputValues_ = outputValues;
+    return *this;
+  }
+
+  inline bool outputValues() const {
+    return this->outputValues_;
+  }
+
+  inline TopKOperatorTester& threads(size_t threads) {
+    this->threads_ = threads;
+    return *this;
+  }
+
+  inline size_t threads() const {
+    return this->threads_;
+  }
+
+  inline TopKOperatorTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testArgMax() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, inputMax()), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<uint32_t> output(batchSize());
+    std::vector<uint32_t> outputRef(batchSize());
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_TRUE(threadpool != nullptr);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(output.begin(), output.end(), UINT32_C(0xDEADBEEF));
+
+      /* Compute reference results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        const uint8_t* row = input.data() + i * inputStride();
+        outputRef[i] = uint32_t(std::max_element(row, row + channels()) - row);
+      }
+
+      /* Create, setup, run, and destroy ArgMax operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t argmaxOp = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_argmax_nc_u8(channels(), 0, &argmaxOp));
+      ASSERT_NE(nullptr, argmaxOp);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_argmax_nc_u8(
+          argmaxOp,
+          batchSize(),
+          input.data(), inputStride(),
+          output.data()));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_run_operator(argmaxOp, threadpool));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(argmaxOp));
+      argmaxOp = nullptr;
+
+      /* Verify results */
+      for (size_t i = 0; i < batchSize(); i++) {
+        ASSERT_EQ(outputRef[i], output[i]) << "in batch index " << i;
+      }
+    }
+
+    pthreadpool_destroy(threadpool);
+  }
+
+  void testTopK() const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint32_t>(0, inputMax()), rng);
+
+    std::vector<uint8_t> input((batchSize() - 1) * inputStride() + channels());
+    std::vector<uint8_t> values((batchSize() - 1) * outputStride() + k());
+    std::vector<uint32_t> indices((batchSize() - 1) * outputStride() + k());
+    std::vector<uint32_t> order(channels());
+
+    pthreadpool_t threadpool = pthreadpool_create(threads());
+    ASSERT_TRUE(threadpool != nullptr);
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(input.begin(), input.end(), std::ref(u8rng));
+      std::fill(values.begin(), values.end(), 0xA5);
+      std::fill(indices.begin(), indices.end(), UINT32_C(0xDEADBEEF));
+
+      /* Create, setup, run, and destroy Top-K operator */
+      ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+      qnnp_operator_t topKOp = nullptr;
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_create_top_k_nc_u8(channels(), k(), 0, &topKOp));
+      ASSERT_NE(nullptr, topKOp);
+
+      ASSERT_EQ(qnnp_status_success,
+        qnnp_setup_top_k_nc_u8(
+          topKOp,
+          batchSize(),
+          input.data(), inputStride(),
+          outputValues() ? values.data() : nullptr, outputStride(),
+          indices.data(), outputStride()));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_run_operator(topKOp, threadpool));
+
+      ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(topKOp));
+      topKOp = nullptr;
+
+      /* Verify results against a stable sort by decreasing value */
+      for (size_t i = 0; i < batchSize(); i++) {
+        const uint8_t* row = input.data() + i * inputStride();
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+          [row](uint32_t a, uint32_t b) { return row[a] > row[b]; });
+        for (size_t j = 0; j < k(); j++) {
+          ASSERT_EQ(order[j], indices[i * outputStride() + j]) <<
+            "in batch index " << i << ", output " << j;
+          if (outputValues()) {
+            ASSERT_EQ(uint32_t(row[order[j]]), uint32_t(values[i * outputStride() + j])) <<
+              "in batch index " << i << ", output " << j;
+          }
+        }
+      }
+    }
+
+    pthreadpool_destroy(threadpool);
+  }
+
+ private:
+  size_t batchSize_{1};
+  size_t channels_{1};
+  size_t k_{1};
+  size_t inputStride_{0};
+  size_t outputStride_{0};
+  uint8_t inputMax_{255};
+  bool outputValues_{true};
+  size_t threads_{1};
+  size_t iterations_{15};
+};
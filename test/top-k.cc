@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <qnnpack.h>
+
+#include "top-k-operator-tester.h"
+
+
+TEST(ARGMAX_OP, single_class) {
+  TopKOperatorTester()
+    .batchSize(1)
+    .channels(1)
+    .testArgMax();
+}
+
+TEST(ARGMAX_OP, many_classes) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batchSize(1)
+      .channels(channels)
+      .iterations(3)
+      .testArgMax();
+  }
+}
+
+TEST(ARGMAX_OP, imagenet_classes) {
+  TopKOperatorTester()
+    .batchSize(1)
+    .channels(1000)
+    .testArgMax();
+}
+
+TEST(ARGMAX_OP, with_ties) {
+  for (size_t channels = 2; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batchSize(3)
+      .channels(channels)
+      .inputMax(3)
+      .iterations(3)
+      .testArgMax();
+  }
+}
+
+TEST(ARGMAX_OP, with_input_stride) {
+  TopKOperatorTester()
+    .batchSize(5)
+    .channels(1000)
+    .inputStride(1009)
+    .testArgMax();
+}
+
+TEST(ARGMAX_OP, multithreaded) {
+  TopKOperatorTester()
+    .batchSize(17)
+    .channels(1001)
+    .threads(4)
+    .testArgMax();
+}
+
+TEST(TOP_K_OP, k_eq_1) {
+  TopKOperatorTester()
+    .batchSize(3)
+    .channels(100)
+    .k(1)
+    .testTopK();
+}
+
+TEST(TOP_K_OP, k_eq_5) {
+  for (size_t channels = 5; channels < 100; channels++) {
+    TopKOperatorTester()
+      .batchSize(1)
+      .channels(channels)
+      .k(5)
+      .iterations(3)
+      .testTopK();
+  }
+}
+
+TEST(TOP_K_OP, k_eq_channels) {
+  for (size_t channels = 1; channels < 40; channels++) {
+    TopKOperatorTester()
+      .batchSize(2)
+      .channels(channels)
+      .k(channels)
+      .iterations(3)
+      .testTopK();
+  }
+}
+
+TEST(TOP_K_OP, imagenet_top5) {
+  TopKOperatorTester()
+    .batchSize(3)
+    .channels(1000)
+    .k(5)
+    .testTopK();
+}
+
+TEST(TOP_K_OP, with_ties) {
+  for (size_t k = 1; k < 20; k++) {
+    TopKOperatorTester()
+      .batchSize(3)
+      .channels(50)
+      .k(k)
+      .inputMax(4)
+      .iterations(3)
+      .testTopK();
+  }
+}
+
+TEST(TOP_K_OP, with_input_stride) {
+  TopKOperatorTester()
+    .batchSize(5)
+    .channels(1000)
+    .inputStride(1009)
+    .k(5)
+    .testTopK();
+}
+
+TEST(TOP_K_OP, with_output_stride) {
+  TopKOperatorTester()
+    .batchSize(5)
+    .channels(1000)
+    .outputStride(7)
+    .k(5)
+    .testTopK();
+}
+
+TEST(TOP_K_OP, indices_only) {
+  TopKOperatorTester()
+    .batchSize(5)
+    .channels(1000)
+    .k(5)
+    .outputValues(false)
+    .testTopK();
+}
+
+TEST(TOP_K_OP, multithreaded) {
+  TopKOperatorTester()
+    .batchSize(17)
+    .channels(1001)
+    .k(10)
+    .threads(4)
+    .testTopK();
+}
+
+TEST(TOP_K_OP, setup_with_invalid_parameters) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  qnnp_operator_t topKOp = nullptr;
+  ASSERT_EQ(qnnp_status_success, qnnp_create_top_k_nc_u8(37, 5, 0, &topKOp));
+
+  std::vector<uint8_t> input(3 * 37);
+  std::vector<uint8_t> values(3 * 5);
+  std::vector<uint32_t> indices(3 * 5);
+  EXPECT_EQ(qnnp_status_invalid_parameter,
+    qnnp_setup_top_k_nc_u8(topKOp, 3, input.data(), 36, values.data(), 5, indices.data(), 5));
+  EXPECT_EQ(qnnp_status_invalid_parameter,
+    qnnp_setup_top_k_nc_u8(topKOp, 3, input.data(), 37, values.data(), 5, nullptr, 5));
+  EXPECT_EQ(qnnp_status_invalid_parameter,
+    qnnp_setup_top_k_nc_u8(topKOp, 3, input.data(), 37, values.data(), 5, indices.data(), 4));
+  EXPECT_EQ(qnnp_status_invalid_parameter,
+    qnnp_setup_top_k_nc_u8(topKOp, 3, input.data(), 37, values.data(), 4, indices.data(), 5));
+  EXPECT_EQ(qnnp_status_success,
+    qnnp_setup_top_k_nc_u8(topKOp, 3, input.data(), 37, nullptr, 0, indices.data(), 5));
+  EXPECT_EQ(qnnp_status_success,
+    qnnp_setup_top_k_nc_u8(topKOp, 3, input.data(), 37, values.data(), 5, indices.data(), 5));
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(topKOp));
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+
+
+class TransposeMicrokernelTester {
+ public:
+  inline TransposeMicrokernelTester& m(size_t m) {
+    assert(m != 0);
+    this->m_ = m;
+    return *this;
+  }
+
+  inline size_t m() const {
+    return this->m_;
+  }
+
+  inline TransposeMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline TransposeMicrokernelTester& xStride(size_t xStride) {
+    assert(xStride != 0);
+    this->xStride_ = xStride;
+    return *this;
+  }
+
+  inline size_t xStride() const {
+    if (this->xStride_ == 0) {
+      return n();
+    } else {
+      assert(this->xStride_ >= n());
+      return this->xStride_;
+    }
+  }
+
+  inline TransposeMicrokernelTester& yStride(size_t yStride) {
+    assert(yStride != 0);
+    this->yStride_ = yStride;
+    return *this;
+  }
+
+  inline size_t yStride() const {
+    if (this->yStride_ == 0) {
+      return m();
+    } else {
+      assert(this->yStride_ >= m());
+      return this->yStride_;
+    }
+  }
+
+  inline TransposeMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void testX8(xtranspose_ukernel_function xtranspose) const {
+    test<uint8_t>(xtranspose);
+  }
+
+  void testX32(xtranspose_ukernel_function xtranspose) const {
+    test<uint32_t>(xtranspose);
+  }
+
+ private:
+  template<typename T>
+  void test(xtranspose_ukernel_function xtranspose) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto xrng = std::bind(std::uniform_int_distribution<T>(), rng);
+
+    std::vector<T> x((m() - 1) * xStride() + n());
+    std::vector<T> y((n() - 1) * yStride() + m());
+
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(xrng));
+      std::fill(y.begin(), y.end(), T(0xA5A5A5A5));
+
+      /* Call optimized micro-kernel */
+      xtranspose(m(), n(), x.data(), xStride() * sizeof(T), y.data(), yStride() * sizeof(T));
+
+      /* Verify results */
+      for (size_t i = 0; i < m(); i++) {
+        for (size_t j = 0; j < n(); j++) {
+          ASSERT_EQ(uint32_t(y[j * yStride() + i]), uint32_t(x[i * xStride() + j]))
+            << "at row " << i << ", column " << j << ", M x N = " << m() << " x " << n();
+        }
+      }
+    }
+  }
+
+  size_t m_{1};
+  size_t n_{1};
+  size_t xStride_{0};
+  size_t yStride_{0};
+  size_t iterations_{3};
+};
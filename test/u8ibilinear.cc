@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <cpuinfo.h>
+
+#include <qnnpack/isa-checks.h>
+#include <qnnpack/u8ibilinear.h>
+
+#include "bilinear-microkernel-tester.h"
+
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(U8IBILINEAR_C8__NEON, channels_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    BilinearMicrokernelTester()
+      .pixels(1)
+      .channels(8)
+      .test(u8ibilinear_ukernel_c8__neon);
+  }
+
+  TEST(U8IBILINEAR_C8__NEON, channels_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 16; channels < 64; channels += 8) {
+      BilinearMicrokernelTester()
+        .pixels(1)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__neon);
+    }
+  }
+
+  TEST(U8IBILINEAR_C8__NEON, channels_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels < 8; channels++) {
+      BilinearMicrokernelTester()
+        .pixels(1)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__neon);
+    }
+  }
+
+  TEST(U8IBILINEAR_C8__NEON, channels_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 9; channels < 32; channels++) {
+      BilinearMicrokernelTester()
+        .pixels(1)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__neon);
+    }
+  }
+
+  TEST(U8IBILINEAR_C8__NEON, multipixel) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      BilinearMicrokernelTester()
+        .pixels(7)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__neon);
+    }
+  }
+
+  TEST(U8IBILINEAR_C8__NEON, multipixel_with_output_stride) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      BilinearMicrokernelTester()
+        .pixels(7)
+        .channels(channels)
+        .outputStride(43)
+        .test(u8ibilinear_ukernel_c8__neon);
+    }
+  }
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(U8IBILINEAR_C8__SSE2, channels_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    BilinearMicrokernelTester()
+      .pixels(1)
+      .channels(8)
+      .test(u8ibilinear_ukernel_c8__sse2);
+  }
+
+  TEST(U8IBILINEAR_C8__SSE2, channels_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 16; channels < 64; channels += 8) {
+      BilinearMicrokernelTester()
+        .pixels(1)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__sse2);
+    }
+  }
+
+  TEST(U8IBILINEAR_C8__SSE2, channels_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels < 8; channels++) {
+      BilinearMicrokernelTester()
+        .pixels(1)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__sse2);
+    }
+  }
+
+  TEST(U8IBILINEAR_C8__SSE2, channels_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 9; channels < 32; channels++) {
+      BilinearMicrokernelTester()
+        .pixels(1)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__sse2);
+    }
+  }
+
+  TEST(U8IBILINEAR_C8__SSE2, multipixel) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      BilinearMicrokernelTester()
+        .pixels(7)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c8__sse2);
+    }
+  }
+
+  TEST(U8IBILINEAR_C8__SSE2, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t channels = 1; channels <= 40; channels += 3) {
+      BilinearMicrokernelTester()
+        .pixels(7)
+        .channels(channels)
+        .outputStride(43)
+        .test(u8ibilinear_ukernel_c8__sse2);
+    }
+  }
+
+  TEST(U8IBILINEAR_C16__AVX2, channels_eq_16) {
+    TEST_REQUIRES_X86_AVX2;
+    BilinearMicrokernelTester()
+      .pixels(1)
+      .channels(16)
+      .test(u8ibilinear_ukernel_c16__avx2);
+  }
+
+  TEST(U8IBILINEAR_C16__AVX2, channels_div_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t channels = 32; channels < 128; channels += 16) {
+      BilinearMicrokernelTester()
+        .pixels(1)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c16__avx2);
+    }
+  }
+
+  TEST(U8IBILINEAR_C16__AVX2, channels_lt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t channels = 1; channels < 16; channels++) {
+      BilinearMicrokernelTester()
+        .pixels(1)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c16__avx2);
+    }
+  }
+
+  TEST(U8IBILINEAR_C16__AVX2, channels_gt_16) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t channels = 17; channels < 32; channels++) {
+      BilinearMicrokernelTester()
+        .pixels(1)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c16__avx2);
+    }
+  }
+
+  TEST(U8IBILINEAR_C16__AVX2, multipixel) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t channels = 1; channels <= 80; channels += 7) {
+      BilinearMicrokernelTester()
+        .pixels(7)
+        .channels(channels)
+        .test(u8ibilinear_ukernel_c16__avx2);
+    }
+  }
+
+  TEST(U8IBILINEAR_C16__AVX2, multipixel_with_output_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t channels = 1; channels <= 80; channels += 7) {
+      BilinearMicrokernelTester()
+        .pixels(7)
+        .channels(channels)
+        .outputStride(83)
+        .test(u8ibilinear_ukernel_c16__avx2);
+    }
+  }
+#endif
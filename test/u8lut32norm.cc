@@ -7,12 +7,61 @@
  */
 
 #include <gtest/gtest.h>
+#include <cpuinfo.h>
 
+#include <qnnpack/isa-checks.h>
 #include <qnnpack/u8lut32norm.h>
 
 #include "lut-norm-microkernel-tester.h"
 
 
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(U8LUT32NORM__AVX2, n_eq_8) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTNormMicrokernelTester()
+      .n(8)
+      .test(u8lut32norm_ukernel__avx2);
+  }
+
+  TEST(U8LUT32NORM__AVX2, n_div_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n < 128; n += 8) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .test(u8lut32norm_ukernel__avx2);
+    }
+  }
+
+  TEST(U8LUT32NORM__AVX2, n_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 8; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .test(u8lut32norm_ukernel__avx2);
+    }
+  }
+
+  TEST(U8LUT32NORM__AVX2, n_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 9; n < 16; n++) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .test(u8lut32norm_ukernel__avx2);
+    }
+  }
+
+  TEST(U8LUT32NORM__AVX2, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 40; n += 5) {
+      LUTNormMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .test(u8lut32norm_ukernel__avx2);
+    }
+  }
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+
+
 TEST(U8LUT32NORM__SCALAR, n_eq_1) {
   LUTNormMicrokernelTester()
     .n(1)
@@ -2235,4 +2235,1113 @@
       }
     }
   }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_mx1_pool) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t kc = 1; kc < 32; kc++) {
+      for (size_t ks = 2; ks < 16; ks++) {
+        MaxPoolMicrokernelTester()
+          .kr(32)
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .test(u8maxpool_ukernel_sub32__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_mx1_pool_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t kc = 1; kc < 32; kc++) {
+      for (size_t ks = 2; ks < 16; ks++) {
+        MaxPoolMicrokernelTester()
+          .kr(32)
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .qmin(192)
+          .test(u8maxpool_ukernel_sub32__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_mx1_pool_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t kc = 1; kc < 32; kc++) {
+      for (size_t ks = 2; ks < 16; ks++) {
+        MaxPoolMicrokernelTester()
+          .kr(32)
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .qmax(192)
+          .test(u8maxpool_ukernel_sub32__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_1xm_pool) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t kc = 1; kc < 32; kc++) {
+      for (size_t ks = 2; ks < 16; ks++) {
+        MaxPoolMicrokernelTester()
+          .kr(32)
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .test(u8maxpool_ukernel_sub32__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_1xm_pool_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t kc = 1; kc < 32; kc++) {
+      for (size_t ks = 2; ks < 16; ks++) {
+        MaxPoolMicrokernelTester()
+          .kr(32)
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .qmin(192)
+          .test(u8maxpool_ukernel_sub32__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_1xm_pool_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t kc = 1; kc < 32; kc++) {
+      for (size_t ks = 2; ks < 16; ks++) {
+        MaxPoolMicrokernelTester()
+          .kr(32)
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .qmax(192)
+          .test(u8maxpool_ukernel_sub32__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_small_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t kc = 1; kc < 32; kc++) {
+          MaxPoolMicrokernelTester()
+            .kr(32)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .iterations(3)
+            .test(u8maxpool_ukernel_sub32__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_small_n_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t kc = 1; kc < 32; kc++) {
+          MaxPoolMicrokernelTester()
+            .kr(32)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .xStride(37)
+            .iterations(3)
+            .test(u8maxpool_ukernel_sub32__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_small_n_with_s) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t s = 2; s <= 5; s++) {
+          for (size_t kc = 1; kc < 32; kc++) {
+            MaxPoolMicrokernelTester()
+              .kr(32)
+              .n(n)
+              .kh(ks)
+              .kw(ks)
+              .kc(kc)
+              .s(s)
+              .iterations(1)
+              .test(u8maxpool_ukernel_sub32__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_small_n_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t kc = 1; kc < 32; kc++) {
+          MaxPoolMicrokernelTester()
+            .kr(32)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .qmin(192)
+            .iterations(3)
+            .test(u8maxpool_ukernel_sub32__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_SUB32__AVX2, kc_lt_32_small_n_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t kc = 1; kc < 32; kc++) {
+          MaxPoolMicrokernelTester()
+            .kr(32)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .qmax(192)
+            .iterations(3)
+            .test(u8maxpool_ukernel_sub32__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_unipass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .kc(32);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          tester
+            .kh(kh)
+            .kw(kw)
+            .test(u8maxpool_ukernel_32x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_unipass_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .kc(32);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          tester
+            .kh(kh)
+            .kw(kw)
+            .qmin(192)
+            .test(u8maxpool_ukernel_32x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_unipass_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .kc(32);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          tester
+            .kh(kh)
+            .kw(kw)
+            .qmax(192)
+            .test(u8maxpool_ukernel_32x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_unipass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .kc(32);
+    for (size_t ks = 2; ks < tester.mr(); ks++) {
+      tester
+        .kh(ks)
+        .kw(1)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+      tester
+        .kh(1)
+        .kw(ks)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_unipass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 32; kc < 512; kc += 96) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_unipass_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 32; kc < 512; kc += 96) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .qmin(192)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_unipass_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 32; kc < 512; kc += 96) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .qmax(192)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_unipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .iterations(3);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 32; kc < 512; kc += 96) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .xStride(521)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_unipass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .iterations(3);
+    for (size_t ks = 2; ks < tester.mr(); ks++) {
+      for (size_t kc = 32; kc < 512; kc += 96) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_unipass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 33; kc < 64; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_unipass_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 33; kc < 64; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .qmin(192)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_unipass_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 33; kc < 64; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .qmax(192)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_unipass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .iterations(3);
+    for (size_t kh = 1; kh <= tester.mr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr(); kw++) {
+        if (kh * kw == tester.mr()) {
+          for (size_t kc = 33; kc < 64; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .xStride(521)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_unipass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .iterations(3);
+    for (size_t ks = 2; ks < tester.mr(); ks++) {
+      for (size_t kc = 33; kc < 64; kc++) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_twopass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .kc(32);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          tester
+            .kh(kh)
+            .kw(kw)
+            .test(u8maxpool_ukernel_32x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_twopass_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .kc(32);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          tester
+            .kh(kh)
+            .kw(kw)
+            .qmin(192)
+            .test(u8maxpool_ukernel_32x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_twopass_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .kc(32);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          tester
+            .kh(kh)
+            .kw(kw)
+            .qmax(192)
+            .test(u8maxpool_ukernel_32x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_twopass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .kc(32);
+    for (size_t ks = tester.mr() + 1; ks < tester.mr() + tester.qr(); ks++) {
+      tester
+        .kh(ks)
+        .kw(1)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+      tester
+        .kh(1)
+        .kw(ks)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_twopass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          for (size_t kc = 32; kc < 512; kc += 96) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_twopass_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          for (size_t kc = 32; kc < 512; kc += 96) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .qmin(192)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_twopass_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          for (size_t kc = 32; kc < 512; kc += 96) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .qmax(192)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_twopass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          for (size_t kc = 32; kc < 512; kc += 96) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .xStride(521)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_twopass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t ks = tester.mr() + 1; ks < tester.mr() + tester.qr(); ks++) {
+      for (size_t kc = 32; kc < 512; kc += 96) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_twopass_fulltile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          for (size_t kc = 33; kc < 64; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_twopass_fulltile_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          for (size_t kc = 33; kc < 64; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .qmin(192)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_twopass_fulltile_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          for (size_t kc = 33; kc < 64; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .qmax(192)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_twopass_fulltile_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t kh = 1; kh <= tester.mr() + tester.qr(); kh++) {
+      for (size_t kw = 1; kw <= tester.mr() + tester.qr(); kw++) {
+        if (kh * kw == tester.mr() + tester.qr()) {
+          for (size_t kc = 33; kc < 64; kc++) {
+            tester
+              .kh(kh)
+              .kw(kw)
+              .kc(kc)
+              .xStride(521)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_twopass_subtile) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t ks = tester.mr() + 1; ks < tester.mr() + tester.qr(); ks++) {
+      for (size_t kc = 33; kc < 64; kc++) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_multipass) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .kc(32);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      tester
+        .kh(ks)
+        .kw(1)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+      tester
+        .kh(1)
+        .kw(ks)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_multipass_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .kc(32);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      tester
+        .kh(ks)
+        .kw(1)
+        .qmin(192)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+      tester
+        .kh(1)
+        .kw(ks)
+        .qmin(192)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_eq_32_multipass_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .kc(32);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      tester
+        .kh(ks)
+        .kw(1)
+        .qmax(192)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+      tester
+        .kh(1)
+        .kw(ks)
+        .qmax(192)
+        .test(u8maxpool_ukernel_32x9p8q__avx2);
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_multipass) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      for (size_t kc = 32; kc < 512; kc += 96) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_multipass_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      for (size_t kc = 32; kc < 512; kc += 96) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .qmin(192)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .qmin(192)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_multipass_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      for (size_t kc = 32; kc < 512; kc += 96) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .qmax(192)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .qmax(192)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_div_32_multipass_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      for (size_t kc = 32; kc < 512; kc += 96) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .xStride(521)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .xStride(521)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_multipass) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      for (size_t kc = 33; kc < 64; kc++) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_multipass_with_qmin) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      for (size_t kc = 33; kc < 64; kc++) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .qmin(192)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .qmin(192)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_multipass_with_qmax) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      for (size_t kc = 33; kc < 64; kc++) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .qmax(192)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .qmax(192)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, kc_gt_32_multipass_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    auto tester = MaxPoolMicrokernelTester()
+      .kr(32)
+      .mr(9)
+      .qr(8)
+      .iterations(3);
+    for (size_t ks = tester.mr() + tester.qr() + 1; ks < tester.mr() + 3 * tester.qr(); ks += 3) {
+      for (size_t kc = 33; kc < 64; kc++) {
+        tester
+          .kh(ks)
+          .kw(1)
+          .kc(kc)
+          .xStride(521)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+        tester
+          .kh(1)
+          .kw(ks)
+          .kc(kc)
+          .xStride(521)
+          .test(u8maxpool_ukernel_32x9p8q__avx2);
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, small_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5, 10}}) {
+        for (size_t kc = 32; kc < 101; kc += 10) {
+          MaxPoolMicrokernelTester()
+            .kr(32)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .iterations(3)
+            .test(u8maxpool_ukernel_32x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, small_n_with_x_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5, 10}}) {
+        for (size_t kc = 32; kc < 101; kc += 10) {
+          MaxPoolMicrokernelTester()
+            .kr(32)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .xStride(101)
+            .iterations(1)
+            .test(u8maxpool_ukernel_32x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, small_n_with_y_stride) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5, 10}}) {
+        for (size_t kc = 32; kc < 101; kc += 10) {
+          MaxPoolMicrokernelTester()
+            .kr(32)
+            .mr(9)
+            .qr(8)
+            .n(n)
+            .kh(ks)
+            .kw(ks)
+            .kc(kc)
+            .yStride(103)
+            .iterations(1)
+            .test(u8maxpool_ukernel_32x9p8q__avx2);
+        }
+      }
+    }
+  }
+
+  TEST(U8MAXPOOL_32x9P8Q__AVX2, small_n_with_s) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 2; n < 5; n++) {
+      for (size_t ks : std::vector<size_t>{{2, 3, 5}}) {
+        for (size_t kc = 32; kc < 101; kc += 10) {
+          for (size_t s = 2; s <= ks; s++) {
+            MaxPoolMicrokernelTester()
+              .kr(32)
+              .mr(9)
+              .qr(8)
+              .n(n)
+              .kh(ks)
+              .kw(ks)
+              .kc(kc)
+              .s(s)
+              .iterations(1)
+              .test(u8maxpool_ukernel_32x9p8q__avx2);
+          }
+        }
+      }
+    }
+  }
 #endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
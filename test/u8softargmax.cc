@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <cpuinfo.h>
+
+#include <qnnpack/isa-checks.h>
+#include <qnnpack/u8softargmax.h>
+
+#include "softargmax-microkernel-tester.h"
+
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(U8SOFTARGMAX__NEON, n_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    SoftArgMaxMicrokernelTester()
+      .n(8)
+      .test(u8softargmax_ukernel__neon);
+  }
+
+  TEST(U8SOFTARGMAX__NEON, n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n < 128; n += 8) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .test(u8softargmax_ukernel__neon);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__NEON, n_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 8; n++) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .test(u8softargmax_ukernel__neon);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__NEON, n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 9; n < 16; n++) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .test(u8softargmax_ukernel__neon);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__NEON, large_n) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 128; n <= 1024; n += 127) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .iterations(3)
+        .test(u8softargmax_ukernel__neon);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__NEON, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 80; n += 7) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .test(u8softargmax_ukernel__neon);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__NEON, output_scale) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 80; n += 7) {
+      for (float outputScale = 1.0e-4f; outputScale < 1.0e+0f; outputScale *= 3.14159265f) {
+        SoftArgMaxMicrokernelTester()
+          .n(n)
+          .outputScale(outputScale)
+          .iterations(3)
+          .test(u8softargmax_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(U8SOFTARGMAX__NEON, output_zero_point) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 80; n += 7) {
+      for (int32_t outputZeroPoint = 0; outputZeroPoint <= 255; outputZeroPoint += 51) {
+        SoftArgMaxMicrokernelTester()
+          .n(n)
+          .outputScale(1.0f / 255.0f)
+          .outputZeroPoint(uint8_t(outputZeroPoint))
+          .iterations(3)
+          .test(u8softargmax_ukernel__neon);
+      }
+    }
+  }
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(U8SOFTARGMAX__SSE2, n_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    SoftArgMaxMicrokernelTester()
+      .n(8)
+      .test(u8softargmax_ukernel__sse2);
+  }
+
+  TEST(U8SOFTARGMAX__SSE2, n_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 16; n < 128; n += 8) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .test(u8softargmax_ukernel__sse2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__SSE2, n_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 8; n++) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .test(u8softargmax_ukernel__sse2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__SSE2, n_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 9; n < 16; n++) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .test(u8softargmax_ukernel__sse2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__SSE2, large_n) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 128; n <= 1024; n += 127) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .iterations(3)
+        .test(u8softargmax_ukernel__sse2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__SSE2, inplace) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 80; n += 7) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .test(u8softargmax_ukernel__sse2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__SSE2, output_scale) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 80; n += 7) {
+      for (float outputScale = 1.0e-4f; outputScale < 1.0e+0f; outputScale *= 3.14159265f) {
+        SoftArgMaxMicrokernelTester()
+          .n(n)
+          .outputScale(outputScale)
+          .iterations(3)
+          .test(u8softargmax_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(U8SOFTARGMAX__SSE2, output_zero_point) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 80; n += 7) {
+      for (int32_t outputZeroPoint = 0; outputZeroPoint <= 255; outputZeroPoint += 51) {
+        SoftArgMaxMicrokernelTester()
+          .n(n)
+          .outputScale(1.0f / 255.0f)
+          .outputZeroPoint(uint8_t(outputZeroPoint))
+          .iterations(3)
+          .test(u8softargmax_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(U8SOFTARGMAX__AVX2, n_eq_8) {
+    TEST_REQUIRES_X86_AVX2;
+    SoftArgMaxMicrokernelTester()
+      .n(8)
+      .test(u8softargmax_ukernel__avx2);
+  }
+
+  TEST(U8SOFTARGMAX__AVX2, n_div_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 16; n < 128; n += 8) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .test(u8softargmax_ukernel__avx2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__AVX2, n_lt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 8; n++) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .test(u8softargmax_ukernel__avx2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__AVX2, n_gt_8) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 9; n < 16; n++) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .test(u8softargmax_ukernel__avx2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__AVX2, large_n) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 128; n <= 1024; n += 127) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .iterations(3)
+        .test(u8softargmax_ukernel__avx2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__AVX2, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 80; n += 7) {
+      SoftArgMaxMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .test(u8softargmax_ukernel__avx2);
+    }
+  }
+
+  TEST(U8SOFTARGMAX__AVX2, output_scale) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 80; n += 7) {
+      for (float outputScale = 1.0e-4f; outputScale < 1.0e+0f; outputScale *= 3.14159265f) {
+        SoftArgMaxMicrokernelTester()
+          .n(n)
+          .outputScale(outputScale)
+          .iterations(3)
+          .test(u8softargmax_ukernel__avx2);
+      }
+    }
+  }
+
+  TEST(U8SOFTARGMAX__AVX2, output_zero_point) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 80; n += 7) {
+      for (int32_t outputZeroPoint = 0; outputZeroPoint <= 255; outputZeroPoint += 51) {
+        SoftArgMaxMicrokernelTester()
+          .n(n)
+          .outputScale(1.0f / 255.0f)
+          .outputZeroPoint(uint8_t(outputZeroPoint))
+          .iterations(3)
+          .test(u8softargmax_ukernel__avx2);
+      }
+    }
+  }
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <qnnpack.h>
+
+#include "convolution-operator-tester.h"
+
+
+static std::vector<qnnp_ukernel_info> getUkernels(qnnp_ukernel_class ukernelClass) {
+  size_t count = 0;
+  EXPECT_EQ(qnnp_status_success, qnnp_get_ukernels_count(ukernelClass, &count));
+  std::vector<qnnp_ukernel_info> ukernels(count);
+  for (size_t i = 0; i < count; i++) {
+    EXPECT_EQ(qnnp_status_success, qnnp_get_ukernel_info(ukernelClass, i, &ukernels[i]));
+  }
+  return ukernels;
+}
+
+static std::string getSelectedUkernel(qnnp_ukernel_class ukernelClass) {
+  for (const qnnp_ukernel_info& info : getUkernels(ukernelClass)) {
+    if (info.selected) {
+      return info.name;
+    }
+  }
+  return std::string();
+}
+
+TEST(UKERNEL_REGISTRY, q8conv_ukernels) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const std::vector<qnnp_ukernel_info> ukernels = getUkernels(qnnp_ukernel_class_q8conv);
+  ASSERT_FALSE(ukernels.empty());
+  size_t selectedCount = 0;
+  for (const qnnp_ukernel_info& info : ukernels) {
+    ASSERT_NE(nullptr, info.name);
+    ASSERT_NE(nullptr, info.isa);
+    ASSERT_NE(0, info.mr);
+    ASSERT_NE(0, info.nr);
+    ASSERT_NE(0, info.kr);
+    selectedCount += size_t(info.selected);
+  }
+  ASSERT_EQ(1, selectedCount);
+}
+
+TEST(UKERNEL_REGISTRY, q8dwconv_ukernels) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const std::vector<qnnp_ukernel_info> ukernels = getUkernels(qnnp_ukernel_class_q8dwconv);
+  ASSERT_FALSE(ukernels.empty());
+  size_t selectedCount = 0;
+  for (const qnnp_ukernel_info& info : ukernels) {
+    ASSERT_NE(nullptr, info.name);
+    ASSERT_NE(nullptr, info.isa);
+    ASSERT_NE(0, info.nr);
+    selectedCount += size_t(info.selected);
+  }
+  ASSERT_EQ(1, selectedCount);
+}
+
+TEST(UKERNEL_REGISTRY, select_q8conv) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const std::string defaultUkernel = getSelectedUkernel(qnnp_ukernel_class_q8conv);
+  for (const qnnp_ukernel_info& info : getUkernels(qnnp_ukernel_class_q8conv)) {
+    ASSERT_EQ(qnnp_status_success, qnnp_select_ukernel(qnnp_ukernel_class_q8conv, info.name));
+    ASSERT_EQ(std::string(info.name), getSelectedUkernel(qnnp_ukernel_class_q8conv));
+    ConvolutionOperatorTester()
+      .inputSize(13, 14)
+      .padding(1)
+      .kernelSize(3, 3)
+      .groupInputChannels(15)
+      .groupOutputChannels(17)
+      .iterations(1)
+      .testQ8();
+  }
+  ASSERT_EQ(qnnp_status_success, qnnp_select_ukernel(qnnp_ukernel_class_q8conv, defaultUkernel.c_str()));
+}
+
+TEST(UKERNEL_REGISTRY, select_q8dwconv) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const std::string defaultUkernel = getSelectedUkernel(qnnp_ukernel_class_q8dwconv);
+  for (const qnnp_ukernel_info& info : getUkernels(qnnp_ukernel_class_q8dwconv)) {
+    ASSERT_EQ(qnnp_status_success, qnnp_select_ukernel(qnnp_ukernel_class_q8dwconv, info.name));
+    ASSERT_EQ(std::string(info.name), getSelectedUkernel(qnnp_ukernel_class_q8dwconv));
+    ConvolutionOperatorTester()
+      .inputSize(15, 14)
+      .padding(1)
+      .kernelSize(3, 3)
+      .groups(27)
+      .iterations(1)
+      .testQ8();
+  }
+  ASSERT_EQ(qnnp_status_success, qnnp_select_ukernel(qnnp_ukernel_class_q8dwconv, defaultUkernel.c_str()));
+}
+
+TEST(UKERNEL_REGISTRY, select_invalid) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_select_ukernel(qnnp_ukernel_class_q8conv, "no-such-ukernel"));
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_select_ukernel(qnnp_ukernel_class_q8conv, nullptr));
+  qnnp_ukernel_info info;
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_get_ukernel_info(qnnp_ukernel_class_q8conv, getUkernels(qnnp_ukernel_class_q8conv).size(), &info));
+}
+
+TEST(UKERNEL_REGISTRY, operator_q8conv_gemm) {
+  for (const qnnp_ukernel_info& info : getUkernels(qnnp_ukernel_class_q8conv)) {
+    ConvolutionOperatorTester()
+      .inputSize(27, 29)
+      .kernelSize(1, 1)
+      .groupInputChannels(23)
+      .groupOutputChannels(19)
+      .ukernel(info.name)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(UKERNEL_REGISTRY, operator_q8conv_conv) {
+  for (const qnnp_ukernel_info& info : getUkernels(qnnp_ukernel_class_q8conv)) {
+    ConvolutionOperatorTester()
+      .inputSize(10, 9)
+      .padding(1)
+      .kernelSize(3, 3)
+      .groups(2)
+      .groupInputChannels(5)
+      .groupOutputChannels(11)
+      .ukernel(info.name)
+      .iterations(3)
+      .testQ8();
+  }
+}
+
+TEST(UKERNEL_REGISTRY, operator_q8dwconv) {
+  for (const qnnp_ukernel_info& info : getUkernels(qnnp_ukernel_class_q8dwconv)) {
+    for (uint32_t kernelSize = 3; kernelSize <= 5; kernelSize += 2) {
+      ConvolutionOperatorTester()
+        .inputSize(15, 14)
+        .padding(kernelSize / 2)
+        .kernelSize(kernelSize, kernelSize)
+        .groups(27)
+        .ukernel(info.name)
+        .iterations(3)
+        .testQ8();
+    }
+  }
+}
+
+/* Runs a convolution, switches it to another micro-kernel, and checks that it runs again only after a new setup */
+static void testSwitchAfterSetup(
+    uint32_t kernelSize, uint32_t groups, size_t groupInputChannels, size_t groupOutputChannels, const char* ukernel)
+{
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  const size_t inputSize = 11;
+  const size_t inputChannels = groups * groupInputChannels;
+  const size_t outputChannels = groups * groupOutputChannels;
+  std::vector<uint8_t> input(inputSize * inputSize * inputChannels);
+  std::vector<uint8_t> kernel(groups * groupOutputChannels * kernelSize * kernelSize * groupInputChannels);
+  std::vector<int32_t> bias(outputChannels);
+  for (size_t i = 0; i < input.size(); i++) {
+    input[i] = uint8_t(i * 7);
+  }
+  for (size_t i = 0; i < kernel.size(); i++) {
+    kernel[i] = uint8_t(i * 13);
+  }
+  for (size_t i = 0; i < bias.size(); i++) {
+    bias[i] = int32_t(i * 37) - 1000;
+  }
+
+  qnnp_operator_t convolution = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_convolution2d_nhwc_q8(
+      kernelSize / 2, kernelSize / 2, kernelSize / 2, kernelSize / 2,
+      kernelSize, kernelSize,
+      1, 1,
+      1, 1,
+      groups, groupInputChannels, groupOutputChannels,
+      127, 0.5f,
+      127, 0.5f,
+      kernel.data(), bias.data(),
+      127, 16.0f, 0, 255,
+      0, &convolution));
+
+  std::vector<uint8_t> referenceOutput(inputSize * inputSize * outputChannels, 0xA5);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_convolution2d_nhwc_q8(
+      convolution, 1, inputSize, inputSize, input.data(), inputChannels,
+      referenceOutput.data(), outputChannels, nullptr /* thread pool */));
+  ASSERT_EQ(qnnp_status_success, qnnp_run_operator(convolution, nullptr /* thread pool */));
+
+  ASSERT_EQ(qnnp_status_success, qnnp_set_operator_ukernel(convolution, ukernel));
+  ASSERT_EQ(qnnp_status_invalid_parameter, qnnp_run_operator(convolution, nullptr /* thread pool */));
+
+  std::vector<uint8_t> output(referenceOutput.size(), 0xA5);
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_setup_convolution2d_nhwc_q8(
+      convolution, 1, inputSize, inputSize, input.data(), inputChannels,
+      output.data(), outputChannels, nullptr /* thread pool */));
+  ASSERT_EQ(qnnp_status_success, qnnp_run_operator(convolution, nullptr /* thread pool */));
+  ASSERT_EQ(referenceOutput, output);
+
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(convolution));
+}
+
+TEST(UKERNEL_REGISTRY, operator_q8conv_switch_requires_setup) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  for (const qnnp_ukernel_info& info : getUkernels(qnnp_ukernel_class_q8conv)) {
+    /* Switching to a micro-kernel with a different mr changes the tiling of the indirection buffer */
+    testSwitchAfterSetup(3, 2, 5, 11, info.name);
+  }
+}
+
+TEST(UKERNEL_REGISTRY, operator_q8dwconv_switch_requires_setup) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  for (const qnnp_ukernel_info& info : getUkernels(qnnp_ukernel_class_q8dwconv)) {
+    /* Switching to a micro-kernel with a different nr reallocates the zero buffer which the indirection buffer uses */
+    for (uint32_t kernelSize = 3; kernelSize <= 5; kernelSize += 2) {
+      testSwitchAfterSetup(kernelSize, 27, 1, 1, info.name);
+    }
+  }
+}
+
+TEST(UKERNEL_REGISTRY, operator_invalid) {
+  ASSERT_EQ(qnnp_status_success, qnnp_initialize());
+  ASSERT_EQ(qnnp_status_invalid_parameter,
+    qnnp_set_operator_ukernel(nullptr, "no-such-ukernel"));
+
+  qnnp_operator_t clamp = nullptr;
+  ASSERT_EQ(qnnp_status_success,
+    qnnp_create_clamp_nc_u8(16, 0, 255, 0, &clamp));
+  const std::vector<qnnp_ukernel_info> ukernels = getUkernels(qnnp_ukernel_class_q8conv);
+  ASSERT_EQ(qnnp_status_unsupported_parameter,
+    qnnp_set_operator_ukernel(clamp, ukernels[0].name));
+  ASSERT_EQ(qnnp_status_success, qnnp_delete_operator(clamp));
+}
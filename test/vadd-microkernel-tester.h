@@ -50,6 +50,15 @@ class VAddMicrokernelTester {
     return this->inplaceB_;
   }
 
+  inline VAddMicrokernelTester& broadcastB(bool broadcastB) {
+    this->broadcastB_ = broadcastB;
+    return *this;
+  }
+
+  inline bool broadcastB() const {
+    return this->broadcastB_;
+  }
+
   inline VAddMicrokernelTester& aScale(float aScale) {
     assert(aScale > 0.0f);
     assert(std::isnormal(aScale));
@@ -138,6 +147,8 @@ class VAddMicrokernelTester {
   }
 
   void test(q8vadd_ukernel_function q8vadd) const {
+    ASSERT_FALSE(inplaceB() && broadcastB());
+
     std::random_device randomDevice;
     auto rng = std::mt19937(randomDevice());
     auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
@@ -172,12 +183,13 @@ class VAddMicrokernelTester {
 
       /* Compute reference results */
       for (size_t i = 0; i < n(); i++) {
+        const size_t bIndex = broadcastB() ? 0 : i;
         yFP[i] = float(yZeroPoint()) +
           float(int32_t(aData[i]) - int32_t(aZeroPoint())) * (aScale() / yScale()) +
-          float(int32_t(bData[i]) - int32_t(bZeroPoint())) * (bScale() / yScale());
+          float(int32_t(bData[bIndex]) - int32_t(bZeroPoint())) * (bScale() / yScale());
         yFP[i] = std::min<float>(yFP[i], float(qmax()));
         yFP[i] = std::max<float>(yFP[i], float(qmin()));
-        yRef[i] = qnnp_add_quantize(aData[i], bData[i], scalarQuantizationParams);
+        yRef[i] = qnnp_add_quantize(aData[i], bData[bIndex], scalarQuantizationParams);
       }
 
       /* Call optimized micro-kernel */
@@ -201,6 +213,7 @@ class VAddMicrokernelTester {
   size_t n_{1};
   bool inplaceA_{false};
   bool inplaceB_{false};
+  bool broadcastB_{false};
   float aScale_{0.75f};
   float bScale_{1.25f};
   float yScale_{0.96875f};
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+#include <qnnpack/requantization.h>
+
+
+class VDequantizeMicrokernelTester {
+ public:
+  inline VDequantizeMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline VDequantizeMicrokernelTester& scale(float scale) {
+    assert(scale > 0.0f);
+    assert(std::isnormal(scale));
+    this->scale_ = scale;
+    return *this;
+  }
+
+  inline float scale() const {
+    return this->scale_;
+  }
+
+  inline VDequantizeMicrokernelTester& zeroPoint(uint8_t zeroPoint) {
+    this->zeroPoint_ = zeroPoint;
+    return *this;
+  }
+
+  inline uint8_t zeroPoint() const {
+    return this->zeroPoint_;
+  }
+
+  inline VDequantizeMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test(q8vdequantize_ukernel_function q8vdequantize) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    auto u8rng = std::bind(std::uniform_int_distribution<uint8_t>(), rng);
+
+    std::vector<uint8_t> x(n());
+    std::vector<float> y(n());
+    std::vector<float> yRef(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(u8rng));
+      std::fill(y.begin(), y.end(), std::nanf(""));
+
+      /* Prepare dequantization parameters */
+      const union qnnp_f32_dequantization_params dequantizationParams =
+          qnnp_compute_f32_dequantization_params(zeroPoint(), scale());
+      const union qnnp_f32_dequantization_params scalarDequantizationParams =
+          qnnp_compute_scalar_f32_dequantization_params(zeroPoint(), scale());
+
+      /* Compute reference results */
+      for (size_t i = 0; i < n(); i++) {
+        yRef[i] = qnnp_f32_dequantize(x[i], scalarDequantizationParams);
+      }
+
+      /* Call optimized micro-kernel */
+      q8vdequantize(n(), x.data(), y.data(), &dequantizationParams);
+
+      /* Verify results */
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_EQ(yRef[i], y[i])
+          << "at position " << i << ", n = " << n() << ", x = " << uint32_t(x[i])
+          << ", scale = " << scale() << ", zero point = " << uint32_t(zeroPoint());
+      }
+    }
+  }
+
+ private:
+  size_t n_{1};
+  float scale_{0.75f};
+  uint8_t zeroPoint_{121};
+  size_t iterations_{15};
+};
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include <qnnpack/params.h>
+#include <qnnpack/requantization.h>
+
+
+class VQuantizeMicrokernelTester {
+ public:
+  inline VQuantizeMicrokernelTester& n(size_t n) {
+    assert(n != 0);
+    this->n_ = n;
+    return *this;
+  }
+
+  inline size_t n() const {
+    return this->n_;
+  }
+
+  inline VQuantizeMicrokernelTester& scale(float scale) {
+    assert(scale > 0.0f);
+    assert(std::isnormal(scale));
+    this->scale_ = scale;
+    return *this;
+  }
+
+  inline float scale() const {
+    return this->scale_;
+  }
+
+  inline VQuantizeMicrokernelTester& zeroPoint(uint8_t zeroPoint) {
+    this->zeroPoint_ = zeroPoint;
+    return *this;
+  }
+
+  inline uint8_t zeroPoint() const {
+    return this->zeroPoint_;
+  }
+
+  inline VQuantizeMicrokernelTester& qmin(uint8_t qmin) {
+    this->qmin_ = qmin;
+    return *this;
+  }
+
+  inline uint8_t qmin() const {
+    return this->qmin_;
+  }
+
+  inline VQuantizeMicrokernelTester& qmax(uint8_t qmax) {
+    this->qmax_ = qmax;
+    return *this;
+  }
+
+  inline uint8_t qmax() const {
+    return this->qmax_;
+  }
+
+  inline VQuantizeMicrokernelTester& iterations(size_t iterations) {
+    this->iterations_ = iterations;
+    return *this;
+  }
+
+  inline size_t iterations() const {
+    return this->iterations_;
+  }
+
+  void test(q8vquantize_ukernel_function q8vquantize) const {
+    std::random_device randomDevice;
+    auto rng = std::mt19937(randomDevice());
+    /* Inputs cover the whole quantized range, with a margin on both sides to exercise clamping */
+    const float rangeMin = (-32.0f - float(int32_t(zeroPoint()))) * scale();
+    const float rangeMax = (287.0f - float(int32_t(zeroPoint()))) * scale();
+    auto f32rng = std::bind(std::uniform_real_distribution<float>(rangeMin, rangeMax), rng);
+
+    std::vector<float> x(n());
+    std::vector<uint8_t> y(n());
+    std::vector<uint8_t> yRef(n());
+    for (size_t iteration = 0; iteration < iterations(); iteration++) {
+      std::generate(x.begin(), x.end(), std::ref(f32rng));
+      std::fill(y.begin(), y.end(), 0xA5);
+
+      /* Prepare quantization parameters */
+      const union qnnp_f32_quantization_params quantizationParams =
+          qnnp_compute_f32_quantization_params(zeroPoint(), scale(), qmin(), qmax());
+      const union qnnp_f32_quantization_params scalarQuantizationParams =
+          qnnp_compute_scalar_f32_quantization_params(zeroPoint(), scale(), qmin(), qmax());
+
+      /* Compute reference results */
+      for (size_t i = 0; i < n(); i++) {
+        yRef[i] = qnnp_f32_quantize(x[i], scalarQuantizationParams);
+      }
+
+      /* Call optimized micro-kernel */
+      q8vquantize(n(), x.data(), y.data(), &quantizationParams);
+
+      /* Verify results */
+      for (size_t i = 0; i < n(); i++) {
+        ASSERT_LE(uint32_t(y[i]), uint32_t(qmax()))
+          << "at position " << i << ", n = " << n();
+        ASSERT_GE(uint32_t(y[i]), uint32_t(qmin()))
+          << "at position " << i << ", n = " << n();
+        ASSERT_EQ(uint32_t(yRef[i]), uint32_t(y[i]))
+          << "at position " << i << ", n = " << n() << ", x = " << x[i]
+          << ", scale = " << scale() << ", zero point = " << uint32_t(zeroPoint());
+      }
+    }
+  }
+
+ private:
+  size_t n_{1};
+  float scale_{0.75f};
+  uint8_t zeroPoint_{121};
+  uint8_t qmin_{0};
+  uint8_t qmax_{255};
+  size_t iterations_{15};
+};
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <cpuinfo.h>
+
+#include <qnnpack/isa-checks.h>
+#include <qnnpack/xtranspose.h>
+
+#include "transpose-microkernel-tester.h"
+
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(X32TRANSPOSE__NEON, m_eq_4_n_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    TransposeMicrokernelTester()
+      .m(4)
+      .n(4)
+      .testX32(x32transpose_ukernel__neon);
+  }
+
+  TEST(X32TRANSPOSE__NEON, m_eq_4_n_div_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 8; n <= 32; n += 4) {
+      TransposeMicrokernelTester()
+        .m(4)
+        .n(n)
+        .testX32(x32transpose_ukernel__neon);
+    }
+  }
+
+  TEST(X32TRANSPOSE__NEON, m_div_4_n_eq_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 8; m <= 32; m += 4) {
+      TransposeMicrokernelTester()
+        .m(m)
+        .n(4)
+        .testX32(x32transpose_ukernel__neon);
+    }
+  }
+
+  TEST(X32TRANSPOSE__NEON, m_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 1; m < 4; m++) {
+      for (size_t n = 1; n <= 12; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX32(x32transpose_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(X32TRANSPOSE__NEON, n_lt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 4; n++) {
+      for (size_t m = 1; m <= 12; m++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX32(x32transpose_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(X32TRANSPOSE__NEON, m_gt_4_n_gt_4) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 5; m < 8; m++) {
+      for (size_t n = 5; n < 8; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX32(x32transpose_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(X32TRANSPOSE__NEON, strided_x) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 1; m <= 12; m++) {
+      for (size_t n = 1; n <= 12; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .xStride(17)
+          .testX32(x32transpose_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(X32TRANSPOSE__NEON, strided_y) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 1; m <= 12; m++) {
+      for (size_t n = 1; n <= 12; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .yStride(19)
+          .testX32(x32transpose_ukernel__neon);
+      }
+    }
+  }
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(X32TRANSPOSE__SSE2, m_eq_4_n_eq_4) {
+    TEST_REQUIRES_X86_SSE2;
+    TransposeMicrokernelTester()
+      .m(4)
+      .n(4)
+      .testX32(x32transpose_ukernel__sse2);
+  }
+
+  TEST(X32TRANSPOSE__SSE2, m_eq_4_n_div_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 8; n <= 32; n += 4) {
+      TransposeMicrokernelTester()
+        .m(4)
+        .n(n)
+        .testX32(x32transpose_ukernel__sse2);
+    }
+  }
+
+  TEST(X32TRANSPOSE__SSE2, m_div_4_n_eq_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 8; m <= 32; m += 4) {
+      TransposeMicrokernelTester()
+        .m(m)
+        .n(4)
+        .testX32(x32transpose_ukernel__sse2);
+    }
+  }
+
+  TEST(X32TRANSPOSE__SSE2, m_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 1; m < 4; m++) {
+      for (size_t n = 1; n <= 12; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX32(x32transpose_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(X32TRANSPOSE__SSE2, n_lt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 4; n++) {
+      for (size_t m = 1; m <= 12; m++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX32(x32transpose_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(X32TRANSPOSE__SSE2, m_gt_4_n_gt_4) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 5; m < 8; m++) {
+      for (size_t n = 5; n < 8; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX32(x32transpose_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(X32TRANSPOSE__SSE2, strided_x) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 1; m <= 12; m++) {
+      for (size_t n = 1; n <= 12; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .xStride(17)
+          .testX32(x32transpose_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(X32TRANSPOSE__SSE2, strided_y) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 1; m <= 12; m++) {
+      for (size_t n = 1; n <= 12; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .yStride(19)
+          .testX32(x32transpose_ukernel__sse2);
+      }
+    }
+  }
+#endif
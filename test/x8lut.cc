@@ -7,12 +7,151 @@
  */
 
 #include <gtest/gtest.h>
+#include <cpuinfo.h>
 
+#include <qnnpack/isa-checks.h>
 #include <qnnpack/x8lut.h>
 
 #include "lut-microkernel-tester.h"
 
 
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(X8LUT__NEON, n_eq_16) {
+    TEST_REQUIRES_ARM_NEON;
+    LUTMicrokernelTester()
+      .n(16)
+      .test(x8lut_ukernel__neon);
+  }
+
+  TEST(X8LUT__NEON, n_div_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 32; n < 256; n += 16) {
+      LUTMicrokernelTester()
+        .n(n)
+        .test(x8lut_ukernel__neon);
+    }
+  }
+
+  TEST(X8LUT__NEON, n_lt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 16; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .test(x8lut_ukernel__neon);
+    }
+  }
+
+  TEST(X8LUT__NEON, n_gt_16) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 17; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .test(x8lut_ukernel__neon);
+    }
+  }
+
+  TEST(X8LUT__NEON, inplace) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 80; n += 8) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .test(x8lut_ukernel__neon);
+    }
+  }
+#endif /* CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64 */
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(X8LUT__SSSE3, n_eq_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    LUTMicrokernelTester()
+      .n(16)
+      .test(x8lut_ukernel__ssse3);
+  }
+
+  TEST(X8LUT__SSSE3, n_div_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 32; n < 256; n += 16) {
+      LUTMicrokernelTester()
+        .n(n)
+        .test(x8lut_ukernel__ssse3);
+    }
+  }
+
+  TEST(X8LUT__SSSE3, n_lt_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 1; n < 16; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .test(x8lut_ukernel__ssse3);
+    }
+  }
+
+  TEST(X8LUT__SSSE3, n_gt_16) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 17; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .test(x8lut_ukernel__ssse3);
+    }
+  }
+
+  TEST(X8LUT__SSSE3, inplace) {
+    TEST_REQUIRES_X86_SSSE3;
+    for (size_t n = 1; n < 80; n += 8) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .test(x8lut_ukernel__ssse3);
+    }
+  }
+
+  TEST(X8LUT__AVX2, n_eq_32) {
+    TEST_REQUIRES_X86_AVX2;
+    LUTMicrokernelTester()
+      .n(32)
+      .test(x8lut_ukernel__avx2);
+  }
+
+  TEST(X8LUT__AVX2, n_div_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 64; n < 512; n += 32) {
+      LUTMicrokernelTester()
+        .n(n)
+        .test(x8lut_ukernel__avx2);
+    }
+  }
+
+  TEST(X8LUT__AVX2, n_lt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 32; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .test(x8lut_ukernel__avx2);
+    }
+  }
+
+  TEST(X8LUT__AVX2, n_gt_32) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 33; n < 64; n++) {
+      LUTMicrokernelTester()
+        .n(n)
+        .test(x8lut_ukernel__avx2);
+    }
+  }
+
+  TEST(X8LUT__AVX2, inplace) {
+    TEST_REQUIRES_X86_AVX2;
+    for (size_t n = 1; n < 160; n += 14) {
+      LUTMicrokernelTester()
+        .n(n)
+        .inplace(true)
+        .test(x8lut_ukernel__avx2);
+    }
+  }
+#endif /* CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64 */
+
+
 TEST(X8LUT__SCALAR, n_eq_1) {
   LUTMicrokernelTester()
     .n(1)
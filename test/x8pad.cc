@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <cpuinfo.h>
+
+#include <qnnpack/isa-checks.h>
+#include <qnnpack/x8pad.h>
+
+#include "pad-microkernel-tester.h"
+
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(X8PAD__NEON, copy_only) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n <= 48; n++) {
+      PadMicrokernelTester()
+        .n(n)
+        .test(x8pad_ukernel__neon);
+    }
+  }
+
+  TEST(X8PAD__NEON, fill_only) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t l = 1; l <= 48; l++) {
+      PadMicrokernelTester()
+        .n(0)
+        .l(l)
+        .test(x8pad_ukernel__neon);
+    }
+  }
+
+  TEST(X8PAD__NEON, left_padding) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t l = 1; l <= 35; l++) {
+      PadMicrokernelTester()
+        .n(13)
+        .l(l)
+        .test(x8pad_ukernel__neon);
+    }
+  }
+
+  TEST(X8PAD__NEON, right_padding) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t r = 1; r <= 35; r++) {
+      PadMicrokernelTester()
+        .n(13)
+        .r(r)
+        .test(x8pad_ukernel__neon);
+    }
+  }
+
+  TEST(X8PAD__NEON, both_paddings) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t l = 1; l <= 19; l += 3) {
+      for (size_t r = 1; r <= 19; r += 3) {
+        PadMicrokernelTester()
+          .n(7)
+          .l(l)
+          .r(r)
+          .test(x8pad_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(X8PAD__NEON, multiple_rows) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 2; m <= 5; m++) {
+      PadMicrokernelTester()
+        .m(m)
+        .n(17)
+        .l(5)
+        .r(11)
+        .test(x8pad_ukernel__neon);
+    }
+  }
+
+  TEST(X8PAD__NEON, multiple_rows_with_strides) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 2; m <= 5; m++) {
+      PadMicrokernelTester()
+        .m(m)
+        .n(17)
+        .l(5)
+        .r(11)
+        .xStride(23)
+        .yStride(41)
+        .test(x8pad_ukernel__neon);
+    }
+  }
+
+  TEST(X8PAD__NEON, multiple_fill_only_rows) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 2; m <= 5; m++) {
+      PadMicrokernelTester()
+        .m(m)
+        .n(0)
+        .l(29)
+        .yStride(37)
+        .test(x8pad_ukernel__neon);
+    }
+  }
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(X8PAD__SSE2, copy_only) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n <= 48; n++) {
+      PadMicrokernelTester()
+        .n(n)
+        .test(x8pad_ukernel__sse2);
+    }
+  }
+
+  TEST(X8PAD__SSE2, fill_only) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t l = 1; l <= 48; l++) {
+      PadMicrokernelTester()
+        .n(0)
+        .l(l)
+        .test(x8pad_ukernel__sse2);
+    }
+  }
+
+  TEST(X8PAD__SSE2, left_padding) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t l = 1; l <= 35; l++) {
+      PadMicrokernelTester()
+        .n(13)
+        .l(l)
+        .test(x8pad_ukernel__sse2);
+    }
+  }
+
+  TEST(X8PAD__SSE2, right_padding) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t r = 1; r <= 35; r++) {
+      PadMicrokernelTester()
+        .n(13)
+        .r(r)
+        .test(x8pad_ukernel__sse2);
+    }
+  }
+
+  TEST(X8PAD__SSE2, both_paddings) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t l = 1; l <= 19; l += 3) {
+      for (size_t r = 1; r <= 19; r += 3) {
+        PadMicrokernelTester()
+          .n(7)
+          .l(l)
+          .r(r)
+          .test(x8pad_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(X8PAD__SSE2, multiple_rows) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 2; m <= 5; m++) {
+      PadMicrokernelTester()
+        .m(m)
+        .n(17)
+        .l(5)
+        .r(11)
+        .test(x8pad_ukernel__sse2);
+    }
+  }
+
+  TEST(X8PAD__SSE2, multiple_rows_with_strides) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 2; m <= 5; m++) {
+      PadMicrokernelTester()
+        .m(m)
+        .n(17)
+        .l(5)
+        .r(11)
+        .xStride(23)
+        .yStride(41)
+        .test(x8pad_ukernel__sse2);
+    }
+  }
+
+  TEST(X8PAD__SSE2, multiple_fill_only_rows) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 2; m <= 5; m++) {
+      PadMicrokernelTester()
+        .m(m)
+        .n(0)
+        .l(29)
+        .yStride(37)
+        .test(x8pad_ukernel__sse2);
+    }
+  }
+#endif
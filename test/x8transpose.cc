@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ * All rights reserved.
+ *
+ * This source code is licensed under the BSD-style license found in the
+ * LICENSE file in the root directory of this source tree.
+ */
+
+#include <gtest/gtest.h>
+#include <cpuinfo.h>
+
+#include <qnnpack/isa-checks.h>
+#include <qnnpack/xtranspose.h>
+
+#include "transpose-microkernel-tester.h"
+
+
+#if CPUINFO_ARCH_ARM || CPUINFO_ARCH_ARM64
+  TEST(X8TRANSPOSE__NEON, m_eq_8_n_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    TransposeMicrokernelTester()
+      .m(8)
+      .n(8)
+      .testX8(x8transpose_ukernel__neon);
+  }
+
+  TEST(X8TRANSPOSE__NEON, m_eq_8_n_div_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 16; n <= 64; n += 8) {
+      TransposeMicrokernelTester()
+        .m(8)
+        .n(n)
+        .testX8(x8transpose_ukernel__neon);
+    }
+  }
+
+  TEST(X8TRANSPOSE__NEON, m_div_8_n_eq_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 16; m <= 64; m += 8) {
+      TransposeMicrokernelTester()
+        .m(m)
+        .n(8)
+        .testX8(x8transpose_ukernel__neon);
+    }
+  }
+
+  TEST(X8TRANSPOSE__NEON, m_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 1; m < 8; m++) {
+      for (size_t n = 1; n <= 24; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX8(x8transpose_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE__NEON, n_lt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 1; m <= 24; m++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX8(x8transpose_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE__NEON, m_gt_8_n_gt_8) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 9; m < 16; m++) {
+      for (size_t n = 9; n < 16; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX8(x8transpose_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE__NEON, strided_x) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 1; m <= 24; m++) {
+      for (size_t n = 1; n <= 24; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .xStride(29)
+          .testX8(x8transpose_ukernel__neon);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE__NEON, strided_y) {
+    TEST_REQUIRES_ARM_NEON;
+    for (size_t m = 1; m <= 24; m++) {
+      for (size_t n = 1; n <= 24; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .yStride(31)
+          .testX8(x8transpose_ukernel__neon);
+      }
+    }
+  }
+#endif
+
+#if CPUINFO_ARCH_X86 || CPUINFO_ARCH_X86_64
+  TEST(X8TRANSPOSE__SSE2, m_eq_8_n_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    TransposeMicrokernelTester()
+      .m(8)
+      .n(8)
+      .testX8(x8transpose_ukernel__sse2);
+  }
+
+  TEST(X8TRANSPOSE__SSE2, m_eq_8_n_div_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 16; n <= 64; n += 8) {
+      TransposeMicrokernelTester()
+        .m(8)
+        .n(n)
+        .testX8(x8transpose_ukernel__sse2);
+    }
+  }
+
+  TEST(X8TRANSPOSE__SSE2, m_div_8_n_eq_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 16; m <= 64; m += 8) {
+      TransposeMicrokernelTester()
+        .m(m)
+        .n(8)
+        .testX8(x8transpose_ukernel__sse2);
+    }
+  }
+
+  TEST(X8TRANSPOSE__SSE2, m_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 1; m < 8; m++) {
+      for (size_t n = 1; n <= 24; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX8(x8transpose_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE__SSE2, n_lt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t n = 1; n < 8; n++) {
+      for (size_t m = 1; m <= 24; m++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX8(x8transpose_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE__SSE2, m_gt_8_n_gt_8) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 9; m < 16; m++) {
+      for (size_t n = 9; n < 16; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .testX8(x8transpose_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE__SSE2, strided_x) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 1; m <= 24; m++) {
+      for (size_t n = 1; n <= 24; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .xStride(29)
+          .testX8(x8transpose_ukernel__sse2);
+      }
+    }
+  }
+
+  TEST(X8TRANSPOSE__SSE2, strided_y) {
+    TEST_REQUIRES_X86_SSE2;
+    for (size_t m = 1; m <= 24; m++) {
+      for (size_t n = 1; n <= 24; n++) {
+        TransposeMicrokernelTester()
+          .m(m)
+          .n(n)
+          .yStride(31)
+          .testX8(x8transpose_ukernel__sse2);
+      }
+    }
+  }
+#endif